@@ -0,0 +1,202 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file has the FilePrefetcher data structure - it reads the next files of a list into the
+ * memory on a background thread, while the current file is worked on.
+ * When the files are on a slow (network) volume, the work on a file hides the latency of
+ * reading the next ones, and taking a file waits only if it was not read yet.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <pthread.h>
+#include "../new-data-types/boolean.h"
+#include "../util/memoryUtil.h"
+#include "../util/timeUtil.h"
+#include "../util/traceUtil.h"
+#include "readFromFile.h"
+#include "FilePrefetcher.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE FILES_MEMORY /* For the memory statistics. */
+#define FIRST_FILE 0
+#define MIN_AHEAD_AMOUNT 1
+/* ------------ */
+
+struct FilePrefetcher
+{
+    char **fileNames; /* The names of the files. */
+    const char *fileType; /* The type of the files. */
+    int filesAmount;
+    int aheadAmount; /* The most files that are read and not taken yet. */
+    char **contents; /* The contents of the read files that were not taken yet. */
+    int readAmount; /* The amount of files that were read. */
+    int takenAmount; /* The amount of files that were taken. */
+    boolean isStopped; /* TRUE to stop the background thread. */
+    boolean isThreadStarted;
+    pthread_mutex_t lock; /* Guards readAmount, takenAmount, contents and isStopped. */
+    pthread_cond_t changed; /* Signaled when a file is read or taken, or on stop. */
+    pthread_t thread;
+};
+
+/* ---------------Prototypes--------------- */
+void *prefetchFiles(void *prefetcher);
+/* ---------------------------------------- */
+
+/*
+ * Starts reading the files of a list ahead, in their order, on a background thread.
+ * The thread reads at most aheadAmount files that were not taken yet.
+ *
+ * @param   *fileNames[]    The names of the files (kept until the prefetcher is deleted).
+ * @param   filesAmount     The amount of the files.
+ * @param   *fileType       The type of the files.
+ * @param   aheadAmount     The most files to read ahead of the taken ones (at least 1).
+ *
+ * @return  Pointer to the started prefetcher.
+ */
+FilePrefetcher *startFilePrefetcher(char *fileNames[], int filesAmount, const char *fileType,
+                                    int aheadAmount)
+{
+    FilePrefetcher *prefetcher = (FilePrefetcher *) allocate_space(sizeof(FilePrefetcher));
+    int i; /* Loop variable. */
+
+    prefetcher -> fileNames = fileNames;
+    prefetcher -> fileType = fileType;
+    prefetcher -> filesAmount = filesAmount;
+    prefetcher -> aheadAmount = (aheadAmount < MIN_AHEAD_AMOUNT)? MIN_AHEAD_AMOUNT : aheadAmount;
+    prefetcher -> contents = (char **) allocate_space(filesAmount * sizeof(char *));
+    for (i = FIRST_FILE; i < filesAmount; i++)
+        prefetcher -> contents[i] = NULL;
+    prefetcher -> readAmount = prefetcher -> takenAmount = FIRST_FILE;
+    prefetcher -> isStopped = FALSE;
+
+    (void) pthread_mutex_init(&prefetcher -> lock, NULL);
+    (void) pthread_cond_init(&prefetcher -> changed, NULL);
+    prefetcher -> isThreadStarted =
+            (pthread_create(&prefetcher -> thread, NULL, prefetchFiles, prefetcher) == 0)?
+            TRUE : FALSE;
+
+    return prefetcher;
+}
+
+/*
+ * Takes the contents of the next file of the list, waits until the file is read.
+ * The files should be taken in their order.
+ * Reads the file on the calling thread if the background thread could not be started.
+ *
+ * @param   *prefetcher     The prefetcher.
+ * @param   *waitSeconds    Will hold the time that was spent waiting for the file.
+ *
+ * @return  The contents of the file (needs to be freed), NULL if the file was not opened.
+ */
+char *takePrefetchedFile(FilePrefetcher *prefetcher, double *waitSeconds)
+{
+    int fileIndex = prefetcher -> takenAmount; /* Only this thread changes it. */
+    char *contents = NULL; /* Value to return. */
+
+    *waitSeconds = getMonotonicSeconds();
+
+    if (fileIndex >= prefetcher -> filesAmount) /* There are no more files. */
+        contents = NULL;
+
+    else if (prefetcher -> isThreadStarted == FALSE)
+    {
+        contents = readWholeFile(prefetcher -> fileNames[fileIndex], prefetcher -> fileType);
+        prefetcher -> takenAmount++;
+    }
+
+    else
+    {
+        (void) pthread_mutex_lock(&prefetcher -> lock);
+        while (prefetcher -> readAmount <= fileIndex)
+            (void) pthread_cond_wait(&prefetcher -> changed, &prefetcher -> lock);
+
+        contents = prefetcher -> contents[fileIndex];
+        prefetcher -> contents[fileIndex] = NULL;
+        prefetcher -> takenAmount++;
+        (void) pthread_cond_signal(&prefetcher -> changed); /* The thread can read one more. */
+        (void) pthread_mutex_unlock(&prefetcher -> lock);
+    }
+
+    *waitSeconds = getMonotonicSeconds() - *waitSeconds;
+
+    return contents;
+}
+
+/*
+ * Stops the background thread and deletes the prefetcher, with the files that were not taken.
+ *
+ * @param   **pPrefetcher   Pointer to the prefetcher to delete.
+ */
+void deleteFilePrefetcher(FilePrefetcher **pPrefetcher)
+{
+    FilePrefetcher *prefetcher;
+    int i; /* Loop variable. */
+
+    if (pPrefetcher != NULL && *pPrefetcher != NULL) /* Check if it is already deleted. */
+    {
+        prefetcher = *pPrefetcher;
+
+        if (prefetcher -> isThreadStarted == TRUE)
+        {
+            (void) pthread_mutex_lock(&prefetcher -> lock);
+            prefetcher -> isStopped = TRUE;
+            (void) pthread_cond_signal(&prefetcher -> changed);
+            (void) pthread_mutex_unlock(&prefetcher -> lock);
+
+            (void) pthread_join(prefetcher -> thread, NULL);
+        }
+
+        for (i = FIRST_FILE; i < prefetcher -> filesAmount; i++)
+            (void) free_ptr(prefetcher -> contents[i]);
+
+        (void) pthread_cond_destroy(&prefetcher -> changed);
+        (void) pthread_mutex_destroy(&prefetcher -> lock);
+        (void) clear_ptr(prefetcher -> contents)
+        (void) clear_ptr(*pPrefetcher)
+    }
+}
+
+/*
+ * The background thread, reads the files in their order, and waits while it is too far ahead.
+ *
+ * @param   *prefetcher     The prefetcher.
+ *
+ * @return  NULL.
+ */
+void *prefetchFiles(void *prefetcher)
+{
+    FilePrefetcher *filePrefetcher = (FilePrefetcher *) prefetcher;
+    int fileIndex; /* The next file to read. */
+    boolean isStopped = FALSE;
+    char *contents;
+
+    for (fileIndex = FIRST_FILE; isStopped == FALSE && fileIndex < filePrefetcher -> filesAmount;
+         fileIndex++)
+    {
+        /* Wait until there is room for one more file. */
+        (void) pthread_mutex_lock(&filePrefetcher -> lock);
+        while (filePrefetcher -> isStopped == FALSE &&
+               fileIndex - filePrefetcher -> takenAmount >= filePrefetcher -> aheadAmount)
+            (void) pthread_cond_wait(&filePrefetcher -> changed, &filePrefetcher -> lock);
+        isStopped = filePrefetcher -> isStopped;
+        (void) pthread_mutex_unlock(&filePrefetcher -> lock);
+
+        if (isStopped == FALSE) /* Read the file without holding the lock. */
+        {
+            contents = readWholeFile(filePrefetcher -> fileNames[fileIndex],
+                                     filePrefetcher -> fileType);
+
+            (void) pthread_mutex_lock(&filePrefetcher -> lock);
+            filePrefetcher -> contents[fileIndex] = contents;
+            filePrefetcher -> readAmount++;
+            (void) pthread_cond_signal(&filePrefetcher -> changed);
+            (void) pthread_mutex_unlock(&filePrefetcher -> lock);
+        }
+    }
+
+    endTraceThread();
+    return NULL;
+}
@@ -0,0 +1,51 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the FilePrefetcher.c file.
+ */
+
+#ifndef MMN_14_FILEPREFETCHER_H
+#define MMN_14_FILEPREFETCHER_H
+
+/* FilePrefetcher data type - reads the next files of a list on a background thread. */
+typedef struct FilePrefetcher FilePrefetcher;
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Starts reading the files of a list ahead, in their order, on a background thread.
+ * The thread reads at most aheadAmount files that were not taken yet.
+ *
+ * @param   *fileNames[]    The names of the files (kept until the prefetcher is deleted).
+ * @param   filesAmount     The amount of the files.
+ * @param   *fileType       The type of the files.
+ * @param   aheadAmount     The most files to read ahead of the taken ones (at least 1).
+ *
+ * @return  Pointer to the started prefetcher.
+ */
+FilePrefetcher *startFilePrefetcher(char *fileNames[], int filesAmount, const char *fileType,
+                                    int aheadAmount);
+
+/*
+ * Takes the contents of the next file of the list, waits until the file is read.
+ * The files should be taken in their order.
+ * Reads the file on the calling thread if the background thread could not be started.
+ *
+ * @param   *prefetcher     The prefetcher.
+ * @param   *waitSeconds    Will hold the time that was spent waiting for the file.
+ *
+ * @return  The contents of the file (needs to be freed), NULL if the file was not opened.
+ */
+char *takePrefetchedFile(FilePrefetcher *prefetcher, double *waitSeconds);
+
+/*
+ * Stops the background thread and deletes the prefetcher, with the files that were not taken.
+ *
+ * @param   **pPrefetcher   Pointer to the prefetcher to delete.
+ */
+void deleteFilePrefetcher(FilePrefetcher **pPrefetcher);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_FILEPREFETCHER_H */
@@ -0,0 +1,410 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file has the output archive - one file that holds all the output files of a batch of
+ * source files (instead of a few small files for every source file), and its reader.
+ *
+ * The archive is a heading line, then the contents of the files one after the other (the files
+ * of a source file are together), then the table of contents:
+ *
+ *      {amount of entries}
+ *      {module} [tab] {file ending} [tab] {offset} [tab] {length}     (for every entry)
+ *      TOC {offset of the table, 20 digits}
+ *
+ * The last line has a fixed length, so a reader finds the table with one seek from the end,
+ * and then reads the contents of any module with one more seek.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../new-data-types/boolean.h"
+#include "../errors/error_types/error_types.h"
+#include "../general-enums/neededKeys.h"
+#include "../general-enums/programFinals.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "fileHelpMethods.h"
+#include "OutputArchive.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE FILES_MEMORY /* For the memory statistics. */
+#define WRITE_MODE "wb"
+#define READ_MODE "rb"
+#define ARCHIVE_HEADING "MMN14 ARCHIVE 1\n"
+#define TRAILER_FORMAT "TOC %020ld\n"
+#define TRAILER_PREFIX "TOC "
+#define TRAILER_LEN 25 /* The prefix, the offset and a new line char. */
+#define ENTRY_FORMAT "%s\t%s\t%ld\t%ld\n"
+#define FIRST_ENTRIES_CAPACITY 16
+#define DECIMAL_BASE 10
+/* ------------ */
+
+struct ArchiveReader
+{
+    FILE *archiveFile;
+    char *tocText; /* The table of contents, holds the strings of the entries. */
+    archive_entry_t *entries; /* Sorted by their modules, then by their offsets. */
+    int entriesAmount;
+};
+
+/* ---------------Prototypes--------------- */
+Error readArchiveToc(ArchiveReader *reader);
+char *readArchiveTocEntry(char *line, archive_entry_t *entry);
+int compareArchiveEntries(const void *entry1, const void *entry2);
+/* ---------------------------------------- */
+
+/* The output archive that is open for writing (the files are written to it). */
+static FILE *outputArchive = NULL;
+static long archiveLength; /* The length of the archive so far. */
+static archive_entry_t *archiveEntries = NULL; /* The entries written so far. */
+static int archiveEntriesAmount, archiveEntriesCapacity;
+
+/*
+ * Opens an output archive for writing. While it is open, writeToFile appends the files to it
+ * instead of writing them.
+ *
+ * @param   *archive_name   The name of the archive (without its ending).
+ *
+ * @return  TRUE if the archive was opened, otherwise FALSE.
+ */
+boolean openOutputArchive(const char *archive_name)
+{
+    if ((outputArchive = openFile(archive_name, ARCHIVE_END, WRITE_MODE)) == NULL)
+        return FALSE;
+
+    fputs(ARCHIVE_HEADING, outputArchive);
+    archiveLength = (long) strlen(ARCHIVE_HEADING);
+    archiveEntriesAmount = ZERO_COUNT;
+    archiveEntriesCapacity = FIRST_ENTRIES_CAPACITY;
+    archiveEntries = (archive_entry_t *) allocate_space(archiveEntriesCapacity *
+                                                        sizeof(archive_entry_t));
+
+    return TRUE;
+}
+
+/*
+ * Checks if an output archive is open for writing.
+ *
+ * @return  TRUE if an output archive is open, otherwise FALSE.
+ */
+boolean isOutputArchiveOpen(void)
+{
+    return (outputArchive != NULL)? TRUE : FALSE;
+}
+
+/*
+ * Appends a file to the open output archive.
+ * The files are appended by one thread at a time.
+ *
+ * @param   *module     The name of the file without its ending.
+ * @param   *fileType   The ending of the file.
+ * @param   *text       The contents of the file.
+ */
+void addToOutputArchive(const char *module, const char *fileType, const char *text)
+{
+    archive_entry_t *entry;
+    size_t length = strlen(text);
+
+    if (archiveEntriesAmount == archiveEntriesCapacity)
+    {
+        archiveEntriesCapacity *= 2;
+        archiveEntries = (archive_entry_t *) reallocate_space(archiveEntries,
+                                                              archiveEntriesCapacity *
+                                                              sizeof(archive_entry_t));
+    }
+
+    entry = &archiveEntries[archiveEntriesAmount++];
+    entry -> module = my_strdup(module);
+    entry -> fileType = my_strdup(fileType);
+    entry -> offset = archiveLength;
+    entry -> length = (long) length;
+
+    (void) fwrite(text, sizeof(char), length, outputArchive);
+    archiveLength += (long) length;
+}
+
+/*
+ * Writes the table of contents of the open output archive and closes it.
+ */
+void closeOutputArchive(void)
+{
+    int i; /* Loop variable. */
+
+    if (outputArchive != NULL)
+    {
+        fprintf(outputArchive, "%d\n", archiveEntriesAmount);
+        for (i = 0; i < archiveEntriesAmount; i++)
+        {
+            fprintf(outputArchive, ENTRY_FORMAT, archiveEntries[i].module,
+                    archiveEntries[i].fileType, archiveEntries[i].offset,
+                    archiveEntries[i].length);
+            (void) clear_ptr(archiveEntries[i].module)
+            (void) clear_ptr(archiveEntries[i].fileType)
+        }
+        fprintf(outputArchive, TRAILER_FORMAT, archiveLength); /* The table starts at the end. */
+
+        closeFile(&outputArchive);
+        (void) clear_ptr(archiveEntries)
+    }
+}
+
+/*
+ * Opens an output archive for reading, and reads its table of contents.
+ *
+ * @param   *archive_name   The name of the archive (without its ending).
+ * @param   *archiveError   Will hold the error of opening the archive, or NO_ERROR.
+ *
+ * @return  Pointer to the archive reader, or NULL if there was an error.
+ */
+ArchiveReader *openArchive(const char *archive_name, Error *archiveError)
+{
+    ArchiveReader *reader = NULL; /* Value to return. */
+    char *fileToOpen = connectTwoStrings(archive_name, ARCHIVE_END); /* Full file name */
+    FILE *archiveFile = fopen(fileToOpen, READ_MODE);
+
+    *archiveError = ARCHIVE_NOT_FOUND_ERR;
+    if (archiveFile != NULL)
+    {
+        reader = (ArchiveReader *) allocate_space(sizeof(ArchiveReader));
+        reader -> archiveFile = archiveFile;
+        reader -> tocText = NULL;
+        reader -> entries = NULL;
+        reader -> entriesAmount = ZERO_COUNT;
+
+        if ((*archiveError = readArchiveToc(reader)) != NO_ERROR)
+            closeArchive(&reader);
+    }
+
+    (void) clear_ptr(fileToOpen)
+    return reader;
+}
+
+/*
+ * Gets the amount of the entries of an archive.
+ *
+ * @param   *reader     The archive reader.
+ *
+ * @return  The amount of the entries.
+ */
+int getArchiveEntriesAmount(const ArchiveReader *reader)
+{
+    return reader -> entriesAmount;
+}
+
+/*
+ * Gets an entry of an archive. The entries are sorted by their modules, and the entries of a
+ * module are in their order in the archive.
+ *
+ * @param   *reader     The archive reader.
+ * @param   index       The index of the entry.
+ *
+ * @return  The entry.
+ */
+const archive_entry_t *getArchiveEntry(const ArchiveReader *reader, int index)
+{
+    return &reader -> entries[index];
+}
+
+/*
+ * Finds the entries of a module in an archive.
+ *
+ * @param   *reader         The archive reader.
+ * @param   *module         The name of the module.
+ * @param   *entriesAmount  Will hold the amount of the entries of the module.
+ *
+ * @return  The index of the first entry of the module, or NO_ARCHIVE_ENTRY if it has none.
+ */
+int findArchiveModule(const ArchiveReader *reader, const char *module, int *entriesAmount)
+{
+    int low = 0, high = reader -> entriesAmount, middle, end;
+
+    /* Binary search for the first entry that is not before the module. */
+    while (low < high)
+    {
+        middle = low + (high - low) / 2;
+        if (strcmp(reader -> entries[middle].module, module) < 0)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    for (end = low; end < reader -> entriesAmount &&
+                    sameStrings(reader -> entries[end].module, module) == TRUE; end++)
+        ;
+
+    *entriesAmount = end - low;
+    return (end > low)? low : NO_ARCHIVE_ENTRY;
+}
+
+/*
+ * Finds an entry of a module in an archive.
+ *
+ * @param   *reader     The archive reader.
+ * @param   *module     The name of the module.
+ * @param   *fileType   The ending of the file.
+ *
+ * @return  The index of the entry, or NO_ARCHIVE_ENTRY if it is not in the archive.
+ */
+int findArchiveEntry(const ArchiveReader *reader, const char *module, const char *fileType)
+{
+    int entriesAmount, index = findArchiveModule(reader, module, &entriesAmount);
+
+    for (; entriesAmount > 0; entriesAmount--, index++)
+        if (sameStrings(reader -> entries[index].fileType, fileType) == TRUE)
+            return index;
+
+    return NO_ARCHIVE_ENTRY;
+}
+
+/*
+ * Reads the contents of entries of an archive, with one seek.
+ * The contents of an entry start at (entry offset - first entry offset) in the read contents,
+ * so the entries of a module (found with findArchiveModule) are read together.
+ *
+ * @param   *reader         The archive reader.
+ * @param   firstIndex      The index of the first entry.
+ * @param   entriesAmount   The amount of the entries to read (from the first one).
+ *
+ * @return  The read contents (null-terminated, needs to be freed), or NULL if they could not
+ *          be read.
+ */
+char *readArchiveEntries(ArchiveReader *reader, int firstIndex, int entriesAmount)
+{
+    const archive_entry_t *first = &reader -> entries[firstIndex];
+    const archive_entry_t *last = &reader -> entries[firstIndex + entriesAmount - 1];
+    size_t length = (size_t) (last -> offset + last -> length - first -> offset);
+    char *contents = (char *) allocate_space(length + SIZE_FOR_NULL); /* Value to return. */
+
+    if (fseek(reader -> archiveFile, first -> offset, SEEK_SET) != 0 ||
+        fread(contents, sizeof(char), length, reader -> archiveFile) != length)
+        {(void) clear_ptr(contents)}
+    else
+        contents[length] = NULL_TERMINATOR;
+
+    return contents;
+}
+
+/*
+ * Closes an archive reader and frees its memory.
+ *
+ * @param   **pReader   Pointer to the archive reader.
+ */
+void closeArchive(ArchiveReader **pReader)
+{
+    if (*pReader != NULL)
+    {
+        closeFile(&(*pReader) -> archiveFile);
+        (void) clear_ptr((*pReader) -> tocText)
+        (void) clear_ptr((*pReader) -> entries)
+        (void) clear_ptr(*pReader)
+    }
+}
+
+/*
+ * Reads the table of contents of an archive (from its end), and sorts its entries.
+ *
+ * @param   *reader     The archive reader, with the opened archive.
+ *
+ * @return  INVALID_ARCHIVE_ERR if the table is not valid, otherwise NO_ERROR.
+ */
+Error readArchiveToc(ArchiveReader *reader)
+{
+    char trailer[TRAILER_LEN + SIZE_FOR_NULL], *line, *end;
+    long trailerOffset, tocOffset;
+    int i; /* Loop variable. */
+
+    /* The last line has the offset of the table. */
+    if (fseek(reader -> archiveFile, -TRAILER_LEN, SEEK_END) != 0 ||
+        (trailerOffset = ftell(reader -> archiveFile)) < 0 ||
+        fread(trailer, sizeof(char), TRAILER_LEN, reader -> archiveFile) != TRAILER_LEN ||
+        strncmp(trailer, TRAILER_PREFIX, strlen(TRAILER_PREFIX)) != 0)
+        return INVALID_ARCHIVE_ERR;
+
+    trailer[TRAILER_LEN] = NULL_TERMINATOR;
+    tocOffset = strtol(trailer + strlen(TRAILER_PREFIX), &end, DECIMAL_BASE);
+    if (*end != ENTER_KEY || tocOffset < 0 || tocOffset > trailerOffset)
+        return INVALID_ARCHIVE_ERR;
+
+    /* Read the table, and split it to its entries. */
+    reader -> tocText = (char *) allocate_space(trailerOffset - tocOffset + SIZE_FOR_NULL);
+    if (fseek(reader -> archiveFile, tocOffset, SEEK_SET) != 0 ||
+        fread(reader -> tocText, sizeof(char), (size_t) (trailerOffset - tocOffset),
+              reader -> archiveFile) != (size_t) (trailerOffset - tocOffset))
+        return INVALID_ARCHIVE_ERR;
+    reader -> tocText[trailerOffset - tocOffset] = NULL_TERMINATOR;
+
+    reader -> entriesAmount = (int) strtol(reader -> tocText, &line, DECIMAL_BASE);
+    if (*line != ENTER_KEY || reader -> entriesAmount < 0)
+        return INVALID_ARCHIVE_ERR;
+
+    reader -> entries = (archive_entry_t *) allocate_space((reader -> entriesAmount + 1) *
+                                                           sizeof(archive_entry_t));
+    for (i = 0, line++; i < reader -> entriesAmount; i++)
+        if ((line = readArchiveTocEntry(line, &reader -> entries[i])) == NULL ||
+            reader -> entries[i].offset + reader -> entries[i].length > tocOffset)
+            return INVALID_ARCHIVE_ERR;
+
+    qsort(reader -> entries, (size_t) reader -> entriesAmount, sizeof(archive_entry_t),
+          compareArchiveEntries);
+
+    return NO_ERROR;
+}
+
+/*
+ * Reads an entry from a line of the table of contents, the strings of the entry are kept in
+ * the line (its separators are replaced with null-terminators).
+ *
+ * @param   *line   The line of the entry.
+ * @param   *entry  Will hold the entry.
+ *
+ * @return  The next line, or NULL if the line is not a valid entry.
+ */
+char *readArchiveTocEntry(char *line, archive_entry_t *entry)
+{
+    char *end;
+
+    entry -> module = line;
+    if ((line = strchr(line, TAB_KEY)) == NULL)
+        return NULL;
+    *line++ = NULL_TERMINATOR;
+
+    entry -> fileType = line;
+    if ((line = strchr(line, TAB_KEY)) == NULL)
+        return NULL;
+    *line++ = NULL_TERMINATOR;
+
+    entry -> offset = strtol(line, &end, DECIMAL_BASE);
+    if (*end != TAB_KEY || entry -> offset < 0)
+        return NULL;
+
+    entry -> length = strtol(end + 1, &end, DECIMAL_BASE);
+    if (*end != ENTER_KEY || entry -> length < 0)
+        return NULL;
+
+    return end + 1;
+}
+
+/*
+ * Compares two entries of an archive by their modules, then by their offsets (for qsort).
+ *
+ * @param   *entry1     The first entry.
+ * @param   *entry2     The second entry.
+ *
+ * @return  A negative number if the first entry is before the second, a positive number if
+ *          it is after it, 0 if they are the same.
+ */
+int compareArchiveEntries(const void *entry1, const void *entry2)
+{
+    const archive_entry_t *first = (const archive_entry_t *) entry1;
+    const archive_entry_t *second = (const archive_entry_t *) entry2;
+    int compare = strcmp(first -> module, second -> module);
+
+    if (compare == 0)
+        compare = (first -> offset > second -> offset) - (first -> offset < second -> offset);
+
+    return compare;
+}
@@ -0,0 +1,138 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the OutputArchive.c file.
+ */
+
+#ifndef MMN_14_OUTPUTARCHIVE_H
+#define MMN_14_OUTPUTARCHIVE_H
+
+/* The ending of an output archive file. */
+#define ARCHIVE_END ".mar"
+
+/* The index of an entry that is not in an archive. */
+#define NO_ARCHIVE_ENTRY (-1)
+
+/* An entry of the table of contents of an output archive - a file that was written to it. */
+typedef struct
+{
+    char *module; /* The name of the file without its ending (the source file name). */
+    char *fileType; /* The ending of the file (.am, .ob, .ent...). */
+    long offset; /* The position of the contents of the file in the archive. */
+    long length; /* The length of the contents of the file. */
+} archive_entry_t;
+
+/* ArchiveReader data type - reads the entries of an output archive. */
+typedef struct ArchiveReader ArchiveReader;
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Opens an output archive for writing. While it is open, writeToFile appends the files to it
+ * instead of writing them.
+ *
+ * @param   *archive_name   The name of the archive (without its ending).
+ *
+ * @return  TRUE if the archive was opened, otherwise FALSE.
+ */
+boolean openOutputArchive(const char *archive_name);
+
+/*
+ * Checks if an output archive is open for writing.
+ *
+ * @return  TRUE if an output archive is open, otherwise FALSE.
+ */
+boolean isOutputArchiveOpen(void);
+
+/*
+ * Appends a file to the open output archive.
+ * The files are appended by one thread at a time.
+ *
+ * @param   *module     The name of the file without its ending.
+ * @param   *fileType   The ending of the file.
+ * @param   *text       The contents of the file.
+ */
+void addToOutputArchive(const char *module, const char *fileType, const char *text);
+
+/*
+ * Writes the table of contents of the open output archive and closes it.
+ */
+void closeOutputArchive(void);
+
+/*
+ * Opens an output archive for reading, and reads its table of contents.
+ *
+ * @param   *archive_name   The name of the archive (without its ending).
+ * @param   *archiveError   Will hold the error of opening the archive, or NO_ERROR.
+ *
+ * @return  Pointer to the archive reader, or NULL if there was an error.
+ */
+ArchiveReader *openArchive(const char *archive_name, Error *archiveError);
+
+/*
+ * Gets the amount of the entries of an archive.
+ *
+ * @param   *reader     The archive reader.
+ *
+ * @return  The amount of the entries.
+ */
+int getArchiveEntriesAmount(const ArchiveReader *reader);
+
+/*
+ * Gets an entry of an archive. The entries are sorted by their modules, and the entries of a
+ * module are in their order in the archive.
+ *
+ * @param   *reader     The archive reader.
+ * @param   index       The index of the entry.
+ *
+ * @return  The entry.
+ */
+const archive_entry_t *getArchiveEntry(const ArchiveReader *reader, int index);
+
+/*
+ * Finds the entries of a module in an archive.
+ *
+ * @param   *reader         The archive reader.
+ * @param   *module         The name of the module.
+ * @param   *entriesAmount  Will hold the amount of the entries of the module.
+ *
+ * @return  The index of the first entry of the module, or NO_ARCHIVE_ENTRY if it has none.
+ */
+int findArchiveModule(const ArchiveReader *reader, const char *module, int *entriesAmount);
+
+/*
+ * Finds an entry of a module in an archive.
+ *
+ * @param   *reader     The archive reader.
+ * @param   *module     The name of the module.
+ * @param   *fileType   The ending of the file.
+ *
+ * @return  The index of the entry, or NO_ARCHIVE_ENTRY if it is not in the archive.
+ */
+int findArchiveEntry(const ArchiveReader *reader, const char *module, const char *fileType);
+
+/*
+ * Reads the contents of entries of an archive, with one seek.
+ * The contents of an entry start at (entry offset - first entry offset) in the read contents,
+ * so the entries of a module (found with findArchiveModule) are read together.
+ *
+ * @param   *reader         The archive reader.
+ * @param   firstIndex      The index of the first entry.
+ * @param   entriesAmount   The amount of the entries to read (from the first one).
+ *
+ * @return  The read contents (null-terminated, needs to be freed), or NULL if they could not
+ *          be read.
+ */
+char *readArchiveEntries(ArchiveReader *reader, int firstIndex, int entriesAmount);
+
+/*
+ * Closes an archive reader and frees its memory.
+ *
+ * @param   **pReader   Pointer to the archive reader.
+ */
+void closeArchive(ArchiveReader **pReader);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_OUTPUTARCHIVE_H */
@@ -0,0 +1,378 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * StructuralIndex.c
+ *
+ * This file has the structural index of a source text: a bitmap for every kind of structural
+ * char (new lines, blanks, ';', ':', ',', '"', '@' and '#'), with a bit for every char of the
+ * text. The bitmaps are built in one pass over the whole text, 32 chars at a time with AVX2,
+ * 16 chars at a time with SSE2 (or a char at a time where neither is available).
+ *
+ * The lines are found by the new line bitmap, and blank and comment lines are skipped by the
+ * blank and the semicolon bitmaps, without copying or scanning them char by char.
+ */
+
+/* ---Include header files--- */
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "../new-data-types/boolean.h"
+#include "../general-enums/neededKeys.h"
+#include "../general-enums/indexes.h"
+#include "../general-enums/programFinals.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "StructuralIndex.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE FILES_MEMORY /* For the memory statistics. */
+#define STRUCTURAL_KINDS_AMOUNT 8
+#define SEMICOLON_KIND 2 /* The index of the bitmap of SEMICOLON_CHARS. */
+#define BITS_IN_WORD (CHAR_BIT * sizeof(unsigned long))
+#define HASH '#'
+#define ONE_BIT 1UL
+#define NO_BITS 0UL
+
+/* The size of the blocks of the text that are indexed at once. */
+#if defined(__AVX2__)
+#define SIMD_BLOCK 32
+#elif defined(__SSE2__)
+#define SIMD_BLOCK 16
+#endif
+/* ------------ */
+
+/* ---Macros--- */
+#define kind_flag(kind) (1 << (kind))
+
+#if defined(__AVX2__)
+typedef __m256i simd_block_t;
+#define load_block(text) _mm256_loadu_si256((const __m256i *) (text))
+#define block_mask(block, ch) ((unsigned long) (unsigned int) \
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8((block), _mm256_set1_epi8(ch))))
+#elif defined(__SSE2__)
+typedef __m128i simd_block_t;
+#define load_block(text) _mm_loadu_si128((const __m128i *) (text))
+#define block_mask(block, ch) ((unsigned long) (unsigned int) \
+        _mm_movemask_epi8(_mm_cmpeq_epi8((block), _mm_set1_epi8(ch))))
+#endif
+/* ------------ */
+
+struct StructuralIndex
+{
+    char *text;
+    size_t length;
+    size_t position; /* The position of the next line to read. */
+    size_t wordsAmount; /* The amount of words in every bitmap. */
+    unsigned long *bitmaps[STRUCTURAL_KINDS_AMOUNT]; /* By the order of the flags. */
+};
+
+/* The chars of every kind of structural chars (by the order of the flags). */
+static const char structuralCharValues[STRUCTURAL_KINDS_AMOUNT] =
+        {ENTER_KEY, SPACE_KEY, SEMICOLON, COLON, COMMA, QUOTES, AT, HASH};
+
+/* ---------------Prototypes--------------- */
+void indexText(StructuralIndex *index);
+void indexChar(StructuralIndex *index, size_t position);
+int getStructuralKinds(char ch);
+unsigned long getBitmapsWord(const StructuralIndex *index, size_t wordIndex,
+                             int structuralChars);
+size_t findBitInBitmaps(const StructuralIndex *index, size_t position, int structuralChars,
+                        unsigned long flipMask);
+size_t lowestBitIndex(unsigned long word);
+boolean isIndexedSkipLine(const StructuralIndex *index, size_t lineStart, size_t lineEnd);
+/* ---------------------------------------- */
+
+/*
+ * Creates the structural index of a text.
+ * The index takes the text, and frees it when it is deleted.
+ *
+ * @param   *text   The text (dynamically allocated, null-terminated).
+ *
+ * @return  Pointer to the created index.
+ */
+StructuralIndex *createStructuralIndex(char *text)
+{
+    StructuralIndex *index = (StructuralIndex *) allocate_space(sizeof(StructuralIndex));
+    unsigned long *bitmapsSpace;
+    int kind; /* Loop variable. */
+
+    index -> text = text;
+    index -> length = strlen(text);
+    index -> position = ZERO_NUMBER;
+    index -> wordsAmount = index -> length / BITS_IN_WORD + 1;
+
+    /* All the bitmaps are in one space, and start empty. */
+    bitmapsSpace = (unsigned long *) allocate_space(STRUCTURAL_KINDS_AMOUNT *
+                                                   index -> wordsAmount * sizeof(unsigned long));
+    (void) memset(bitmapsSpace, ZERO_NUMBER,
+                  STRUCTURAL_KINDS_AMOUNT * index -> wordsAmount * sizeof(unsigned long));
+    for (kind = ZERO_INDEX; kind < STRUCTURAL_KINDS_AMOUNT; kind++)
+        index -> bitmaps[kind] = bitmapsSpace + kind * index -> wordsAmount;
+
+    indexText(index);
+    return index;
+}
+
+/*
+ * Builds the bitmaps of the text, a block of chars at a time (where SIMD is available).
+ *
+ * @param   *index  The index.
+ */
+void indexText(StructuralIndex *index)
+{
+    size_t position = ZERO_NUMBER;
+
+#ifdef SIMD_BLOCK
+    simd_block_t block;
+    unsigned long blockMask;
+    int kind; /* Loop variable. */
+
+    /* A block never crosses a word of the bitmaps, the words are a multiple of the blocks. */
+    for (; position + SIMD_BLOCK <= index -> length; position += SIMD_BLOCK)
+    {
+        block = load_block(index -> text + position);
+        for (kind = ZERO_INDEX; kind < STRUCTURAL_KINDS_AMOUNT; kind++)
+        {
+            blockMask = block_mask(block, structuralCharValues[kind]);
+            if (kind_flag(kind) == BLANK_CHARS)
+                blockMask |= block_mask(block, TAB_KEY);
+
+            index -> bitmaps[kind][position / BITS_IN_WORD] |=
+                    blockMask << (position % BITS_IN_WORD);
+        }
+    }
+#endif
+
+    for (; position < index -> length; position++) /* The chars after the last block. */
+        indexChar(index, position);
+}
+
+/*
+ * Adds a char of the text to the bitmaps of its kind.
+ *
+ * @param   *index      The index.
+ * @param   position    The position of the char.
+ */
+void indexChar(StructuralIndex *index, size_t position)
+{
+    int kinds = getStructuralKinds(index -> text[position]);
+    int kind; /* Loop variable. */
+
+    for (kind = ZERO_INDEX; kind < STRUCTURAL_KINDS_AMOUNT; kind++)
+        if (kinds & kind_flag(kind))
+            index -> bitmaps[kind][position / BITS_IN_WORD] |=
+                    ONE_BIT << (position % BITS_IN_WORD);
+}
+
+/*
+ * Gets the kind of a structural char.
+ *
+ * @param   ch  The char.
+ *
+ * @return  The flag of the kind of the char, or 0 if it is not a structural char.
+ */
+int getStructuralKinds(char ch)
+{
+    int kind; /* Loop variable. */
+
+    if (ch == TAB_KEY)
+        return BLANK_CHARS;
+
+    for (kind = ZERO_INDEX; kind < STRUCTURAL_KINDS_AMOUNT; kind++)
+        if (structuralCharValues[kind] == ch)
+            return kind_flag(kind);
+
+    return ZERO_NUMBER;
+}
+
+/*
+ * Finds the next structural char of the given kinds.
+ *
+ * @param   *index              The index.
+ * @param   position            The position to start the search from (including it).
+ * @param   structuralChars     The kinds of the chars to find (combined flags).
+ *
+ * @return  The position of the found char, or the length of the text if there is none.
+ */
+size_t findStructuralChar(const StructuralIndex *index, size_t position, int structuralChars)
+{
+    return findBitInBitmaps(index, position, structuralChars, NO_BITS);
+}
+
+/*
+ * Skips the structural chars of the given kinds.
+ *
+ * @param   *index              The index.
+ * @param   position            The position to start from (including it).
+ * @param   structuralChars     The kinds of the chars to skip (combined flags).
+ *
+ * @return  The position of the next char that is not of these kinds,
+ *          or the length of the text if there is none.
+ */
+size_t skipStructuralChars(const StructuralIndex *index, size_t position, int structuralChars)
+{
+    return findBitInBitmaps(index, position, structuralChars, ~NO_BITS);
+}
+
+/*
+ * Finds the next set bit in the combined bitmaps of the given kinds, a word at a time.
+ *
+ * @param   *index              The index.
+ * @param   position            The position to start the search from (including it).
+ * @param   structuralChars     The kinds of the bitmaps to combine.
+ * @param   flipMask            Mask to flip the combined words with (to find a clear bit).
+ *
+ * @return  The position of the found bit, or the length of the text if there is none.
+ */
+size_t findBitInBitmaps(const StructuralIndex *index, size_t position, int structuralChars,
+                        unsigned long flipMask)
+{
+    size_t wordIndex = position / BITS_IN_WORD, foundPosition;
+    unsigned long word;
+
+    if (position >= index -> length)
+        return index -> length;
+
+    /* Clear the bits before the position in its word. */
+    word = (getBitmapsWord(index, wordIndex, structuralChars) ^ flipMask) &
+           (~NO_BITS << (position % BITS_IN_WORD));
+
+    while (word == NO_BITS && ++wordIndex < index -> wordsAmount)
+        word = getBitmapsWord(index, wordIndex, structuralChars) ^ flipMask;
+
+    if (word == NO_BITS)
+        return index -> length;
+
+    foundPosition = wordIndex * BITS_IN_WORD + lowestBitIndex(word);
+    return (foundPosition < index -> length)? foundPosition : index -> length;
+}
+
+/*
+ * Gets a word of the combined bitmaps of the given kinds.
+ *
+ * @param   *index              The index.
+ * @param   wordIndex           The index of the word.
+ * @param   structuralChars     The kinds of the bitmaps to combine.
+ *
+ * @return  The combined word.
+ */
+unsigned long getBitmapsWord(const StructuralIndex *index, size_t wordIndex,
+                             int structuralChars)
+{
+    unsigned long word = NO_BITS; /* Value to return. */
+    int kind; /* Loop variable. */
+
+    for (kind = ZERO_INDEX; kind < STRUCTURAL_KINDS_AMOUNT; kind++)
+        if (structuralChars & kind_flag(kind))
+            word |= index -> bitmaps[kind][wordIndex];
+
+    return word;
+}
+
+/*
+ * Finds the index of the lowest set bit of a word.
+ *
+ * @param   word    The word (not zero).
+ *
+ * @return  The index of the lowest set bit.
+ */
+size_t lowestBitIndex(unsigned long word)
+{
+#ifdef __GNUC__
+    return (size_t) __builtin_ctzl(word);
+#else
+    size_t bitIndex = ZERO_NUMBER; /* Value to return. */
+
+    while ((word & ONE_BIT) == NO_BITS)
+    {
+        word >>= 1;
+        bitIndex++;
+    }
+
+    return bitIndex;
+#endif
+}
+
+/*
+ * Reads the next line of the text, and moves the index past it.
+ * Blank and comment lines are skipped in bulk, by the bitmaps of the index.
+ *
+ * @param   *index              The index.
+ * @param   readLength          The most chars read as one line (a longer line is read in
+ *                              parts, the same as fgets does), or WHOLE_LINES.
+ * @param   maxSkippedLength    Blank and comment lines up to this length (without the new line
+ *                              char) are skipped, or NO_SKIPPED_LINES to read them too.
+ * @param   *lineNumber         The number of the last read line, counts the skipped lines too.
+ *
+ * @return  The line (dynamically allocated, with its new line char), or NULL at the end.
+ */
+char *readIndexedLine(StructuralIndex *index, int readLength, int maxSkippedLength,
+                      int *lineNumber)
+{
+    size_t lineStart, lineEnd, contentLength;
+    char *line = NULL; /* Value to return. */
+
+    while (line == NULL && index -> position < index -> length)
+    {
+        lineStart = index -> position;
+        lineEnd = findStructuralChar(index, lineStart, NEW_LINE_CHARS);
+        lineEnd = (lineEnd < index -> length)? lineEnd + 1 : lineEnd; /* With the new line. */
+        if (readLength != WHOLE_LINES && lineEnd - lineStart > (size_t) readLength)
+            lineEnd = lineStart + readLength;
+
+        index -> position = lineEnd;
+        (*lineNumber)++;
+
+        contentLength = lineEnd - lineStart;
+        if (index -> text[lineEnd - 1] == ENTER_KEY)
+            contentLength--;
+
+        if (maxSkippedLength == NO_SKIPPED_LINES || contentLength > (size_t) maxSkippedLength ||
+            isIndexedSkipLine(index, lineStart, lineEnd) == FALSE)
+            line = strcpyPart(index -> text, (int) lineStart, (int) lineEnd);
+    }
+
+    return line;
+}
+
+/*
+ * Checks if a line of the text is a blank line or a comment line.
+ *
+ * @param   *index      The index.
+ * @param   lineStart   The position of the start of the line.
+ * @param   lineEnd     The position after the end of the line.
+ *
+ * @return  TRUE if the line is a blank or a comment line, otherwise FALSE.
+ */
+boolean isIndexedSkipLine(const StructuralIndex *index, size_t lineStart, size_t lineEnd)
+{
+    boolean isComment = (index -> bitmaps[SEMICOLON_KIND][lineStart / BITS_IN_WORD] >>
+                         (lineStart % BITS_IN_WORD)) & ONE_BIT;
+
+    return (isComment == TRUE ||
+            skipStructuralChars(index, lineStart, BLANK_CHARS | NEW_LINE_CHARS) >= lineEnd)?
+           TRUE : FALSE;
+}
+
+/*
+ * Deletes an index and its text.
+ *
+ * @param   **pIndex    Pointer to the index to delete.
+ */
+void deleteStructuralIndex(StructuralIndex **pIndex)
+{
+    if (pIndex == NULL || *pIndex == NULL)
+        return;
+
+    (void) clear_ptr((*pIndex) -> bitmaps[ZERO_INDEX]) /* The space of all the bitmaps. */
+    (void) clear_ptr((*pIndex) -> text)
+    (void) clear_ptr(*pIndex)
+}
@@ -0,0 +1,89 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the StructuralIndex.c file.
+ */
+
+#ifndef MMN_14_STRUCTURALINDEX_H
+#define MMN_14_STRUCTURALINDEX_H
+
+#include <stddef.h>
+
+/* StructuralIndex data type - a source text, with the bitmaps of its structural chars. */
+typedef struct StructuralIndex StructuralIndex;
+
+/* The structural chars (can be combined to search a few of them). */
+#define NEW_LINE_CHARS 0x01
+#define BLANK_CHARS 0x02 /* Spaces and tabs. */
+#define SEMICOLON_CHARS 0x04
+#define COLON_CHARS 0x08
+#define COMMA_CHARS 0x10
+#define QUOTES_CHARS 0x20
+#define AT_CHARS 0x40
+#define HASH_CHARS 0x80
+
+#define WHOLE_LINES 0 /* Read every line whole. */
+#define NO_SKIPPED_LINES (-1) /* Read the blank and the comment lines too. */
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Creates the structural index of a text.
+ * The index takes the text, and frees it when it is deleted.
+ *
+ * @param   *text   The text (dynamically allocated, null-terminated).
+ *
+ * @return  Pointer to the created index.
+ */
+StructuralIndex *createStructuralIndex(char *text);
+
+/*
+ * Finds the next structural char of the given kinds.
+ *
+ * @param   *index              The index.
+ * @param   position            The position to start the search from (including it).
+ * @param   structuralChars     The kinds of the chars to find (combined flags).
+ *
+ * @return  The position of the found char, or the length of the text if there is none.
+ */
+size_t findStructuralChar(const StructuralIndex *index, size_t position, int structuralChars);
+
+/*
+ * Skips the structural chars of the given kinds.
+ *
+ * @param   *index              The index.
+ * @param   position            The position to start from (including it).
+ * @param   structuralChars     The kinds of the chars to skip (combined flags).
+ *
+ * @return  The position of the next char that is not of these kinds,
+ *          or the length of the text if there is none.
+ */
+size_t skipStructuralChars(const StructuralIndex *index, size_t position, int structuralChars);
+
+/*
+ * Reads the next line of the text, and moves the index past it.
+ * Blank and comment lines are skipped in bulk, by the bitmaps of the index.
+ *
+ * @param   *index              The index.
+ * @param   readLength          The most chars read as one line (a longer line is read in
+ *                              parts, the same as fgets does), or WHOLE_LINES.
+ * @param   maxSkippedLength    Blank and comment lines up to this length (without the new line
+ *                              char) are skipped, or NO_SKIPPED_LINES to read them too.
+ * @param   *lineNumber         The number of the last read line, counts the skipped lines too.
+ *
+ * @return  The line (dynamically allocated, with its new line char), or NULL at the end.
+ */
+char *readIndexedLine(StructuralIndex *index, int readLength, int maxSkippedLength,
+                      int *lineNumber);
+
+/*
+ * Deletes an index and its text.
+ *
+ * @param   **pIndex    Pointer to the index to delete.
+ */
+void deleteStructuralIndex(StructuralIndex **pIndex);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_STRUCTURALINDEX_H */
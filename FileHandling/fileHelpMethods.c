@@ -14,7 +14,8 @@
 /* -------------------------- */
 
 /* ---Finals--- */
-#define BUFFER 256
+#define MEMORY_MODULE FILES_MEMORY /* For the memory statistics. */
+#define COPY_BUFFER_SIZE 4096
 /* ------------ */
 
 /*
@@ -28,22 +29,11 @@
  */
 FILE *openFile(const char *file_name, const char *fileType, const char *modeType)
 {
-    static FILE *file = NULL; /* Will be the file to open */
-    static char currFileName[BUFFER];
-    static char currModeType[BUFFER];
     char *fileToOpen = connectTwoStrings(file_name, fileType); /* Full file name */
+    FILE *file = fopen(fileToOpen, modeType); /* Open the file */
 
-    /* If we open a different file or open the same one but in different type */
-    if (sameStrings(currFileName, fileToOpen) == FALSE  ||
-        sameStrings(currModeType, modeType) == FALSE)
-    {
-        file = fopen(fileToOpen, modeType); /* Open the file */
-        if (file == NULL)
-            printf("\nUnable to open file: \"%s\"\n", file_name);
-
-        (void) strcpy(currFileName, fileToOpen);
-        (void) strcpy(currModeType, modeType);
-    }
+    if (file == NULL)
+        printf("\nUnable to open file: \"%s\"\n", file_name);
 
     (void) clear_ptr(fileToOpen) /* Freeing unnecessary string */
     return file;
@@ -60,4 +50,34 @@ void closeFile(FILE **file)
     if (file != NULL && *file != NULL) /* Close the file only if it's open */
         handle_file_close_errors(fclose(*file));
     *file = NULL;
-}
\ No newline at end of file
+}
+/*
+ * Removes a file, if it exists.
+ *
+ * @param   *file_name The name of the file to remove.
+ * @param   *fileType The type of the file to remove.
+ */
+void removeFile(const char *file_name, const char *fileType)
+{
+    char *fileToRemove = connectTwoStrings(file_name, fileType); /* Full file name */
+
+    (void) remove(fileToRemove); /* A file that does not exist is already removed. */
+
+    (void) clear_ptr(fileToRemove) /* Freeing unnecessary string */
+}
+
+/*
+ * Copies all the contents of a file to another file.
+ *
+ * @param   *source         The file to copy (open for reading, read from its start).
+ * @param   *destination    The file to copy to (open for writing).
+ */
+void copyFileContents(FILE *source, FILE *destination)
+{
+    char buffer[COPY_BUFFER_SIZE];
+    size_t readAmount;
+
+    rewind(source);
+    while ((readAmount = fread(buffer, sizeof(char), COPY_BUFFER_SIZE, source)) > 0)
+        (void) fwrite(buffer, sizeof(char), readAmount, destination);
+}
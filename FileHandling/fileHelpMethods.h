@@ -29,6 +29,22 @@ FILE *openFile(const char *file_name, const char *fileType, const char *modeType
  */
 void closeFile(FILE **file);
 
+/*
+ * Removes a file, if it exists.
+ *
+ * @param   *file_name The name of the file to remove.
+ * @param   *fileType The type of the file to remove.
+ */
+void removeFile(const char *file_name, const char *fileType);
+
+/*
+ * Copies all the contents of a file to another file.
+ *
+ * @param   *source         The file to copy (open for reading, read from its start).
+ * @param   *destination    The file to copy to (open for writing).
+ */
+void copyFileContents(FILE *source, FILE *destination);
+
 /* ---------------------------------------- */
 
 #endif /* MMN_14_FILEHELPMETHODS_H */
@@ -9,42 +9,81 @@
 #include <stdio.h>
 #include "fileHelpMethods.h"
 #include "../util/stringsUtil.h"
+#include "../util/memoryUtil.h"
+#include "../util/traceUtil.h"
+#include "../general-enums/neededKeys.h"
+#include "../general-enums/programFinals.h"
+#include "StructuralIndex.h"
 /* -------------------------- */
 
 /* ---Finals--- */
-#define SUCCESS_CODE 0
-#define UNABLE_TO_OPEN_FILE (-2)
+#define MEMORY_MODULE FILES_MEMORY /* For the memory statistics. */
 #define READ_MODE "r"
-#define BUFFER 82
+#define READ_CHUNK 4096
 /* ------------ */
 
 /*
- * Reads the next line from a given file.
+ * Reads the whole contents of a given file.
+ * This function keeps no state between calls, so it can be used to read a few files
+ * at the same time (even from different threads).
  *
  * @param   *file_name      The name of the file to read from.
  * @param   *fileType       The type of the file to read from.
- * @param   **line          Pointer to string that will hold the read line.
  *
- * @return  The length of the line if it has been read successfully, EOF (-1) if the line
- *          was not read successfully, -2 if the file was not opened.
+ * @return  The contents of the file (needs to be freed), NULL if the file was not opened.
  */
-int readNextLineFromFile(const char *file_name, const char *fileType, char **line)
+char *readWholeFile(const char *file_name, const char *fileType)
 {
-    int returnCode = UNABLE_TO_OPEN_FILE; /* Return code to return, assume error. */
-    FILE *fileToRead = openFile(file_name, fileType, READ_MODE); /* Open file */
+    char *contents = NULL; /* String to return. */
+    char *fileToOpen = connectTwoStrings(file_name, fileType); /* Full file name */
+    FILE *fileToRead;
+    trace_span_t span;
 
-    if (fileToRead != NULL) /* Read the line if the file was opened. */
+    beginTraceSpan(&span, "read_file", file_name);
+
+    if ((fileToRead = fopen(fileToOpen, READ_MODE)) != NULL)
     {
-        char lineTmp[BUFFER]; /* Will hold the line. */
+        size_t size = ZERO_NUMBER, capacity = READ_CHUNK, readAmount;
+        contents = (char *) allocate_space(capacity + SIZE_FOR_NULL);
 
-        /* Read the line. If there is no file to read, close the file. */
-        if ((*line = my_strdup(fgets(lineTmp, BUFFER, fileToRead))) == NULL) {
-            closeFile(&fileToRead);
-            returnCode = EOF;
+        /* Read chunks until the end of the file, growing the string when needed. */
+        while ((readAmount = fread(contents + size, sizeof(char), capacity - size, fileToRead)) > 0)
+        {
+            size += readAmount;
+            if (size == capacity)
+            {
+                capacity *= 2;
+                contents = (char *) reallocate_space(contents, capacity + SIZE_FOR_NULL);
+            }
         }
-        else
-            returnCode = SUCCESS_CODE;
+        contents[size] = NULL_TERMINATOR;
+
+        closeFile(&fileToRead);
+    }
+
+    (void) clear_ptr(fileToOpen)
+    endTraceSpan(&span);
+    return contents;
+}
+
+/*
+ * Reads a whole source file and builds its structural index, to read its lines from.
+ *
+ * @param   *file_name      The name of the file to read from.
+ * @param   *fileType       The type of the file to read from.
+ *
+ * @return  The index of the contents of the file (needs to be deleted),
+ *          NULL if the file was not opened.
+ */
+StructuralIndex *readIndexedFile(const char *file_name, const char *fileType)
+{
+    char *contents = readWholeFile(file_name, fileType);
+
+    if (contents == NULL)
+    {
+        printf("\nUnable to open file: \"%s\"\n", file_name);
+        return NULL;
     }
 
-    return returnCode;
-}
\ No newline at end of file
+    return createStructuralIndex(contents);
+}
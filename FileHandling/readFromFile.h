@@ -8,21 +8,32 @@
 #ifndef MMN_14_READFROMFILE_H
 #define MMN_14_READFROMFILE_H
 
-#define UNABLE_TO_OPEN_FILE (-2)
+#include "StructuralIndex.h"
 
 /* ---------------Prototypes--------------- */
 
 /*
- * Reads the next line from a given file.
+ * Reads the whole contents of a given file.
+ * This function keeps no state between calls, so it can be used to read a few files
+ * at the same time (even from different threads).
  *
  * @param   *file_name      The name of the file to read from.
  * @param   *fileType       The type of the file to read from.
- * @param   **line          Pointer to string that will hold the read line.
  *
- * @return  The length of the line if it has been read successfully, EOF (-1) if the line
- *          was not read successfully, -2 if the file was not opened.
+ * @return  The contents of the file (needs to be freed), NULL if the file was not opened.
  */
-int readNextLineFromFile(const char *file_name, const char *fileType, char **line);
+char *readWholeFile(const char *file_name, const char *fileType);
+
+/*
+ * Reads a whole source file and builds its structural index, to read its lines from.
+ *
+ * @param   *file_name      The name of the file to read from.
+ * @param   *fileType       The type of the file to read from.
+ *
+ * @return  The index of the contents of the file (needs to be deleted),
+ *          NULL if the file was not opened.
+ */
+StructuralIndex *readIndexedFile(const char *file_name, const char *fileType);
 
 /* ---------------------------------------- */
 
@@ -3,11 +3,16 @@
  * @version (18/08/2023)
  *
  * This file has the methods to write to files.
+ * While an output archive is open, the files are appended to it instead.
  */
 
 /* ---Include header files--- */
 #include <stdio.h>
+#include "../new-data-types/boolean.h"
+#include "../errors/error_types/error_types.h"
 #include "fileHelpMethods.h"
+#include "OutputArchive.h"
+#include "../util/traceUtil.h"
 /* -------------------------- */
 
 /* ---Finals--- */
@@ -15,7 +20,7 @@
 /* ------------ */
 
 /*
- * Writes text to a given file.
+ * Writes text to a given file (or to the open output archive).
  *
  * @param   *file_name      The name of the file to write to.
  * @param   *fileType       The type of the file to write to.
@@ -23,14 +28,43 @@
  */
 void writeToFile(const char *file_name, const char *fileType, const char *text)
 {
+    trace_span_t span;
+
     if (text != NULL) /* If we need to print anything. */
     {
-        FILE *fileToWriteTo = openFile(file_name, fileType, WRITE_MODE); /* Open the file */
+        FILE *fileToWriteTo;
+
+        beginTraceSpan(&span, "write_file", file_name);
+
+        if (isOutputArchiveOpen() == TRUE)
+        {
+            addToOutputArchive(file_name, fileType, text);
+            endTraceSpan(&span);
+            return;
+        }
+
+        fileToWriteTo = openFile(file_name, fileType, WRITE_MODE); /* Open the file */
 
         if (fileToWriteTo != NULL) /* Check if the file was opened. */
         {
             fputs(text, fileToWriteTo); /* Printing to the file */
             closeFile(&fileToWriteTo); /* Closing the file */
         }
+
+        endTraceSpan(&span);
     }
+}
+
+/*
+ * Removes an output file that has nothing to print, so the file of an earlier run of the same
+ * source is not left behind. While an output archive is open nothing is written to the
+ * files, so nothing is removed.
+ *
+ * @param   *file_name      The name of the file to remove.
+ * @param   *fileType       The type of the file to remove.
+ */
+void removeOutputFile(const char *file_name, const char *fileType)
+{
+    if (isOutputArchiveOpen() == FALSE)
+        removeFile(file_name, fileType);
 }
\ No newline at end of file
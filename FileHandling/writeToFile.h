@@ -19,6 +19,15 @@
  */
 void writeToFile(const char *file_name, const char *fileType, const char *text);
 
+/*
+ * Removes an output file that has nothing to print, so the file of an earlier run of the same
+ * source is not left behind. While an output archive is open nothing is removed.
+ *
+ * @param   *file_name      The name of the file to remove.
+ * @param   *fileType       The type of the file to remove.
+ */
+void removeOutputFile(const char *file_name, const char *fileType);
+
 /* ---------------------------------------- */
 
 #endif /* MMN_14_WRITETOFILE_H */
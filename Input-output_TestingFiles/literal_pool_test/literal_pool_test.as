@@ -0,0 +1,22 @@
+; Literal pooling test, assembled with the -P option.
+; A table is a .data or .string line with a label and the data lines
+; without a label after it, and only whole tables are pooled.
+.entry MAIN
+MAIN: lea T2, @r1
+ prn @r1
+ lea T1, @r2
+; T2 starts like T1, but its table is {1, 2}, so it is kept.
+T1: .data 1
+.data 9
+T2: .data 1
+.data 2
+; T3 continues after an instruction, so it is {1, 9} and is pooled to T1.
+T3: .data 1
+ lea T3, @r3
+.data 9
+; T4 is the same words as S1 (with its null terminator), so it is pooled to S1.
+S1: .string "ab"
+T4: .data 97, 98
+.data 0
+ prn T4
+ stop
@@ -0,0 +1,18 @@
+; Literal pooling of written tables test, assembled with the -P option.
+; A table that the program can write to is a variable and not a literal,
+; so it is not pooled, and no later table is pooled with it.
+.entry E1
+ inc D0
+ prn D1
+ lea D1, D2
+ prn D3
+ stop
+; D0 is written by inc, so D1 is not pooled to it.
+D0: .data 5
+D1: .data 5
+; D2 is written by lea, so it is not pooled to D1.
+D2: .data 5
+; E1 is a .entry label (a linked file can write it), so it is not pooled to D1.
+E1: .data 5
+; D3 is only read, so it is pooled to D1.
+D3: .data 5
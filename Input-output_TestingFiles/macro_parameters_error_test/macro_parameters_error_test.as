@@ -0,0 +1,12 @@
+; Macros with an empty parameter and with a trailing comma after the parameters.
+mcro m_trail a,
+      mov a, @r1
+endmcro
+mcro m_empty a,,b
+      add a, b
+endmcro
+mcro m_ok a
+      inc a
+endmcro
+      m_ok @r2
+      stop
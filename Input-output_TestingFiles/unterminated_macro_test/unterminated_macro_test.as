@@ -0,0 +1,5 @@
+; A macro definition that is not ended before the end of the file.
+MAIN: mov @r1, @r2
+      stop
+mcro m_inc
+      inc @r1
@@ -15,6 +15,7 @@
 /* -------------------------- */
 
 /* ---Finals--- */
+#define MEMORY_MODULE NAME_TABLE_MEMORY /* For the memory statistics. */
 #define SUCCESS_CODE 0
 #define TABLE_IS_NULL_CODE (-1)
 #define NAME_ALREADY_IN_TABLE_CODE (-2)
@@ -323,6 +324,30 @@ char *numbersNameTableToString(NameTable *nameTable)
     return nameTableStr;
 }
 
+/*
+ * Adds copies of all the names of a string table (and their strings) to another string table.
+ * Names that are already in the other table are skipped.
+ *
+ * @param   *destTable  The table to add the names to.
+ * @param   *srcTable   The table to copy the names from.
+ */
+void copyStringTable(NameTable *destTable, const NameTable *srcTable)
+{
+    Node *curr = srcTable -> head;
+    char *name;
+
+    while (curr != NULL) /* Copy it node-by-node. */
+    {
+        name = my_strdup(curr -> name);
+        if (addNameToTable(destTable, name) != SUCCESS_CODE)
+            {(void) clear_ptr(name)}
+        else if (curr -> data != NULL)
+            (void) addStringToData(destTable, curr -> name, curr -> data -> string);
+
+        curr = curr -> next;
+    }
+}
+
 /*
  * Deletes a given node.
  *
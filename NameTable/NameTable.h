@@ -119,6 +119,15 @@ int changeToPosAndAdd(NameTable *name_table, int add);
  */
 char *numbersNameTableToString(NameTable *nameTable);
 
+/*
+ * Adds copies of all the names of a string table (and their strings) to another string table.
+ * Names that are already in the other table are skipped.
+ *
+ * @param   *destTable  The table to add the names to.
+ * @param   *srcTable   The table to copy the names from.
+ */
+void copyStringTable(NameTable *destTable, const NameTable *srcTable);
+
 /*
  * Deletes the entire NameTable and frees the memory.
  *
@@ -0,0 +1,326 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file has the functions to load assembled objects back from their output files.
+ *
+ * The object file (.ob) starts with a heading line {IC [tab] DC} and after that
+ * every line holds one word in Base64 (two characters, the upper 6 bits first).
+ * The entry (.ent) and extern (.ext) files hold a label name and an address in every line.
+ * The relocation (.rel) file holds an address and a kind ('R' or 'E') in every line.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../new-data-types/boolean.h"
+#include "../general-enums/programFinals.h"
+#include "../general-enums/neededKeys.h"
+#include "../general-enums/indexes.h"
+#include "../general-enums/assemblerFinals.h"
+#include "../encoding/wordHandling.h"
+#include "../FileHandling/readFromFile.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "ObjectFile.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE OBJECT_FILE_MEMORY /* For the memory statistics. */
+#define OBJECT_END ".ob"
+#define ENT_END ".ent"
+#define EXT_END ".ext"
+#define REL_END ".rel"
+#define RELOCATABLE_KIND 'R'
+#define EXTERNAL_KIND 'E'
+#define HEADING_VALUES 2
+#define SYMBOL_VALUES 2
+/* ------------ */
+
+/* ---Macros--- */
+#define isLineEnd(ch) ((ch) == ENTER_KEY || (ch) == '\r')
+/* ------------ */
+
+/* ---------------Prototypes--------------- */
+Error loadObjectWords(ObjectFile *objectFile, const char *contents);
+Error loadObjectSymbols(const char *contents, object_symbol_t **pSymbols, int *pAmount,
+                        Error invalidFileError);
+Error loadObjectRelocations(ObjectFile *objectFile, const char *contents);
+int countLines(const char *contents);
+const char *skipLineEnds(const char *str);
+/* ---------------------------------------- */
+
+/*
+ * Loads an assembled object, its .ob file and its .ent, .ext and .rel files (if there are).
+ * Uses no shared state, so a few objects can be loaded at the same time.
+ *
+ * @param   *file_name      The name of the object (without endings).
+ * @param   *loadError      Will hold the error that occurred while loading (if there is).
+ *
+ * @return  The loaded object, NULL if an error occurred.
+ */
+ObjectFile *loadObjectFile(const char *file_name, Error *loadError)
+{
+    ObjectFile *objectFile = NULL; /* Object to return. */
+    char *contents = readWholeFile(file_name, OBJECT_END);
+
+    *loadError = (contents == NULL)? OBJECT_FILE_NOT_FOUND_ERR : NO_ERROR;
+
+    if (*loadError == NO_ERROR)
+    {
+        objectFile = (ObjectFile *) allocate_space(sizeof(ObjectFile));
+        objectFile -> file_name = my_strdup(file_name);
+        objectFile -> words = NULL;
+        objectFile -> entries = objectFile -> externs = NULL;
+        objectFile -> relocations = NULL;
+        objectFile -> entriesAmount = objectFile -> externsAmount = ZERO_COUNT;
+        objectFile -> relocationsAmount = ZERO_COUNT;
+
+        *loadError = loadObjectWords(objectFile, contents);
+        (void) clear_ptr(contents)
+    }
+
+    /* The .ent and .ext files are optional (the assembler creates them only when needed). */
+    if (*loadError == NO_ERROR && (contents = readWholeFile(file_name, ENT_END)) != NULL)
+    {
+        *loadError = loadObjectSymbols(contents, &objectFile -> entries,
+                                       &objectFile -> entriesAmount, INVALID_ENTRY_FILE_ERR);
+        (void) clear_ptr(contents)
+    }
+
+    if (*loadError == NO_ERROR && (contents = readWholeFile(file_name, EXT_END)) != NULL)
+    {
+        *loadError = loadObjectSymbols(contents, &objectFile -> externs,
+                                       &objectFile -> externsAmount, INVALID_EXTERN_FILE_ERR);
+        (void) clear_ptr(contents)
+    }
+
+    if (*loadError == NO_ERROR && (contents = readWholeFile(file_name, REL_END)) != NULL)
+    {
+        *loadError = loadObjectRelocations(objectFile, contents);
+        (void) clear_ptr(contents)
+    }
+
+    if (*loadError != NO_ERROR && objectFile != NULL)
+        deleteObjectFile(&objectFile);
+
+    return objectFile;
+}
+
+/*
+ * Loads the words of an object from the contents of its .ob file.
+ *
+ * @param   *objectFile     The object to load the words to.
+ * @param   *contents       The contents of the .ob file.
+ *
+ * @return  NO_ERROR if the words were loaded, otherwise INVALID_OBJECT_FILE_ERR.
+ */
+Error loadObjectWords(ObjectFile *objectFile, const char *contents)
+{
+    Error loadError = INVALID_OBJECT_FILE_ERR; /* Assume invalid file. */
+    int wordsAmount, i; /* Loop variables. */
+
+    if (sscanf(contents, "%d %d", &objectFile -> counters[IC_],
+               &objectFile -> counters[DC_]) == HEADING_VALUES &&
+        objectFile -> counters[IC_] >= ZERO_COUNT && objectFile -> counters[DC_] >= ZERO_COUNT &&
+        objectFile -> counters[IC_] + objectFile -> counters[DC_] <= IMG_SYSTEM_MEMORY_SIZE)
+    {
+        wordsAmount = getObjectWordsAmount(objectFile);
+        objectFile -> words = (word_t *) allocate_space(wordsAmount * sizeof(word_t) + 1);
+        loadError = NO_ERROR;
+
+        contents = skipLineEnds(strchr(contents, ENTER_KEY));
+
+        /* Decode the words, every line is {upper 6 bits, lower 6 bits} in Base64. */
+        for (i = ZERO_INDEX; i < wordsAmount && loadError == NO_ERROR; i++)
+        {
+            if (contents == NULL || contents[ZERO_INDEX] == NULL_TERMINATOR ||
+                convertBase64ToWord(contents, &objectFile -> words[i]) == FALSE)
+                loadError = INVALID_OBJECT_FILE_ERR;
+            else
+                contents = skipLineEnds(contents + BASE64_CHARS_FOR_WORD);
+        }
+
+        if (loadError == NO_ERROR && contents != NULL && *contents != NULL_TERMINATOR)
+            loadError = INVALID_OBJECT_FILE_ERR; /* Extraneous words. */
+    }
+
+    return loadError;
+}
+
+/*
+ * Loads symbols (name and address in every line) from the contents of a .ent or a .ext file.
+ *
+ * @param   *contents           The contents of the file.
+ * @param   **pSymbols          Pointer to the array that will hold the symbols.
+ * @param   *pAmount            Pointer to the amount of symbols.
+ * @param   invalidFileError    The error to return if the file is invalid.
+ *
+ * @return  NO_ERROR if the symbols were loaded, otherwise the given invalid file error.
+ */
+Error loadObjectSymbols(const char *contents, object_symbol_t **pSymbols, int *pAmount,
+                        Error invalidFileError)
+{
+    Error loadError = NO_ERROR;
+    char name[MAX_LABEL_LEN + SIZE_FOR_NULL];
+    const char *line;
+    int address;
+
+    /* Allocate the symbols at once. */
+    *pSymbols = (object_symbol_t *) allocate_space(countLines(contents) * sizeof(object_symbol_t)
+                                                   + 1);
+    *pAmount = ZERO_COUNT;
+
+    for (line = skipLineEnds(contents); *line != NULL_TERMINATOR && loadError == NO_ERROR;
+         line = skipLineEnds(line + strcspn(line, "\r\n")))
+    {
+        if (sscanf(line, "%31s %d", name, &address) != SYMBOL_VALUES)
+            loadError = invalidFileError;
+
+        else
+        {
+            (*pSymbols)[*pAmount].name = my_strdup(name);
+            (*pSymbols)[*pAmount].address = address;
+            (*pAmount)++;
+        }
+    }
+
+    return loadError;
+}
+
+/*
+ * Loads the relocation table of an object from the contents of its .rel file.
+ *
+ * @param   *objectFile     The object to load the relocation table to.
+ * @param   *contents       The contents of the .rel file.
+ *
+ * @return  NO_ERROR if the table was loaded, otherwise INVALID_OBJECT_FILE_ERR.
+ */
+Error loadObjectRelocations(ObjectFile *objectFile, const char *contents)
+{
+    Error loadError = NO_ERROR;
+    const char *line;
+    char kind;
+    int address;
+
+    objectFile -> relocations = (object_relocation_t *)
+            allocate_space(countLines(contents) * sizeof(object_relocation_t) + 1);
+
+    for (line = skipLineEnds(contents); *line != NULL_TERMINATOR && loadError == NO_ERROR;
+         line = skipLineEnds(line + strcspn(line, "\r\n")))
+    {
+        if (sscanf(line, "%d %c", &address, &kind) != SYMBOL_VALUES ||
+            (kind != RELOCATABLE_KIND && kind != EXTERNAL_KIND) ||
+            isObjectCodeAddress(objectFile, address) == FALSE)
+            loadError = INVALID_OBJECT_FILE_ERR;
+
+        else
+        {
+            objectFile -> relocations[objectFile -> relocationsAmount].address = address;
+            objectFile -> relocations[objectFile -> relocationsAmount].kind =
+                    (kind == RELOCATABLE_KIND)? RELOCATABLE : EXTERNAL;
+            objectFile -> relocationsAmount++;
+        }
+    }
+
+    return loadError;
+}
+
+/*
+ * Counts the non empty lines in a string.
+ *
+ * @param   *contents   The string to count its lines.
+ *
+ * @return  The amount of non empty lines.
+ */
+int countLines(const char *contents)
+{
+    int linesAmount = ZERO_COUNT;
+    const char *line;
+
+    for (line = skipLineEnds(contents); *line != NULL_TERMINATOR; linesAmount++)
+        line = skipLineEnds(line + strcspn(line, "\r\n"));
+
+    return linesAmount;
+}
+
+/*
+ * Skips line ending characters.
+ *
+ * @param   *str    The string to skip the line endings in (can be NULL).
+ *
+ * @return  Pointer to the first character that is not a line ending, NULL if str is NULL.
+ */
+const char *skipLineEnds(const char *str)
+{
+    while (str != NULL && isLineEnd(*str))
+        str++;
+
+    return str;
+}
+
+/*
+ * Gets the total amount of words (code and data) in an object.
+ *
+ * @param   *objectFile     The object to get its size.
+ *
+ * @return  The total amount of words in the object.
+ */
+int getObjectWordsAmount(const ObjectFile *objectFile)
+{
+    return objectFile -> counters[IC_] + objectFile -> counters[DC_];
+}
+
+/*
+ * Checks if an address of an object is in its code segment.
+ *
+ * @param   *objectFile     The object to check the address in.
+ * @param   address         The address to check (as the assembler assigned it).
+ *
+ * @return  TRUE if the address is in the code segment, otherwise FALSE.
+ */
+boolean isObjectCodeAddress(const ObjectFile *objectFile, int address)
+{
+    return (address >= PROGRAM_MEM_START &&
+            address < PROGRAM_MEM_START + objectFile -> counters[IC_])? TRUE : FALSE;
+}
+
+/*
+ * Gets the word of an object in a given address.
+ *
+ * @param   *objectFile     The object to get the word from.
+ * @param   address         The address of the word (as the assembler assigned it).
+ *
+ * @return  Pointer to the word, NULL if the address is not in the object.
+ */
+word_t *getObjectWord(ObjectFile *objectFile, int address)
+{
+    return (address >= PROGRAM_MEM_START &&
+            address < PROGRAM_MEM_START + getObjectWordsAmount(objectFile))?
+            &objectFile -> words[address - PROGRAM_MEM_START] : NULL;
+}
+
+/*
+ * Deletes an object and frees all of its memory.
+ *
+ * @param   **pObjectFile   Pointer to the object to delete.
+ */
+void deleteObjectFile(ObjectFile **pObjectFile)
+{
+    int i; /* Loop variable. */
+
+    for (i = ZERO_INDEX; i < (*pObjectFile) -> entriesAmount; i++) {
+        (void) clear_ptr((*pObjectFile) -> entries[i].name)
+    }
+    for (i = ZERO_INDEX; i < (*pObjectFile) -> externsAmount; i++) {
+        (void) clear_ptr((*pObjectFile) -> externs[i].name)
+    }
+
+    (void) clear_ptr((*pObjectFile) -> entries)
+    (void) clear_ptr((*pObjectFile) -> externs)
+    (void) clear_ptr((*pObjectFile) -> relocations)
+    (void) clear_ptr((*pObjectFile) -> words)
+    (void) clear_ptr((*pObjectFile) -> file_name)
+    (void) clear_ptr(*pObjectFile)
+}
@@ -0,0 +1,96 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the ObjectFile.c file.
+ */
+
+#ifndef MMN_14_OBJECTFILE_H
+#define MMN_14_OBJECTFILE_H
+
+#include "../new-data-types/boolean.h"
+#include "../general-enums/assemblerFinals.h"
+#include "../encoding/encodingDataStructures/word.h"
+#include "../encoding/encoding-finals/encoding_types.h"
+#include "../errors/error_types/error_types.h"
+
+/* A symbol from the .ent or the .ext file of an object. */
+typedef struct
+{
+    char *name; /* The name of the symbol. */
+    int address; /* Entry: the address of the symbol. Extern: the address of the word using it. */
+} object_symbol_t;
+
+/* A word from the relocation table (.rel file) of an object. */
+typedef struct
+{
+    int address; /* The address of the word. */
+    encoding_type_t kind; /* RELOCATABLE or EXTERNAL. */
+} object_relocation_t;
+
+/* ObjectFile data type - the contents of an assembled object (.ob, .ent, .ext and .rel files). */
+typedef struct
+{
+    char *file_name; /* The name of the object (without endings). */
+    int counters[COUNTERS_AMOUNT]; /* Amount of code words (IC_) and data words (DC_). */
+    word_t *words; /* The code words followed by the data words. */
+    object_symbol_t *entries; /* The entry symbols of the object. */
+    int entriesAmount;
+    object_symbol_t *externs; /* The uses of external symbols in the object. */
+    int externsAmount;
+    object_relocation_t *relocations; /* The relocation table, NULL if there is no .rel file. */
+    int relocationsAmount;
+} ObjectFile;
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Loads an assembled object, its .ob file and its .ent, .ext and .rel files (if there are).
+ * Uses no shared state, so a few objects can be loaded at the same time.
+ *
+ * @param   *file_name      The name of the object (without endings).
+ * @param   *loadError      Will hold the error that occurred while loading (if there is).
+ *
+ * @return  The loaded object, NULL if an error occurred.
+ */
+ObjectFile *loadObjectFile(const char *file_name, Error *loadError);
+
+/*
+ * Gets the total amount of words (code and data) in an object.
+ *
+ * @param   *objectFile     The object to get its size.
+ *
+ * @return  The total amount of words in the object.
+ */
+int getObjectWordsAmount(const ObjectFile *objectFile);
+
+/*
+ * Checks if an address of an object is in its code segment.
+ *
+ * @param   *objectFile     The object to check the address in.
+ * @param   address         The address to check (as the assembler assigned it).
+ *
+ * @return  TRUE if the address is in the code segment, otherwise FALSE.
+ */
+boolean isObjectCodeAddress(const ObjectFile *objectFile, int address);
+
+/*
+ * Gets the word of an object in a given address.
+ *
+ * @param   *objectFile     The object to get the word from.
+ * @param   address         The address of the word (as the assembler assigned it).
+ *
+ * @return  Pointer to the word, NULL if the address is not in the object.
+ */
+word_t *getObjectWord(ObjectFile *objectFile, int address);
+
+/*
+ * Deletes an object and frees all of its memory.
+ *
+ * @param   **pObjectFile   Pointer to the object to delete.
+ */
+void deleteObjectFile(ObjectFile **pObjectFile);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_OBJECTFILE_H */
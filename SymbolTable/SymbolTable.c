@@ -0,0 +1,332 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file has the functions of the SymbolTable data structure.
+ * The table holds one record for every symbol of a source file, with its address, section,
+ * and flags (defined, entry, extern), so every check of a symbol is a single lookup.
+ *
+ * The records are kept in an array (in the order the symbols were first seen), and an open
+ * addressing hash table (linear probing) maps a name to the index of its record.
+ */
+
+/* ---Include header files--- */
+#include <stddef.h>
+#include <string.h>
+#include "../new-data-types/boolean.h"
+#include "../general-enums/programFinals.h"
+#include "../general-enums/indexes.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "SymbolTable.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE SYMBOL_TABLE_MEMORY /* For the memory statistics. */
+#define MIN_CAPACITY 16
+#define EMPTY_SLOT (-1)
+#define NO_ENTRY_NUMBER (-1)
+/* ------------ */
+
+/* SymbolTable data type. */
+struct SymbolTable
+{
+    symbol_t *records;
+    int size;
+    int *slots; /* Indexes of records, EMPTY_SLOT if empty. */
+    int capacity; /* Capacity of the records and the slots, always a power of 2. */
+    int entriesAmount;
+};
+
+/* ---------------Prototypes--------------- */
+int findSymbolSlot(const SymbolTable *table, const char *name);
+symbol_t *getOrAddSymbol(SymbolTable *table, const char *name);
+void growSymbolTable(SymbolTable *table);
+/* ---------------------------------------- */
+
+/*
+ * Creates a new empty SymbolTable.
+ *
+ * @return  Pointer to the newly created SymbolTable.
+ */
+SymbolTable *createSymbolTable(void)
+{
+    SymbolTable *table = (SymbolTable *) allocate_space(sizeof(SymbolTable));
+    int i; /* Loop variable. */
+
+    table -> size = table -> entriesAmount = ZERO_COUNT;
+    table -> capacity = MIN_CAPACITY;
+    table -> records = (symbol_t *) allocate_space(MIN_CAPACITY * sizeof(symbol_t));
+    table -> slots = (int *) allocate_space(2 * MIN_CAPACITY * sizeof(int));
+    for (i = ZERO_INDEX; i < 2 * MIN_CAPACITY; i++)
+        table -> slots[i] = EMPTY_SLOT;
+
+    return table;
+}
+
+/*
+ * Finds the slot of a name in the table, or the empty slot where it should be added.
+ * There are twice as many slots as records, so the probing sequences stay short.
+ *
+ * @param   *table  The table to search in.
+ * @param   *name   The name to search for.
+ *
+ * @return  The index of the slot.
+ */
+int findSymbolSlot(const SymbolTable *table, const char *name)
+{
+    unsigned long mask = 2 * (unsigned long) table -> capacity - 1;
+    unsigned long slotIndex = hashString(name) & mask;
+
+    while (table -> slots[slotIndex] != EMPTY_SLOT &&
+           strcmp(table -> records[table -> slots[slotIndex]].name, name) != 0)
+        slotIndex = (slotIndex + 1) & mask;
+
+    return (int) slotIndex;
+}
+
+/*
+ * Doubles the capacity of the table.
+ *
+ * @param   *table  The table to grow.
+ */
+void growSymbolTable(SymbolTable *table)
+{
+    int i; /* Loop variable. */
+
+    table -> capacity *= 2;
+    table -> records = (symbol_t *) reallocate_space(table -> records,
+                                                     table -> capacity * sizeof(symbol_t));
+
+    (void) clear_ptr(table -> slots)
+    table -> slots = (int *) allocate_space(2 * table -> capacity * sizeof(int));
+    for (i = ZERO_INDEX; i < 2 * table -> capacity; i++)
+        table -> slots[i] = EMPTY_SLOT;
+
+    for (i = ZERO_INDEX; i < table -> size; i++) /* Add the records again. */
+        table -> slots[findSymbolSlot(table, table -> records[i].name)] = i;
+}
+
+/*
+ * Gets the record of a symbol, adds a new empty record if it is not in the table.
+ *
+ * @param   *table  The table of the symbols.
+ * @param   *name   The name of the symbol.
+ *
+ * @return  The record of the symbol.
+ */
+symbol_t *getOrAddSymbol(SymbolTable *table, const char *name)
+{
+    int slotIndex = findSymbolSlot(table, name);
+    symbol_t *symbol;
+
+    if (table -> slots[slotIndex] == EMPTY_SLOT) /* New symbol. */
+    {
+        if (table -> size == table -> capacity)
+        {
+            growSymbolTable(table);
+            slotIndex = findSymbolSlot(table, name);
+        }
+
+        symbol = &table -> records[table -> size];
+        symbol -> name = my_strdup(name);
+        symbol -> value = ZERO_NUMBER;
+        symbol -> section = NO_SECTION;
+        symbol -> flags = NO_SYMBOL_FLAGS;
+        symbol -> lineNumber = ZERO_NUMBER;
+        symbol -> entryNumber = NO_ENTRY_NUMBER;
+        table -> slots[slotIndex] = table -> size++;
+    }
+
+    return &table -> records[table -> slots[slotIndex]];
+}
+
+/*
+ * Finds a symbol in the table.
+ * The returned record is valid until the next symbol is added to the table.
+ *
+ * @param   *table  The table to search in.
+ * @param   *name   The name of the symbol.
+ *
+ * @return  The record of the symbol, or NULL if it is not in the table.
+ */
+const symbol_t *findSymbol(const SymbolTable *table, const char *name)
+{
+    int recordIndex = table -> slots[findSymbolSlot(table, name)];
+
+    return (recordIndex != EMPTY_SLOT)? &table -> records[recordIndex] : NULL;
+}
+
+/*
+ * Gets the flags of a symbol.
+ *
+ * @param   *table  The table to search in.
+ * @param   *name   The name of the symbol.
+ *
+ * @return  The flags of the symbol (NO_SYMBOL_FLAGS if it is not in the table).
+ */
+int getSymbolFlags(const SymbolTable *table, const char *name)
+{
+    const symbol_t *symbol = findSymbol(table, name);
+
+    return (symbol != NULL)? symbol -> flags : NO_SYMBOL_FLAGS;
+}
+
+/*
+ * Defines a symbol (a label of a line in the file), adds it to the table if needed.
+ *
+ * @param   *table      The table of the symbols.
+ * @param   *name       The name of the symbol (copied).
+ * @param   section     The section the label is in.
+ * @param   value       The address of the label (relative to the section).
+ * @param   lineNumber  The line of the definition.
+ */
+void defineSymbol(SymbolTable *table, const char *name, symbol_section_t section, int value,
+                  int lineNumber)
+{
+    symbol_t *symbol = getOrAddSymbol(table, name);
+
+    symbol -> flags |= SYMBOL_DEFINED;
+    symbol -> section = section;
+    symbol -> value = value;
+    symbol -> lineNumber = lineNumber;
+}
+
+/*
+ * Declares a symbol in a .entry or .extern guidance, adds it to the table if needed.
+ *
+ * @param   *table      The table of the symbols.
+ * @param   *name       The name of the symbol (copied).
+ * @param   flag        SYMBOL_ENTRY, SYMBOL_EXTERN or SYMBOL_IN_ERROR_LINE.
+ * @param   lineNumber  The line of the declaration.
+ */
+void declareSymbol(SymbolTable *table, const char *name, int flag, int lineNumber)
+{
+    symbol_t *symbol = getOrAddSymbol(table, name);
+
+    if (symbol -> flags == NO_SYMBOL_FLAGS) /* Not defined (yet), keep the declaration. */
+        symbol -> lineNumber = lineNumber;
+
+    if (flag == SYMBOL_ENTRY && (symbol -> flags & SYMBOL_ENTRY) == NO_SYMBOL_FLAGS)
+        symbol -> entryNumber = table -> entriesAmount++;
+
+    symbol -> flags |= flag;
+}
+
+/*
+ * Sets the address of a defined symbol.
+ *
+ * @param   *table  The table of the symbols.
+ * @param   *name   The name of the symbol.
+ * @param   value   The new address of the symbol (relative to its section).
+ */
+void setSymbolValue(SymbolTable *table, const char *name, int value)
+{
+    int recordIndex = table -> slots[findSymbolSlot(table, name)];
+
+    if (recordIndex != EMPTY_SLOT)
+        table -> records[recordIndex].value = value;
+}
+
+/*
+ * Moves all the symbols of the data section after the code section.
+ *
+ * @param   *table      The table of the symbols.
+ * @param   codeSize    The amount of words in the code section.
+ */
+void relocateDataSymbols(SymbolTable *table, int codeSize)
+{
+    int i; /* Loop variable. */
+
+    for (i = ZERO_INDEX; i < table -> size; i++)
+        if (table -> records[i].section == DATA_SECTION)
+            table -> records[i].value += codeSize;
+}
+
+/*
+ * Moves the symbols of the data section to new addresses, after words of the data were removed.
+ *
+ * @param   *table          The table of the symbols.
+ * @param   dataStart       The address of the first word of the data.
+ * @param   *newOffsets     The new offset (from dataStart) of every word of the data.
+ * @param   dataSize        The amount of words in the data (before the removal).
+ */
+void moveDataSymbols(SymbolTable *table, int dataStart, const int *newOffsets, int dataSize)
+{
+    int i, offset; /* Loop variable, and the offset of a symbol in the data. */
+
+    for (i = ZERO_INDEX; i < table -> size; i++)
+    {
+        offset = table -> records[i].value - dataStart;
+        if (table -> records[i].section == DATA_SECTION && offset >= ZERO_INDEX &&
+            offset < dataSize)
+            table -> records[i].value = dataStart + newOffsets[offset];
+    }
+}
+
+/*
+ * Gets the records of all the symbols, in the order the symbols were first seen.
+ * The records are valid until the next symbol is added to the table.
+ *
+ * @param   *table          The table of the symbols.
+ * @param   *symbolsAmount  Will hold the amount of the symbols.
+ *
+ * @return  The records of the symbols.
+ */
+const symbol_t *getSymbols(const SymbolTable *table, int *symbolsAmount)
+{
+    *symbolsAmount = table -> size;
+    return table -> records;
+}
+
+/*
+ * Gets the contents of the entries file: every .entry symbol and its address,
+ * in the order of their declarations.
+ *
+ * @param   *table  The table of the symbols.
+ *
+ * @return  The contents of the entries file (NULL if there are no entries).
+ */
+char *entrySymbolsToString(const SymbolTable *table)
+{
+    char *entriesStr = NULL; /* String to return. */
+    const symbol_t **entries;
+    int i; /* Loop variable. */
+
+    if (table -> entriesAmount > ZERO_COUNT)
+    {
+        /* Walk over the entry symbols, and put them in the order of their declarations. */
+        entries = (const symbol_t **) allocate_space(table -> entriesAmount *
+                                                     sizeof(symbol_t *));
+        for (i = ZERO_INDEX; i < table -> size; i++)
+            if ((table -> records[i].flags & SYMBOL_ENTRY) != NO_SYMBOL_FLAGS)
+                entries[table -> records[i].entryNumber] = &table -> records[i];
+
+        for (i = ZERO_INDEX; i < table -> entriesAmount; i++)
+            addToStringInFormat(&entriesStr, entries[i] -> name, entries[i] -> value);
+
+        (void) clear_ptr(entries)
+    }
+
+    return entriesStr;
+}
+
+/*
+ * Deletes the table and frees its memory.
+ *
+ * @param   **pTable    Pointer to the table to delete.
+ */
+void deleteSymbolTable(SymbolTable **pTable)
+{
+    int i; /* Loop variable. */
+
+    if (pTable != NULL && *pTable != NULL) /* Check if it is already deleted. */
+    {
+        for (i = ZERO_INDEX; i < (*pTable) -> size; i++)
+            {(void) clear_ptr((*pTable) -> records[i].name)}
+
+        (void) clear_ptr((*pTable) -> records)
+        (void) clear_ptr((*pTable) -> slots)
+        (void) clear_ptr(*pTable)
+    }
+}
@@ -0,0 +1,146 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the SymbolTable.c file.
+ */
+
+#ifndef MMN_14_SYMBOLTABLE_H
+#define MMN_14_SYMBOLTABLE_H
+
+#include "../new-data-types/boolean.h"
+
+/* SymbolTable data type - table of all the symbols (labels) of a source file. */
+typedef struct SymbolTable SymbolTable;
+
+/* Flags of a symbol (a symbol can have a few of them). */
+#define SYMBOL_DEFINED 0x1 /* Defined as a label in the file. */
+#define SYMBOL_ENTRY 0x2 /* Declared in a .entry guidance. */
+#define SYMBOL_EXTERN 0x4 /* Declared in a .extern guidance. */
+#define SYMBOL_IN_ERROR_LINE 0x8 /* The label of a line with an error in itself (not defined). */
+#define NO_SYMBOL_FLAGS 0x0
+
+/* The section of a defined symbol. */
+typedef enum {NO_SECTION, CODE_SECTION, DATA_SECTION} symbol_section_t;
+
+/* A symbol record. */
+typedef struct
+{
+    char *name;
+    int value; /* The address of the symbol (if it is defined). */
+    symbol_section_t section; /* NO_SECTION if the symbol is not defined. */
+    int flags;
+    int lineNumber; /* The line of the definition (or of the first declaration if not defined). */
+    int entryNumber; /* The place of the symbol between the .entry symbols. */
+} symbol_t;
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Creates a new empty SymbolTable.
+ *
+ * @return  Pointer to the newly created SymbolTable.
+ */
+SymbolTable *createSymbolTable(void);
+
+/*
+ * Finds a symbol in the table.
+ * The returned record is valid until the next symbol is added to the table.
+ *
+ * @param   *table  The table to search in.
+ * @param   *name   The name of the symbol.
+ *
+ * @return  The record of the symbol, or NULL if it is not in the table.
+ */
+const symbol_t *findSymbol(const SymbolTable *table, const char *name);
+
+/*
+ * Gets the flags of a symbol.
+ *
+ * @param   *table  The table to search in.
+ * @param   *name   The name of the symbol.
+ *
+ * @return  The flags of the symbol (NO_SYMBOL_FLAGS if it is not in the table).
+ */
+int getSymbolFlags(const SymbolTable *table, const char *name);
+
+/*
+ * Defines a symbol (a label of a line in the file), adds it to the table if needed.
+ *
+ * @param   *table      The table of the symbols.
+ * @param   *name       The name of the symbol (copied).
+ * @param   section     The section the label is in.
+ * @param   value       The address of the label (relative to the section).
+ * @param   lineNumber  The line of the definition.
+ */
+void defineSymbol(SymbolTable *table, const char *name, symbol_section_t section, int value,
+                  int lineNumber);
+
+/*
+ * Declares a symbol in a .entry or .extern guidance, adds it to the table if needed.
+ *
+ * @param   *table      The table of the symbols.
+ * @param   *name       The name of the symbol (copied).
+ * @param   flag        SYMBOL_ENTRY, SYMBOL_EXTERN or SYMBOL_IN_ERROR_LINE.
+ * @param   lineNumber  The line of the declaration.
+ */
+void declareSymbol(SymbolTable *table, const char *name, int flag, int lineNumber);
+
+/*
+ * Sets the address of a defined symbol.
+ *
+ * @param   *table  The table of the symbols.
+ * @param   *name   The name of the symbol.
+ * @param   value   The new address of the symbol (relative to its section).
+ */
+void setSymbolValue(SymbolTable *table, const char *name, int value);
+
+/*
+ * Moves all the symbols of the data section after the code section.
+ *
+ * @param   *table      The table of the symbols.
+ * @param   codeSize    The amount of words in the code section.
+ */
+void relocateDataSymbols(SymbolTable *table, int codeSize);
+
+/*
+ * Moves the symbols of the data section to new addresses, after words of the data were removed.
+ *
+ * @param   *table          The table of the symbols.
+ * @param   dataStart       The address of the first word of the data.
+ * @param   *newOffsets     The new offset (from dataStart) of every word of the data.
+ * @param   dataSize        The amount of words in the data (before the removal).
+ */
+void moveDataSymbols(SymbolTable *table, int dataStart, const int *newOffsets, int dataSize);
+
+/*
+ * Gets the records of all the symbols, in the order the symbols were first seen.
+ * The records are valid until the next symbol is added to the table.
+ *
+ * @param   *table          The table of the symbols.
+ * @param   *symbolsAmount  Will hold the amount of the symbols.
+ *
+ * @return  The records of the symbols.
+ */
+const symbol_t *getSymbols(const SymbolTable *table, int *symbolsAmount);
+
+/*
+ * Gets the contents of the entries file: every .entry symbol and its address,
+ * in the order of their declarations.
+ *
+ * @param   *table  The table of the symbols.
+ *
+ * @return  The contents of the entries file (NULL if there are no entries).
+ */
+char *entrySymbolsToString(const SymbolTable *table);
+
+/*
+ * Deletes the table and frees its memory.
+ *
+ * @param   **pTable    Pointer to the table to delete.
+ */
+void deleteSymbolTable(SymbolTable **pTable);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_SYMBOLTABLE_H */
@@ -27,27 +27,190 @@
 
 /* ---Include header files--- */
 #include <stdio.h>
+#include <stdlib.h>
+#include "new-data-types/boolean.h"
+#include "new-data-types/assembler_options.h"
+#include "new-data-types/process_result.h"
+#include "new-data-types/error_count.h"
+#include "util/memoryUtil.h"
+#include "util/ArenaAllocator.h"
+#include "util/stringsUtil.h"
+#include "util/SpscQueue.h"
+#include "util/traceUtil.h"
+#include "FileHandling/fileHelpMethods.h"
+#include "FileHandling/FilePrefetcher.h"
+#include "NameTable/NameTable.h"
+#include "SymbolTable/SymbolTable.h"
+#include "assembler_ast/assembler_ast.h"
+#include "errors/error_types/error_types.h"
+#include "FileHandling/OutputArchive.h"
+#include "transitions/cross_reference.h"
+#include "transitions/macro_template.h"
+#include "transitions/pre-processor.h"
 #include "assembler_algorithm.h"
 /* -------------------------- */
 
 /* ---Finals--- */
-#define NO_GIVEN_FILES 1
-#define FIRST_FILE_NAME 1
+#define MEMORY_MODULE ASSEMBLER_MEMORY /* For the memory statistics. */
+#define FIRST_ARGUMENT 1
 #define SUCCESS_CODE 0
+#define OPTIMIZE_OPTION "-O"
+#define LOW_MEMORY_OPTION "-M"
+#define POOL_LITERALS_OPTION "-P"
+#define DEAD_CODE_OPTION "-D"
+#define CONTROL_FLOW_OPTION "-C"
+#define PIPELINE_OPTION "-T"
+#define READ_AHEAD_OPTION "-R"
+#define MEMORY_REPORT_OPTION "-A"
+#define TRACE_OPTION "-X"
+#define CHECK_OPTION "--check"
+#define ALL_ERRORS_OPTION "--all-errors"
+#define XREF_OPTION "--xref"
+#define MAX_ERRORS_OPTION "--max-errors" /* Followed by the cap. */
+#define ARCHIVE_OPTION "--archive" /* Followed by the name of the archive. */
+#define ARENA_OPTION "--arena"
+#define NO_ERRORS_CAP 0
+#define SOURCE_FILE_TYPE ".as"
+#define READ_AHEAD_FILES 4 /* The most source files that are read ahead of the assembled one. */
+#define MILLISECONDS_IN_SECOND 1000
+#define TRACE_FILE_NAME "assembler"
+#define TRACE_FILE_TYPE ".trace.json"
+#define WRITE_MODE "w"
 /* ------------ */
 
+/* ---------------Prototypes--------------- */
+boolean readOption(const char *argument, assembler_options_t *options);
+/* ---------------------------------------- */
+
 /*
  * Driver code.
  */
 int main(int argc, char *argv[])
 {
+    assembler_options_t options;
+    char **fileNames = argv; /* Kept at the start of the arguments, nothing is allocated yet. */
+    allocator_t *arena = NULL; /* The allocator of the whole run (with --arena). */
+    FilePrefetcher *prefetcher = NULL; /* Reads the next source files (with read-ahead). */
+    char *sourceText = NULL; /* The contents of the current source file (with read-ahead). */
+    double waitSeconds; /* The time spent waiting for the current source file. */
+    FILE *traceFile;
+    int filesAmount = 0;
     int i; /* Loop variable */
 
-    if (argc == NO_GIVEN_FILES) /* Print a message if the arguments are insufficient. */
+    options.isOptimize = options.isLowMemory = options.isPoolLiterals = FALSE;
+    options.isEliminateDeadCode = options.isControlFlowReport = options.isPipelined = FALSE;
+    options.isReadAhead = options.isMemoryReport = options.isTrace = options.isCheckOnly = FALSE;
+    options.isAllErrors = options.isCrossReference = options.isArena = FALSE;
+    options.maxErrors = NO_ERRORS_CAP;
+    options.archiveName = NULL; /* Separate output files. */
+    for (i = FIRST_ARGUMENT; i < argc; i++) /* Read the options. */
+    {
+        if (sameStrings(argv[i], MAX_ERRORS_OPTION) == TRUE && i + 1 < argc)
+            options.maxErrors = atoi(argv[++i]);
+        else if (sameStrings(argv[i], ARCHIVE_OPTION) == TRUE && i + 1 < argc)
+            options.archiveName = argv[++i];
+        else if (readOption(argv[i], &options) == FALSE)
+            fileNames[filesAmount++] = argv[i];
+    }
+
+    /* Set before anything is allocated, the memory is kept between the files. */
+    if (options.isArena == TRUE)
+        setAllocator(arena = createArenaAllocator());
+
+    if (options.isTrace == TRUE)
+        startTracing();
+
+    if (filesAmount == 0) /* Print a message if the arguments are insufficient. */
         puts("\nPlease select the assembly source files to assemble.");
+    else if (options.archiveName != NULL && openOutputArchive(options.archiveName) == FALSE)
+        filesAmount = 0; /* The archive could not be created, no file is assembled. */
+    else if (options.isReadAhead == TRUE)
+        prefetcher = startFilePrefetcher(fileNames, filesAmount, SOURCE_FILE_TYPE,
+                                         READ_AHEAD_FILES);
+
+    for (i = 0; i < filesAmount; i++) /* Assemble all the files. */
+    {
+        if (prefetcher != NULL) /* The file is read while the files before it are assembled. */
+        {
+            sourceText = takePrefetchedFile(prefetcher, &waitSeconds);
+            printf("\nWaited %.3f milliseconds to read the source file \"%s\"\n",
+                   waitSeconds * MILLISECONDS_IN_SECOND, fileNames[i]);
+        }
+
+        assemble(fileNames[i], sourceText, &options);
+    }
+
+    deleteFilePrefetcher(&prefetcher);
+    clearIncludeCache(); /* The included files are shared by all the files. */
+
+    if (isOutputArchiveOpen() == TRUE) /* All the output files were written to it. */
+    {
+        closeOutputArchive();
+        printf("\nWrote the output files to the archive \"%s%s\"\n", options.archiveName,
+               ARCHIVE_END);
+    }
+
+    if (options.isTrace == TRUE) /* All the threads are done, write their spans. */
+    {
+        if ((traceFile = openFile(TRACE_FILE_NAME, TRACE_FILE_TYPE, WRITE_MODE)) != NULL)
+        {
+            writeTrace(traceFile);
+            closeFile(&traceFile);
+            printf("\nWrote the trace of the assembler to \"%s%s\"\n", TRACE_FILE_NAME,
+                   TRACE_FILE_TYPE);
+        }
+        stopTracing();
+    }
 
-    for (i = FIRST_FILE_NAME; i < argc; i++) /* Assemble all the files. */
-        assemble(argv[i]);
+    if (arena != NULL) /* Everything was freed, return the memory of the arena. */
+    {
+        setAllocator(NULL);
+        deleteArenaAllocator(&arena);
+    }
 
     return SUCCESS_CODE;
 }
+
+/*
+ * Reads an option of the assembler from a command line argument.
+ *
+ * @param   *argument   The command line argument.
+ * @param   *options    The options of the assembler, the read option is set in it.
+ *
+ * @return  TRUE if the argument is an option, FALSE if it is a file name.
+ */
+boolean readOption(const char *argument, assembler_options_t *options)
+{
+    boolean isOption = TRUE; /* Value to return, assume the argument is an option. */
+
+    if (sameStrings(argument, OPTIMIZE_OPTION) == TRUE)
+        options -> isOptimize = TRUE;
+    else if (sameStrings(argument, LOW_MEMORY_OPTION) == TRUE)
+        options -> isLowMemory = TRUE;
+    else if (sameStrings(argument, POOL_LITERALS_OPTION) == TRUE)
+        options -> isPoolLiterals = TRUE;
+    else if (sameStrings(argument, DEAD_CODE_OPTION) == TRUE)
+        options -> isEliminateDeadCode = TRUE;
+    else if (sameStrings(argument, CONTROL_FLOW_OPTION) == TRUE)
+        options -> isControlFlowReport = TRUE;
+    else if (sameStrings(argument, PIPELINE_OPTION) == TRUE)
+        options -> isPipelined = TRUE;
+    else if (sameStrings(argument, READ_AHEAD_OPTION) == TRUE)
+        options -> isReadAhead = TRUE;
+    else if (sameStrings(argument, MEMORY_REPORT_OPTION) == TRUE)
+        options -> isMemoryReport = TRUE;
+    else if (sameStrings(argument, TRACE_OPTION) == TRUE)
+        options -> isTrace = TRUE;
+    else if (sameStrings(argument, CHECK_OPTION) == TRUE)
+        options -> isCheckOnly = TRUE;
+    else if (sameStrings(argument, ALL_ERRORS_OPTION) == TRUE)
+        options -> isAllErrors = TRUE;
+    else if (sameStrings(argument, XREF_OPTION) == TRUE)
+        options -> isCrossReference = TRUE;
+    else if (sameStrings(argument, ARENA_OPTION) == TRUE)
+        options -> isArena = TRUE;
+    else
+        isOption = FALSE;
+
+    return isOption;
+}
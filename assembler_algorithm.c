@@ -22,16 +22,36 @@
 /* ---Include header files--- */
 #include <stdio.h>
 #include "new-data-types/process_result.h"
+#include "new-data-types/assembler_options.h"
+#include "new-data-types/error_count.h"
+#include "general-enums/programFinals.h"
 #include "NameTable/NameTable.h"
+#include "SymbolTable/SymbolTable.h"
 #include "assembler_ast/assembler_ast.h"
+#include "errors/error_types/error_types.h"
+#include "errors/system_errors.h"
+#include "errors/assembler_errors.h"
+#include "util/memoryUtil.h"
+#include "util/traceUtil.h"
+#include "FileHandling/fileHelpMethods.h"
+#include "FileHandling/writeToFile.h"
+#include "util/SpscQueue.h"
+#include "transitions/cross_reference.h"
+#include "transitions/macro_template.h"
 #include "transitions/pre-processor.h"
+#include "transitions/assembler_pipeline.h"
 #include "transitions/first-transition.h"
+#include "transitions/peephole_optimizer.h"
 #include "transitions/second_transition.h"
+#include "transitions/control_flow_report.h"
 /* -------------------------- */
 
 /* ---Finals--- */
+#define MEMORY_MODULE ASSEMBLER_MEMORY /* For the memory statistics. */
 #define COLOR_GREEN "\x1B[32m"
 #define COLOR_RESET "\x1B[0m"
+#define AFTER_MACRO ".am" /* File end of after pre-processor type file */
+#define READ_MODE "r"
 /* ------------ */
 
 /* ---Macros--- */
@@ -40,12 +60,17 @@
 /* ------------ */
 
 /* Assembler stage */
-typedef enum {ASSEMBLER, PRE_PROCESSOR, FIRST_TRANSITION, SECOND_TRANSITION, FINISH_FAILURE,
-              FINISH_SUCCESS} stage_t;
+typedef enum {ASSEMBLER, PRE_PROCESSOR, FIRST_TRANSITION, OPTIMIZATION, SECOND_TRANSITION,
+              FINISH_FAILURE, FINISH_SUCCESS, CHECK_FAILURE, CHECK_SUCCESS} stage_t;
 
 /* ---------------Prototypes--------------- */
 void printAssemblerState(const char *file_name, stage_t stageNumber);
-void clearDataStructures(NameTable *labelsMap[], ast_list_t **pAstList);
+process_result pipelineFirstStages(const char *file_name, SymbolTable **symbols,
+                                   ast_list_t **astList, const assembler_options_t *options,
+                                   AssemblerPipeline *pipeline, MacroCalls *calls,
+                                   error_count_t *errors);
+void clearDataStructures(SymbolTable **pSymbols, ast_list_t **pAstList);
+void printMemoryReport(void);
 
 /*
 ---!!! DEBUGGING !!! IGNORE---
@@ -58,52 +83,195 @@ void printData(ast_list_t *astList, NameTable *labelsMap[]);
  * Initiates the assembly process for the given source file.
  *
  * @param   *file_name   The name of the source file to be assembled.
+ * @param   *sourceText  The contents of the source file if they were read already (freed by
+ *                       the assembler), or NULL to read the file.
+ * @param   *options     The options given to the assembler.
  */
-void assemble(const char *file_name)
+void assemble(const char *file_name, char *sourceText, const assembler_options_t *options)
 {
     process_result processResult; /* Will hold every stage process result. */
-    NameTable *labelsMap[TYPES_OF_LABELS] = {NULL}; /* Will hold all the labels. */
+    SymbolTable *symbols = NULL; /* Will hold all the labels. */
     ast_list_t *astList = NULL; /* Will hold the diagnosed lines from the first transition. */
+    AssemblerPipeline *pipeline = NULL; /* Runs the first stages on their own threads. */
+    char *amText = NULL; /* The .am contents, when only checking or writing to an archive. */
+    char **pAmText = (options -> isCheckOnly == TRUE || options -> archiveName != NULL)?
+                     &amText : NULL;
+    CrossReference *xref = NULL; /* The definitions and the uses of the names (with --xref). */
+    MacroCalls *calls = createMacroCalls(); /* To report the calls of the lines with errors. */
+    error_count_t errors; /* The lines with errors of the file, in all of its stages. */
+    trace_span_t span;
 
+    errors.errorsAmount = ZERO_COUNT;
+    errors.maxErrors = options -> maxErrors;
+
+    resetMemoryStatistics(); /* The memory report is of this file only. */
+
+    beginTraceSpan(&span, "assemble", file_name);
     printAssemblerState(file_name, ASSEMBLER); /* Start assembler. */
 
+    if (options -> isCrossReference == TRUE && options -> isCheckOnly == FALSE)
+        xref = createCrossReference();
+
     printAssemblerState(file_name, PRE_PROCESSOR); /* Start pre-process. */
-    processResult = pre_process(file_name);
+    if (options -> isPipelined == TRUE && options -> isCheckOnly == FALSE)
+        pipeline = startAssemblerPipeline(file_name, sourceText, xref, calls,
+                                          options -> maxErrors);
 
-    if (processResult == SUCCESS)
+    if (pipeline != NULL)
+        processResult = pipelineFirstStages(file_name, &symbols, &astList, options, pipeline,
+                                            calls, &errors);
+    else /* One stage after the other (also if the threads could not be started). */
     {
-        printAssemblerState(file_name, FIRST_TRANSITION); /* Start first transition. */
-        processResult = first_transition(file_name, labelsMap, &astList);
+        processResult = pre_process(file_name, sourceText, NULL, pAmText, xref, calls,
+                                    &errors);
+        /* With an archive, the .am file is written to it and read from the memory. */
+        if (options -> archiveName != NULL && options -> isCheckOnly == FALSE)
+            writeToFile(file_name, AFTER_MACRO, amText);
+
+        if (processResult == SUCCESS)
+        {
+            printAssemblerState(file_name, FIRST_TRANSITION); /* Start first transition. */
+            processResult = first_transition(file_name, &symbols, &astList, options, pAmText,
+                                             calls, &errors);
+        }
+        (void) clear_ptr(amText) /* If the first transition did not take it. */
+    }
+
+    /* Optimizing and reporting have no use when only checking the file. */
+    if (processResult == SUCCESS && options -> isOptimize == TRUE &&
+        options -> isCheckOnly == FALSE)
+    {
+        printAssemblerState(file_name, OPTIMIZATION); /* Start optimization. */
+        printf("Peephole optimization saved %d words\n", peephole_optimize(astList, symbols));
     }
 
     if (processResult == SUCCESS)
     {
         printAssemblerState(file_name, SECOND_TRANSITION); /* Start second transition. */
-        processResult = second_transition(file_name, labelsMap, astList);
+        processResult = second_transition(file_name, symbols, astList, options -> isCheckOnly,
+                                          xref, &errors);
     }
+    /* Report the labels errors of the built lines too (not after the cap, lines are unread). */
+    else if (options -> isAllErrors == TRUE && symbols != NULL &&
+             isErrorsCapReached(file_name, &errors, NULL) == FALSE)
+    {
+        printAssemblerState(file_name, SECOND_TRANSITION); /* Check only, the file failed. */
+        (void) second_transition(file_name, symbols, astList, TRUE, NULL, &errors);
+    }
+
+    if (processResult == SUCCESS && options -> isControlFlowReport == TRUE &&
+        options -> isCheckOnly == FALSE)
+        createControlFlowReport(file_name, astList, symbols);
 
-    clearDataStructures(labelsMap, &astList);
+    if (processResult == SUCCESS && xref != NULL)
+        createCrossReferenceFile(file_name, xref, symbols);
+    deleteCrossReference(&xref);
+    deleteMacroCalls(&calls);
 
-    if (processResult == SUCCESS) /* Finished assembling. */
+    clearDataStructures(&symbols, &astList);
+
+    if (options -> isMemoryReport == TRUE)
+        printMemoryReport();
+
+    if (options -> isCheckOnly == TRUE) /* Finished checking, nothing was assembled. */
+        printAssemblerState(file_name, (processResult == SUCCESS)? CHECK_SUCCESS : CHECK_FAILURE);
+    else if (processResult == SUCCESS) /* Finished assembling. */
         printAssemblerState(file_name, FINISH_SUCCESS);
     else
         printAssemblerState(file_name, FINISH_FAILURE);
+
+    endTraceSpan(&span);
+}
+
+/*
+ * Runs the pre-process and the first transition of a file on a pipeline: the lines are
+ * handled by the first transition while the file is still pre-processed.
+ * The diagnoses of the first transition are kept until the pre-process is done, so they are
+ * printed after the pre-process ones (and not at all if the pre-process fails), the same as
+ * when the stages run one after the other.
+ *
+ * @param   *file_name   The name of the source file to be assembled.
+ * @param   **symbols    Will hold the table of the symbols (labels) of the file.
+ * @param   **astList    Will hold the list of abstract syntax trees of the file.
+ * @param   *options     The options given to the assembler.
+ * @param   *pipeline    The started pipeline of the file, deleted.
+ * @param   *calls       The calls of the macros with parameters, recorded by the pipeline.
+ * @param   *errors      The count of the lines with errors of the file.
+ *
+ * @return  The result of the pre-process and the first transition.
+ */
+process_result pipelineFirstStages(const char *file_name, SymbolTable **symbols,
+                                   ast_list_t **astList, const assembler_options_t *options,
+                                   AssemblerPipeline *pipeline, MacroCalls *calls,
+                                   error_count_t *errors)
+{
+    process_result processResult, linesRes;
+    FILE *diagnoses = tmpfile(); /* The diagnoses of the first transition lines. */
+    FILE *amFile = NULL;
+    trace_span_t span; /* The first transition, the pre-process is traced on its own thread. */
+
+    handle_temp_file_errors(diagnoses);
+    beginTraceSpan(&span, "first_transition", file_name);
+
+    linesRes = first_transition_pipelined(file_name, symbols, astList, options, pipeline,
+                                          diagnoses, calls, errors);
+    /* The pre-process result, its lines with errors are added to the ones of the file. */
+    processResult = finishAssemblerPipeline(&pipeline, errors);
+
+    if (processResult == SUCCESS)
+    {
+        printAssemblerState(file_name, FIRST_TRANSITION); /* Start first transition. */
+        copyFileContents(diagnoses, stderr);
+
+        /* The lines were streamed, but the .am file should be there as if they were read. */
+        if (options -> archiveName == NULL &&
+            (amFile = openFile(file_name, AFTER_MACRO, READ_MODE)) == NULL)
+            linesRes = FAILURE;
+        closeFile(&amFile);
+
+        processResult = finish_first_transition(file_name, *symbols, *astList, linesRes,
+                                                options);
+    }
+    else
+        clearDataStructures(symbols, astList); /* The lines of the file were not all read. */
+
+    endTraceSpan(&span);
+    closeFile(&diagnoses);
+
+    return processResult;
 }
 
 /*
  * Clears the data structures used during the assembly process.
  *
- * @param   *labelsMap[]    An array of pointers to symbol tables for label management.
+ * @param   **pSymbols      Pointer to the table of the symbols (labels).
  * @param   **pAstList      Pointer to the list of abstract syntax trees.
  */
-void clearDataStructures(NameTable *labelsMap[], ast_list_t **pAstList)
+void clearDataStructures(SymbolTable **pSymbols, ast_list_t **pAstList)
 {
-    deleteTable(&(labelsMap[NORMAL]));
-    deleteTable(&(labelsMap[ENTRY]));
-    deleteTable(&(labelsMap[EXTERN]));
+    deleteSymbolTable(pSymbols);
     (void) deleteAstList(pAstList);
 }
 
+/*
+ * Prints the memory that every module used since the assembly of the file started
+ * (only the modules that used memory).
+ */
+void printMemoryReport(void)
+{
+    memory_statistics_t statistics;
+    int module; /* Loop variable. */
+
+    puts("\nMemory of the modules (allocations, allocated bytes, frees):");
+    for (module = 0; module < MEMORY_MODULES_AMOUNT; module++)
+    {
+        getMemoryStatistics((memory_module_t) module, &statistics);
+        if (statistics.allocations > 0 || statistics.frees > 0)
+            printf("  %-13s %10lu %12lu %10lu\n", getMemoryModuleName((memory_module_t) module),
+                   statistics.allocations, statistics.allocatedBytes, statistics.frees);
+    }
+}
+
 /*
  * Prints the state of the assembler at a specific stage of the assembly process.
  *
@@ -123,6 +291,9 @@ void printAssemblerState(const char *file_name, stage_t stageNumber)
         case FIRST_TRANSITION:
             INFO_MSG("Starting first transition stage", file_name);
             break;
+        case OPTIMIZATION:
+            INFO_MSG("Starting optimization stage", file_name);
+            break;
         case SECOND_TRANSITION:
             INFO_MSG("Starting second transition stage", file_name);
             break;
@@ -132,6 +303,12 @@ void printAssemblerState(const char *file_name, stage_t stageNumber)
         case FINISH_SUCCESS:
             INFO_MSG("Successfully assembled source file!", file_name);
             break;
+        case CHECK_FAILURE:
+            INFO_MSG("Source file checked, errors were found.", file_name);
+            break;
+        case CHECK_SUCCESS:
+            INFO_MSG("Source file checked, no errors.", file_name);
+            break;
     }
 }
 
@@ -8,14 +8,19 @@
 #ifndef MMN_14_ASSEMBLER_ALGORITHM_H
 #define MMN_14_ASSEMBLER_ALGORITHM_H
 
+#include "new-data-types/assembler_options.h"
+
 /* ---------------Prototypes--------------- */
 
 /*
  * Initiates the assembly process for the given source file.
  *
  * @param   *file_name   The name of the source file to be assembled.
+ * @param   *sourceText  The contents of the source file if they were read already (freed by
+ *                       the assembler), or NULL to read the file.
+ * @param   *options     The options given to the assembler.
  */
-void assemble(const char *file_name);
+void assemble(const char *file_name, char *sourceText, const assembler_options_t *options);
 
 /* ---------------------------------------- */
 
@@ -9,21 +9,27 @@
  */
 
 /* ---Include header files--- */
+#include <stdio.h>
 #include <stddef.h>
+#include <string.h>
 #include "../new-data-types/boolean.h"
 #include "../encoding/encoding-finals/encoding_finals.h"
 #include "../general-enums/assemblerFinals.h"
+#include "../general-enums/programFinals.h"
 #include "../util/memoryUtil.h"
 #include "../util/stringsUtil.h"
+#include "../errors/system_errors.h"
 /* -------------------------- */
 
 /* ---Finals--- */
+#define MEMORY_MODULE AST_MEMORY /* For the memory statistics. */
 #define ZERO_INITIALIZE 0
 #define SUCCESS_CODE 0
 #define INVALID_GIVEN_PARAM_CODE (-1)
 #define UNKNOWN_NUMBER 0
 #define ZERO_ARGUMENTS 0
 #define FIRST_ARG 1
+#define ONE_ITEM 1
 /* ------------ */
 
 /* ---Macros--- */
@@ -67,6 +73,7 @@ typedef struct
 {
     char *label;
     sentence_node_t *sentenceNode;
+    int lineNumber; /* The number of the line in the source file (after the pre-processor). */
 } ast_t; /* ast (abstract syntax tree) type. */
 
 /* This is a data structure with a purpose to save a list of asts. */
@@ -76,12 +83,17 @@ typedef struct ast_list_node_t
     struct ast_list_node_t *next;
 } ast_list_node_t; /* ast list type. */
 
-/* List of abstract syntax trees. */
+/* List of abstract syntax trees.
+ * A spilled list keeps its ASTs in a temporary file instead of the memory, one record for
+ * every AST, and only one AST (the last one that was read) is in the memory at a time. */
 typedef struct
 {
     ast_list_node_t *head;
     ast_list_node_t *tail;
     int counters[COUNTERS_AMOUNT];
+    FILE *spillFile; /* The temporary file of the ASTs, NULL if the list is in the memory. */
+    ast_list_node_t *cursor; /* The next node to read from the list (in the memory). */
+    ast_t *readAst; /* The last AST that was read from the temporary file. */
 } ast_list_t;
 
 /* -------------------------------------------------- */
@@ -90,6 +102,12 @@ typedef struct
 addressing_method_t findAddressingMethod(ast_t *ast, data_type_t dataType);
 arg_node_t *gotoLastArgNode(ast_t *ast);
 boolean isLabel(ast_t *ast);
+unsigned short getArgAmount(ast_t *ast);
+int deleteAst(ast_t **pAst);
+void writeAstRecord(FILE *spillFile, ast_t *ast);
+ast_t *readAstRecord(FILE *spillFile);
+void writeRecordString(FILE *spillFile, const char *string);
+char *readRecordString(FILE *spillFile);
 /* ---------------------------------------- */
 
 /*
@@ -106,6 +124,27 @@ ast_list_t *createAstList(void )
     newAstList -> tail = NULL;
     newAstList -> counters[IC_] = ZERO_INITIALIZE;
     newAstList -> counters[DC_] = ZERO_INITIALIZE;
+    newAstList -> spillFile = NULL;
+    newAstList -> cursor = NULL;
+    newAstList -> readAst = NULL;
+
+    return newAstList;
+}
+
+/*
+ * Creates an empty spilled AST list.
+ * The ASTs added to a spilled list are written to a temporary file and deleted from the
+ * memory, so the memory used by the list does not grow with the size of the source file.
+ * The ASTs can be read back only by readNextAstFromList().
+ *
+ * @return  ast_list_t* A pointer to the newly created ast list.
+ */
+ast_list_t *createSpilledAstList(void )
+{
+    ast_list_t *newAstList = createAstList();
+
+    newAstList -> spillFile = tmpfile(); /* Removed automatically when it is closed. */
+    handle_temp_file_errors(newAstList -> spillFile);
 
     return newAstList;
 }
@@ -137,6 +176,7 @@ ast_t *creatAst(void )
     ast_t *newAst = (ast_t *) allocate_space(sizeof(ast_t)); /* Creating the ast. */
     newAst -> label = NULL; /* Resetting the label attribute to NULL. */
     newAst -> sentenceNode = NULL; /* Resetting the 'sentenceNode' attribute. */
+    newAst -> lineNumber = ZERO_INITIALIZE; /* Resetting the line number. */
     return newAst;
 }
 
@@ -207,6 +247,7 @@ arg_node_t *createArgumentNode(data_t *argData)
 
 /*
  * Adds an AST (Abstract Syntax Tree) to the AST list.
+ * If the list is spilled, the AST is written to the temporary file and deleted.
  *
  * @param   *astList Pointer to the AST list.
  * @param   **ast Pointer to the AST to add to the list.
@@ -217,7 +258,14 @@ int addAstToList(ast_list_t *astList, ast_t **ast)
 {
     int returnCode = INVALID_GIVEN_PARAM_CODE; /* Code to return, assume error. */
 
-    if (astList != NULL && ast != NULL && *ast != NULL) /* If the parameters are valid. */
+    if (astList != NULL && ast != NULL && *ast != NULL && astList -> spillFile != NULL)
+    {
+        writeAstRecord(astList -> spillFile, *ast);
+        (void) deleteAst(ast);
+        returnCode = SUCCESS_CODE; /* New AST written successfully to the file. */
+    }
+
+    else if (astList != NULL && ast != NULL && *ast != NULL) /* If the parameters are valid. */
     {
         ast_list_node_t *newAstListNode = createAstListNode(ast); /* Create a node for the ast. */
         if (astList -> head == NULL) /* If the list is empty. */
@@ -247,6 +295,29 @@ int *getCounterPointer(ast_list_t *astList, int counter)
     return astList -> counters + counter;
 }
 
+/*
+ * Sets the number of the line the AST represents.
+ *
+ * @param   *ast        Pointer to the AST.
+ * @param   lineNumber  The number of the line in the source file.
+ */
+void setAstLineNumber(ast_t *ast, int lineNumber)
+{
+    ast -> lineNumber = lineNumber;
+}
+
+/*
+ * Gets the number of the line the AST represents.
+ *
+ * @param   *ast    Pointer to the AST.
+ *
+ * @return  The number of the line in the source file.
+ */
+int getAstLineNumber(ast_t *ast)
+{
+    return ast -> lineNumber;
+}
+
 /*
  * Adds a label name to the AST.
  *
@@ -335,6 +406,181 @@ ast_t *getAst(ast_list_node_t *astListNode)
     return astListNode -> ast;
 }
 
+/*
+ * Goes back to the start of the AST list, so the next read will be of the first AST.
+ *
+ * @param   *astList    Pointer to the AST list.
+ */
+void rewindAstList(ast_list_t *astList)
+{
+    astList -> cursor = astList -> head;
+    (void) deleteAst(&astList -> readAst);
+
+    if (astList -> spillFile != NULL)
+        rewind(astList -> spillFile);
+}
+
+/*
+ * Reads the next AST from the AST list (the first one after rewindAstList()).
+ * Works on lists in the memory and on spilled lists.
+ * The AST belongs to the list. If the list is spilled, the AST is valid only until
+ * the next read.
+ *
+ * @param   *astList    Pointer to the AST list.
+ *
+ * @return  The next AST in the list, or NULL if there are no more ASTs.
+ */
+ast_t *readNextAstFromList(ast_list_t *astList)
+{
+    ast_t *nextAst = NULL; /* AST to return. */
+
+    if (astList -> spillFile != NULL)
+    {
+        (void) deleteAst(&astList -> readAst); /* Only one AST is kept in the memory. */
+        nextAst = astList -> readAst = readAstRecord(astList -> spillFile);
+    }
+
+    else if (astList -> cursor != NULL)
+    {
+        nextAst = astList -> cursor -> ast;
+        astList -> cursor = astList -> cursor -> next;
+    }
+
+    return nextAst;
+}
+
+/*
+ * Writes a record of an AST to the temporary file of a spilled list.
+ * The record is the line number, the sentence, the label and the arguments.
+ * The addressing methods are not written, they are found again from the data types.
+ *
+ * @param   *spillFile  The temporary file.
+ * @param   *ast        The AST to write.
+ */
+void writeAstRecord(FILE *spillFile, ast_t *ast)
+{
+    unsigned char sentenceType = (unsigned char) ast -> sentenceNode -> sentence.sentenceType;
+    unsigned char sentence = (unsigned char) ((sentenceType == DIRECTION_SENTENCE)?
+            ast -> sentenceNode -> sentence.sentence.opcode :
+            ast -> sentenceNode -> sentence.sentence.guidance);
+    unsigned char argAmount = (unsigned char) getArgAmount(ast), dataType, reg;
+    arg_node_t *currArg = ast -> sentenceNode -> argListHead;
+
+    (void) fwrite(&ast -> lineNumber, sizeof(int), ONE_ITEM, spillFile);
+    (void) fwrite(&sentenceType, sizeof(unsigned char), ONE_ITEM, spillFile);
+    (void) fwrite(&sentence, sizeof(unsigned char), ONE_ITEM, spillFile);
+    (void) fwrite(&argAmount, sizeof(unsigned char), ONE_ITEM, spillFile);
+    writeRecordString(spillFile, ast -> label);
+
+    while (currArg != NULL) /* Write the arguments. */
+    {
+        dataType = (unsigned char) currArg -> argData -> dataType;
+        (void) fwrite(&dataType, sizeof(unsigned char), ONE_ITEM, spillFile);
+
+        if (currArg -> argData -> dataType == INT)
+            (void) fwrite(&currArg -> argData -> data.num, sizeof(short), ONE_ITEM, spillFile);
+        else if (currArg -> argData -> dataType == REG)
+        {
+            reg = (unsigned char) currArg -> argData -> data.reg;
+            (void) fwrite(&reg, sizeof(unsigned char), ONE_ITEM, spillFile);
+        }
+        else
+            writeRecordString(spillFile, currArg -> argData -> data.string);
+
+        currArg = currArg -> nextArg;
+    }
+
+    handle_temp_file_errors(spillFile);
+}
+
+/*
+ * Reads a record of an AST from the temporary file of a spilled list.
+ *
+ * @param   *spillFile  The temporary file.
+ *
+ * @return  The AST of the record, or NULL if there are no more records.
+ */
+ast_t *readAstRecord(FILE *spillFile)
+{
+    ast_t *ast = NULL; /* AST to return. */
+    int lineNumber;
+    unsigned char sentenceType, sentence, argAmount, dataType, reg;
+    data_t *argData;
+
+    if (fread(&lineNumber, sizeof(int), ONE_ITEM, spillFile) == ONE_ITEM)
+    {
+        (void) fread(&sentenceType, sizeof(unsigned char), ONE_ITEM, spillFile);
+        (void) fread(&sentence, sizeof(unsigned char), ONE_ITEM, spillFile);
+        (void) fread(&argAmount, sizeof(unsigned char), ONE_ITEM, spillFile);
+
+        ast = creatAst();
+        ast -> lineNumber = lineNumber;
+        ast -> label = readRecordString(spillFile);
+        addSentenceToAst(ast, sentence, (sentence_type_t) sentenceType);
+
+        for (; argAmount > ZERO_ARGUMENTS; argAmount--) /* Read the arguments. */
+        {
+            argData = (data_t *) allocate_space(sizeof(data_t));
+            (void) fread(&dataType, sizeof(unsigned char), ONE_ITEM, spillFile);
+            argData -> dataType = (data_type_t) dataType;
+
+            if (argData -> dataType == INT)
+                (void) fread(&argData -> data.num, sizeof(short), ONE_ITEM, spillFile);
+            else if (argData -> dataType == REG)
+            {
+                (void) fread(&reg, sizeof(unsigned char), ONE_ITEM, spillFile);
+                argData -> data.reg = (reg_t) reg;
+            }
+            else
+                argData -> data.string = readRecordString(spillFile);
+
+            addArgumentToAst(ast, argData);
+        }
+    }
+
+    handle_temp_file_errors(spillFile);
+
+    return ast;
+}
+
+/*
+ * Writes a string to a record in the temporary file (its length, and then its characters).
+ *
+ * @param   *spillFile  The temporary file.
+ * @param   *string     The string to write, can be NULL (written as an empty string).
+ */
+void writeRecordString(FILE *spillFile, const char *string)
+{
+    unsigned short length = (unsigned short) ((string != NULL)? strlen(string) : ZERO_COUNT);
+
+    (void) fwrite(&length, sizeof(unsigned short), ONE_ITEM, spillFile);
+    if (length > ZERO_COUNT)
+        (void) fwrite(string, sizeof(char), length, spillFile);
+}
+
+/*
+ * Reads a string from a record in the temporary file.
+ *
+ * @param   *spillFile  The temporary file.
+ *
+ * @return  A new string with the read characters, or NULL if the string is empty.
+ */
+char *readRecordString(FILE *spillFile)
+{
+    unsigned short length = ZERO_COUNT;
+    char *string = NULL; /* String to return. */
+
+    (void) fread(&length, sizeof(unsigned short), ONE_ITEM, spillFile);
+    if (length > ZERO_COUNT)
+    {
+        string = (char *) allocate_space(length + SIZE_FOR_NULL);
+        (void) fread(string, sizeof(char), length, spillFile);
+        string[length] = '\0';
+    }
+
+    return string;
+}
+
 /*
  * Gets a duplicate of the label name from the given AST.
  *
@@ -654,6 +900,36 @@ int deleteAstListNode(ast_list_node_t **pAstListNode)
     return returnCode;
 }
 
+/*
+ * Removes the AST after the given node from the AST list, and deletes it.
+ *
+ * @param   *astList    Pointer to the AST list.
+ * @param   *prevNode   The node before the AST to remove, or NULL to remove the head of the list.
+ *
+ * @return  0 on success, -1 if there is no AST to remove.
+ */
+int deleteNextAstFromList(ast_list_t *astList, ast_list_node_t *prevNode)
+{
+    int returnCode = INVALID_GIVEN_PARAM_CODE; /* Code to return, assume error. */
+    ast_list_node_t *nodeToDelete = (prevNode == NULL)? astList -> head : prevNode -> next;
+
+    if (nodeToDelete != NULL) /* If there is an AST to remove. */
+    {
+        /* Connect the nodes around the removed node. */
+        if (prevNode == NULL)
+            astList -> head = nodeToDelete -> next;
+        else
+            prevNode -> next = nodeToDelete -> next;
+
+        if (astList -> tail == nodeToDelete) /* Fix the tail. */
+            astList -> tail = prevNode;
+
+        returnCode = deleteAstListNode(&nodeToDelete);
+    }
+
+    return returnCode;
+}
+
 /*
  * Deletes the entire AST list and set the pointer to NULL.
  *
@@ -665,6 +941,13 @@ int deleteAstList(ast_list_t **pAstList)
 {
     int returnCode = INVALID_GIVEN_PARAM_CODE; /* Code to return, assume error. */
 
+    if (pAstList != NULL && *pAstList != NULL && (*pAstList) -> spillFile != NULL)
+    {
+        (void) deleteAst(&(*pAstList) -> readAst);
+        handle_file_close_errors(fclose((*pAstList) -> spillFile)); /* Also removes it. */
+        returnCode = SUCCESS_CODE;
+    }
+
     /* If the parameter is valid */
     if (pAstList != NULL && *pAstList != NULL && (*pAstList) -> head != NULL)
     {
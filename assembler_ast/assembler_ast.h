@@ -50,6 +50,16 @@ typedef struct arg_node_t arg_node_t;
  */
 ast_list_t *createAstList(void );
 
+/*
+ * Creates an empty spilled AST list.
+ * The ASTs added to a spilled list are written to a temporary file and deleted from the
+ * memory, so the memory used by the list does not grow with the size of the source file.
+ * The ASTs can be read back only by readNextAstFromList().
+ *
+ * @return  ast_list_t* A pointer to the newly created ast list.
+ */
+ast_list_t *createSpilledAstList(void );
+
 /*
  * Creates a new AST (Abstract Syntax Tree) to represent a line of assembly code.
  *
@@ -59,6 +69,7 @@ ast_t *creatAst(void );
 
 /*
  * Adds an AST (Abstract Syntax Tree) to the AST list.
+ * If the list is spilled, the AST is written to the temporary file and deleted.
  *
  * @param   *astList Pointer to the AST list.
  * @param   **ast Pointer to the AST to add to the list.
@@ -77,6 +88,23 @@ int addAstToList(ast_list_t *astList, ast_t **ast);
  */
 int *getCounterPointer(ast_list_t *astList, int counter);
 
+/*
+ * Sets the number of the line the AST represents.
+ *
+ * @param   *ast        Pointer to the AST.
+ * @param   lineNumber  The number of the line in the source file.
+ */
+void setAstLineNumber(ast_t *ast, int lineNumber);
+
+/*
+ * Gets the number of the line the AST represents.
+ *
+ * @param   *ast    Pointer to the AST.
+ *
+ * @return  The number of the line in the source file.
+ */
+int getAstLineNumber(ast_t *ast);
+
 /*
  * Adds a label name to the AST.
  *
@@ -129,6 +157,25 @@ ast_list_node_t *getNextAstNode(ast_list_node_t *astListNode);
  */
 ast_t *getAst(ast_list_node_t *astListNode);
 
+/*
+ * Goes back to the start of the AST list, so the next read will be of the first AST.
+ *
+ * @param   *astList    Pointer to the AST list.
+ */
+void rewindAstList(ast_list_t *astList);
+
+/*
+ * Reads the next AST from the AST list (the first one after rewindAstList()).
+ * Works on lists in the memory and on spilled lists.
+ * The AST belongs to the list. If the list is spilled, the AST is valid only until
+ * the next read.
+ *
+ * @param   *astList    Pointer to the AST list.
+ *
+ * @return  The next AST in the list, or NULL if there are no more ASTs.
+ */
+ast_t *readNextAstFromList(ast_list_t *astList);
+
 /*
  * Gets a duplicate of the label name from the given AST.
  *
@@ -257,6 +304,16 @@ int deleteLabel(ast_t *ast);
  */
 int deleteAst(ast_t **pAst);
 
+/*
+ * Removes the AST after the given node from the AST list, and deletes it.
+ *
+ * @param   *astList    Pointer to the AST list.
+ * @param   *prevNode   The node before the AST to remove, or NULL to remove the head of the list.
+ *
+ * @return  0 on success, -1 if there is no AST to remove.
+ */
+int deleteNextAstFromList(ast_list_t *astList, ast_list_node_t *prevNode);
+
 /*
  * Deletes the entire AST list and set the pointer to NULL.
  *
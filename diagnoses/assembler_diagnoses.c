@@ -18,7 +18,6 @@
 /* -------------------------- */
 
 /* ---Finals--- */
-#define MAX_PARAM_COUNT 2
 #define ONE_BIT 1
 #define VALID_ARG 0
 #define INVALID_ARG_MTD (-1)
@@ -30,9 +29,9 @@ enum {src, dest};
 /* ------------ */
 
 /* ---Macros--- */
-#define inst_B (ONE_BIT << INSTANT)
-#define dir_B (ONE_BIT << DIRECT)
-#define reg_B (ONE_BIT << DIRECT_REGISTER)
+#define ISA_TABLE_ENTRY(name, srcMethods, destMethods, cycles) \
+        {#name, ((srcMethods) != NO_ARG_B) + ((destMethods) != NO_ARG_B), \
+         (srcMethods), (destMethods)},
 /* ------------ */
 
 /* Groups of operations by the amount of arguments they accept. */
@@ -41,6 +40,18 @@ typedef enum {ZERO_ARGS, ONE_ARGS, TWO_ARGS} op_group_t;
 /* Indicates the state of the area between arguments. */
 typedef enum {LAST_ARG, CAN_BE_ANOTHER_ARG, MUST_BE_ANOTHER_ARG} area_status_t;
 
+/* The description of an operation in the instruction set. */
+typedef struct
+{
+    const char *name; /* The name of the operation, as it is written in the source code. */
+    op_group_t opGroup; /* How many arguments the operation accepts. */
+    int srcMethods; /* Mask of the legal addressing methods of the source argument. */
+    int destMethods; /* Mask of the legal addressing methods of the destination argument. */
+} isa_entry_t;
+
+/* The instruction set, by the opcodes. */
+static const isa_entry_t isaTable[OPCODE_AMOUNT] = {ISA_OPERATIONS(ISA_TABLE_ENTRY)};
+
 /* ---------------Prototypes--------------- */
 /* ---------------------------------------- */
 
@@ -54,33 +65,7 @@ typedef enum {LAST_ARG, CAN_BE_ANOTHER_ARG, MUST_BE_ANOTHER_ARG} area_status_t;
  */
 op_group_t getOpGroup(opcodes_t opcode)
 {
-    op_group_t opGroup;
-
-    /* Finding which operation group does the given operation belongs to.
-     * Used a switch here instead of 'if' statements (which will look better)
-     * because it is faster. */
-    switch (opcode)
-    {
-        case mov: case cmp: case add: case sub:
-            opGroup = TWO_ARGS; break;
-
-        case not: case clr:
-            opGroup = ONE_ARGS; break;
-
-        case lea:
-            opGroup = TWO_ARGS; break;
-
-        case inc: case dec: case jmp: case bne: case red: case prn: case jsr:
-            opGroup = ONE_ARGS; break;
-
-        case rts: case stop:
-            opGroup = ZERO_ARGS; break;
-
-        default:
-            opGroup = NO_OPCODE;
-    }
-
-    return opGroup;
+    return (opcode == NO_OPCODE)? (op_group_t) NO_OPCODE : isaTable[opcode].opGroup;
 }
 
 /*
@@ -97,35 +82,14 @@ op_group_t getOpGroup(opcodes_t opcode)
  */
 int validArg(opcodes_t opcode, boolean isDest, addressing_method_t addMtd)
 {
-    /* Table representing valid addressing method for every operation. */
-    char addressingMethodsTable[OPCODE_AMOUNT][MAX_PARAM_COUNT] =
-            {
-                    {inst_B | dir_B | reg_B,             dir_B | reg_B},    /* mov */
-                    {inst_B | dir_B | reg_B,    inst_B | dir_B | reg_B},    /* cmp */
-                    {inst_B | dir_B | reg_B,             dir_B | reg_B},    /* add */
-                    {inst_B | dir_B | reg_B,             dir_B | reg_B},    /* sub */
-                    {ZERO_ADD_MTD,                       dir_B | reg_B},    /* not */
-                    {ZERO_ADD_MTD,                       dir_B | reg_B},    /* clr */
-                    {         dir_B,                     dir_B | reg_B},    /* lea */
-                    {ZERO_ADD_MTD,                       dir_B | reg_B},    /* inc */
-                    {ZERO_ADD_MTD,                       dir_B | reg_B},    /* dec */
-                    {ZERO_ADD_MTD,                       dir_B | reg_B},    /* jmp */
-                    {ZERO_ADD_MTD,                       dir_B | reg_B},    /* bne */
-                    {ZERO_ADD_MTD,                       dir_B | reg_B},    /* red */
-                    {ZERO_ADD_MTD,              inst_B | dir_B | reg_B},    /* prn */
-                    {ZERO_ADD_MTD,                       dir_B | reg_B},    /* jsr */
-                    {ZERO_ADD_MTD, ZERO_ADD_MTD},                           /* rts */
-                    {ZERO_ADD_MTD, ZERO_ADD_MTD},                           /* stop */
-            };
-
     int validArg; /* Value to return. */
-    int argIndex = (isDest)? ONE_INDEX : ZERO_INDEX; /* Index of argument in table. */
+    int methods = (isDest)? isaTable[opcode].destMethods : isaTable[opcode].srcMethods;
 
-    if (addressingMethodsTable[opcode][argIndex] == ZERO_ADD_MTD)
+    if (methods == NO_ARG_B)
         validArg = INVALID_ARG_NUMBER;
 
-    /* Check if the argument addressing method matches the one in the table. */
-    else if (addressingMethodsTable[opcode][argIndex] & (ONE_BIT << addMtd))
+    /* Check if the argument addressing method is one of the legal methods. */
+    else if (methods & (ONE_BIT << addMtd))
         validArg = VALID_ARG;
     else
         validArg = INVALID_ARG_MTD;
@@ -133,6 +97,18 @@ int validArg(opcodes_t opcode, boolean isDest, addressing_method_t addMtd)
     return validArg;
 }
 
+/*
+ * Gets the name of the operation with the given opcode, as it is written in the source code.
+ *
+ * @param   opcode  The opcode of the operation (not NO_OPCODE).
+ *
+ * @return  The name of the operation.
+ */
+const char *getOpcodeName(opcodes_t opcode)
+{
+    return isaTable[opcode].name;
+}
+
 /*
  * Checks if the operation with the given opcode requires the argument
  * with the give number.
@@ -50,6 +50,15 @@ op_group_t getOpGroup(opcodes_t opcode);
  */
 int validArg(opcodes_t opcode, boolean isDest, addressing_method_t addMtd);
 
+/*
+ * Gets the name of the operation with the given opcode, as it is written in the source code.
+ *
+ * @param   opcode  The opcode of the operation (not NO_OPCODE).
+ *
+ * @return  The name of the operation.
+ */
+const char *getOpcodeName(opcodes_t opcode);
+
 /*
  * Gets the area status after an argument for the given opcode, argument number, and guidance type.
  * Area status informs about the possibility of another argument.
@@ -16,8 +16,10 @@
 #include "../assembler_ast/assembler_ast.h"
 #include "../general-enums/indexes.h"
 #include "../general-enums/neededKeys.h"
+#include "../general-enums/assemblerFinals.h"
 #include "diagnose_line.h"
 #include "diagnose_util.h"
+#include "assembler_diagnoses.h"
 #include "../util/memoryUtil.h"
 #include "../util/stringsUtil.h"
 #include "../util/numberUtil.h"
@@ -27,10 +29,12 @@
 /* ------------ */
 
 /* ---Finals--- */
+#define MEMORY_MODULE DIAGNOSES_MEMORY /* For the memory statistics. */
 #define REG_LEN 3
 #define FIRST_REGISTER 0
 #define LAST_REGISTER 7
 #define COMMA_DELIM ","
+#define INCLUDE_DIRECTIVE ".include"
 /* ------------ */
 
 /* ---------------Prototypes--------------- */
@@ -98,6 +102,25 @@ boolean isCallingMacro(const char *line, NameTable *macro_table)
     return isCallingMacro;
 }
 
+/*
+ * Checks if the given line is a .include line (includes another source file).
+ *
+ * @param   line The line to check.
+ *
+ * @return  TRUE if the line is a .include line, otherwise FALSE.
+ */
+boolean isIncludeLine(const char *line)
+{
+    boolean isInclude; /* Value to return. */
+    char *firstWord = NULL; /* Will hold first word in line. */
+    findWord(line, &firstWord, FIRST_WORD); /* Find the first word. */
+
+    isInclude = sameStrings(firstWord, INCLUDE_DIRECTIVE);
+
+    (void) clear_ptr(firstWord) /* Free unnecessary variable. */
+    return isInclude;
+}
+
 /*
  * Checks if the given line is a special macro-related line (not a body of a mcro def).
  *
@@ -162,17 +185,13 @@ guidance_t getGuidance(const char *word)
  */
 opcodes_t getOpcode(const char *word)
 {
-    /* Array to save all the opcodes. */
-    const char *opcodes_list[OPCODE_AMOUNT] = {"mov", "cmp", "add", "sub",
-                                   "not", "clr", "lea", "inc",
-                                   "dec", "jmp", "bne", "red",
-                                   "prn", "jsr", "rts", "stop"};
-    int sizeOfList = sizeof(opcodes_list) / sizeof(opcodes_list[ZERO_INDEX]);
+    opcodes_t opcode = mov;
 
-    /* Get the index of 'word' in opcodes_list. if it's not an opcode, will be -1. */
-    int index = getIndexOfStrInArray(opcodes_list, sizeOfList, word);
+    /* Find the opcode with the name 'word'. if it's not an opcode, will be NO_OPCODE. */
+    while (opcode < OPCODE_AMOUNT && sameStrings(word, getOpcodeName(opcode)) == FALSE)
+        opcode++;
 
-    return (opcodes_t) index;
+    return (opcode < OPCODE_AMOUNT)? opcode : NO_OPCODE;
 }
 
 /*
@@ -497,4 +516,106 @@ boolean isLastArg(const char *line, int argumentNum, boolean isLabel)
     }
 
     return (line[currArg] == NULL_TERMINATOR)? TRUE : FALSE;
-}
\ No newline at end of file
+}
+/*
+ * Gets the comma separated arguments of a macro line (the parameters of a definition, or the
+ * arguments of a call), without the empty space around them.
+ * Empty arguments are kept (as empty strings), and commas inside quotes don't separate.
+ *
+ * @param   *line           The macro line.
+ * @param   wordNumber      The word that the arguments start at.
+ * @param   *argsAmount     Will hold the amount of the arguments (0 if there are none).
+ *
+ * @return  The array of the arguments (needs to be freed), or NULL if there are none.
+ */
+char **getMacroArguments(const char *line, word_number wordNumber, int *argsAmount)
+{
+    char **args = NULL; /* Value to return. */
+    int start = findStartIndexOfWord(line, wordNumber), end, i;
+    boolean isInQuotes = FALSE;
+
+    *argsAmount = 0;
+    if (line[start] == NULL_TERMINATOR) /* No arguments. */
+        return NULL;
+
+    /* Count the arguments, to allocate the array once. */
+    *argsAmount = 1;
+    for (i = start; line[i] != NULL_TERMINATOR; i++)
+    {
+        if (line[i] == QUOTES)
+            isInQuotes = !isInQuotes;
+        else if (line[i] == COMMA && isInQuotes == FALSE)
+            (*argsAmount)++;
+    }
+
+    args = (char **) allocate_space(sizeof(char *) * (*argsAmount));
+
+    for (i = 0; i < *argsAmount; i++) /* Copy the arguments, without the empty space. */
+    {
+        while (line[start] != NULL_TERMINATOR && isEmpty(line[start]) == TRUE)
+            start++;
+
+        for (end = start, isInQuotes = FALSE; line[end] != NULL_TERMINATOR &&
+             (line[end] != COMMA || isInQuotes == TRUE); end++)
+            if (line[end] == QUOTES)
+                isInQuotes = !isInQuotes;
+
+        args[i] = strcpyPart(line, start, end);
+        start = (line[end] == COMMA)? end + 1 : end; /* Skip the comma. */
+
+        for (end = (int) strlen(args[i]); end > 0 && isEmpty(args[i][end - 1]) == TRUE; end--)
+            args[i][end - 1] = NULL_TERMINATOR;
+    }
+
+    return args;
+}
+
+/*
+ * Frees the arguments of a macro line.
+ *
+ * @param   **args          The arguments (can be NULL).
+ * @param   argsAmount      The amount of the arguments.
+ */
+void freeMacroArguments(char **args, int argsAmount)
+{
+    int i; /* Loop variable. */
+
+    if (args != NULL)
+    {
+        for (i = 0; i < argsAmount; i++)
+            {(void) clear_ptr(args[i])}
+        (void) clear_ptr(args)
+    }
+}
+
+/*
+ * Checks if the given parameters of a macro are legal - every parameter starts with a letter
+ * and has only letters and numbers, is not a saved word, and is different from the others.
+ *
+ * @param   **params        The parameters.
+ * @param   paramsAmount    The amount of the parameters.
+ *
+ * @return  TRUE if the parameters are legal, otherwise FALSE.
+ */
+boolean areLegalMacroParameters(char **params, int paramsAmount)
+{
+    boolean isLegal = (paramsAmount <= MAX_MACRO_PARAMETERS)? TRUE : FALSE; /* Value to return. */
+    int i, j; /* Loop variables. */
+
+    for (i = 0; i < paramsAmount && isLegal == TRUE; i++)
+    {
+        if (isLetter(params[i][ZERO_INDEX]) == FALSE || isSavedWord(params[i]) == TRUE)
+            isLegal = FALSE;
+
+        /* An empty parameter is illegal already, its first char is the terminator. */
+        for (j = 1; isLegal == TRUE && params[i][j] != NULL_TERMINATOR; j++)
+            if (isLegalChar(params[i][j]) == FALSE)
+                isLegal = FALSE;
+
+        for (j = 0; j < i && isLegal == TRUE; j++)
+            if (sameStrings(params[i], params[j]) == TRUE)
+                isLegal = FALSE;
+    }
+
+    return isLegal;
+}
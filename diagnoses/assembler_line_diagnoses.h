@@ -60,6 +60,15 @@ boolean isFinishMacroDef(boolean wasInMacroDef, boolean isInMacroDef);
  */
 boolean isCallingMacro(const char *line, NameTable *macro_table);
 
+/*
+ * Checks if the given line is a .include line (includes another source file).
+ *
+ * @param   line The line to check.
+ *
+ * @return  TRUE if the line is a .include line, otherwise FALSE.
+ */
+boolean isIncludeLine(const char *line);
+
 /*
  * Checks if the given line is a special macro-related line (not a body of a mcro def).
  *
@@ -228,6 +237,38 @@ void getArgDataFromLine(const char *line, int argumentNum, boolean isLabel, data
  */
 boolean isLastArg(const char *line, int argumentNum, boolean isLabel);
 
+/*
+ * Gets the comma separated arguments of a macro line (the parameters of a definition, or the
+ * arguments of a call), without the empty space around them.
+ * Empty arguments are kept (as empty strings), and commas inside quotes don't separate.
+ *
+ * @param   *line           The macro line.
+ * @param   wordNumber      The word that the arguments start at.
+ * @param   *argsAmount     Will hold the amount of the arguments (0 if there are none).
+ *
+ * @return  The array of the arguments (needs to be freed), or NULL if there are none.
+ */
+char **getMacroArguments(const char *line, word_number wordNumber, int *argsAmount);
+
+/*
+ * Frees the arguments of a macro line.
+ *
+ * @param   **args          The arguments (can be NULL).
+ * @param   argsAmount      The amount of the arguments.
+ */
+void freeMacroArguments(char **args, int argsAmount);
+
+/*
+ * Checks if the given parameters of a macro are legal - every parameter starts with a letter
+ * and has only letters and numbers, is not a saved word, and is different from the others.
+ *
+ * @param   **params        The parameters.
+ * @param   paramsAmount    The amount of the parameters.
+ *
+ * @return  TRUE if the parameters are legal, otherwise FALSE.
+ */
+boolean areLegalMacroParameters(char **params, int paramsAmount);
+
 /* ---------------------------------------- */
 
 #endif /* MMN_14_ASSEMBLER_LINE_DIAGNOSES_H */
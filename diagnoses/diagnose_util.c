@@ -19,6 +19,7 @@
 /* -------------- */
 
 /* ---Finals--- */
+#define MEMORY_MODULE DIAGNOSES_MEMORY /* For the memory statistics. */
 #define ZERO_COUNT 0
 /* ------------ */
 
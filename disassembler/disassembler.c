@@ -0,0 +1,60 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * disassembler.c
+ *
+ * This file houses the main function of the disassembler program. The disassembler
+ * reconstructs the source code of assembled (or linked) objects from their .ob file,
+ * with the labels of their .ent and .ext files (if there are).
+ *
+ * Usage: mmn_14_disassembler [-t] object_name ...
+ *
+ * Object names are given without endings (the same as the assembler source files).
+ * The source code of every object is written to {object_name}.dis.as,
+ * -t reports the time every disassembly took.
+ *
+ * Note: This implementation assumes the C90 standard for compatibility.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include "../new-data-types/boolean.h"
+#include "../util/stringsUtil.h"
+#include "disassembler_algorithm.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define FIRST_ARGUMENT 1
+#define SUCCESS_CODE 0
+#define FAILURE_CODE 1
+#define TIMING_OPTION "-t"
+/* ------------ */
+
+/*
+ * Driver code.
+ */
+int main(int argc, char *argv[])
+{
+    boolean isTimed = FALSE;
+    int objectsAmount = 0, returnCode = SUCCESS_CODE;
+    int i; /* Loop variable. */
+
+    for (i = FIRST_ARGUMENT; i < argc; i++)
+        if (sameStrings(argv[i], TIMING_OPTION) == TRUE)
+            isTimed = TRUE;
+
+    /* Disassemble the objects one by one. */
+    for (i = FIRST_ARGUMENT; i < argc; i++)
+        if (sameStrings(argv[i], TIMING_OPTION) == FALSE)
+        {
+            objectsAmount++;
+            if (disassemble_object(argv[i], isTimed) == FAILURE)
+                returnCode = FAILURE_CODE;
+        }
+
+    if (objectsAmount == 0) /* Print a message if the arguments are insufficient. */
+        puts("\nPlease select the assembled objects to disassemble.");
+
+    return returnCode;
+}
@@ -0,0 +1,703 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * disassembler_algorithm.c
+ *
+ * This file implements the reconstruction of assembly source code from an assembled object.
+ *
+ * The words of the object are decoded from Base64 by the object loader, then:
+ *      1. The symbols of the .ent file become labels at their addresses, and the uses of
+ *         the symbols of the .ext file are kept by the addresses of the words using them.
+ *      2. The code segment is decoded instruction by instruction, through the decode table.
+ *         Every relocatable argument marks its address as the target of a label.
+ *      3. Targets that are not entry symbols get a new label name, 'L' and their address.
+ *      4. The source code is written: the .extern and .entry lines, an instruction line for
+ *         every instruction and .data (or .string) lines for the data segment. Data lines are
+ *         split at labels, and so no line is longer than the maximum line length.
+ *
+ * Assembling the reconstructed source code gives back the same object.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../new-data-types/boolean.h"
+#include "../new-data-types/process_result.h"
+#include "../general-enums/programFinals.h"
+#include "../general-enums/indexes.h"
+#include "../general-enums/assemblerFinals.h"
+#include "../encoding/encoding-finals/encoding_finals.h"
+#include "../encoding/encoding-finals/ranges.h"
+#include "../encoding/wordHandling.h"
+#include "../encoding/decodeTable.h"
+#include "../assembler_ast/assembler_ast.h"
+#include "../diagnoses/assembler_diagnoses.h"
+#include "../ObjectFile/ObjectFile.h"
+#include "../FileHandling/writeToFile.h"
+#include "../errors/tools_errors.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "../util/timeUtil.h"
+#include "disassembler_algorithm.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE DISASSEMBLER_MEMORY /* For the memory statistics. */
+#define DISASSEMBLED_END ".dis.as"
+#define ADDRESS_TITLE "Address"
+#define ADDRESS_BUFFER 16
+#define MAX_LINE_LEN 80
+#define MAX_TEXT_LINE_LEN (3 * MAX_LABEL_LEN + MAX_LINE_LEN) /* Line with the longest labels. */
+#define LABEL_SEPARATOR ": "
+#define DATA_GUIDANCE ".data"
+#define STRING_GUIDANCE ".string"
+#define LONGEST_DATA_VALUE ", -2048"
+#define SYNTHETIC_LABEL_PREFIX 'L'
+#define MIN_STRING_LEN 2
+#define ONE_BIT 1
+#define WORD_SIGN_BIT 0x800
+#define WORD_RANGE 0x1000
+#define INSTANT_SIGN_BIT 0x200
+#define INSTANT_RANGE 0x400
+#define REGISTERS_AMOUNT 8
+#define FIRST_PRINTABLE ' '
+#define LAST_PRINTABLE '~'
+#define QUOTES '"'
+#define END_OF_STRING 0
+#define MICROSECONDS_IN_SECOND 1000000.0
+#define COLOR_GREEN "\x1B[32m"
+#define COLOR_RESET "\x1B[0m"
+/* ------------ */
+
+/* ---Macros--- */
+#define INFO_MSG(message, file) printf("\n" COLOR_GREEN "Disassembler state:" COLOR_RESET \
+        " %s " COLOR_GREEN "On file:" COLOR_RESET " \"%s\"\n", (message), (file))
+
+#define get_field(word, low, high) (((word) >> (low)) & ((ONE_BIT << ((high) - (low) + 1)) - 1))
+
+#define to_signed(value, signBit, range) (((value) & (signBit))? (value) - (range) : (value))
+
+#define is_printable(value) ((value) >= FIRST_PRINTABLE && (value) <= LAST_PRINTABLE && \
+                             (value) != QUOTES)
+/* ------------ */
+
+/* State of the disassembly of an object. */
+typedef struct
+{
+    const ObjectFile *objectFile;
+    int wordsAmount;
+    int codeSize;
+    int *values; /* The value of every word, by index (address - PROGRAM_MEM_START). */
+    const char **labels; /* The label defined at every index, NULL if there is none. */
+    boolean *isTarget; /* Flag for every index, TRUE if a relocatable argument points to it. */
+    boolean *isInstStart; /* Flag for every index, TRUE if an instruction starts at it. */
+    const char **externUses; /* The external symbol used by every word, NULL if there is none. */
+    char **syntheticLabels; /* The label names that were created. */
+    int syntheticAmount;
+    char *text; /* The reconstructed source code. */
+    size_t textLength;
+    int errorAddress; /* The address where an error was found. */
+} disassembly_t;
+
+/* ---------------Prototypes--------------- */
+Error disassembleObject(disassembly_t *dis);
+Error markObjectSymbols(disassembly_t *dis);
+Error decodeCodeSegment(disassembly_t *dis);
+Error checkArgumentWord(disassembly_t *dis, int index, addressing_method_t method,
+                        boolean isDest, boolean isSharedWord);
+Error nameLabels(disassembly_t *dis);
+char *createSyntheticLabel(const disassembly_t *dis, int address);
+boolean isObjectSymbolName(const ObjectFile *objectFile, const char *name);
+void writeDeclarations(disassembly_t *dis);
+void writeCodeSegment(disassembly_t *dis);
+int writeArgument(disassembly_t *dis, int index, addressing_method_t method, boolean isDest);
+void writeDataSegment(disassembly_t *dis);
+int writeStringLine(disassembly_t *dis, int index);
+int writeDataLine(disassembly_t *dis, int index);
+void writeLabel(disassembly_t *dis, int index);
+void writeText(disassembly_t *dis, const char *text);
+void clearDisassembly(disassembly_t *dis);
+/* ---------------------------------------- */
+
+/*
+ * Reconstructs the source code of an assembled object.
+ * Writes the source code to {object_name}.dis.as.
+ *
+ * @param   *object_name    The name of the object (without endings).
+ * @param   isTimed         Flag indicating if the time of the disassembly is reported.
+ *
+ * @return  SUCCESS if the source code was reconstructed, otherwise FAILURE.
+ */
+process_result disassemble_object(const char *object_name, boolean isTimed)
+{
+    disassembly_t dis;
+    Error disError;
+    ObjectFile *objectFile;
+    char address[ADDRESS_BUFFER];
+    double seconds;
+
+    INFO_MSG("Starting disassembling object", object_name);
+
+    initDecodeTable();
+    objectFile = loadObjectFile(object_name, &disError);
+
+    if (disError == NO_ERROR)
+    {
+        dis.objectFile = objectFile;
+        seconds = getMonotonicSeconds();
+        disError = disassembleObject(&dis);
+        seconds = getMonotonicSeconds() - seconds;
+
+        if (disError == NO_ERROR)
+        {
+            writeToFile(object_name, DISASSEMBLED_END, dis.text);
+            if (isTimed == TRUE)
+                printf("\nDisassembled %d words in %.3f microseconds\n", dis.wordsAmount,
+                       seconds * MICROSECONDS_IN_SECOND);
+        }
+        else
+        {
+            (void) sprintf(address, "%d", dis.errorAddress);
+            handle_tool_error(object_name, ADDRESS_TITLE, address, disError);
+        }
+
+        clearDisassembly(&dis);
+        deleteObjectFile(&objectFile);
+    }
+
+    else
+        handle_tool_error(object_name, NULL, NULL, disError);
+
+    if (disError == NO_ERROR)
+        INFO_MSG("Successfully disassembled object!", object_name);
+    else
+        INFO_MSG("Failed to disassemble object.", object_name);
+
+    return (disError == NO_ERROR)? SUCCESS : FAILURE;
+}
+
+/*
+ * Reconstructs the source code of a loaded object.
+ *
+ * @param   *dis    The disassembly state (with the loaded object).
+ *
+ * @return  NO_ERROR if the source code was reconstructed, otherwise the error that occurred.
+ */
+Error disassembleObject(disassembly_t *dis)
+{
+    const ObjectFile *objectFile = dis -> objectFile;
+    Error disError;
+    int i; /* Loop variable. */
+
+    dis -> wordsAmount = getObjectWordsAmount(objectFile);
+    dis -> codeSize = objectFile -> counters[IC_];
+    dis -> values = (int *) allocate_space(dis -> wordsAmount * sizeof(int) + 1);
+    dis -> labels = (const char **) allocate_space(dis -> wordsAmount * sizeof(char *) + 1);
+    dis -> isTarget = (boolean *) allocate_space(dis -> wordsAmount * sizeof(boolean) + 1);
+    dis -> isInstStart = (boolean *) allocate_space(dis -> wordsAmount * sizeof(boolean) + 1);
+    dis -> externUses = (const char **) allocate_space(dis -> wordsAmount * sizeof(char *) + 1);
+    dis -> syntheticLabels = NULL;
+    dis -> syntheticAmount = ZERO_COUNT;
+    dis -> text = NULL;
+    dis -> textLength = ZERO_COUNT;
+    dis -> errorAddress = PROGRAM_MEM_START;
+
+    for (i = ZERO_INDEX; i < dis -> wordsAmount; i++)
+    {
+        dis -> values[i] = getBitsInRange(objectFile -> words[i], DATA_LOW, DATA_HIGH);
+        dis -> labels[i] = dis -> externUses[i] = NULL;
+        dis -> isTarget[i] = dis -> isInstStart[i] = FALSE;
+    }
+
+    disError = markObjectSymbols(dis);
+    if (disError == NO_ERROR)
+        disError = decodeCodeSegment(dis);
+    if (disError == NO_ERROR)
+        disError = nameLabels(dis);
+
+    if (disError == NO_ERROR) /* Every word takes at most one line. */
+    {
+        dis -> text = (char *) allocate_space((dis -> wordsAmount + objectFile -> entriesAmount +
+                objectFile -> externsAmount + ONE_INDEX) * (MAX_TEXT_LINE_LEN + SIZE_FOR_NULL));
+        dis -> text[ZERO_INDEX] = '\0';
+
+        writeDeclarations(dis);
+        writeCodeSegment(dis);
+        writeDataSegment(dis);
+    }
+
+    return disError;
+}
+
+/*
+ * Marks the symbols of the object: entry symbols as labels at their addresses,
+ * and uses of external symbols at the words using them.
+ *
+ * @param   *dis    The disassembly state.
+ *
+ * @return  NO_ERROR if the symbols are valid, otherwise the error that occurred.
+ */
+Error markObjectSymbols(disassembly_t *dis)
+{
+    const ObjectFile *objectFile = dis -> objectFile;
+    Error symbolsError = NO_ERROR;
+    int index, i; /* Loop variables. */
+
+    for (i = ZERO_INDEX; i < objectFile -> entriesAmount && symbolsError == NO_ERROR; i++)
+    {
+        index = objectFile -> entries[i].address - PROGRAM_MEM_START;
+
+        if (index < ZERO_INDEX || index >= dis -> wordsAmount || dis -> labels[index] != NULL)
+        {
+            symbolsError = INVALID_ENTRY_FILE_ERR;
+            dis -> errorAddress = objectFile -> entries[i].address;
+        }
+        else
+            dis -> labels[index] = objectFile -> entries[i].name;
+    }
+
+    for (i = ZERO_INDEX; i < objectFile -> externsAmount && symbolsError == NO_ERROR; i++)
+    {
+        index = objectFile -> externs[i].address - PROGRAM_MEM_START;
+
+        if (index < ZERO_INDEX || index >= dis -> codeSize)
+        {
+            symbolsError = INVALID_EXTERN_FILE_ERR;
+            dis -> errorAddress = objectFile -> externs[i].address;
+        }
+        else
+            dis -> externUses[index] = objectFile -> externs[i].name;
+    }
+
+    return symbolsError;
+}
+
+/*
+ * Decodes the code segment instruction by instruction, marks where instructions start
+ * and the targets of relocatable arguments.
+ *
+ * @param   *dis    The disassembly state.
+ *
+ * @return  NO_ERROR if the code segment is valid, otherwise the error that occurred.
+ */
+Error decodeCodeSegment(disassembly_t *dis)
+{
+    Error codeError = NO_ERROR;
+    const decoded_word_t *decodedWord;
+    boolean isSharedWord;
+    int index = ZERO_INDEX, argIndex;
+
+    while (index < dis -> codeSize && codeError == NO_ERROR)
+    {
+        decodedWord = decodeInstructionWord(dis -> values[index]);
+        isSharedWord = (decodedWord -> srcMtd == DIRECT_REGISTER &&
+                        decodedWord -> destMtd == DIRECT_REGISTER)? TRUE : FALSE;
+        argIndex = index + ONE_INDEX;
+
+        if (decodedWord -> opcode == NO_OPCODE || index + decodedWord -> length > dis -> codeSize)
+            codeError = INVALID_OBJECT_FILE_ERR;
+
+        else
+        {
+            dis -> isInstStart[index] = TRUE;
+
+            /* The source argument word comes before the destination argument word. */
+            if (decodedWord -> srcMtd != ZERO_ADD_MTD)
+            {
+                codeError = checkArgumentWord(dis, argIndex, decodedWord -> srcMtd, FALSE,
+                                              isSharedWord);
+                if (isSharedWord == FALSE)
+                    argIndex++;
+            }
+            if (decodedWord -> destMtd != ZERO_ADD_MTD && codeError == NO_ERROR)
+                codeError = checkArgumentWord(dis, argIndex, decodedWord -> destMtd, TRUE,
+                                              isSharedWord);
+        }
+
+        if (codeError == NO_ERROR)
+            index += decodedWord -> length;
+        else
+            dis -> errorAddress = PROGRAM_MEM_START + index;
+    }
+
+    return codeError;
+}
+
+/*
+ * Checks that an argument word can be written as an argument in the source code,
+ * and marks the target of a relocatable argument.
+ *
+ * @param   *dis            The disassembly state.
+ * @param   index           The index of the argument word.
+ * @param   method          The addressing method of the argument.
+ * @param   isDest          Flag indicating if the argument is the destination argument.
+ * @param   isSharedWord    Flag indicating if the word is shared by two register arguments.
+ *
+ * @return  NO_ERROR if the argument word is valid, otherwise the error that occurred.
+ */
+Error checkArgumentWord(disassembly_t *dis, int index, addressing_method_t method,
+                        boolean isDest, boolean isSharedWord)
+{
+    Error argError = NO_ERROR;
+    int word = dis -> values[index];
+    int are = get_field(word, ARE_LOW, ARE_HIGH), target;
+
+    if (method == DIRECT && are == RELOCATABLE)
+    {
+        target = get_field(word, DIR_DATA_LOW, DIR_DATA_HIGH) - PROGRAM_MEM_START;
+        if (target < ZERO_INDEX || target >= dis -> wordsAmount)
+            argError = INVALID_OBJECT_FILE_ERR;
+        else
+            dis -> isTarget[target] = TRUE;
+    }
+
+    else if (method == DIRECT) /* An external argument word is empty. */
+        argError = (are == EXTERNAL && get_field(word, DIR_DATA_LOW, DIR_DATA_HIGH) == ZERO_NUMBER)?
+                ((dis -> externUses[index] != NULL)? NO_ERROR : INVALID_EXTERN_FILE_ERR) :
+                INVALID_OBJECT_FILE_ERR;
+
+    else if (are != ABSOLUTE || dis -> externUses[index] != NULL)
+        argError = INVALID_OBJECT_FILE_ERR;
+
+    /* A register word has only the fields of its registers. */
+    else if (method == DIRECT_REGISTER && (get_field(word, DEST_REG_LOW, DEST_REG_HIGH) >=
+            REGISTERS_AMOUNT || get_field(word, SRC_REG_LOW, SRC_REG_HIGH) >= REGISTERS_AMOUNT ||
+            (isSharedWord == FALSE && get_field(word, (isDest == TRUE)? SRC_REG_LOW : DEST_REG_LOW,
+                    (isDest == TRUE)? SRC_REG_HIGH : DEST_REG_HIGH) != ZERO_NUMBER)))
+        argError = INVALID_OBJECT_FILE_ERR;
+
+    return argError;
+}
+
+/*
+ * Names the targets of relocatable arguments that are not entry symbols,
+ * and checks that every label in the code segment is at the start of an instruction.
+ *
+ * @param   *dis    The disassembly state.
+ *
+ * @return  NO_ERROR if all the labels can be written, otherwise the error that occurred.
+ */
+Error nameLabels(disassembly_t *dis)
+{
+    Error labelsError = NO_ERROR;
+    int index; /* Loop variable. */
+
+    dis -> syntheticLabels = (char **) allocate_space(dis -> wordsAmount * sizeof(char *) + 1);
+
+    for (index = ZERO_INDEX; index < dis -> wordsAmount && labelsError == NO_ERROR; index++)
+    {
+        if (dis -> isTarget[index] == TRUE && dis -> labels[index] == NULL)
+        {
+            dis -> syntheticLabels[dis -> syntheticAmount] = createSyntheticLabel(
+                    dis, PROGRAM_MEM_START + index);
+            dis -> labels[index] = dis -> syntheticLabels[dis -> syntheticAmount++];
+        }
+
+        if (dis -> labels[index] != NULL && index < dis -> codeSize &&
+            dis -> isInstStart[index] == FALSE)
+        {
+            labelsError = INVALID_OBJECT_FILE_ERR;
+            dis -> errorAddress = PROGRAM_MEM_START + index;
+        }
+    }
+
+    return labelsError;
+}
+
+/*
+ * Creates a new label name for an address, 'L' and the address.
+ * More 'L's are added while the name is the name of a symbol of the object.
+ *
+ * @param   *dis        The disassembly state.
+ * @param   address     The address of the label.
+ *
+ * @return  The new label name (dynamically allocated).
+ */
+char *createSyntheticLabel(const disassembly_t *dis, int address)
+{
+    char *label = (char *) allocate_space(MAX_LABEL_LEN + SIZE_FOR_NULL);
+    int prefixLength = ONE_INDEX;
+
+    do
+    {
+        (void) memset(label, SYNTHETIC_LABEL_PREFIX, prefixLength);
+        (void) sprintf(label + prefixLength, "%d", address);
+        prefixLength++;
+    } while (isObjectSymbolName(dis -> objectFile, label) == TRUE);
+
+    return label;
+}
+
+/*
+ * Checks if a name is the name of an entry or an external symbol of an object.
+ *
+ * @param   *objectFile     The object.
+ * @param   *name           The name to check.
+ *
+ * @return  TRUE if the name is a name of a symbol of the object, otherwise FALSE.
+ */
+boolean isObjectSymbolName(const ObjectFile *objectFile, const char *name)
+{
+    boolean isSymbolName = FALSE;
+    int i; /* Loop variable. */
+
+    for (i = ZERO_INDEX; i < objectFile -> entriesAmount && isSymbolName == FALSE; i++)
+        isSymbolName = sameStrings(objectFile -> entries[i].name, name);
+    for (i = ZERO_INDEX; i < objectFile -> externsAmount && isSymbolName == FALSE; i++)
+        isSymbolName = sameStrings(objectFile -> externs[i].name, name);
+
+    return isSymbolName;
+}
+
+/*
+ * Writes the .extern lines (by the order of the first use of every symbol)
+ * and the .entry lines (by the order of the .ent file).
+ *
+ * @param   *dis    The disassembly state.
+ */
+void writeDeclarations(disassembly_t *dis)
+{
+    const ObjectFile *objectFile = dis -> objectFile;
+    boolean isDeclared;
+    int i, j; /* Loop variables. */
+
+    for (i = ZERO_INDEX; i < objectFile -> externsAmount; i++)
+    {
+        isDeclared = FALSE;
+        for (j = ZERO_INDEX; j < i && isDeclared == FALSE; j++)
+            isDeclared = sameStrings(objectFile -> externs[i].name, objectFile -> externs[j].name);
+
+        if (isDeclared == FALSE)
+        {
+            writeText(dis, ".extern ");
+            writeText(dis, objectFile -> externs[i].name);
+            writeText(dis, "\n");
+        }
+    }
+
+    for (i = ZERO_INDEX; i < objectFile -> entriesAmount; i++)
+    {
+        writeText(dis, ".entry ");
+        writeText(dis, objectFile -> entries[i].name);
+        writeText(dis, "\n");
+    }
+}
+
+/*
+ * Writes an instruction line for every instruction of the code segment.
+ *
+ * @param   *dis    The disassembly state.
+ */
+void writeCodeSegment(disassembly_t *dis)
+{
+    const decoded_word_t *decodedWord;
+    int index = ZERO_INDEX, argIndex;
+
+    while (index < dis -> codeSize)
+    {
+        decodedWord = decodeInstructionWord(dis -> values[index]);
+        argIndex = index + ONE_INDEX;
+
+        writeLabel(dis, index);
+        writeText(dis, getOpcodeName(decodedWord -> opcode));
+
+        if (decodedWord -> srcMtd != ZERO_ADD_MTD)
+        {
+            writeText(dis, " ");
+            argIndex += writeArgument(dis, argIndex, decodedWord -> srcMtd, FALSE);
+            writeText(dis, ",");
+
+            /* Two register arguments share one word. */
+            if (decodedWord -> destMtd == DIRECT_REGISTER &&
+                decodedWord -> srcMtd == DIRECT_REGISTER)
+                argIndex--;
+        }
+        if (decodedWord -> destMtd != ZERO_ADD_MTD)
+        {
+            writeText(dis, " ");
+            (void) writeArgument(dis, argIndex, decodedWord -> destMtd, TRUE);
+        }
+
+        writeText(dis, "\n");
+        index += decodedWord -> length;
+    }
+}
+
+/*
+ * Writes an argument of an instruction.
+ *
+ * @param   *dis        The disassembly state.
+ * @param   index       The index of the argument word.
+ * @param   method      The addressing method of the argument.
+ * @param   isDest      Flag indicating if the argument is the destination argument.
+ *
+ * @return  The amount of words the argument took (one).
+ */
+int writeArgument(disassembly_t *dis, int index, addressing_method_t method, boolean isDest)
+{
+    char argument[ADDRESS_BUFFER];
+    int word = dis -> values[index];
+
+    if (method == INSTANT)
+    {
+        (void) sprintf(argument, "%d", to_signed(get_field(word, DIR_DATA_LOW, DIR_DATA_HIGH),
+                                                 INSTANT_SIGN_BIT, INSTANT_RANGE));
+        writeText(dis, argument);
+    }
+
+    else if (method == DIRECT)
+        writeText(dis, (dis -> externUses[index] != NULL)? dis -> externUses[index] :
+                       dis -> labels[get_field(word, DIR_DATA_LOW, DIR_DATA_HIGH) -
+                                     PROGRAM_MEM_START]);
+
+    else /* DIRECT_REGISTER */
+    {
+        (void) sprintf(argument, "@r%d", (isDest == TRUE)?
+                get_field(word, DEST_REG_LOW, DEST_REG_HIGH) :
+                get_field(word, SRC_REG_LOW, SRC_REG_HIGH));
+        writeText(dis, argument);
+    }
+
+    return ONE_INDEX;
+}
+
+/*
+ * Writes the data segment, a new line starts at every label.
+ *
+ * @param   *dis    The disassembly state.
+ */
+void writeDataSegment(disassembly_t *dis)
+{
+    int index = dis -> codeSize, stringLength;
+
+    while (index < dis -> wordsAmount)
+    {
+        writeLabel(dis, index);
+
+        stringLength = writeStringLine(dis, index);
+        index += (stringLength > ZERO_COUNT)? stringLength : writeDataLine(dis, index);
+    }
+}
+
+/*
+ * Writes a .string line if the data from the given index is a string
+ * (printable characters and a null character, before the next label).
+ *
+ * @param   *dis    The disassembly state.
+ * @param   index   The index of the first word of the line.
+ *
+ * @return  The amount of words written (zero if the data is not a string).
+ */
+int writeStringLine(disassembly_t *dis, int index)
+{
+    char string[MAX_LINE_LEN + SIZE_FOR_NULL];
+    int length = ZERO_COUNT, maxLength = MAX_LINE_LEN - (int) strlen(STRING_GUIDANCE " \"\"") -
+            ((dis -> labels[index] != NULL)? (int) strlen(dis -> labels[index]) +
+                                              (int) strlen(LABEL_SEPARATOR) : ZERO_COUNT);
+
+    while (index + length < dis -> wordsAmount && length < maxLength &&
+           is_printable(dis -> values[index + length]) &&
+           (length == ZERO_COUNT || dis -> labels[index + length] == NULL))
+    {
+        string[length] = (char) dis -> values[index + length];
+        length++;
+    }
+
+    /* The string must end with a null character, which is not the start of a label. */
+    if (length < MIN_STRING_LEN || index + length >= dis -> wordsAmount ||
+        dis -> values[index + length] != END_OF_STRING || dis -> labels[index + length] != NULL)
+        return ZERO_COUNT;
+
+    string[length] = '\0';
+    writeText(dis, STRING_GUIDANCE " \"");
+    writeText(dis, string);
+    writeText(dis, "\"\n");
+
+    return length + ONE_INDEX;
+}
+
+/*
+ * Writes a .data line, until the next label or the maximum line length.
+ *
+ * @param   *dis    The disassembly state.
+ * @param   index   The index of the first word of the line.
+ *
+ * @return  The amount of words written.
+ */
+int writeDataLine(disassembly_t *dis, int index)
+{
+    char value[ADDRESS_BUFFER];
+    int lineLength = (int) strlen(DATA_GUIDANCE) + ((dis -> labels[index] != NULL)?
+            (int) strlen(dis -> labels[index]) + (int) strlen(LABEL_SEPARATOR) : ZERO_COUNT);
+    int amount = ZERO_COUNT;
+
+    writeText(dis, DATA_GUIDANCE);
+
+    do
+    {
+        (void) sprintf(value, (amount == ZERO_COUNT)? " %d" : ", %d",
+                       to_signed(dis -> values[index + amount], WORD_SIGN_BIT, WORD_RANGE));
+        writeText(dis, value);
+        lineLength += (int) strlen(value);
+        amount++;
+    } while (index + amount < dis -> wordsAmount && dis -> labels[index + amount] == NULL &&
+             lineLength + (int) strlen(LONGEST_DATA_VALUE) <= MAX_LINE_LEN);
+
+    writeText(dis, "\n");
+
+    return amount;
+}
+
+/*
+ * Writes the label defined at an index, if there is one.
+ *
+ * @param   *dis    The disassembly state.
+ * @param   index   The index of the word.
+ */
+void writeLabel(disassembly_t *dis, int index)
+{
+    if (dis -> labels[index] != NULL)
+    {
+        writeText(dis, dis -> labels[index]);
+        writeText(dis, LABEL_SEPARATOR);
+    }
+}
+
+/*
+ * Adds text to the end of the reconstructed source code.
+ *
+ * @param   *dis    The disassembly state.
+ * @param   *text   The text to add.
+ */
+void writeText(disassembly_t *dis, const char *text)
+{
+    size_t length = strlen(text);
+
+    (void) memcpy(dis -> text + dis -> textLength, text, length + SIZE_FOR_NULL);
+    dis -> textLength += length;
+}
+
+/*
+ * Frees the memory of a disassembly state.
+ *
+ * @param   *dis    The disassembly state.
+ */
+void clearDisassembly(disassembly_t *dis)
+{
+    int i; /* Loop variable. */
+
+    for (i = ZERO_INDEX; i < dis -> syntheticAmount; i++)
+    {
+        (void) clear_ptr(dis -> syntheticLabels[i])
+    }
+
+    (void) clear_ptr(dis -> syntheticLabels)
+    (void) clear_ptr(dis -> values)
+    (void) clear_ptr(dis -> labels)
+    (void) clear_ptr(dis -> isTarget)
+    (void) clear_ptr(dis -> isInstStart)
+    (void) clear_ptr(dis -> externUses)
+    (void) clear_ptr(dis -> text)
+}
@@ -0,0 +1,29 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the disassembler_algorithm.c file.
+ */
+
+#ifndef MMN_14_DISASSEMBLER_ALGORITHM_H
+#define MMN_14_DISASSEMBLER_ALGORITHM_H
+
+#include "../new-data-types/boolean.h"
+#include "../new-data-types/process_result.h"
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Reconstructs the source code of an assembled object.
+ * Writes the source code to {object_name}.dis.as.
+ *
+ * @param   *object_name    The name of the object (without endings).
+ * @param   isTimed         Flag indicating if the time of the disassembly is reported.
+ *
+ * @return  SUCCESS if the source code was reconstructed, otherwise FAILURE.
+ */
+process_result disassemble_object(const char *object_name, boolean isTimed);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_DISASSEMBLER_ALGORITHM_H */
@@ -0,0 +1,127 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * decodeTable.c
+ *
+ * This file has the decode table of the first words of instructions.
+ *
+ * The table has an entry for every one of the 4096 possible 12 bits words, so decoding
+ * a word is a single lookup. It is built from the same definitions the encoder uses:
+ * the bit ranges of the fields, the opcodes, and the valid addressing methods of
+ * every operation (validArg, from the instruction set table).
+ */
+
+/* ---Include header files--- */
+#include <stddef.h>
+#include "../new-data-types/boolean.h"
+#include "../general-enums/indexes.h"
+#include "encoding-finals/encoding_finals.h"
+#include "encoding-finals/ranges.h"
+#include "../assembler_ast/assembler_ast.h"
+#include "../diagnoses/assembler_diagnoses.h"
+#include "decodeTable.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define ONE_BIT 1
+/* ------------ */
+
+/* ---Macros--- */
+#define get_field(word, low, high) (((word) >> (low)) & ((ONE_BIT << ((high) - (low) + 1)) - 1))
+/* ------------ */
+
+/* The decode table, by the value of the word. */
+static decoded_word_t decodeTable[WORD_VALUES_AMOUNT];
+static boolean isDecodeTableBuilt = FALSE;
+
+/* ---------------Prototypes--------------- */
+void decodeWordForTable(int word, decoded_word_t *decodedWord);
+boolean isValidMethodForTable(opcodes_t opcode, boolean isDest, addressing_method_t method);
+/* ---------------------------------------- */
+
+/*
+ * Builds the decode table, if it was not built yet.
+ * Must be called before decoding words, and before any threads that decode words are started.
+ */
+void initDecodeTable(void)
+{
+    int word; /* Loop variable. */
+
+    if (isDecodeTableBuilt == FALSE)
+    {
+        for (word = ZERO_INDEX; word < WORD_VALUES_AMOUNT; word++)
+            decodeWordForTable(word, &decodeTable[word]);
+        isDecodeTableBuilt = TRUE;
+    }
+}
+
+/*
+ * Decodes the first word of an instruction.
+ *
+ * @param   word    The 12 bits word to decode.
+ *
+ * @return  The decoded word (its opcode is NO_OPCODE if the word is not a valid instruction).
+ */
+const decoded_word_t *decodeInstructionWord(int word)
+{
+    return &decodeTable[word];
+}
+
+/*
+ * Decodes a word for the decode table.
+ *
+ * @param   word            The word to decode.
+ * @param   *decodedWord    Will hold the decoded word.
+ */
+void decodeWordForTable(int word, decoded_word_t *decodedWord)
+{
+    opcodes_t opcode = (opcodes_t) get_field(word, OPCODE_LOW, OPCODE_HIGH);
+    addressing_method_t srcMtd = (addressing_method_t) get_field(word, SRC_MTD_LOW, SRC_MTD_HIGH);
+    addressing_method_t destMtd = (addressing_method_t) get_field(word, DEST_MTD_LOW,
+                                                                   DEST_MTD_HIGH);
+
+    /* The first word of an instruction is absolute. */
+    if (get_field(word, ARE_LOW, ARE_HIGH) == ABSOLUTE &&
+        isValidMethodForTable(opcode, FALSE, srcMtd) == TRUE &&
+        isValidMethodForTable(opcode, TRUE, destMtd) == TRUE)
+    {
+        decodedWord -> opcode = opcode;
+        decodedWord -> srcMtd = srcMtd;
+        decodedWord -> destMtd = destMtd;
+
+        /* Two register arguments share one word. */
+        decodedWord -> length = ONE_INDEX + ((srcMtd != ZERO_ADD_MTD)? ONE_INDEX : ZERO_INDEX) +
+                ((destMtd != ZERO_ADD_MTD)? ONE_INDEX : ZERO_INDEX) -
+                ((srcMtd == DIRECT_REGISTER && destMtd == DIRECT_REGISTER)? ONE_INDEX : ZERO_INDEX);
+    }
+
+    else
+    {
+        decodedWord -> opcode = NO_OPCODE;
+        decodedWord -> srcMtd = decodedWord -> destMtd = ZERO_ADD_MTD;
+        decodedWord -> length = ONE_INDEX;
+    }
+}
+
+/*
+ * Checks if an addressing method field of an instruction is valid for its operation.
+ *
+ * @param   opcode      The opcode of the instruction.
+ * @param   isDest      Flag indicating if the field is of the destination argument.
+ * @param   method      The value of the addressing method field.
+ *
+ * @return  TRUE if the field is valid, otherwise FALSE.
+ */
+boolean isValidMethodForTable(opcodes_t opcode, boolean isDest, addressing_method_t method)
+{
+    boolean isValid;
+
+    if (method == ZERO_ADD_MTD) /* Valid only if the operation has no such argument. */
+        isValid = (validArg(opcode, isDest, DIRECT) == INVALID_ARG_NUMBER)? TRUE : FALSE;
+    else
+        isValid = ((method == INSTANT || method == DIRECT || method == DIRECT_REGISTER) &&
+                   validArg(opcode, isDest, method) == VALID_ARG)? TRUE : FALSE;
+
+    return isValid;
+}
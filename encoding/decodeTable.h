@@ -0,0 +1,45 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the decodeTable.c file.
+ */
+
+#ifndef MMN_14_DECODETABLE_H
+#define MMN_14_DECODETABLE_H
+
+#include "encoding-finals/opcodes.h"
+#include "encoding-finals/addressing_methods.h"
+
+/* The amount of different 12 bits words. */
+#define WORD_VALUES_AMOUNT 4096
+
+/* A decoded first word of an instruction. */
+typedef struct
+{
+    opcodes_t opcode; /* NO_OPCODE if the word is not a valid first word of an instruction. */
+    addressing_method_t srcMtd; /* ZERO_ADD_MTD if the operation has no source argument. */
+    addressing_method_t destMtd; /* ZERO_ADD_MTD if the operation has no destination argument. */
+    int length; /* The amount of words of the instruction (including the first word). */
+} decoded_word_t;
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Builds the decode table, if it was not built yet.
+ * Must be called before decoding words, and before any threads that decode words are started.
+ */
+void initDecodeTable(void);
+
+/*
+ * Decodes the first word of an instruction.
+ *
+ * @param   word    The 12 bits word to decode.
+ *
+ * @return  The decoded word (its opcode is NO_OPCODE if the word is not a valid instruction).
+ */
+const decoded_word_t *decodeInstructionWord(int word);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_DECODETABLE_H */
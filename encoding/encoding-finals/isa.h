@@ -0,0 +1,45 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file contains the description of the instruction set of the imaginary computer.
+ * The opcodes, their names and their legal addressing methods are all made from the
+ * one list below, so adding an operation is adding a line to it.
+ */
+
+#ifndef MMN_14_ISA_H
+#define MMN_14_ISA_H
+
+#include "addressing_methods.h"
+
+/* Bits of the addressing methods, for the masks of the legal addressing methods. */
+#define INST_B (1 << INSTANT)
+#define DIR_B (1 << DIRECT)
+#define REG_B (1 << DIRECT_REGISTER)
+#define NO_ARG_B 0 /* The operation has no such argument. */
+
+/*
+ * The operations, by the order of their opcodes:
+ * X(name, legal source addressing methods, legal destination addressing methods, cycles).
+ * The cycles are of the execution of the operation only, without fetching its words and
+ * accessing its memory operands (see the cost model of the control flow report).
+ */
+#define ISA_OPERATIONS(X) \
+        X(mov,  INST_B | DIR_B | REG_B,           DIR_B | REG_B,  1) \
+        X(cmp,  INST_B | DIR_B | REG_B,  INST_B | DIR_B | REG_B,  1) \
+        X(add,  INST_B | DIR_B | REG_B,           DIR_B | REG_B,  1) \
+        X(sub,  INST_B | DIR_B | REG_B,           DIR_B | REG_B,  1) \
+        X(not,  NO_ARG_B,                         DIR_B | REG_B,  1) \
+        X(clr,  NO_ARG_B,                         DIR_B | REG_B,  1) \
+        X(lea,           DIR_B,                   DIR_B | REG_B,  1) \
+        X(inc,  NO_ARG_B,                         DIR_B | REG_B,  1) \
+        X(dec,  NO_ARG_B,                         DIR_B | REG_B,  1) \
+        X(jmp,  NO_ARG_B,                         DIR_B | REG_B,  1) \
+        X(bne,  NO_ARG_B,                         DIR_B | REG_B,  1) \
+        X(red,  NO_ARG_B,                         DIR_B | REG_B,  2) \
+        X(prn,  NO_ARG_B,                INST_B | DIR_B | REG_B,  2) \
+        X(jsr,  NO_ARG_B,                         DIR_B | REG_B,  2) \
+        X(rts,  NO_ARG_B,                         NO_ARG_B,       2) \
+        X(stop, NO_ARG_B,                         NO_ARG_B,       1)
+
+#endif /* MMN_14_ISA_H */
@@ -8,9 +8,13 @@
 #ifndef MMN_14_OPCODES_H
 #define MMN_14_OPCODES_H
 
-/* Represents all the opcodes. */
+#include "isa.h"
+
+#define OPCODE_ENUM_ENTRY(name, srcMethods, destMethods, cycles) name,
+
+/* Represents all the opcodes (in the order of the instruction set list). */
 typedef enum {NO_OPCODE = -1,
-              mov, cmp, add, sub, not, clr, lea, inc, dec, jmp, bne, red, prn, jsr, rts, stop,
+              ISA_OPERATIONS(OPCODE_ENUM_ENTRY)
               OPCODE_AMOUNT} opcodes_t;
 
-#endif /* MMN_14_OPCODES_H */
\ No newline at end of file
+#endif /* MMN_14_OPCODES_H */
@@ -41,7 +41,7 @@
 #include <string.h>
 #include "../new-data-types/boolean.h"
 #include "../assembler_ast/assembler_ast.h"
-#include "../NameTable/NameTable.h"
+#include "../SymbolTable/SymbolTable.h"
 #include "../general-enums/programFinals.h"
 #include "../general-enums/neededKeys.h"
 #include "../general-enums/indexes.h"
@@ -55,11 +55,9 @@
 /* -------------------------- */
 
 /* ---Finals--- */
+#define MEMORY_MODULE ENCODING_MEMORY /* For the memory statistics. */
 #define ZERO_BYTE 0
-#define CHARS_FOR_WORD 2
 #define SIZE_FOR_NEW_LINE 1
-#define FIRST_PART_OF_WORD 0
-#define SECOND_PART_OF_WORD 1
 #define BUFFER 82
 /* ------------ */
 
@@ -69,16 +67,16 @@
 /* ------------------------------------------ */
 
 /* ---------------Prototypes--------------- */
-void encodeInstruction(ast_t *lineAst, MemoryImage *memoryImage, NameTable *normalLabels,
-                     NameTable *extLabels, char **extFileContents);
+void encodeInstruction(ast_t *lineAst, MemoryImage *memoryImage, SymbolTable *symbols,
+                       char **extFileContents, char **relFileContents);
 void encodeDataNumber(ast_t *lineAst, MemoryImage *memoryImage);
 void encodeDataString(ast_t *lineAst, MemoryImage *memoryImage);
 void encodeInstructionWithZeroArgs(word_t *instructions, int *currWord);
 void encodeInstructionWithOneArgs(word_t *instructions, int *currWord, arg_node_t *argument,
-                          NameTable *normalLabels, NameTable *extLabels, char **extFileContents);
+                          SymbolTable *symbols, char **extFileContents, char **relFileContents);
 void encodeInstructionWithTwoArgs(word_t *instructions, int *currWord, arg_node_t *firstArg,
-                          arg_node_t *secondArg, NameTable *normalLabels, NameTable *extLabels,
-                          char **extFileContents);
+                          arg_node_t *secondArg, SymbolTable *symbols, char **extFileContents,
+                          char **relFileContents);
 /* ---------------------------------------- */
 
 /*
@@ -95,16 +93,16 @@ MemoryImage *createMemoryImage(int IC, int DC)
 
     /* Allocating space for the instructions memory image. */
     if (IC > ZERO_COUNT) {
-        newMemoryImage -> instructions = (word_t *) calloc(IC, sizeof(word_t));
-        handle_allocation_error(newMemoryImage -> instructions);
+        newMemoryImage -> instructions = (word_t *) allocate_space(IC * sizeof(word_t));
+        (void) memset(newMemoryImage -> instructions, 0, IC * sizeof(word_t));
     }
 
     else newMemoryImage -> instructions = NULL;
 
     /* Allocating space for the data memory image. */
     if (DC > ZERO_COUNT) {
-        newMemoryImage -> data = (word_t *) calloc(DC, sizeof(word_t));
-        handle_allocation_error(newMemoryImage -> data);
+        newMemoryImage -> data = (word_t *) allocate_space(DC * sizeof(word_t));
+        (void) memset(newMemoryImage -> data, 0, DC * sizeof(word_t));
     }
     else newMemoryImage -> data = NULL;
 
@@ -115,6 +113,31 @@ MemoryImage *createMemoryImage(int IC, int DC)
     return newMemoryImage;
 }
 
+/*
+ * Create a new full MemoryImage structure out of already encoded words.
+ *
+ * @param   *words  The code words followed by the data words.
+ * @param   IC      The number of instruction words in the given words.
+ * @param   DC      The number of data words in the given words.
+ *
+ * @return  Pointer to the newly created MemoryImage structure.
+ */
+MemoryImage *createMemoryImageFromWords(const word_t *words, int IC, int DC)
+{
+    MemoryImage *newMemoryImage = createMemoryImage(IC, DC);
+
+    /* Copy the segments and mark all the words as encoded. */
+    if (IC > ZERO_COUNT)
+        (void) memcpy(newMemoryImage -> instructions, words, IC * sizeof(word_t));
+    if (DC > ZERO_COUNT)
+        (void) memcpy(newMemoryImage -> data, words + IC, DC * sizeof(word_t));
+
+    newMemoryImage -> currWord[IC_] = IC;
+    newMemoryImage -> currWord[DC_] = DC;
+
+    return newMemoryImage;
+}
+
 /*
  * Gets encoding information.
  * Encoding information is the following string: {IC [tab] DC [new line]}.
@@ -138,17 +161,17 @@ char *getEncodingInformation(MemoryImage *memoryImage)
  *
  * @param   *lineAst            Abstract syntax tree (AST) representing the line of assembly code.
  * @param   *memoryImage        The memory image where the encoded instructions/data will be stored.
- * @param   *normalLabels       The normal labels table.
- * @param   *extLabels          The external labels table.
+ * @param   *symbols            The table of the symbols (labels) of the file.
  * @param   **extFileContents   Pointer to the string of the external file content to output.
+ * @param   **relFileContents   Pointer to the string of the relocation table to output.
  */
-void encodeLine(ast_t *lineAst, MemoryImage *memoryImage, NameTable *normalLabels,
-                NameTable *extLabels, char **extFileContents)
+void encodeLine(ast_t *lineAst, MemoryImage *memoryImage, SymbolTable *symbols,
+                char **extFileContents, char **relFileContents)
 {
     sentence_t astSentence = getSentence(lineAst);
 
     if (astSentence.sentenceType == DIRECTION_SENTENCE) /* Encode direction. */
-        encodeInstruction(lineAst, memoryImage, normalLabels, extLabels, extFileContents);
+        encodeInstruction(lineAst, memoryImage, symbols, extFileContents, relFileContents);
 
     /* lineAst.sentenceType == GUIDANCE_SENTENCE */
     else if (astSentence.sentence.guidance == data) /* Encode number data. */
@@ -165,12 +188,12 @@ void encodeLine(ast_t *lineAst, MemoryImage *memoryImage, NameTable *normalLabel
  *
  * @param   *lineAst            The abstract syntax tree (AST) representing the instruction.
  * @param   *memoryImage        The memory image where the encoded instruction will be stored.
- * @param   *normalLabels       The normal labels table.
- * @param   *extLabels          The external labels table.
+ * @param   *symbols            The table of the symbols (labels) of the file.
  * @param   **extFileContents   Pointer to the string of the external file content to output.
+ * @param   **relFileContents   Pointer to the string of the relocation table to output.
  */
-void encodeInstruction(ast_t *lineAst, MemoryImage *memoryImage, NameTable *normalLabels,
-                     NameTable *extLabels, char **extFileContents)
+void encodeInstruction(ast_t *lineAst, MemoryImage *memoryImage, SymbolTable *symbols,
+                       char **extFileContents, char **relFileContents)
 {
     /* Save instruction data image and current address to encode instruction in. */
     word_t *instructions = memoryImage -> instructions;
@@ -188,10 +211,10 @@ void encodeInstruction(ast_t *lineAst, MemoryImage *memoryImage, NameTable *norm
 
     else if (secondArg == NULL)
         encodeInstructionWithOneArgs(instructions, currWord, firstArg,
-                                     normalLabels, extLabels, extFileContents);
+                                     symbols, extFileContents, relFileContents);
     else
-        encodeInstructionWithTwoArgs(instructions, currWord, firstArg, secondArg, normalLabels,
-                                     extLabels, extFileContents);
+        encodeInstructionWithTwoArgs(instructions, currWord, firstArg, secondArg, symbols,
+                                     extFileContents, relFileContents);
 }
 
 /*
@@ -245,7 +268,7 @@ void encodeDataString(ast_t *lineAst, MemoryImage *memoryImage)
 void encodeInstructionWithZeroArgs(word_t *instructions, int *currWord)
 {
     /* Turn addressing methods for dest and src arguments to 0. */
-    encodeAddressingMethods(instructions[*currWord],
+    encodeAddressingMethods(&instructions[*currWord],
                             ZERO_ADD_MTD, ZERO_ADD_MTD);
     (*currWord)++; /* Increase currWord by 1 since only 1 word is needed for decoding. */
 }
@@ -257,19 +280,19 @@ void encodeInstructionWithZeroArgs(word_t *instructions, int *currWord)
  * @param   *currWord           pointer to the current word index in the array
  *                              (updated after encoding).
  * @param   *argument           Argument node representing the argument of the instruction.
- * @param   *normalLabels       Table of normal labels for reference.
- * @param   *extLabels          Table of external labels for reference.
+ * @param   *symbols            The table of the symbols (labels) of the file.
  * @param   **extFileContents   Pointer to the string of the external file content to output.
+ * @param   **relFileContents   Pointer to the string of the relocation table to output.
  */
 void encodeInstructionWithOneArgs(word_t *instructions, int *currWord, arg_node_t *argument,
-                          NameTable *normalLabels, NameTable *extLabels, char **extFileContents)
+                          SymbolTable *symbols, char **extFileContents, char **relFileContents)
 {
     addressing_method_t destMtd = getArgAddressingMethod(argument);
-    encodeAddressingMethods(instructions[*currWord], destMtd, ZERO_ADD_MTD);
+    encodeAddressingMethods(&instructions[*currWord], destMtd, ZERO_ADD_MTD);
 
     (*currWord)++; /* Argument word */
-    encodeDirArgument(instructions[*currWord], *currWord + PROGRAM_MEM_START, argument,
-                      TRUE, normalLabels, extLabels, extFileContents);
+    encodeDirArgument(&instructions[*currWord], *currWord + PROGRAM_MEM_START, argument,
+                      TRUE, symbols, extFileContents, relFileContents);
 
     (*currWord)++; /* Next word */
 }
@@ -282,31 +305,31 @@ void encodeInstructionWithOneArgs(word_t *instructions, int *currWord, arg_node_
  *                              (updated after encoding).
  * @param   *firstArg           Argument node representing the first argument of the instruction.
  * @param   *secondArg          Argument node representing the second argument of the instruction.
- * @param   *normalLabels       Table of normal labels for reference.
- * @param   *extLabels          Table of external labels for reference.
+ * @param   *symbols            The table of the symbols (labels) of the file.
  * @param   **extFileContents   pointer to the string of the external file content to output.
+ * @param   **relFileContents   Pointer to the string of the relocation table to output.
  */
 void encodeInstructionWithTwoArgs(word_t *instructions, int *currWord, arg_node_t *firstArg,
-                          arg_node_t *secondArg, NameTable *normalLabels, NameTable *extLabels,
-                          char **extFileContents)
+                          arg_node_t *secondArg, SymbolTable *symbols, char **extFileContents,
+                          char **relFileContents)
 {
     /* Get addressing methods for both of the arguments and encode them into the first word. */
     addressing_method_t srcMtd = getArgAddressingMethod(firstArg);
     addressing_method_t destMtd = getArgAddressingMethod(secondArg);
-    encodeAddressingMethods(instructions[*currWord], destMtd, srcMtd);
+    encodeAddressingMethods(&instructions[*currWord], destMtd, srcMtd);
     (*currWord)++; /* First argument word. */
 
     /* Special case where both of the arguments are registers, they can be encoded in one word. */
     if (destMtd == DIRECT_REGISTER && srcMtd == DIRECT_REGISTER)
-        encodeDirectRegisterArg(instructions[*currWord], getArgData(secondArg).data.reg,
+        encodeDirectRegisterArg(&instructions[*currWord], getArgData(secondArg).data.reg,
                                 getArgData(firstArg).data.reg);
     else /* Encode each argument to a different word (dest first). */
     {
-        encodeDirArgument(instructions[*currWord], *currWord + PROGRAM_MEM_START, firstArg,
-                          FALSE, normalLabels, extLabels, extFileContents);
+        encodeDirArgument(&instructions[*currWord], *currWord + PROGRAM_MEM_START, firstArg,
+                          FALSE, symbols, extFileContents, relFileContents);
         (*currWord)++; /* Second argument word. */
-        encodeDirArgument(instructions[*currWord], *currWord + PROGRAM_MEM_START, secondArg,
-                          TRUE, normalLabels, extLabels, extFileContents);
+        encodeDirArgument(&instructions[*currWord], *currWord + PROGRAM_MEM_START, secondArg,
+                          TRUE, symbols, extFileContents, relFileContents);
     }
 
     (*currWord)++; /* Next instruction. */
@@ -324,32 +347,54 @@ void encodeInstructionWithTwoArgs(word_t *instructions, int *currWord, arg_node_
  */
 char *getEncodedWords(MemoryImage *memoryImage, boolean isWordsInstructions)
 {
-    word_t tmpWord; /* Temporary word to hold encoded Base64 words. */
-
     int i; /* Loop variable. */
 
     int wordsCnt = (isWordsInstructions)? memoryImage -> currWord[IC_] :
             memoryImage -> currWord[DC_]; /* How many words to encode. */
-    int size = (CHARS_FOR_WORD + SIZE_FOR_NEW_LINE) * wordsCnt; /* Size of the string. */
-    word_t *specificMemImage = (isWordsInstructions)? memoryImage -> instructions :
+    int size = (BASE64_CHARS_FOR_WORD + SIZE_FOR_NEW_LINE) * wordsCnt; /* Size of the string. */
+    const word_t *specificMemImage = (isWordsInstructions)? memoryImage -> instructions :
             memoryImage -> data;
 
     char *encoded64Words = (char *) allocate_space(size + SIZE_FOR_NULL);
+    char *currLine = encoded64Words; /* The line of the current word. */
     encoded64Words[size] = NULL_TERMINATOR; /* String to return. */
 
     /* Convert each word to Base64 and add a new line after it. */
-    for (i = ZERO_INDEX; i < size; i += (CHARS_FOR_WORD + SIZE_FOR_NEW_LINE))
+    for (i = ZERO_INDEX; i < wordsCnt; i++, currLine += BASE64_CHARS_FOR_WORD + SIZE_FOR_NEW_LINE)
     {
-        convertWordToBase64(specificMemImage[i/3], tmpWord);
-        /* Since we are printing from right to left, we need to reverse the order. */
-        encoded64Words[i + SECOND_PART_OF_WORD] = (char) tmpWord[FIRST_PART_OF_WORD];
-        encoded64Words[i + FIRST_PART_OF_WORD] = (char) tmpWord[SECOND_PART_OF_WORD];
-        encoded64Words[i + CHARS_FOR_WORD] = ENTER_KEY;
+        convertWordToBase64(specificMemImage[i], currLine);
+        currLine[BASE64_CHARS_FOR_WORD] = ENTER_KEY;
     }
 
     return encoded64Words;
 }
 
+/*
+ * Gets the contents of the object file (.ob) of the memory image: the heading of the encoding,
+ * after that the code segment (in Base64) and after that the data segment (also in Base64).
+ *
+ * @param   *memoryImage    The memory image to get the object file contents of.
+ *
+ * @return  The contents of the object file.
+ */
+char *getObjectFileContents(MemoryImage *memoryImage)
+{
+    /* Get the heading of the .ob file. */
+    char *objectFileContents = getEncodingInformation(memoryImage);
+
+    char *instructionSection = getEncodedWords(memoryImage, TRUE); /* Add the code segment. */
+    char *dataSection = getEncodedWords(memoryImage, FALSE); /* Add the data segment. */
+
+    /* Apply to string containing the header. */
+    addTwoStrings(&objectFileContents, instructionSection);
+    addTwoStrings(&objectFileContents, dataSection);
+
+    (void) clear_ptr(instructionSection)
+    (void) clear_ptr(dataSection)
+
+    return objectFileContents;
+}
+
 /*
  * Clears the memory image.
  *
@@ -366,32 +411,15 @@ void clearMemoryImage(MemoryImage **pMemoryImage)
 
 !!! -----DEBUGGING----- !!! IGNORE !!!
 
-void printWord(const word_t word)
+void printWord(word_t word)
 {
     int i;
-    unsigned char mask = 1 << 3;
 
-    for (i = ZERO_INDEX; i < 4; i++)
+    for (i = BITS_IN_WORD - 1; i >= ZERO_INDEX; i--)
     {
-        if (word[SECOND_PART_OF_WORD] & mask)
-            putchar('1');
-        else
-            putchar('0');
-
-        mask >>= 1;
-    }
-    putchar(' ');
-    mask = 1 << 7;
-    for (i = ZERO_INDEX; i < 8; i++)
-    {
-        if (i == 4)
+        putchar((word & (1 << i))? '1' : '0');
+        if (i == 8 || i == 4)
             putchar(' ');
-        if (word[FIRST_PART_OF_WORD] & mask)
-            putchar('1');
-        else
-            putchar('0');
-
-        mask >>= 1;
     }
     putchar('\n');
 }
@@ -8,6 +8,8 @@
 #ifndef MMN_14_ENCODING_H
 #define MMN_14_ENCODING_H
 
+#include "encodingDataStructures/word.h"
+
 /* Prototype for data structure to hold the memory image. */
 typedef struct MemoryImage MemoryImage;
 
@@ -21,6 +23,17 @@ typedef struct MemoryImage MemoryImage;
  */
 MemoryImage *createMemoryImage(int IC, int DC);
 
+/*
+ * Create a new full MemoryImage structure out of already encoded words.
+ *
+ * @param   *words  The code words followed by the data words.
+ * @param   IC      The number of instruction words in the given words.
+ * @param   DC      The number of data words in the given words.
+ *
+ * @return  Pointer to the newly created MemoryImage structure.
+ */
+MemoryImage *createMemoryImageFromWords(const word_t *words, int IC, int DC);
+
 /*
  * Gets encoding information.
  * Encoding information is the following string: {IC [tab] DC [new line]}.
@@ -37,12 +50,12 @@ char *getEncodingInformation(MemoryImage *memoryImage);
  *
  * @param   *lineAst            Abstract syntax tree (AST) representing the line of assembly code.
  * @param   *memoryImage        The memory image where the encoded instructions/data will be stored.
- * @param   *normalLabels       The normal labels table.
- * @param   *extLabels          The external labels table.
+ * @param   *symbols            The table of the symbols (labels) of the file.
  * @param   **extFileContents   A pointer to the string of the external file content to output.
+ * @param   **relFileContents   Pointer to the string of the relocation table to output.
  */
-void encodeLine(ast_t *lineAst, MemoryImage *memoryImage, NameTable *normalLabels,
-                NameTable *extLabels, char **extFileContents);
+void encodeLine(ast_t *lineAst, MemoryImage *memoryImage, SymbolTable *symbols,
+                char **extFileContents, char **relFileContents);
 
 /*
  * Gets a string representing the encoded words of the memory image in Base64.
@@ -56,6 +69,16 @@ void encodeLine(ast_t *lineAst, MemoryImage *memoryImage, NameTable *normalLabel
  */
 char *getEncodedWords(MemoryImage *memoryImage, boolean isWordsInstructions);
 
+/*
+ * Gets the contents of the object file (.ob) of the memory image: the heading of the encoding,
+ * after that the code segment (in Base64) and after that the data segment (also in Base64).
+ *
+ * @param   *memoryImage    The memory image to get the object file contents of.
+ *
+ * @return  The contents of the object file.
+ */
+char *getObjectFileContents(MemoryImage *memoryImage);
+
 /*
  * Clears the memory image.
  *
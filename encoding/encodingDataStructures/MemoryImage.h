@@ -11,7 +11,7 @@
 #include "word.h"
 #include "../../general-enums/assemblerFinals.h"
 
-/* Data structure to hold the memory image. 2 represents the number of real bytes */
+/* Data structure to hold the memory image, the code words and the data words in two arrays. */
 typedef struct
 {
     word_t *instructions;
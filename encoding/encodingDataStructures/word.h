@@ -1,6 +1,6 @@
 /*
  * @author Ofir Paz
- * @version (18/08/2023)
+ * @version (19/10/2026)
  *
  * This file contains the new data type 'word_t'.
  */
@@ -8,8 +8,10 @@
 #ifndef MMN_14_WORD_H
 #define MMN_14_WORD_H
 
-#define BYTES_FOR_WORD 2
+#define BITS_IN_WORD 12
+#define BASE64_CHARS_FOR_WORD 2 /* A word is written with two Base64 characters. */
 
-typedef unsigned char word_t[BYTES_FOR_WORD];
+/* A word of the imaginary computer, in the lower 12 bits (the rest of the bits are 0). */
+typedef unsigned short word_t;
 
 #endif /* MMN_14_WORD_H */
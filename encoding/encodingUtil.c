@@ -6,9 +6,10 @@
  */
 
 /* ---Include header files--- */
+#include <stdio.h>
 #include <stdlib.h>
 #include "../new-data-types/boolean.h"
-#include "../NameTable/NameTable.h"
+#include "../SymbolTable/SymbolTable.h"
 #include "../assembler_ast/assembler_ast.h"
 #include "encoding-finals/ranges.h"
 #include "wordHandling.h"
@@ -17,13 +18,17 @@
 
 /* ---Finals--- */
 #define ZERO_BYTE 0
+#define BUFFER 32
+#define RELOCATABLE_KIND 'R'
+#define EXTERNAL_KIND 'E'
 /* ------------ */
 
 /* ---Macros--- */
 /* ------------ */
 
 /* ---------------Prototypes--------------- */
-void encodeToWordARE(word_t word, encoding_type_t encodingType);
+void encodeToWordARE(word_t *word, encoding_type_t encodingType);
+void addToRelocationTable(char **relFileContents, int address, encoding_type_t encodingType);
 /* ---------------------------------------- */
 
 /*
@@ -36,18 +41,18 @@ void encodeToWordARE(word_t word, encoding_type_t encodingType);
 void encodePartDir(word_t *instructions, int currWord, opcodes_t opcode)
 {
     /* Encode opcode. */
-    setBitsInRangeToVal(instructions[currWord], OPCODE_LOW, OPCODE_HIGH, opcode);
+    setBitsInRangeToVal(&instructions[currWord], OPCODE_LOW, OPCODE_HIGH, opcode);
     /* Encode known A, R, E field (instruction is always absolute). */
-    encodeToWordARE(instructions[currWord], ABSOLUTE);
+    encodeToWordARE(&instructions[currWord], ABSOLUTE);
 }
 
 /*
  * Encodes an immediate argument to the given word.
  *
- * @param   word         The word to encode the immediate argument to.
+ * @param   *word        The word to encode the immediate argument to.
  * @param   instantVal   The immediate value to be encoded.
  */
-void encodeInstantArg(word_t word, int instantVal)
+void encodeInstantArg(word_t *word, int instantVal)
 {
     /* instant value is independent of where the program will be loaded to the memory. */
     encodeToWordARE(word, ABSOLUTE);
@@ -57,23 +62,24 @@ void encodeInstantArg(word_t word, int instantVal)
 /*
  * Encodes a direct argument to the given word using the provided parameters.
  *
- * @param   word              The word to encode the direct argument to.
+ * @param   *word             The word to encode the direct argument to.
  * @param   directLabel       The label for the direct argument.
- * @param   normalLabels      A table containing normal (internal) labels.
- * @param   extLabels         A table containing external labels.
+ * @param   symbols           The table of the symbols (labels) of the file.
  * @param   extFileContents   Pointer to string of external file contents.
+ * @param   relFileContents   Pointer to the string of the relocation table to output.
  * @param   address           The current address for relative addressing calculations.
  */
-void encodeDirectArg(word_t word, int address, const char *directLabel, NameTable *normalLabels,
-                     NameTable *extLabels, char **extFileContents)
+void encodeDirectArg(word_t *word, int address, const char *directLabel, SymbolTable *symbols,
+                     char **extFileContents, char **relFileContents)
 {
-    /* Get the label value from the extern table (if it's there). */
-    name_data_t *labelVal = getDataByName(normalLabels, directLabel);
+    /* Get the record of the label (defined in this file or extern). */
+    const symbol_t *label = findSymbol(symbols, directLabel);
 
-    if (labelVal != NULL) /* Label in argument is defined in this file. */
+    if (label -> flags & SYMBOL_DEFINED) /* Label in argument is defined in this file. */
     {
         encodeToWordARE(word, RELOCATABLE); /* Relocatable encoding. */
-        setBitsInRangeToVal(word, DIR_DATA_LOW, DIR_DATA_HIGH, labelVal -> num);
+        setBitsInRangeToVal(word, DIR_DATA_LOW, DIR_DATA_HIGH, label -> value);
+        addToRelocationTable(relFileContents, address, RELOCATABLE);
     }
     else /* Label in argument is an extern label. */
     {
@@ -81,17 +87,34 @@ void encodeDirectArg(word_t word, int address, const char *directLabel, NameTabl
         /* The address will be found in the linking stage. */
         setBitsInRangeToVal(word, DIR_DATA_LOW, DIR_DATA_HIGH, ZERO_BYTE);
         addToStringInFormat(extFileContents, directLabel, address);
+        addToRelocationTable(relFileContents, address, EXTERNAL);
     }
 }
 
+/*
+ * Adds a word to the relocation table, in the format {address [tab] kind [new line]}.
+ *
+ * @param   **relFileContents   Pointer to the string of the relocation table.
+ * @param   address             The address of the word in the memory.
+ * @param   encodingType        The encoding of the word (RELOCATABLE or EXTERNAL).
+ */
+void addToRelocationTable(char **relFileContents, int address, encoding_type_t encodingType)
+{
+    char relocationLine[BUFFER];
+
+    sprintf(relocationLine, "%d\t%c\n", address,
+            (encodingType == RELOCATABLE)? RELOCATABLE_KIND : EXTERNAL_KIND);
+    addTwoStrings(relFileContents, relocationLine);
+}
+
 /*
  * Encodes to the given word registers arguments.
  *
- * @param   word        The word to encode the register argument to.
+ * @param   *word       The word to encode the register argument to.
  * @param   destReg     The destination register to be encoded as a direct register argument.
  * @param   srcReg      The source register to be encoded as a direct register argument.
  */
-void encodeDirectRegisterArg(word_t word, register_t destReg, register_t srcReg)
+void encodeDirectRegisterArg(word_t *word, register_t destReg, register_t srcReg)
 {
     /* Register is independent of where the program will be loaded to the memory. */
     encodeToWordARE(word, ABSOLUTE);
@@ -104,16 +127,16 @@ void encodeDirectRegisterArg(word_t word, register_t destReg, register_t srcReg)
 /*
  * Encodes an argument of a direction to the given word.
  *
- * @param   word              The word to encode the argument to.
+ * @param   *word             The word to encode the argument to.
  * @param   address           The address of the word in the memory.
  * @param   argument          The argument to encode.
  * @param   isDest            Flag indicating if the argument is for the destination operand.
- * @param   normalLabels      Table of normal labels.
- * @param   extLabels         Table of external labels.
+ * @param   symbols           The table of the symbols (labels) of the file.
  * @param   extFileContents   Pointer to string of external file contents.
+ * @param   relFileContents   Pointer to the string of the relocation table to output.
  */
-void encodeDirArgument(word_t word, int address, arg_node_t *argument, boolean isDest,
-                       NameTable *normalLabels, NameTable *extLabels, char **extFileContents)
+void encodeDirArgument(word_t *word, int address, arg_node_t *argument, boolean isDest,
+                       SymbolTable *symbols, char **extFileContents, char **relFileContents)
 {
     addressing_method_t argMtd = getArgAddressingMethod(argument); /* Get. mtd */
 
@@ -124,7 +147,7 @@ void encodeDirArgument(word_t word, int address, arg_node_t *argument, boolean i
             break;
         case DIRECT: /* Encode and add to ext file content (if needed) single label argument. */
             encodeDirectArg(word, address, getArgData(argument).data.string,
-                            normalLabels, extLabels, extFileContents);
+                            symbols, extFileContents, relFileContents);
             break;
         case DIRECT_REGISTER: /* Encode single register argument. */
             if (isDest == TRUE)
@@ -147,17 +170,18 @@ void encodeDirArgument(word_t word, int address, arg_node_t *argument, boolean i
  */
 void encodeDataVal(word_t *data, int currData, int dataVal)
 {
-    setBitsInRangeToVal(data[currData], DATA_LOW, DATA_HIGH, dataVal);
+    setBitsInRangeToVal(&data[currData], DATA_LOW, DATA_HIGH, dataVal);
 }
 
 /*
  * Encodes the addressing methods for the destination and source operands to the given word.
  *
- * @param   word       The word to encode the addressing methods to.
+ * @param   *word      The word to encode the addressing methods to.
  * @param   destMtd    The addressing method for the destination operand.
  * @param   srcMtd     The addressing method for the source operand.
  */
-void encodeAddressingMethods(word_t word, addressing_method_t destMtd, addressing_method_t srcMtd)
+void encodeAddressingMethods(word_t *word, addressing_method_t destMtd,
+                             addressing_method_t srcMtd)
 {
     setBitsInRangeToVal(word, DEST_MTD_LOW, DEST_MTD_HIGH, destMtd); /* Dest. */
     setBitsInRangeToVal(word, SRC_MTD_LOW, SRC_MTD_HIGH, srcMtd); /* Source. */
@@ -166,10 +190,10 @@ void encodeAddressingMethods(word_t word, addressing_method_t destMtd, addressin
 /*
  * Encodes the A, R, E field to a given word.
  *
- * @param   word            The word to encode the A, R, E field to.
+ * @param   *word           The word to encode the A, R, E field to.
  * @param   encodingType    The specific ARE to be used for encoding.
  */
-void encodeToWordARE(word_t word, encoding_type_t encodingType)
+void encodeToWordARE(word_t *word, encoding_type_t encodingType)
 {
     setBitsInRangeToVal(word, ARE_LOW, ARE_HIGH, encodingType);
 }
\ No newline at end of file
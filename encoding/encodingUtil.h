@@ -22,25 +22,25 @@ void encodePartDir(word_t *instructions, int currWord, opcodes_t opcode);
 /*
  * Encodes to the given word registers arguments.
  *
- * @param   word        The word to encode the register argument to.
+ * @param   *word       The word to encode the register argument to.
  * @param   destReg     The destination register to be encoded as a direct register argument.
  * @param   srcReg      The source register to be encoded as a direct register argument.
  */
-void encodeDirectRegisterArg(word_t word, reg_t destReg, reg_t srcReg);
+void encodeDirectRegisterArg(word_t *word, reg_t destReg, reg_t srcReg);
 
 /*
  * Encodes an argument of a direction to the given word.
  *
- * @param   word              The word to encode the argument to.
+ * @param   *word             The word to encode the argument to.
  * @param   address           The address of the word in the memory.
  * @param   argument          The argument to encode.
  * @param   isDest            Flag indicating if the argument is for the destination operand.
- * @param   normalLabels      Table of normal labels.
- * @param   extLabels         Table of external labels.
+ * @param   symbols           The table of the symbols (labels) of the file.
  * @param   extFileContents   Pointer to string of external file contents.
+ * @param   relFileContents   Pointer to the string of the relocation table to output.
  */
-void encodeDirArgument(word_t word, int address, arg_node_t *argument, boolean isDest,
-                       NameTable *normalLabels, NameTable *extLabels, char **extFileContents);
+void encodeDirArgument(word_t *word, int address, arg_node_t *argument, boolean isDest,
+                       SymbolTable *symbols, char **extFileContents, char **relFileContents);
 
 /*
  * Encodes a data value into the given data word array.
@@ -54,19 +54,20 @@ void encodeDataVal(word_t *data, int currData, int dataVal);
 /*
  * Encodes the addressing methods for the destination and source operands to the given word.
  *
- * @param   word       The word to encode the addressing methods to.
+ * @param   *word      The word to encode the addressing methods to.
  * @param   destMtd    The addressing method for the destination operand.
  * @param   srcMtd     The addressing method for the source operand.
  */
-void encodeAddressingMethods(word_t word, addressing_method_t destMtd, addressing_method_t srcMtd);
+void encodeAddressingMethods(word_t *word, addressing_method_t destMtd,
+                             addressing_method_t srcMtd);
 
 /*
  * Encodes the A, R, E field to a given word.
  *
- * @param   word            The word to encode the A, R, E field to.
+ * @param   *word           The word to encode the A, R, E field to.
  * @param   encodingType    The specific ARE to be used for encoding.
  */
-void encodeToWordARE(word_t word, encoding_type_t encodingType);
+void encodeToWordARE(word_t *word, encoding_type_t encodingType);
 
 /* ---------------------------------------- */
 
@@ -13,37 +13,29 @@
 
 /* ---Finals--- */
 #define FIRST_BIT_ON 1
-#define FIRST_PART_OF_WORD 0
-#define SECOND_PART_OF_WORD 1
-#define SIX_NUMBER 6
-#define TWO_NUMBER 2
-#define FOUR_NUMBER 4
+#define UPPER_PART_OF_WORD 0
+#define LOWER_PART_OF_WORD 1
+#define BITS_IN_BASE64_CHAR 6
+#define BASE64_CHAR_MASK 0x3f
 #define ZERO_BYTE 0
-#define FULL_1_BYTE ((unsigned ) 0xff)
-#define BITS_IN_BYTE 8
 #define START_WORD_RANGE 0
 #define END_WORD_RANGE 11
+#define BASE64_VALUES "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+#define BASE64_VALUES_AMOUNT 64
+#define ASCII_AMOUNT 256
+#define INVALID_BASE64_VAL (-1)
 /* ------------ */
 
 /* ---Macros--- */
 
-/* ---Masking operations--- */
-
-/* Use when 1 <= n <= 8. */
-#define get_first_n_bits(byte, n) ((byte) & (FULL_1_BYTE >> (BITS_IN_BYTE - (n))))
-
 /* Use when low and high are numbers. */
 #define isValidWordRange(low, high)\
     ((START_WORD_RANGE <= (low) && (low) <= (high) && (high) <= END_WORD_RANGE)? TRUE : FALSE)
 
 #define range(low, high) ((high) - (low) + 1)
 
-/* Use when 0 <= low <= high <= 7 and val can fit in (high - low + 1) bits. */
-#define set_bits_to_val(byte, low, high, val) (byte = \
-    ((val) << (low)) | \
-    (((low) > ZERO_INDEX)? get_first_n_bits(byte, low) : ZERO_BYTE) | \
-    (((high) < BITS_IN_BYTE)?                     \
-        (get_first_n_bits((byte) >> (high), (BITS_IN_BYTE - (high))) << (high)) : ZERO_BYTE))
+/* Mask of the bits low to high (including) of a word. */
+#define range_mask(low, high) (((FIRST_BIT_ON << range(low, high)) - 1) << (low))
 
 /* ------------ */
 
@@ -85,57 +77,92 @@ boolean isUnsignedOverflow(int size, unsigned long int val)
 }
 
 /*
- * Sets a range of bits in a word to the specified value.
+ * Sets a range of bits in a word to the specified value (the rest of the word is kept).
  *
- * @param   word    The word where the bits will be modified.
+ * @param   *word   The word where the bits will be modified.
  * @param   low     The lowest index (0-based) of the bit range to set (including low).
  * @param   high    The highest index (0-based) of the bit range to set (including high).
  * @param   val     The value to which the specified bit range should be set.
  */
-void setBitsInRangeToVal(word_t word, int low, int high, int val)
+void setBitsInRangeToVal(word_t *word, int low, int high, int val)
 {
     if (isValidWordRange(low, high) == TRUE && isUnsignedOverflow(range(low, high), val) == FALSE)
-    {
-        if (high < BITS_IN_BYTE) /* If the range is just in the first part. */
-            set_bits_to_val(word[FIRST_PART_OF_WORD], low, high, val);
-
-        else if (low < BITS_IN_BYTE) /* If the range is split between the parts. */
-        {
-            /* Set some of the bits at the end of the first part. */
-            set_bits_to_val(word[FIRST_PART_OF_WORD], low, BITS_IN_BYTE - 1,
-                            get_first_n_bits(val, BITS_IN_BYTE - low));
-            /* Set the rest of the bits at the start of the second part. */
-            set_bits_to_val(word[SECOND_PART_OF_WORD], ZERO_INDEX, high - BITS_IN_BYTE,
-                            get_first_n_bits(val >> (BITS_IN_BYTE - low), high - BITS_IN_BYTE + 1));
-        }
-
-        else /* The range is just in the second part. */
-            set_bits_to_val(word[SECOND_PART_OF_WORD], low - BITS_IN_BYTE,
-                            high - BITS_IN_BYTE, val);
-    }
+        *word = (word_t) ((*word & ~range_mask(low, high)) |
+                          (((unsigned) val << low) & range_mask(low, high)));
+}
+
+/*
+ * Gets the value of a range of bits in a word.
+ *
+ * @param   word    The word to get the bits from.
+ * @param   low     The lowest index (0-based) of the bit range to get (including low).
+ * @param   high    The highest index (0-based) of the bit range to get (including high).
+ *
+ * @return  The unsigned value of the bit range, 0 if the range is invalid.
+ */
+int getBitsInRange(word_t word, int low, int high)
+{
+    int value = ZERO_BYTE; /* Value to return, assume invalid range. */
+
+    if (isValidWordRange(low, high) == TRUE)
+        value = (word & range_mask(low, high)) >> low;
+
+    return value;
 }
 
 /*
  * Convert a word to a Base64 representation.
  *
- * @param   word    The word to be converted.
- * @param   word64  The word to hold the Base64 converted word.
+ * @param   word        The word to be converted.
+ * @param   *word64     Will hold the two Base64 characters of the word (upper 6 bits first).
  */
-void convertWordToBase64(const word_t word, word_t word64)
+void convertWordToBase64(word_t word, char *word64)
 {
     /* Conversion is as such: base64Values[i] = i in Base64 */
-    char base64Values[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    const char *base64Values = BASE64_VALUES;
+
+    /* The upper 6 bits of the word are written first, then the lower 6 bits. */
+    word64[UPPER_PART_OF_WORD] = base64Values[(word >> BITS_IN_BASE64_CHAR) & BASE64_CHAR_MASK];
+    word64[LOWER_PART_OF_WORD] = base64Values[word & BASE64_CHAR_MASK];
+}
+
+/*
+ * Convert a Base64 representation back to a word (the inverse of convertWordToBase64).
+ *
+ * @param   *word64     The two Base64 characters of the word (upper 6 bits first).
+ * @param   *word       Will hold the converted word.
+ *
+ * @return  TRUE if both parts of the representation are Base64 characters, otherwise FALSE.
+ */
+boolean convertBase64ToWord(const char *word64, word_t *word)
+{
+    /* Reverse lookup table: base64Indexes[c] = value of the character c in Base64. */
+    static signed char base64Indexes[ASCII_AMOUNT];
+    static boolean isTableReady = FALSE;
+    boolean isValid = FALSE; /* Return value, assume invalid representation. */
+    int upperPart, lowerPart;
 
-    /* Since a word in the assembly language requires a minimum
-     * of two bytes to be represented, We take the first 6 bits of the
-     * representation, and the last 6 bits of it and convert them. */
+    if (isTableReady == FALSE) /* Build the table once. */
+    {
+        const char *base64Values = BASE64_VALUES;
+        int i; /* Loop variable. */
+
+        for (i = ZERO_INDEX; i < ASCII_AMOUNT; i++)
+            base64Indexes[i] = INVALID_BASE64_VAL;
+        for (i = ZERO_INDEX; i < BASE64_VALUES_AMOUNT; i++)
+            base64Indexes[(unsigned char) base64Values[i]] = (signed char) i;
+
+        isTableReady = TRUE;
+    }
 
-    unsigned char firstChar = get_first_n_bits(word[FIRST_PART_OF_WORD], SIX_NUMBER);
-    unsigned char secondChar =
-            (get_first_n_bits(word[FIRST_PART_OF_WORD] >> SIX_NUMBER, TWO_NUMBER)) |
-            (get_first_n_bits(word[SECOND_PART_OF_WORD], FOUR_NUMBER) << TWO_NUMBER);
+    upperPart = base64Indexes[(unsigned char) word64[UPPER_PART_OF_WORD]];
+    lowerPart = base64Indexes[(unsigned char) word64[LOWER_PART_OF_WORD]];
+
+    if (upperPart != INVALID_BASE64_VAL && lowerPart != INVALID_BASE64_VAL)
+    {
+        *word = (word_t) ((upperPart << BITS_IN_BASE64_CHAR) | lowerPart);
+        isValid = TRUE;
+    }
 
-    /* Assign them back to the word in their base 64 equivalents. */
-    word64[FIRST_PART_OF_WORD] = base64Values[firstChar];
-    word64[SECOND_PART_OF_WORD] = base64Values[secondChar];
+    return isValid;
 }
\ No newline at end of file
@@ -23,22 +23,43 @@
 boolean isSignedOverflow(int size, long int val);
 
 /*
- * Sets a range of bits in a word to the specified value.
+ * Sets a range of bits in a word to the specified value (the rest of the word is kept).
  *
- * @param   word    The word where the bits will be modified.
+ * @param   *word   The word where the bits will be modified.
  * @param   low     The lowest index (0-based) of the bit range to set (including low).
  * @param   high    The highest index (0-based) of the bit range to set (including high).
  * @param   val     The value to which the specified bit range should be set.
  */
-void setBitsInRangeToVal(word_t word, int low, int high, int val);
+void setBitsInRangeToVal(word_t *word, int low, int high, int val);
+
+/*
+ * Gets the value of a range of bits in a word.
+ *
+ * @param   word    The word to get the bits from.
+ * @param   low     The lowest index (0-based) of the bit range to get (including low).
+ * @param   high    The highest index (0-based) of the bit range to get (including high).
+ *
+ * @return  The unsigned value of the bit range, 0 if the range is invalid.
+ */
+int getBitsInRange(word_t word, int low, int high);
 
 /*
  * Convert a word to a Base64 representation.
  *
- * @param   word    The word to be converted.
- * @param   word64  The word to hold the Base64 converted word.
+ * @param   word        The word to be converted.
+ * @param   *word64     Will hold the two Base64 characters of the word (upper 6 bits first).
+ */
+void convertWordToBase64(word_t word, char *word64);
+
+/*
+ * Convert a Base64 representation back to a word (the inverse of convertWordToBase64).
+ *
+ * @param   *word64     The two Base64 characters of the word (upper 6 bits first).
+ * @param   *word       Will hold the converted word.
+ *
+ * @return  TRUE if both parts of the representation are Base64 characters, otherwise FALSE.
  */
-void convertWordToBase64(const word_t word, word_t word64);
+boolean convertBase64ToWord(const char *word64, word_t *word);
 
 /* ---------------------------------------- */
 
@@ -8,7 +8,7 @@
 
 /* ---Include header files--- */
 #include <stddef.h>
-#include "../../NameTable/NameTable.h"
+#include "../../SymbolTable/SymbolTable.h"
 #include "../../assembler_ast/assembler_ast.h"
 #include "../error_types/error_types.h"
 #include "../../general-enums/assemblerFinals.h"
@@ -17,6 +17,7 @@
 /* -------------------------- */
 
 /* ---Finals--- */
+#define MEMORY_MODULE DIAGNOSES_MEMORY /* For the memory statistics. */
 /* ------------ */
 
 /* ---Macros--- */
@@ -25,8 +26,9 @@
 /* ---------------Prototypes--------------- */
 Error checkOperationArgErrors(ast_t *lineAst);
 Error checkGuidanceArgErrors(ast_t *lineAst);
-Error checkOneArgOpError(opcodes_t opcode, arg_node_t *destArg);
-Error checkTwoArgOpError(opcodes_t opcode, arg_node_t *destArg, arg_node_t *srcArg);
+LogicalError checkLabelDefFlagsError(int labelFlags);
+LogicalError checkEntryFlagsError(int labelFlags);
+LogicalError checkExternFlagsError(int labelFlags);
 /* ---------------------------------------- */
 
 /*
@@ -68,7 +70,8 @@ Error checkErrorInMissingArg(ast_t *lineAST)
 }
 
 /*
- * Checks for errors in the argument of an operation.
+ * Checks for errors in the arguments of an operation.
+ * The legal addressing methods of every argument are taken from the instruction set table.
  *
  * @param   *lineAst    The AST containing the operation and the arguments.
  *
@@ -81,63 +84,23 @@ Error checkOperationArgErrors(ast_t *lineAst)
     arg_node_t *firstArg = getArgList(lineAst);
     int argCount = getOpGroup(opcode); /* How many arguments are needed. */
 
-    /* Check for errors specifically by how many arguments the operation needs. */
-    if (argCount == ONE_ARGS)
-        argError = checkOneArgOpError(opcode, firstArg);
+    /* The destination argument is the last one, the source argument comes before it. */
+    arg_node_t *destArg = (argCount == TWO_ARGS)? getNextNode(firstArg) : firstArg;
+    arg_node_t *srcArg = (argCount == TWO_ARGS)? firstArg : NULL;
 
-    else if (argCount == TWO_ARGS)
-        argError = checkTwoArgOpError(opcode, getNextNode(firstArg), firstArg);
+    /* Check for specific errors (an operation with no arguments has nothing to check). */
+    if (argCount != ZERO_ARGS)
+    {
+        if (validArg(opcode, TRUE, getArgAddressingMethod(destArg)) == INVALID_ARG_MTD)
+            argError = ILLEGAL_DEST_ARG_MTD_ERR;
 
-    return argError;
-}
+        else if (srcArg != NULL &&
+                 validArg(opcode, FALSE, getArgAddressingMethod(srcArg)) == INVALID_ARG_MTD)
+            argError = ILLEGAL_SRC_ARG_MTD_ERR;
 
-/*
- * Checks for errors in the argument of an operation that accepts one argument only.
- *
- * @param   opcode      The opcode of the operation.
- * @param   *destArg    The argument of the operation.
- *
- * @return  The specific found error, or NO_ERROR if there is none.
- */
-Error checkOneArgOpError(opcodes_t opcode, arg_node_t *destArg)
-{
-    Error argError = NO_ERROR; /* Error to return. */
-    addressing_method_t destMtd = getArgAddressingMethod(destArg);
-
-    /* Check for specific errors. */
-    if (validArg(opcode, TRUE, destMtd) == INVALID_ARG_MTD)
-        argError = ILLEGAL_DEST_ARG_MTD_ERR;
-
-    else if (isOverflowNumber(destArg, FALSE))
-        argError = INSTANT_VALUE_OVERFLOW_ERR;
-
-    return argError;
-}
-
-/*
- * Checks for errors in the argument of an operation that accepts two argument only.
- *
- * @param   opcode      The opcode of the operation.
- * @param   *destArg    The destination argument of the operation.
- * @param   *srcArg     The source argument of the operation.
- *
- * @return  The specific found error, or NO_ERROR if there is none.
- */
-Error checkTwoArgOpError(opcodes_t opcode, arg_node_t *destArg, arg_node_t *srcArg)
-{
-    Error argError = NO_ERROR; /* Error to return. */
-    addressing_method_t destMtd = getArgAddressingMethod(destArg);
-    addressing_method_t srcMtd = getArgAddressingMethod(srcArg);
-
-    /* Check for specific errors. */
-    if (validArg(opcode, TRUE, destMtd) == INVALID_ARG_MTD)
-        argError = ILLEGAL_DEST_ARG_MTD_ERR;
-
-    else if (validArg(opcode, FALSE, srcMtd) == INVALID_ARG_MTD)
-        argError = ILLEGAL_SRC_ARG_MTD_ERR;
-
-    else if (isAnyOverflowNumber(srcArg, FALSE))
-        argError = INSTANT_VALUE_OVERFLOW_ERR;
+        else if (isAnyOverflowNumber(firstArg, FALSE))
+            argError = INSTANT_VALUE_OVERFLOW_ERR;
+    }
 
     return argError;
 }
@@ -173,74 +136,109 @@ Error checkGuidanceArgErrors(ast_t *lineAst)
  * Checks for errors in defining a new label.
  *
  * @param   *lineAst        The AST containing the label definition.
- * @param   *normalTable    The normal labels table.
- * @param   *extTable       The external labels table.
+ * @param   *symbols        The table of the symbols (labels) of the file.
  *
  * @return  The specific found error, or NO_ERROR if there is none.
  */
-LogicalError checkLabelDefTableError(ast_t *lineAst, NameTable *normalTable, NameTable *extTable)
+LogicalError checkLabelDefTableError(ast_t *lineAst, SymbolTable *symbols)
 {
-    LogicalError labelDefError = NO_ERROR; /* Error to return. */
     char *labelName = getLabelName(lineAst); /* Save the label name for error diagnoses. */
+    LogicalError labelDefError = checkLabelDefFlagsError(getSymbolFlags(symbols, labelName));
+
+    (void) clear_ptr(labelName) /* Clear unnecessary variable. */
+    return labelDefError;
+}
+
+/*
+ * Checks for errors in adding a new entry label to the entry table.
+ *
+ * @param   *label          The entry label name to check for errors in the addition.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ *
+ * @return  The specific found error, or NO_ERROR if there is none.
+ */
+LogicalError checkAddToEntryTableError(const char *label, SymbolTable *symbols)
+{
+    return checkEntryFlagsError(getSymbolFlags(symbols, label));
+}
+
+/*
+ * Checks for errors in adding a new external label to the extern table.
+ *
+ * @param   *label          The extern label name to check for errors in the addition.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ *
+ * @return  The specific found error, or NO_ERROR if there is none.
+ */
+LogicalError checkAddToExternTableError(const char *label, SymbolTable *symbols)
+{
+    return checkExternFlagsError(getSymbolFlags(symbols, label));
+}
+
+/*
+ * Checks for errors in defining a label, by what is already known about it.
+ *
+ * @param   labelFlags      The flags of the label (SYMBOL_DEFINED, SYMBOL_ENTRY, SYMBOL_EXTERN).
+ *
+ * @return  The specific found error, or NO_ERROR if there is none.
+ */
+LogicalError checkLabelDefFlagsError(int labelFlags)
+{
+    LogicalError labelDefError = NO_ERROR; /* Error to return. */
 
     /* Check the specific error if there is. */
-    if (isNameInTable(normalTable, labelName))
+    if (labelFlags & SYMBOL_DEFINED)
         labelDefError = MULTIPLE_NORMAL_LABEL_DEF_ERR;
 
-    else if (isNameInTable(extTable, labelName))
+    else if (labelFlags & SYMBOL_EXTERN)
         labelDefError = LABEL_DEFINED_AS_NORMAL_AND_EXT_ERR;
 
-    (void) clear_ptr(labelName) /* Clear unnecessary variable. */
     return labelDefError;
 }
 
 /*
- * Checks for errors in adding a new entry label to the entry table.
+ * Checks for errors in declaring a label as entry, by what is already known about it.
  *
- * @param   *label          The entry label name to check for errors in the addition.
- * @param   *entLabels      The entry labels table.
- * @param   *extTable       The external labels table.
+ * @param   labelFlags      The flags of the label (SYMBOL_DEFINED, SYMBOL_ENTRY, SYMBOL_EXTERN).
  *
  * @return  The specific found error, or NO_ERROR if there is none.
  */
-LogicalError checkAddToEntryTableError(const char *label, NameTable *entLabels,
-                                       NameTable *extLabels)
+LogicalError checkEntryFlagsError(int labelFlags)
 {
     LogicalError addToEntryTableError = NO_ERROR; /* Error to return. */
 
     /* Check the specific error if there is. */
-    if (isNameInTable(entLabels, label))
+    if (labelFlags & SYMBOL_ENTRY)
         addToEntryTableError = MULTIPLE_ENTRY_LABEL_DEF_ERR;
 
-    else if (isNameInTable(extLabels, label))
+    else if (labelFlags & SYMBOL_EXTERN)
         addToEntryTableError = LABEL_DEFINED_AS_ENT_AND_EXT_ERR;
 
     return addToEntryTableError;
 }
 
 /*
- * Checks for errors in adding a new external label to the extern table.
+ * Checks for errors in declaring a label as external, by what is already known about it.
  *
- * @param   *label          The extern label name to check for errors in the addition.
- * @param   *labelsMap[]    Array holding all the different label tables.
+ * @param   labelFlags      The flags of the label (SYMBOL_DEFINED, SYMBOL_ENTRY, SYMBOL_EXTERN).
  *
  * @return  The specific found error, or NO_ERROR if there is none.
  */
-LogicalError checkAddToExternTableError(const char *label, NameTable *labelsMap[])
+LogicalError checkExternFlagsError(int labelFlags)
 {
-    LogicalError addToEntryTableError = NO_ERROR; /* Error to return. */
+    LogicalError addToExternTableError = NO_ERROR; /* Error to return. */
 
     /* Check the specific error if there is. */
-    if (isNameInTable(labelsMap[NORMAL], label))
-        addToEntryTableError = LABEL_DEFINED_AS_NORMAL_AND_EXT_ERR;
+    if (labelFlags & SYMBOL_DEFINED)
+        addToExternTableError = LABEL_DEFINED_AS_NORMAL_AND_EXT_ERR;
 
-    else if (isNameInTable(labelsMap[ENTRY], label))
-        addToEntryTableError = LABEL_DEFINED_AS_ENT_AND_EXT_ERR;
+    else if (labelFlags & SYMBOL_ENTRY)
+        addToExternTableError = LABEL_DEFINED_AS_ENT_AND_EXT_ERR;
 
-    else if (isNameInTable(labelsMap[EXTERN], label))
-        addToEntryTableError = MULTIPLE_EXTERN_LABEL_DEF_ERR;
+    else if (labelFlags & SYMBOL_EXTERN)
+        addToExternTableError = MULTIPLE_EXTERN_LABEL_DEF_ERR;
 
-    return addToEntryTableError;
+    return addToExternTableError;
 }
 
 /*
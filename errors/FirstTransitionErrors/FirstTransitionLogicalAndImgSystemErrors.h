@@ -32,34 +32,58 @@ Error checkErrorInMissingArg(ast_t *lineAST);
  * Checks for errors in defining a new label.
  *
  * @param   *lineAst        The AST containing the label definition.
- * @param   *normalTable    The normal labels table.
- * @param   *extTable       The external labels table.
+ * @param   *symbols        The table of the symbols (labels) of the file.
  *
  * @return  The specific found error, or NO_ERROR if there is none.
  */
-LogicalError checkLabelDefTableError(ast_t *lineAst, NameTable *normalTable, NameTable *extTable);
+LogicalError checkLabelDefTableError(ast_t *lineAst, SymbolTable *symbols);
 
 /*
  * Checks for errors in adding a new entry label to the entry table.
  *
  * @param   *label          The entry label name to check for errors in the addition.
- * @param   *entLabels      The entry labels table.
- * @param   *extTable       The external labels table.
+ * @param   *symbols        The table of the symbols (labels) of the file.
  *
  * @return  The specific found error, or NO_ERROR if there is none.
  */
-LogicalError checkAddToEntryTableError(const char *label, NameTable *entLabels,
-                                       NameTable *extLabels);
+LogicalError checkAddToEntryTableError(const char *label, SymbolTable *symbols);
 
 /*
  * Checks for errors in adding a new external label to the extern table.
  *
  * @param   *label          The extern label name to check for errors in the addition.
- * @param   *labelsMap[]    Array holding all the different label tables.
+ * @param   *symbols        The table of the symbols (labels) of the file.
  *
  * @return  The specific found error, or NO_ERROR if there is none.
  */
-LogicalError checkAddToExternTableError(const char *label, NameTable *labelsMap[]);
+LogicalError checkAddToExternTableError(const char *label, SymbolTable *symbols);
+
+/*
+ * Checks for errors in defining a label, by what is already known about it.
+ *
+ * @param   labelFlags      The flags of the label (SYMBOL_DEFINED, SYMBOL_ENTRY, SYMBOL_EXTERN).
+ *
+ * @return  The specific found error, or NO_ERROR if there is none.
+ */
+LogicalError checkLabelDefFlagsError(int labelFlags);
+
+/*
+ * Checks for errors in declaring a label as entry, by what is already known about it.
+ *
+ * @param   labelFlags      The flags of the label (SYMBOL_DEFINED, SYMBOL_ENTRY, SYMBOL_EXTERN).
+ *
+ * @return  The specific found error, or NO_ERROR if there is none.
+ */
+LogicalError checkEntryFlagsError(int labelFlags);
+
+/*
+ * Checks for errors in declaring a label as external, by what is already known about it.
+ *
+ * @param   labelFlags      The flags of the label (SYMBOL_DEFINED, SYMBOL_ENTRY, SYMBOL_EXTERN).
+ *
+ * @return  The specific found error, or NO_ERROR if there is none.
+ */
+LogicalError checkExternFlagsError(int labelFlags);
 
 /*
  * Checks if there has been a program memory overflow.
@@ -27,148 +27,12 @@
 /* ------------ */
 
 /* ---Finals--- */
+#define MEMORY_MODULE DIAGNOSES_MEMORY /* For the memory statistics. */
 /* ------------ */
 
 /* ---------------Prototypes--------------- */
 /* ---------------------------------------- */
 
-/* ---------------LABEL SYNTAX ERRORS--------------- */
-
-/*
- * Checks if a label is missing in the given line.
- * Assuming the line starts with the label definition and that it has a colon in it.
- *
- * @param   *labelLine  The line of assembly code to check for a missing label.
- *
- * @return  TRUE if a label is missing in the given line, otherwise FALSE.
- */
-boolean isMissingLabel(const char *labelLine)
-{
-    return (labelLine[ZERO_INDEX] == COLON)? TRUE : FALSE;
-}
-
-/*
- * Checks if there is no empty space between a label and the colon in the given label line.
- *
- * @param   *labelLine  The line of assembly code to check for empty space between label and colon.
- *
- * @return  TRUE if there is empty space between the label and colon, otherwise FALSE.
- */
-boolean isEmptyBetweenLabelAndColon(const char *labelLine)
-{
-    return (nextEmptyIndex(labelLine, ZERO_INDEX) <
-            nextSpecificCharIndex(labelLine, ZERO_INDEX, COLON))? TRUE : FALSE;
-}
-
-/*
- * Checks if the label in the given label line starts with a number.
- *
- * @param   *labelLine  The line of assembly code to check for a label that starts with a number.
- *
- * @return  TRUE if the label starts with a number, otherwise FALSE.
- */
-boolean isLabelStartWithNumber(const char *labelLine)
-{
-    return isCharNumber(labelLine[ZERO_INDEX]);
-}
-
-/*
- * Checks if the label in the given label line starts with an illegal character.
- *
- * @param   *labelLine  The line of assembly code to check for a label that starts with
- *                      an illegal character.
- *
- * @return  TRUE if the label starts with an illegal character, otherwise FALSE.
- */
-boolean isLabelStartWithIllegalChar(const char *labelLine)
-{
-    return (isLetter(labelLine[ZERO_INDEX]) == FALSE)? TRUE : FALSE;
-}
-
-/*
- * Checks if the label in the given label line contains any illegal characters.
- *
- * @param   *labelLine  The line of assembly code to check for a label that contains
- *                      illegal characters.
- *
- * @return  TRUE if the label contains illegal characters, otherwise FALSE.
- */
-boolean isLabelContainsIllegalChar(const char *labelLine)
-{
-    boolean isLabelContainsIllegalChar = FALSE; /* Value to return, assume no error. */
-    int i = ZERO_INDEX; /* Loop variable. */
-
-    /* While we haven't reached the end of the label definition and didn't find an illegal char. */
-    while (labelLine[i] != COLON && isLabelContainsIllegalChar == FALSE)
-    {
-        if (isLegalChar(labelLine[i]) == FALSE)
-            isLabelContainsIllegalChar = TRUE;
-        i++;
-    }
-
-    return isLabelContainsIllegalChar;
-}
-
-/*
- * Checks if the label in the given label line is too long (exceeds the maximum allowed length).
- *
- * @param   *labelLine  The line of assembly code to check for a label that is too long.
- *
- * @return  TRUE if the label is too long, otherwise FALSE.
- */
-boolean isLabelTooLong(const char *labelLine)
-{
-    return (nextSpecificCharIndex(labelLine, ZERO_INDEX, COLON) > MAX_LABEL_LEN)? TRUE : FALSE;
-}
-
-/*
- * Checks if the label in the given label line matches a saved word
- * (e.g., an assembler guidance, opcode or register).
- *
- * @param   *labelLine  The line of assembly code to check for a label that matches a saved word.
- *
- * @return  TRUE if the label matches a saved word, otherwise FALSE.
- */
-boolean isLabelSavedWord(const char *labelLine)
-{
-    char *label = getLabelFromLine(labelLine); /* Saving the label in a string. */
-
-    boolean isLabelSavedWord = isSavedWord(label); /* Checking if it's a saved word. */
-
-    (void) clear_ptr(label) /* Freeing the string. */
-    return isLabelSavedWord;
-}
-
-/*
- * Checks if there are multiple consecutive colons in the given line after the label.
- *
- * @param   *labelLine      The line of assembly code to check for multiple consecutive colons.
- *
- * @return  TRUE if there are multiple consecutive colons after the label in the given line,
- *          otherwise FALSE.
- */
-boolean isMultipleConsColons(const char *labelLine)
-{
-    int colonIndex = nextSpecificCharIndex(labelLine, MINUS_ONE_INDEX, COLON);
-    return (labelLine[nextCharIndex(labelLine, colonIndex)] == COLON)? TRUE : FALSE;
-}
-
-/*
- * Checks if there is a comma after the label in the given line.
- *
- * @param   *labelLine      The line of assembly code to check for a comma after the label.
- *
- * @return  TRUE if there is a comma after the label in the given line, otherwise FALSE.
- */
-boolean isCommaAfterLabel(const char *labelLine)
-{
-    int colonIndex = nextSpecificCharIndex(labelLine, MINUS_ONE_INDEX, COLON);
-    return (labelLine[nextCharIndex(labelLine, colonIndex)] == COMMA)? TRUE : FALSE;
-}
-
-/* ---------------END OF LABEL SYNTAX ERRORS--------------- */
-
-
 /* ---------------GENERAL COMMAND SYNTAX ERRORS--------------- */
 
 /*
@@ -335,34 +199,6 @@ boolean isExtraneousTextAfterOperation(const char *operationLine)
 /* ---------------END OF OPERATION SYNTAX ERRORS--------------- */
 
 
-/* ---------------ARGUMENT SYNTAX ERRORS--------------- */
-
-/*
- * Checks if the given direct argument contains any illegal characters.
- *
- * @param   *directArg  The direct argument (in string type) to check for illegal chars in it.
- *
- * @return  TRUE if the direct argument contains illegal characters, otherwise FALSE.
- */
-boolean isDirectArgContainsIllegalChars(const char *directArg)
-{
-    boolean isDirectArgContainsIllegalChars = FALSE; /* Value to return, assume no error. */
-    int i = ZERO_INDEX; /* Loop variable. */
-
-    /* While we haven't reached the end of the direct arg and didn't find an illegal char. */
-    while (directArg[i] != NULL_TERMINATOR && isDirectArgContainsIllegalChars == FALSE)
-    {
-        if (isLegalChar(directArg[i]) == FALSE)
-            isDirectArgContainsIllegalChars = TRUE;
-        i++;
-    }
-
-    return isDirectArgContainsIllegalChars;
-}
-
-/* ---------------END OF ARGUMENT SYNTAX ERRORS--------------- */
-
-
 /* ---------------DIFFERENT AREA SYNTAX ERRORS--------------- */
 
 /*
@@ -11,97 +11,6 @@
 /* ---------------Prototypes--------------- */
 
 
-/* ---------------LABEL SYNTAX ERRORS--------------- */
-
-/*
- * Checks if a label is missing in the given line.
- * Assuming the line starts with the label definition and that it has a colon in it.
- *
- * @param   *labelLine  The line of assembly code to check for a missing label.
- *
- * @return  TRUE if a label is missing in the given line, otherwise FALSE.
- */
-boolean isMissingLabel(const char *labelLine);
-
-/*
- * Checks if there is no empty space between a label and the colon in the given label line.
- *
- * @param   *labelLine  The line of assembly code to check for empty space between label and colon.
- *
- * @return  TRUE if there is empty space between the label and colon, otherwise FALSE.
- */
-boolean isEmptyBetweenLabelAndColon(const char *labelLine);
-
-/*
- * Checks if the label in the given label line starts with a number.
- *
- * @param   *labelLine  The line of assembly code to check for a label that starts with a number.
- *
- * @return  TRUE if the label starts with a number, otherwise FALSE.
- */
-boolean isLabelStartWithNumber(const char *labelLine);
-
-/*
- * Checks if the label in the given label line starts with an illegal character.
- *
- * @param   *labelLine  The line of assembly code to check for a label that starts with
- *                      an illegal character.
- *
- * @return  TRUE if the label starts with an illegal character, otherwise FALSE.
- */
-boolean isLabelStartWithIllegalChar(const char *labelLine);
-
-/*
- * Checks if the label in the given label line contains any illegal characters.
- *
- * @param   *labelLine  The line of assembly code to check for a label that contains
- *                      illegal characters.
- *
- * @return  TRUE if the label contains illegal characters, otherwise FALSE.
- */
-boolean isLabelContainsIllegalChar(const char *labelLine);
-
-/*
- * Checks if the label in the given label line is too long (exceeds the maximum allowed length).
- *
- * @param   *labelLine  The line of assembly code to check for a label that is too long.
- *
- * @return  TRUE if the label is too long, otherwise FALSE.
- */
-boolean isLabelTooLong(const char *labelLine);
-
-/*
- * Checks if the label in the given label line matches a saved word
- * (e.g., an assembler guidance, opcode or register).
- *
- * @param   *labelLine  The line of assembly code to check for a label that matches a saved word.
- *
- * @return  TRUE if the label matches a saved word, otherwise FALSE.
- */
-boolean isLabelSavedWord(const char *labelLine);
-
-/*
- * Checks if there are multiple consecutive colons in the given line after the label.
- *
- * @param   *labelLine      The line of assembly code to check for multiple consecutive colons.
- *
- * @return  TRUE if there are multiple consecutive colons after the label in the given line,
- *          otherwise FALSE.
- */
-boolean isMultipleConsColons(const char *labelLine);
-
-/*
- * Checks if there is a comma after the label in the given line.
- *
- * @param   *labelLine      The line of assembly code to check for a comma after the label.
- *
- * @return  TRUE if there is a comma after the label in the given line, otherwise FALSE.
- */
-boolean isCommaAfterLabel(const char *labelLine);
-
-/* ---------------END OF LABEL SYNTAX ERRORS--------------- */
-
-
 /* ---------------GENERAL COMMAND SYNTAX ERRORS--------------- */
 
 /*
@@ -195,20 +104,6 @@ boolean isExtraneousTextAfterOperation(const char *operationLine);
 /* ---------------END OF OPERATION SYNTAX ERRORS--------------- */
 
 
-/* ---------------ARGUMENT SYNTAX ERRORS--------------- */
-
-/*
- * Checks if the given direct argument contains any illegal characters.
- *
- * @param   *directArg  The direct argument (in string type) to check for illegal chars in it.
- *
- * @return  TRUE if the direct argument contains illegal characters, otherwise FALSE.
- */
-boolean isDirectArgContainsIllegalChars(const char *directArg);
-
-/* ---------------END OF ARGUMENT SYNTAX ERRORS--------------- */
-
-
 /* ---------------DIFFERENT AREA SYNTAX ERRORS--------------- */
 
 /*
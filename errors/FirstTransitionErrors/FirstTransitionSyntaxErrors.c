@@ -15,6 +15,7 @@
 #include "../../general-enums/assemblerFinals.h"
 #include "../error_types/error_types.h"
 #include "FirstTransitionSyntaxErrorCheckUtil.h"
+#include "FirstTransitionSyntaxScanner.h"
 #include "../../diagnoses/diagnose_line.h"
 #include "../../diagnoses/assembler_line_diagnoses.h"
 #include "../../diagnoses/assembler_diagnoses.h"
@@ -28,6 +29,7 @@
 /* ------------ */
 
 /* ---Finals--- */
+#define MEMORY_MODULE DIAGNOSES_MEMORY /* For the memory statistics. */
 /* ------------ */
 
 /* ---------------Prototypes--------------- */
@@ -52,38 +54,9 @@ SyntaxError checkSyntaxErrorBetweenArgs(const char *emptyAfterArgLine, area_stat
  */
 SyntaxError checkSyntaxErrorInLabel(const char *line)
 {
-    SyntaxError labelDefError = NO_ERROR; /* Syntax error to return. */
     const char *labelLine = line + nextCharIndex(line, MINUS_ONE_INDEX);
 
-    /* Checking every possible syntax error in the label definition. */
-    if (isMissingLabel(labelLine))
-        labelDefError = EXPECTED_LABEL_ERR;
-
-    else if (isEmptyBetweenLabelAndColon(labelLine))
-        labelDefError = EMPTY_BETWEEN_LABEL_AND_COLON_ERR;
-
-    else if (isLabelStartWithNumber(labelLine))
-        labelDefError = LABEL_START_WITH_NUM_ERR;
-
-    else if (isLabelStartWithIllegalChar(labelLine))
-        labelDefError = LABEL_START_WITH_ILLEGAL_CHAR_ERR;
-
-    else if (isLabelContainsIllegalChar(labelLine))
-        labelDefError = LABEL_CONTAINS_ILLEGAL_CHAR_ERR;
-
-    else if (isLabelTooLong(labelLine))
-        labelDefError = LABEL_TOO_LONG_ERR;
-
-    else if (isLabelSavedWord(labelLine))
-        labelDefError = LABEL_IS_SAVED_WORD_ERR;
-
-    else if (isMultipleConsColons(labelLine))
-        labelDefError = MULTIPLE_CONS_COLONS_ERR;
-
-    else if (isCommaAfterLabel(labelLine))
-        labelDefError = COMMA_AFTER_LABEL_ERR;
-
-    return labelDefError;
+    return scanLabelDefinition(labelLine);
 }
 
 /*
@@ -274,22 +247,7 @@ SyntaxError checkSyntaxErrorBetweenArgs(const char *emptyAfterArgLine, area_stat
  */
 SyntaxError checkSyntaxErrorInInstantArg(const char *argument)
 {
-    SyntaxError instantArgError = NO_ERROR; /* Syntax error to return, assume no error. */
-
-    /* Check for a specific error. */
-    if (isPlusOrMinus(argument[ZERO_INDEX]) && argument[ONE_INDEX] == NULL_TERMINATOR)
-        instantArgError = VALUE_IS_ONLY_SIGN_ERR;
-
-    else if (isPlusOrMinus(argument[ZERO_INDEX]) && isPlusOrMinus(argument[ONE_INDEX]))
-        instantArgError = MULTIPLE_SIGNS_IN_VALUE_ERR;
-
-    else if (isStrFloat(argument))
-        instantArgError = INSTANT_VALUE_IS_FLOAT_ERR;
-
-    else if (isStrInteger(argument) == FALSE)
-        instantArgError = INSTANT_VALUE_IS_ILLEGAL_NUMBER_ERR;
-
-    return instantArgError;
+    return scanInstantArg(argument);
 }
 
 /*
@@ -301,35 +259,7 @@ SyntaxError checkSyntaxErrorInInstantArg(const char *argument)
  */
 SyntaxError checkSyntaxErrorInDirectRegArg(const char *argument)
 {
-    SyntaxError regArgSyntaxError = NO_ERROR; /* Syntax error to return, assume no error. */
-
-    /* Check for all the possible errors. */
-    if (argument[ONE_INDEX] == NULL_TERMINATOR)
-        regArgSyntaxError = EXPECTED_REGISTER_ERR;
-
-    else if (argument[ONE_INDEX] == AT)
-        regArgSyntaxError = MULTIPLE_CONS_AT_ERR;
-
-    else if (isLetter(argument[ONE_INDEX]) == FALSE)
-        regArgSyntaxError = MISSING_REG_LETTER_ERR;
-
-    else if (argument[ONE_INDEX] == CHAR_R)
-        regArgSyntaxError = CAPITAL_REGISTER_LETTER_ERR;
-
-    else if (argument[ONE_INDEX] != CHAR_r)
-        regArgSyntaxError = WRONG_REGISTER_LETTER_ERR;
-
-    else if (isCharNumber(argument[TWO_INDEX]) == FALSE)
-        regArgSyntaxError = EXPECTED_REGISTER_NUMBER_ERR;
-
-    else if (!between(argument[TWO_INDEX] - CHAR_ZERO, r0, r7) ||
-            (isCharNumber(argument[THREE_INDEX]) && !isCharNumber(argument[FOUR_INDEX])))
-        regArgSyntaxError = ILLEGAL_REGISTER_NUMBER_ERR;
-
-    else if (argument[THREE_INDEX] != NULL_TERMINATOR)
-        regArgSyntaxError = EXTRANEOUS_TEXT_AFTER_REG_ERR;
-
-    return regArgSyntaxError;
+    return scanDirectRegArg(argument);
 }
 
 /*
@@ -374,14 +304,5 @@ SyntaxError checkSyntaxErrorInStringArg(const char *line)
  */
 SyntaxError checkSyntaxErrorInDirectArg(const char *argument)
 {
-    SyntaxError directArgError = NO_ERROR; /* Syntax error to return, assume no error. */
-
-    /* Check all the specific errors. */
-    if (strlen(argument) > MAX_LABEL_LEN)
-        directArgError = ARG_LABEL_TOO_LONG_ERR;
-
-    else if (isDirectArgContainsIllegalChars(argument))
-        directArgError = ILLEGAL_CHARS_IN_DIRECT_ARG_ERR;
-
-    return directArgError;
+    return scanDirectArg(argument);
 }
@@ -0,0 +1,377 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * FirstTransitionSyntaxScanner.c
+ *
+ * This file has the scanners of label definitions and arguments of the first transition.
+ *
+ * Every character is mapped to a class with a table (one entry for every byte value),
+ * and every scanner is a state machine over the classes that goes over the text once.
+ * Since one text can have a few errors, a scanner keeps what it found in the pass and
+ * then picks the error in the same order of checks as the rest of the syntax errors.
+ */
+
+/* ---Include header files--- */
+#include <string.h>
+#include "../../new-data-types/boolean.h"
+#include "../../general-enums/neededKeys.h"
+#include "../../general-enums/indexes.h"
+#include "../../general-enums/assemblerFinals.h"
+#include "../../encoding/encoding-finals/registers.h"
+#include "../error_types/error_types.h"
+#include "../../diagnoses/assembler_line_diagnoses.h"
+#include "FirstTransitionSyntaxScanner.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define CHAR_VALUES_AMOUNT 256
+/* ------------ */
+
+/* ---Macros--- */
+#define char_class(ch) (charClassTable[(unsigned char) (ch)])
+/* ------------ */
+
+/* The class of a character. */
+typedef enum {OTHER_CLASS, LETTER_CLASS, DIGIT_CLASS, BLANK_CLASS, NEW_LINE_CLASS, COLON_CLASS,
+              COMMA_CLASS, SIGN_CLASS, DOT_CLASS, AT_CLASS, END_CLASS} char_class_t;
+
+/* States of the label definition scanner. */
+typedef enum {LABEL_START, IN_LABEL, AFTER_COLON, LABEL_SCANNED} label_state_t;
+
+/* States of the instant argument scanner. */
+typedef enum {INSTANT_START, AFTER_SIGN, IN_INTEGER, IN_FRACTION, INSTANT_SCANNED} instant_state_t;
+
+/* States of the direct register argument scanner (the place in the argument). */
+typedef enum {REG_LETTER, REG_NUMBER, AFTER_REG_NUMBER, AFTER_SECOND_DIGIT,
+              REG_SCANNED} register_state_t;
+
+/* The character class table, by the value of the character. */
+static char_class_t charClassTable[CHAR_VALUES_AMOUNT];
+static boolean isCharClassTableBuilt = FALSE;
+
+/* ---------------Prototypes--------------- */
+char_class_t classifyCharForTable(int ch);
+SyntaxError pickLabelDefinitionError(const char *labelLine, char_class_t firstClass,
+                                     boolean isBlankInLabel, boolean isIllegalInLabel,
+                                     int colonIndex, char_class_t afterColonClass);
+/* ---------------------------------------- */
+
+/*
+ * Builds the character class table of the scanner, if it was not built yet.
+ * Must be called before scanning.
+ */
+void initSyntaxScanner(void)
+{
+    int ch; /* Loop variable. */
+
+    if (isCharClassTableBuilt == FALSE)
+    {
+        for (ch = ZERO_INDEX; ch < CHAR_VALUES_AMOUNT; ch++)
+            charClassTable[ch] = classifyCharForTable(ch);
+        isCharClassTableBuilt = TRUE;
+    }
+}
+
+/*
+ * Finds the class of a character for the character class table.
+ *
+ * @param   ch  The value of the character.
+ *
+ * @return  The class of the character.
+ */
+char_class_t classifyCharForTable(int ch)
+{
+    char_class_t charClass = OTHER_CLASS; /* Class to return, assume other. */
+
+    if ((ch >= CHAR_a && ch <= CHAR_z) || (ch >= CHAR_A && ch <= CHAR_Z))
+        charClass = LETTER_CLASS;
+    else if (ch >= CHAR_ZERO && ch <= CHAR_NINE)
+        charClass = DIGIT_CLASS;
+    else if (ch == SPACE_KEY || ch == TAB_KEY)
+        charClass = BLANK_CLASS;
+    else if (ch == ENTER_KEY)
+        charClass = NEW_LINE_CLASS;
+    else if (ch == COLON)
+        charClass = COLON_CLASS;
+    else if (ch == COMMA)
+        charClass = COMMA_CLASS;
+    else if (ch == PLUS || ch == MINUS)
+        charClass = SIGN_CLASS;
+    else if (ch == DOT)
+        charClass = DOT_CLASS;
+    else if (ch == AT)
+        charClass = AT_CLASS;
+    else if (ch == NULL_TERMINATOR)
+        charClass = END_CLASS;
+
+    return charClass;
+}
+
+/*
+ * Scans a label definition for a syntax error.
+ * Assuming the line starts with the label definition and that it has a colon in it.
+ *
+ * @param   *labelLine  The line of assembly code starting from the label definition.
+ *
+ * @return  The label definition syntax error found in the line, or NO_ERROR if there isn't.
+ */
+SyntaxError scanLabelDefinition(const char *labelLine)
+{
+    label_state_t state = LABEL_START;
+    char_class_t currClass, firstClass = END_CLASS, afterColonClass = END_CLASS;
+    boolean isBlankInLabel = FALSE, isIllegalInLabel = FALSE;
+    int colonIndex = MINUS_ONE_INDEX; /* Stays -1 if there is no colon. */
+    int i = ZERO_INDEX; /* Loop variable. */
+
+    while (state != LABEL_SCANNED)
+    {
+        currClass = char_class(labelLine[i]);
+        switch (state)
+        {
+            case LABEL_START:
+                firstClass = currClass;
+                state = (currClass == COLON_CLASS || currClass == END_CLASS)?
+                        LABEL_SCANNED : IN_LABEL;
+                break;
+
+            case IN_LABEL:
+                if (currClass == COLON_CLASS)
+                {
+                    colonIndex = i;
+                    state = AFTER_COLON;
+                }
+                else if (currClass == END_CLASS)
+                    state = LABEL_SCANNED;
+                else if (currClass == BLANK_CLASS)
+                    isBlankInLabel = TRUE;
+                else if (currClass != LETTER_CLASS && currClass != DIGIT_CLASS)
+                    isIllegalInLabel = TRUE;
+                break;
+
+            case AFTER_COLON: /* Skip the empty chars after the colon. */
+                if (currClass != BLANK_CLASS && currClass != NEW_LINE_CLASS)
+                {
+                    afterColonClass = currClass;
+                    state = LABEL_SCANNED;
+                }
+                break;
+
+            case LABEL_SCANNED:
+                break;
+        }
+        i++;
+    }
+
+    return pickLabelDefinitionError(labelLine, firstClass, isBlankInLabel, isIllegalInLabel,
+                                    colonIndex, afterColonClass);
+}
+
+/*
+ * Picks the syntax error of a scanned label definition.
+ *
+ * @param   *labelLine          The line of assembly code starting from the label definition.
+ * @param   firstClass          The class of the first char of the label.
+ * @param   isBlankInLabel      Was there a space or a tab before the colon.
+ * @param   isIllegalInLabel    Was there an illegal char before the colon.
+ * @param   colonIndex          The index of the colon, -1 if there is no colon.
+ * @param   afterColonClass     The class of the first not empty char after the colon.
+ *
+ * @return  The label definition syntax error, or NO_ERROR if there isn't.
+ */
+SyntaxError pickLabelDefinitionError(const char *labelLine, char_class_t firstClass,
+                                     boolean isBlankInLabel, boolean isIllegalInLabel,
+                                     int colonIndex, char_class_t afterColonClass)
+{
+    SyntaxError labelDefError = NO_ERROR; /* Syntax error to return. */
+    char label[MAX_LABEL_LEN + 1]; /* Will hold the label, to check if it is a saved word. */
+
+    if (firstClass == COLON_CLASS)
+        labelDefError = EXPECTED_LABEL_ERR;
+
+    else if (isBlankInLabel == TRUE)
+        labelDefError = EMPTY_BETWEEN_LABEL_AND_COLON_ERR;
+
+    else if (firstClass == DIGIT_CLASS)
+        labelDefError = LABEL_START_WITH_NUM_ERR;
+
+    else if (firstClass != LETTER_CLASS)
+        labelDefError = LABEL_START_WITH_ILLEGAL_CHAR_ERR;
+
+    else if (isIllegalInLabel == TRUE || colonIndex == MINUS_ONE_INDEX)
+        labelDefError = LABEL_CONTAINS_ILLEGAL_CHAR_ERR;
+
+    else if (colonIndex > MAX_LABEL_LEN)
+        labelDefError = LABEL_TOO_LONG_ERR;
+
+    else
+    {
+        /* The label has only letters and numbers, so it can only be an opcode. */
+        memcpy(label, labelLine, colonIndex);
+        label[colonIndex] = NULL_TERMINATOR;
+
+        if (isSavedWord(label) == TRUE)
+            labelDefError = LABEL_IS_SAVED_WORD_ERR;
+
+        else if (afterColonClass == COLON_CLASS)
+            labelDefError = MULTIPLE_CONS_COLONS_ERR;
+
+        else if (afterColonClass == COMMA_CLASS)
+            labelDefError = COMMA_AFTER_LABEL_ERR;
+    }
+
+    return labelDefError;
+}
+
+/*
+ * Scans an instant argument for a syntax error.
+ *
+ * @param   *argument   The instant argument (in string type) to scan.
+ *
+ * @return  The specific syntax error in the instant value, or NO_ERROR if there isn't.
+ */
+SyntaxError scanInstantArg(const char *argument)
+{
+    instant_state_t state = INSTANT_START;
+    SyntaxError instantArgError = NO_ERROR; /* Syntax error to return, assume no error. */
+    char_class_t currClass;
+    int i = ZERO_INDEX; /* Loop variable. */
+
+    while (state != INSTANT_SCANNED)
+    {
+        currClass = char_class(argument[i]);
+        switch (state)
+        {
+            case INSTANT_START:
+            case AFTER_SIGN:
+            case IN_INTEGER:
+                if (currClass == DIGIT_CLASS)
+                    state = IN_INTEGER;
+                else if (currClass == DOT_CLASS)
+                    state = IN_FRACTION;
+                else if (currClass == SIGN_CLASS && state == INSTANT_START)
+                    state = AFTER_SIGN;
+                else
+                {
+                    if (state == AFTER_SIGN && currClass == END_CLASS)
+                        instantArgError = VALUE_IS_ONLY_SIGN_ERR;
+                    else if (state == AFTER_SIGN && currClass == SIGN_CLASS)
+                        instantArgError = MULTIPLE_SIGNS_IN_VALUE_ERR;
+                    else if (currClass != END_CLASS)
+                        instantArgError = INSTANT_VALUE_IS_ILLEGAL_NUMBER_ERR;
+                    state = INSTANT_SCANNED;
+                }
+                break;
+
+            case IN_FRACTION: /* After one dot, only numbers can come. */
+                if (currClass != DIGIT_CLASS)
+                {
+                    instantArgError = (currClass == END_CLASS)?
+                            INSTANT_VALUE_IS_FLOAT_ERR : INSTANT_VALUE_IS_ILLEGAL_NUMBER_ERR;
+                    state = INSTANT_SCANNED;
+                }
+                break;
+
+            case INSTANT_SCANNED:
+                break;
+        }
+        i++;
+    }
+
+    return instantArgError;
+}
+
+/*
+ * Scans a direct register argument for a syntax error.
+ * Assuming the argument starts with '@'.
+ *
+ * @param   *argument   The direct register argument (in string type) to scan.
+ *
+ * @return  The specific syntax error in the direct register argument, or NO_ERROR if there isn't.
+ */
+SyntaxError scanDirectRegArg(const char *argument)
+{
+    register_state_t state = REG_LETTER;
+    SyntaxError regArgSyntaxError = NO_ERROR; /* Syntax error to return, assume no error. */
+    char ch;
+    int i = ONE_INDEX; /* Loop variable, skip the '@'. */
+
+    while (state != REG_SCANNED)
+    {
+        ch = argument[i];
+        switch (state)
+        {
+            case REG_LETTER:
+                if (char_class(ch) == END_CLASS)
+                    regArgSyntaxError = EXPECTED_REGISTER_ERR;
+                else if (char_class(ch) == AT_CLASS)
+                    regArgSyntaxError = MULTIPLE_CONS_AT_ERR;
+                else if (char_class(ch) != LETTER_CLASS)
+                    regArgSyntaxError = MISSING_REG_LETTER_ERR;
+                else if (ch == CHAR_R)
+                    regArgSyntaxError = CAPITAL_REGISTER_LETTER_ERR;
+                else if (ch != CHAR_r)
+                    regArgSyntaxError = WRONG_REGISTER_LETTER_ERR;
+                state = (regArgSyntaxError == NO_ERROR)? REG_NUMBER : REG_SCANNED;
+                break;
+
+            case REG_NUMBER:
+                if (char_class(ch) != DIGIT_CLASS)
+                    regArgSyntaxError = EXPECTED_REGISTER_NUMBER_ERR;
+                else if (ch - CHAR_ZERO > r7)
+                    regArgSyntaxError = ILLEGAL_REGISTER_NUMBER_ERR;
+                state = (regArgSyntaxError == NO_ERROR)? AFTER_REG_NUMBER : REG_SCANNED;
+                break;
+
+            case AFTER_REG_NUMBER:
+                if (char_class(ch) == DIGIT_CLASS)
+                    state = AFTER_SECOND_DIGIT;
+                else
+                {
+                    if (char_class(ch) != END_CLASS)
+                        regArgSyntaxError = EXTRANEOUS_TEXT_AFTER_REG_ERR;
+                    state = REG_SCANNED;
+                }
+                break;
+
+            case AFTER_SECOND_DIGIT: /* A number of two digits is not a register. */
+                regArgSyntaxError = (char_class(ch) == DIGIT_CLASS)?
+                        EXTRANEOUS_TEXT_AFTER_REG_ERR : ILLEGAL_REGISTER_NUMBER_ERR;
+                state = REG_SCANNED;
+                break;
+
+            case REG_SCANNED:
+                break;
+        }
+        i++;
+    }
+
+    return regArgSyntaxError;
+}
+
+/*
+ * Scans a direct (label) argument for a syntax error.
+ *
+ * @param   *argument   The direct argument (in string type) to scan.
+ *
+ * @return  The specific syntax error in the direct argument, or NO_ERROR if there isn't.
+ */
+SyntaxError scanDirectArg(const char *argument)
+{
+    SyntaxError directArgError = NO_ERROR; /* Syntax error to return, assume no error. */
+    char_class_t currClass;
+    int i; /* Loop variable. */
+
+    for (i = ZERO_INDEX; (currClass = char_class(argument[i])) != END_CLASS; i++)
+    {
+        if (i == MAX_LABEL_LEN) /* Too long, stronger than an illegal char. */
+        {
+            directArgError = ARG_LABEL_TOO_LONG_ERR;
+            break;
+        }
+        if (currClass != LETTER_CLASS && currClass != DIGIT_CLASS)
+            directArgError = ILLEGAL_CHARS_IN_DIRECT_ARG_ERR;
+    }
+
+    return directArgError;
+}
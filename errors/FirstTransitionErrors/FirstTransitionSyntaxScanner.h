@@ -0,0 +1,59 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the FirstTransitionSyntaxScanner.c file.
+ */
+
+#ifndef MMN_14_FIRSTTRANSITIONSYNTAXSCANNER_H
+#define MMN_14_FIRSTTRANSITIONSYNTAXSCANNER_H
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Builds the character class table of the scanner, if it was not built yet.
+ * Must be called before scanning.
+ */
+void initSyntaxScanner(void);
+
+/*
+ * Scans a label definition for a syntax error.
+ * Assuming the line starts with the label definition and that it has a colon in it.
+ *
+ * @param   *labelLine  The line of assembly code starting from the label definition.
+ *
+ * @return  The label definition syntax error found in the line, or NO_ERROR if there isn't.
+ */
+SyntaxError scanLabelDefinition(const char *labelLine);
+
+/*
+ * Scans an instant argument for a syntax error.
+ *
+ * @param   *argument   The instant argument (in string type) to scan.
+ *
+ * @return  The specific syntax error in the instant value, or NO_ERROR if there isn't.
+ */
+SyntaxError scanInstantArg(const char *argument);
+
+/*
+ * Scans a direct register argument for a syntax error.
+ * Assuming the argument starts with '@'.
+ *
+ * @param   *argument   The direct register argument (in string type) to scan.
+ *
+ * @return  The specific syntax error in the direct register argument, or NO_ERROR if there isn't.
+ */
+SyntaxError scanDirectRegArg(const char *argument);
+
+/*
+ * Scans a direct (label) argument for a syntax error.
+ *
+ * @param   *argument   The direct argument (in string type) to scan.
+ *
+ * @return  The specific syntax error in the direct argument, or NO_ERROR if there isn't.
+ */
+SyntaxError scanDirectArg(const char *argument);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_FIRSTTRANSITIONSYNTAXSCANNER_H */
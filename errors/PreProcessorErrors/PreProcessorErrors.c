@@ -11,16 +11,21 @@
 #include "../../new-data-types/boolean.h"
 #include "../../new-data-types/word_number.h"
 #include "../../general-enums/neededKeys.h"
+#include "../../general-enums/indexes.h"
 #include "../error_types/error_types.h"
 #include "../../diagnoses/assembler_line_diagnoses.h"
 #include "../../diagnoses/diagnose_util.h"
+#include "../../diagnoses/diagnose_line.h"
+#include "../../util/memoryUtil.h"
 /* -------------------------- */
 
 /* ---Macros--- */
 /* ------------ */
 
 /* ---Finals--- */
+#define MEMORY_MODULE DIAGNOSES_MEMORY /* For the memory statistics. */
 #define MAX_LINE_LEN 80
+#define MIN_QUOTED_NAME_LEN 3 /* Two quotes and at least one character. */
 /* ------------ */
 
 /* ---------------Prototypes--------------- */
@@ -28,6 +33,7 @@ boolean isMissingMacroERR(const char *macro_name, boolean wasInMacroDef, boolean
 boolean isInvalidMacroNameERR(const char *macro_name, boolean wasInMacroDef, boolean isInMacroDef);
 boolean isExtraneousTextInMacroLineERR(const char *line,
                                        boolean wasInMacroDef, boolean isInMacroDef);
+boolean isInvalidMacroParametersERR(const char *line, boolean wasInMacroDef, boolean isInMacroDef);
 /* ---------------------------------------- */
 
 /*
@@ -57,11 +63,39 @@ Error checkPreProcessErrors(const char *line, const char *macro_name,
     else if (isExtraneousTextInMacroLineERR(line, wasInMacroDef, isInMacroDef) == TRUE)
         macroError = EXTRANEOUS_TEXT_IN_MACRO_LINE_ERR;
 
+    else if (isInvalidMacroParametersERR(line, wasInMacroDef, isInMacroDef) == TRUE)
+        macroError = INVALID_MACRO_PARAMETERS_ERR;
+
     /* ----------------------------- */
 
     return macroError; /* Return error */
 }
 
+/*
+ * Checks for errors in a .include line.
+ * The line must have a file name in quotes after the .include, and nothing after it.
+ *
+ * @param   *line   The .include line.
+ *
+ * @return  An error code indicating the type of the error, or NO_ERROR if no error is found.
+ */
+Error checkIncludeLineErrors(const char *line)
+{
+    Error includeError = NO_ERROR; /* Value to return. */
+    char *fileName = NULL; /* Will hold the quoted file name. */
+    findWord(line, &fileName, SECOND_WORD);
+
+    if (fileName == NULL || strlen(fileName) < MIN_QUOTED_NAME_LEN ||
+        fileName[ZERO_INDEX] != QUOTES || fileName[strlen(fileName) - 1] != QUOTES)
+        includeError = EXPECTED_INCLUDED_FILE_NAME_ERR;
+
+    else if (line[findStartIndexOfWord(line, THIRD_WORD)] != NULL_TERMINATOR)
+        includeError = EXTRANEOUS_TXT_ERR;
+
+    (void) clear_ptr(fileName) /* Free unnecessary variable. */
+    return includeError;
+}
+
 /*
  * Checks if a given line of text exceeds a specified maximum length.
  * In this assembly language, the maximum line length is 80, not including the new line char.
@@ -105,7 +139,8 @@ boolean isInvalidMacroNameERR(const char *macro_name, boolean wasInMacroDef, boo
 
 /*
  * Checks if an error related to extraneous text in a macro line occurs during assembly.
- * A macro line is a line that starts with 'mcro' or 'endmcro'.
+ * Only an 'endmcro' line is checked, the text after the name in a 'mcro' line is the
+ * parameters of the macro (checked by isInvalidMacroParametersERR).
  *
  * @param   *line           The input line of assembly code.
  * @param   wasInMacroDef   Indicates if the previous line was within a macro definition.
@@ -118,13 +153,34 @@ boolean isExtraneousTextInMacroLineERR(const char *line,
 {
     Error isExtraTxt = FALSE; /* Value to return. */
 
-    if (isMacroLine(wasInMacroDef, isInMacroDef) == TRUE)
+    if (isFinishMacroDef(wasInMacroDef, isInMacroDef) == TRUE &&
+        line[findStartIndexOfWord(line, SECOND_WORD)] != NULL_TERMINATOR)
+        isExtraTxt = TRUE;
+
+    return isExtraTxt;
+}
+
+/*
+ * Checks if the parameters of a new macro definition are invalid (see areLegalMacroParameters).
+ *
+ * @param   *line           The input line of assembly code.
+ * @param   wasInMacroDef   Indicates if the previous line was within a macro definition.
+ * @param   isInMacroDef    Indicates if the current line is within a macro definition.
+ *
+ * @return  TRUE if the line defines a macro with invalid parameters, otherwise FALSE.
+ */
+boolean isInvalidMacroParametersERR(const char *line, boolean wasInMacroDef, boolean isInMacroDef)
+{
+    boolean isInvalid = FALSE; /* Value to return. */
+    char **params;
+    int paramsAmount;
+
+    if (isInNewMacroDef(wasInMacroDef, isInMacroDef) == TRUE)
     {
-        word_number lastWord = (isInNewMacroDef(wasInMacroDef, isInMacroDef) == TRUE)?
-                SECOND_WORD : FIRST_WORD;
-        if (line[findStartIndexOfWord(line, lastWord + 1)] != NULL_TERMINATOR)
-            isExtraTxt = TRUE;
+        params = getMacroArguments(line, THIRD_WORD, &paramsAmount);
+        isInvalid = (areLegalMacroParameters(params, paramsAmount) == TRUE)? FALSE : TRUE;
+        freeMacroArguments(params, paramsAmount);
     }
 
-    return isExtraTxt;
+    return isInvalid;
 }
\ No newline at end of file
@@ -30,6 +30,16 @@ typedef int Error;
 Error checkPreProcessErrors(const char *line, const char *macro_name,
                             boolean wasInMacroDef, boolean isInMacroDef);
 
+/*
+ * Checks for errors in a .include line.
+ * The line must have a file name in quotes after the .include, and nothing after it.
+ *
+ * @param   *line   The .include line.
+ *
+ * @return  An error code indicating the type of the error, or NO_ERROR if no error is found.
+ */
+Error checkIncludeLineErrors(const char *line);
+
 /*
  * Checks if a given line of text exceeds a specified maximum length.
  * In this assembly language, the maximum line length is 80, not including the new line char.
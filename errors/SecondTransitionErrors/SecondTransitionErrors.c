@@ -9,7 +9,8 @@
 /* ---Include header files--- */
 #include <stddef.h>
 #include "../../new-data-types/boolean.h"
-#include "../../NameTable/NameTable.h"
+#include "../../new-data-types/error_count.h"
+#include "../../SymbolTable/SymbolTable.h"
 #include "../../assembler_ast/assembler_ast.h"
 #include "../error_types/error_types.h"
 #include "../assembler_errors.h"
@@ -49,26 +50,25 @@ void handleLineErrorInSecondTrans(const char *file_name, int currLine, Error lin
  * whether an entry label is defined in the file.
  *
  * @param   *entLabel       The entry label to check for errors.
- * @param   *normalLabels   Pointer to the NameTable containing normal labels.
+ * @param   *symbols        The table of the symbols (labels) of the file.
  *
  * @return  The specific error found, or NO_ERROR if there was no error.
  */
-LogicalError checkEntryLabelError(const char *entLabel, NameTable *normalLabels)
+LogicalError checkEntryLabelError(const char *entLabel, SymbolTable *symbols)
 {
-    return (isNameInTable(normalLabels, entLabel))? NO_ERROR : ENTRY_LABEL_NOT_DEFINED_IN_FILE_ERR;
+    return (getSymbolFlags(symbols, entLabel) & (SYMBOL_DEFINED | SYMBOL_IN_ERROR_LINE))?
+            NO_ERROR : ENTRY_LABEL_NOT_DEFINED_IN_FILE_ERR;
 }
 
 /*
  * Checks for a logical error related to an undefined label argument.
  *
  * @param   *lineAst        The Abstract Syntax Tree (AST) for the line to check.
- * @param   *normalLabels   Pointer to the NameTable containing normal labels.
- * @param   *extLabels      Pointer to the NameTable containing external labels.
+ * @param   *symbols        The table of the symbols (labels) of the file.
  *
  * @return  The specific error found, or NO_ERROR if there was no error.
  */
-LogicalError checkUndefinedLabelArgumentError(ast_t *lineAst, NameTable *normalLabels,
-                                              NameTable *extLabels)
+LogicalError checkUndefinedLabelArgumentError(ast_t *lineAst, SymbolTable *symbols)
 {
     LogicalError undefinedLabelArgError = NO_ERROR; /* Logical error to return. */
 
@@ -81,8 +81,8 @@ LogicalError checkUndefinedLabelArgumentError(ast_t *lineAst, NameTable *normalL
         {
             if (getArgData(currArg).dataType == STRING) /* If the argument is label. */
                 /* If it is undefined. */
-                if (isNameInTable(normalLabels, getArgData(currArg).data.string) == FALSE &&
-                    isNameInTable(extLabels, getArgData(currArg).data.string) == FALSE)
+                if ((getSymbolFlags(symbols, getArgData(currArg).data.string) &
+                     (SYMBOL_DEFINED | SYMBOL_EXTERN | SYMBOL_IN_ERROR_LINE)) == NO_SYMBOL_FLAGS)
                         undefinedLabelArgError = USE_OF_UNDEFINED_LABEL_ERR;
 
             currArg = getNextNode(currArg); /* Go to next argument. */
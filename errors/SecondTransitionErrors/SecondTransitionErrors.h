@@ -13,7 +13,7 @@
 /* ---------------Prototypes--------------- */
 
 /* ---Typedef prototype for encapsulation--- */
-typedef struct NameTable NameTable;
+typedef struct SymbolTable SymbolTable;
 typedef struct ast_t ast_t;
 /* ----------------------------------------- */
 
@@ -36,23 +36,21 @@ void handleLineErrorInSecondTrans(const char *file_name, int currLine, Error lin
  * whether an entry label is defined in the file.
  *
  * @param   *entLabel       The entry label to check for errors.
- * @param   *normalLabels   Pointer to the NameTable containing normal labels.
+ * @param   *symbols        The table of the symbols (labels) of the file.
  *
  * @return  The specific error found, or NO_ERROR if there was no error.
  */
-LogicalError checkEntryLabelError(const char *entLabel, NameTable *normalLabels);
+LogicalError checkEntryLabelError(const char *entLabel, SymbolTable *symbols);
 
 /*
  * Checks for a logical error related to an undefined label argument.
  *
  * @param   *lineAst        The Abstract Syntax Tree (AST) for the line to check.
- * @param   *normalLabels   Pointer to the NameTable containing normal labels.
- * @param   *extLabels      Pointer to the NameTable containing external labels.
+ * @param   *symbols        The table of the symbols (labels) of the file.
  *
  * @return  The specific error found, or NO_ERROR if there was no error.
  */
-LogicalError checkUndefinedLabelArgumentError(ast_t *lineAst, NameTable *normalLabels,
-                                              NameTable *extLabels);
+LogicalError checkUndefinedLabelArgumentError(ast_t *lineAst, SymbolTable *symbols);
 
 /* ---------------------------------------- */
 
@@ -7,7 +7,10 @@
 
 /* ---Include header files--- */
 #include <stdio.h>
+#include "../new-data-types/boolean.h"
+#include "../new-data-types/error_count.h"
 #include "error_types/error_types.h"
+#include "assembler_errors.h"
 /* -------------------------- */
 
 /* ---Finals--- */
@@ -17,12 +20,146 @@
 #define ANSI_COLOR_BLUE     "\x1B[34m"
 #define ANSI_COLOR_RESET    "\x1b[0m"
 
+#define NO_ERRORS_CAP 0
+
 /* ------------ */
 
 /* ---------------Prototypes--------------- */
-void print_assembler_ERR(Error error, const char *file_name, int lineNumber);
+void print_assembler_ERR(FILE *diagnoses, Error error, const char *file_name, int lineNumber);
 /* ---------------------------------------- */
 
+/* Imaginary system error messages array. */
+static const char *imgSystemErrorMSG[IMG_SYSTEM_ERROR_SIZE - IMG_SYSTEM_ERR_START] =
+        {
+                /* Indicates no error. !! add new errors after this one !! */
+            "NO_ERROR",
+
+                /* Memory limitations errors */
+            "Line overflow error! A line must be 80 or less characters long.",
+            "Instant value overflow error! Instant value must be: -512 <= x <= 511.",
+            "Data value overflow error! Data value must be: -2048 <= x 2047.",
+            "Program memory overflow! Keep in mind that this system has 1024 words of memory."
+        };
+
+/* Syntax error messages array. */
+static const char *syntaxErrorMSG[SYNTAX_ERROR_SIZE - SYNTAX_ERR_START] =
+        {
+                /* Indicates no error. !! add new errors after this one !! */
+            "NO_ERROR",
+                /* Macro related syntax errors */
+            "Expected macro!",
+            "Invalid macro name! a macro name cannot be a saved word.",
+            "Extraneous text in a macro definition line !!",
+            "Invalid macro parameters! Expected different names separated by commas.",
+
+                /* Include related syntax errors */
+            "Expected a file name in quotes after .include!",
+
+                /* Label related syntax errors */
+            "Expected label name !!",
+            "Empty space between label and colon! Label and colon can't be seperated.",
+            "Label starts with a number! It must start with a letter.",
+            "Label starts with an illegal character! It must start with a letter.",
+            "Label Contains illegal characters! It can include only letters and numbers.",
+            "Label Is too long! Max label length is 31 characters long.",
+            "Label Is a saved word! A label name cannot be a saved word.",
+            "Multiple consecutive colons after label name! Label definition needs one colon.",
+            "Unneeded comma after label definition!",
+
+                /* Command syntax errors */
+            "Expected command (operation or guidance)!",
+            "Unneeded comma after command!",
+
+                /* Guidance syntax errors. */
+            "Expected guidance after dot!",
+            "Multiple consecutive dots in guidance!",
+            "Guidance name is wrong case (try to use lower case letters)!",
+            "Undefined guidance!",
+
+                /* Operation syntax errors. */
+            "Expected dot before guidance!",
+            "Operation is wrong case (try to use lower case letters)!",
+            "Undefined operation!",
+
+                /* General argument errors. */
+            "Expected comma and argument!",
+            "Expected comma!",
+            "Expected argument!",
+            "Multiple consecutive commas!",
+
+                /* String argument syntax errors. */
+            "Expected open quotes in string argument!",
+            "Expected closing quotes in string argument!",
+            "String contains unprintable characters!",
+
+                /* Instant value argument syntax errors. */
+            "Number is only a sign!",
+            "Multiple consecutive signs in number argument!",
+            "Number is not an integer! This machine supports only integers.",
+            "Supposed value is an illegal number!",
+
+                /* Label argument syntax errors. */
+            "Supposed label argument is too long! Max label name length is 31.",
+            "Illegal characters in supposed label argument!",
+
+                /* Register argument syntax errors.*/
+            "Expected register argument!",
+            "Multiple consecutive ats ('@') !",
+            "Expected register letter! Register letter is the letter 'r'.",
+            "Capital register letter! Try to use 'r' instead of 'R'.",
+            "Wrong register letter! The only register letter is 'r'.",
+            "Expected register number!",
+            "Illegal register number! Register numbers range from 0 to 7.",
+            "Extraneous text after register argument! Try to remove text after @rx (x=number)",
+
+                /* Extraneous text errors */
+            "Extraneous comma!",
+            "Extraneous text!",
+            "Expected comma (or might be extraneous text)!",
+            "Expected argument after last comma (or might be extraneous comma)!"
+        };
+
+/* Logical error messages array. */
+static const char *logicalErrorMSG[LOGICAL_ERROR_SIZE - LOGICAL_ERR_START] =
+        {
+                /* Indicates no error. !! add new errors after this one !! */
+            "NO_ERROR",
+
+                /* Macro related logical errors. */
+            "Wrong amount of arguments in a macro call! Give an argument for every parameter.",
+
+                /* Include related logical errors. */
+            "Unable to open the included file!",
+            "Include cycle! A file can't include itself (directly or through other files).",
+            "The included file has errors!",
+
+                /* Label related logical errors. */
+            "Label already defined! Try to use a different label name.",
+
+                /* Guidance related logical errors. */
+            "Argument is not a label! Expected a label name argument.",
+            "Argument is not a number! Expected a data number argument!",
+
+                /* Addressing methods related logical errors. */
+            "Illegal addressing method for destination argument!",
+            "Illegal addressing method for source argument!",
+
+                /* Entry label related logical errors */
+            "Label was already defined as entry label!",
+            "Declared entry label is not defined in the file!",
+
+                /* Extern label related logical errors */
+            "Label was already defined as external label!",
+
+                /* Label tables related logical errors */
+            "Label was defined in the file and is external!",
+            "Label was defined both as entry and extern!",
+            "Argument is a label that is not defined in this file and not declared as extern!"
+        };
+
+/* Array including all the different error messages. */
+static const char **errorMSG[] = {imgSystemErrorMSG, syntaxErrorMSG, logicalErrorMSG};
+
 /*
  * Handles an assembler error.
  *
@@ -32,141 +169,84 @@ void print_assembler_ERR(Error error, const char *file_name, int lineNumber);
  */
 void handle_assembler_error(const char *file_name, int lineNumber, Error lineError)
 {
-    print_assembler_ERR(lineError, file_name, lineNumber);
+    print_assembler_ERR(stderr, lineError, file_name, lineNumber);
+}
+
+/*
+ * Handles an assembler error, printing it to the given stream.
+ *
+ * @param   *diagnoses      The stream to print the error to.
+ * @param   *file_name      The name of the file where the error occurred.
+ * @param   lineNumber      The line number where the error occurred.
+ * @param   lineError       The specific error that occurred.
+ */
+void report_assembler_error(FILE *diagnoses, const char *file_name, int lineNumber,
+                            Error lineError)
+{
+    print_assembler_ERR(diagnoses, lineError, file_name, lineNumber);
 }
 
 /*
  * Prints an assembler-related error message along with file and line information.
  *
+ * @param   *diagnoses  The stream to print the message to.
  * @param   error       The error code indicating the type of error.
  * @param   *file_name  The name of the source file where the error occurred.
  * @param   lineNumber  The line number in the source file where the error occurred.
  */
-void print_assembler_ERR(Error error, const char *file_name, int lineNumber)
+void print_assembler_ERR(FILE *diagnoses, Error error, const char *file_name, int lineNumber)
 {
-    /* Imaginary system error messages array. */
-    const char *imgSystemErrorMSG[IMG_SYSTEM_ERROR_SIZE - IMG_SYSTEM_ERR_START] =
-            {
-                    /* Indicates no error. !! add new errors after this one !! */
-                "NO_ERROR",
-
-                    /* Memory limitations errors */
-                "Line overflow error! A line must be 80 or less characters long.",
-                "Instant value overflow error! Instant value must be: -512 <= x <= 511.",
-                "Data value overflow error! Data value must be: -2048 <= x 2047.",
-                "Program memory overflow! Keep in mind that this system has 1024 words of memory."
-            };
-
-    /* Syntax error messages array. */
-    const char *syntaxErrorMSG[SYNTAX_ERROR_SIZE - SYNTAX_ERR_START] =
-            {
-                    /* Indicates no error. !! add new errors after this one !! */
-                "NO_ERROR",
-                    /* Macro related syntax errors */
-                "Expected macro!",
-                "Invalid macro name! a macro name cannot be a saved word.",
-                "Extraneous text in a macro definition line !!",
-
-                    /* Label related syntax errors */
-                "Expected label name !!",
-                "Empty space between label and colon! Label and colon can't be seperated.",
-                "Label starts with a number! It must start with a letter.",
-                "Label starts with an illegal character! It must start with a letter.",
-                "Label Contains illegal characters! It can include only letters and numbers.",
-                "Label Is too long! Max label length is 31 characters long.",
-                "Label Is a saved word! A label name cannot be a saved word.",
-                "Multiple consecutive colons after label name! Label definition needs one colon.",
-                "Unneeded comma after label definition!",
-
-                    /* Command syntax errors */
-                "Expected command (operation or guidance)!",
-                "Unneeded comma after command!",
-
-                    /* Guidance syntax errors. */
-                "Expected guidance after dot!",
-                "Multiple consecutive dots in guidance!",
-                "Guidance name is wrong case (try to use lower case letters)!",
-                "Undefined guidance!",
-
-                    /* Operation syntax errors. */
-                "Expected dot before guidance!",
-                "Operation is wrong case (try to use lower case letters)!",
-                "Undefined operation!",
-
-                    /* General argument errors. */
-                "Expected comma and argument!",
-                "Expected comma!",
-                "Expected argument!",
-                "Multiple consecutive commas!",
-
-                    /* String argument syntax errors. */
-                "Expected open quotes in string argument!",
-                "Expected closing quotes in string argument!",
-                "String contains unprintable characters!",
-
-                    /* Instant value argument syntax errors. */
-                "Number is only a sign!",
-                "Multiple consecutive signs in number argument!",
-                "Number is not an integer! This machine supports only integers.",
-                "Supposed value is an illegal number!",
-
-                    /* Label argument syntax errors. */
-                "Supposed label argument is too long! Max label name length is 31.",
-                "Illegal characters in supposed label argument!",
-
-                    /* Register argument syntax errors.*/
-                "Expected register argument!",
-                "Multiple consecutive ats ('@') !",
-                "Expected register letter! Register letter is the letter 'r'.",
-                "Capital register letter! Try to use 'r' instead of 'R'.",
-                "Wrong register letter! The only register letter is 'r'.",
-                "Expected register number!",
-                "Illegal register number! Register numbers range from 0 to 7.",
-                "Extraneous text after register argument! Try to remove text after @rx (x=number)",
-
-                    /* Extraneous text errors */
-                "Extraneous comma!",
-                "Extraneous text!",
-                "Expected comma (or might be extraneous text)!",
-                "Expected argument after last comma (or might be extraneous comma)!"
-            };
-
-    /* Logical error messages array. */
-    const char *logicalErrorMSG[LOGICAL_ERROR_SIZE - LOGICAL_ERR_START] =
-            {
-                    /* Indicates no error. !! add new errors after this one !! */
-                "NO_ERROR",
-
-                    /* Label related logical errors. */
-                "Label already defined! Try to use a different label name.",
-
-                    /* Guidance related logical errors. */
-                "Argument is not a label! Expected a label name argument.",
-                "Argument is not a number! Expected a data number argument!",
-
-                    /* Addressing methods related logical errors. */
-                "Illegal addressing method for destination argument!",
-                "Illegal addressing method for source argument!",
-
-                    /* Entry label related logical errors */
-                "Label was already defined as entry label!",
-                "Declared entry label is not defined in the file!",
-
-                    /* Extern label related logical errors */
-                "Label was already defined as external label!",
-
-                    /* Label tables related logical errors */
-                "Label was defined in the file and is external!",
-                "Label was defined both as entry and extern!",
-                "Argument is a label that is not defined in this file and not declared as extern!"
-            };
-    /* Array including all the different error messages. */
-    const char **errorMSG[] = {imgSystemErrorMSG, syntaxErrorMSG, logicalErrorMSG};
-
     /* Printing the errors. */
-    fprintf(stderr, ANSI_COLOR_RED "\nERROR: " ANSI_COLOR_RESET "%s\n",
-            errorMSG[(error / MAX_ERRORS_IN_ENUM) - 1][error % MAX_ERRORS_IN_ENUM]);
+    fprintf(diagnoses, ANSI_COLOR_RED "\nERROR: " ANSI_COLOR_RESET "%s\n",
+            getAssemblerErrorMessage(error));
+
+    fprintf(diagnoses, ANSI_COLOR_BLUE "In file: " ANSI_COLOR_RESET "\"%s\", "
+                       ANSI_COLOR_BLUE "On line: " ANSI_COLOR_RESET "%d\n", file_name, lineNumber);
+}
+
+/*
+ * Prints the call of a macro that an error in an expanded line (a .am line) came from.
+ *
+ * @param   *diagnoses      The stream to print the call to.
+ * @param   *macroName      The name of the called macro.
+ * @param   callLine        The line of the call in the source (.as) file.
+ */
+void report_macro_call(FILE *diagnoses, const char *macroName, int callLine)
+{
+    fprintf(diagnoses, ANSI_COLOR_BLUE "In the call of macro: " ANSI_COLOR_RESET "\"%s\", "
+                       ANSI_COLOR_BLUE "On source line: " ANSI_COLOR_RESET "%d\n",
+            macroName, callLine);
+}
+
+/*
+ * Checks if the lines with errors of a file reached their cap, and reports it when they did.
+ *
+ * @param   *file_name      The name of the source file being processed.
+ * @param   *errors         The count of the lines with errors of the file.
+ * @param   *diagnoses      The stream to report to, or NULL to only check.
+ *
+ * @return  TRUE if no more lines should be read, otherwise FALSE.
+ */
+boolean isErrorsCapReached(const char *file_name, const error_count_t *errors, FILE *diagnoses)
+{
+    boolean isReached = (errors -> maxErrors > NO_ERRORS_CAP &&
+                         errors -> errorsAmount >= errors -> maxErrors)? TRUE : FALSE;
+
+    if (isReached == TRUE && diagnoses != NULL)
+        fprintf(diagnoses, "\nStopped reading file \"%s\" after %d lines with errors.\n",
+                file_name, errors -> errorsAmount);
 
-    fprintf(stderr, ANSI_COLOR_BLUE "In file: " ANSI_COLOR_RESET "\"%s\", "
-                    ANSI_COLOR_BLUE "On line: " ANSI_COLOR_RESET "%d\n", file_name, lineNumber);
-}
\ No newline at end of file
+    return isReached;
+}
+
+/*
+ * Gets the message of an assembler error.
+ *
+ * @param   error       The error code indicating the type of error.
+ *
+ * @return  The message of the error.
+ */
+const char *getAssemblerErrorMessage(Error error)
+{
+    return errorMSG[(error / MAX_ERRORS_IN_ENUM) - 1][error % MAX_ERRORS_IN_ENUM];
+}
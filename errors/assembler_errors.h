@@ -8,6 +8,8 @@
 #ifndef MMN_14_ASSEMBLER_ERRORS_H
 #define MMN_14_ASSEMBLER_ERRORS_H
 
+#include <stdio.h>
+
 /* ---------------Prototypes--------------- */
 
 /*
@@ -19,6 +21,47 @@
  */
 void handle_assembler_error(const char *file_name, int lineNumber, Error lineError);
 
+/*
+ * Handles an assembler error, printing it to the given stream.
+ *
+ * @param   *diagnoses      The stream to print the error to.
+ * @param   *file_name      The name of the file where the error occurred.
+ * @param   lineNumber      The line number where the error occurred.
+ * @param   lineError       The specific error that occurred.
+ */
+void report_assembler_error(FILE *diagnoses, const char *file_name, int lineNumber,
+                            Error lineError);
+
+/*
+ * Gets the message of an assembler error.
+ *
+ * @param   error       The error code indicating the type of error.
+ *
+ * @return  The message of the error.
+ */
+const char *getAssemblerErrorMessage(Error error);
+
+/*
+ * Checks if the lines with errors of a file reached their cap, and reports it when they did.
+ * The cap is shared by all the stages of the file.
+ *
+ * @param   *file_name      The name of the source file being processed.
+ * @param   *errors         The count of the lines with errors of the file.
+ * @param   *diagnoses      The stream to report to, or NULL to only check.
+ *
+ * @return  TRUE if no more lines should be read, otherwise FALSE.
+ */
+boolean isErrorsCapReached(const char *file_name, const error_count_t *errors, FILE *diagnoses);
+
+/*
+ * Prints the call of a macro that an error in an expanded line (a .am line) came from.
+ *
+ * @param   *diagnoses      The stream to print the call to.
+ * @param   *macroName      The name of the called macro.
+ * @param   callLine        The line of the call in the source (.as) file.
+ */
+void report_macro_call(FILE *diagnoses, const char *macroName, int callLine);
+
 /* ---------------------------------------- */
 
 #endif /* MMN_14_ASSEMBLER_ERRORS_H */
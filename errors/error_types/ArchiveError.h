@@ -0,0 +1,29 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file contains the new data type 'ArchiveError' that will be used
+ * to distinguish different errors that can occur while reading an output archive.
+ */
+
+#ifndef MMN_14_ARCHIVEERROR_H
+#define MMN_14_ARCHIVEERROR_H
+
+/* new ArchiveError data type.
+ * This represents all the errors that can occur while reading an output archive. */
+typedef enum
+{
+    /* Indicates no error. !! add new errors after this one !! */
+        ARCHIVE_ERR_START = start_of_error(6),
+
+    /* Archive file related errors. */
+        ARCHIVE_NOT_FOUND_ERR, INVALID_ARCHIVE_ERR,
+
+    /* Entries related errors. */
+        MODULE_NOT_IN_ARCHIVE_ERR,
+
+    /* Amount of archive errors. !! add new errors before this one !! */
+        ARCHIVE_ERROR_SIZE
+} ArchiveError;
+
+#endif /* MMN_14_ARCHIVEERROR_H */
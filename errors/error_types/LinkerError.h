@@ -0,0 +1,33 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file contains the new data type 'LinkerError' that will be used
+ * to distinguish different errors that can occur while linking object files.
+ */
+
+#ifndef MMN_14_LINKERERROR_H
+#define MMN_14_LINKERERROR_H
+
+/* new LinkerError data type.
+ * This represents all the errors that can occur while linking object files. */
+typedef enum
+{
+    /* Indicates no error. !! add new errors after this one !! */
+        LINKER_ERR_START = start_of_error(4),
+
+    /* Object files related linker errors. */
+        OBJECT_FILE_NOT_FOUND_ERR, INVALID_OBJECT_FILE_ERR, INVALID_ENTRY_FILE_ERR,
+        INVALID_EXTERN_FILE_ERR,
+
+    /* Symbol resolution related linker errors. */
+        MULTIPLE_ENTRY_SYMBOL_DEF_ERR, UNRESOLVED_EXTERN_SYMBOL_ERR,
+
+    /* Linked image related linker errors. */
+        LINKED_IMAGE_OVERFLOW_ERR,
+
+    /* Amount of linker errors. !! add new errors before this one !! */
+        LINKER_ERROR_SIZE
+} LinkerError;
+
+#endif /* MMN_14_LINKERERROR_H */
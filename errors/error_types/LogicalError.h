@@ -16,6 +16,10 @@ typedef enum
     /* Indicates no error. !! add new errors after this one !! */
         LOGICAL_ERR_START = start_of_error(3),
     /* Macro related logical errors. */
+        MACRO_ARGUMENTS_AMOUNT_ERR,
+
+    /* Include related logical errors. */
+        INCLUDED_FILE_NOT_FOUND_ERR, INCLUDE_CYCLE_ERR, ERRORS_IN_INCLUDED_FILE_ERR,
 
     /* Label related logical errors. */
         MULTIPLE_NORMAL_LABEL_DEF_ERR,
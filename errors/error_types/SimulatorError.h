@@ -0,0 +1,35 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file contains the new data type 'SimulatorError' that will be used
+ * to distinguish different errors that can occur while running a program on the simulator.
+ */
+
+#ifndef MMN_14_SIMULATORERROR_H
+#define MMN_14_SIMULATORERROR_H
+
+/* new SimulatorError data type.
+ * This represents all the errors that can occur while running a program. */
+typedef enum
+{
+    /* Indicates no error. !! add new errors after this one !! */
+        SIMULATOR_ERR_START = start_of_error(5),
+
+    /* Loading related simulator errors. */
+        PROGRAM_TOO_LARGE_ERR, UNLINKED_EXTERN_SYMBOL_ERR,
+
+    /* Instruction related simulator errors. */
+        ILLEGAL_INSTRUCTION_ERR, PC_OUT_OF_CODE_ERR,
+
+    /* Stack related simulator errors. */
+        STACK_OVERFLOW_ERR, STACK_UNDERFLOW_ERR,
+
+    /* Run limitations simulator errors. */
+        STEPS_LIMIT_REACHED_ERR,
+
+    /* Amount of simulator errors. !! add new errors before this one !! */
+        SIMULATOR_ERROR_SIZE
+} SimulatorError;
+
+#endif /* MMN_14_SIMULATORERROR_H */
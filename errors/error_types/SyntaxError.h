@@ -18,6 +18,10 @@ typedef enum
 
     /* Macro related syntax errors */
         EXPECTED_MACRO_ERR, INVALID_MACRO_NAME_ERR, EXTRANEOUS_TEXT_IN_MACRO_LINE_ERR,
+        INVALID_MACRO_PARAMETERS_ERR,
+
+    /* Include related syntax errors */
+        EXPECTED_INCLUDED_FILE_NAME_ERR,
 
     /* Label related syntax errors */
         EXPECTED_LABEL_ERR, EMPTY_BETWEEN_LABEL_AND_COLON_ERR, LABEL_START_WITH_NUM_ERR,
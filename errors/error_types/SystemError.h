@@ -18,7 +18,7 @@ typedef enum
     /* Dynamic space allocation errors */
         NO_ALLOCATION_ERR,
     /* File handling related errors */
-        FILE_CLOSE_ERR,
+        FILE_CLOSE_ERR, TEMP_FILE_ERR,
     /* Amount of system errors. !! add new errors before this one !! */
         SYSTEM_ERROR_SIZE
 } SystemError;
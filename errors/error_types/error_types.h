@@ -13,6 +13,9 @@
 #include "ImgSystemError.h"
 #include "SyntaxError.h"
 #include "LogicalError.h"
+#include "LinkerError.h"
+#include "SimulatorError.h"
+#include "ArchiveError.h"
 /* ----------------------------- */
 
 /* Combine all different error types to be represented as int */
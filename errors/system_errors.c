@@ -29,7 +29,8 @@ void system_error(SystemError sysErr)
                     /* Dynamic space allocation errors */
             "ERR: Not enough space in the memory !",
                     /* File handling related errors */
-            "ERR: error with closing a file !"
+            "ERR: error with closing a file !",
+            "ERR: error with the temporary file of the assembler !"
             };
 
     puts(systemErrorMsg[sysErr]); /* Printing the error */
@@ -56,4 +57,15 @@ void handle_file_close_errors(int code)
 {
     if (code == EOF) /* EOF (-1) is error return code of fclose() */
         system_error(FILE_CLOSE_ERR);
-}
\ No newline at end of file
+}
+
+/*
+ * Handles error with creating, writing or reading a temporary file.
+ *
+ * @param   *file   The temporary file (NULL if it could not be created).
+ */
+void handle_temp_file_errors(FILE *file)
+{
+    if (file == NULL || ferror(file))
+        system_error(TEMP_FILE_ERR);
+}
@@ -8,6 +8,8 @@
 #ifndef MMN_14_SYSTEM_ERRORS_H
 #define MMN_14_SYSTEM_ERRORS_H
 
+#include <stdio.h>
+
 /* ---------------Prototypes--------------- */
 
 /*
@@ -24,6 +26,13 @@ void handle_allocation_error(void *ptr);
  */
 void handle_file_close_errors(int code);
 
+/*
+ * Handles error with creating, writing or reading a temporary file.
+ *
+ * @param   *file   The temporary file (NULL if it could not be created).
+ */
+void handle_temp_file_errors(FILE *file);
+
 /* ---------------------------------------- */
 
 #endif /* MMN_14_SYSTEM_ERRORS_H */
@@ -0,0 +1,105 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file has the functions to handle errors found by the tools that
+ * work on assembled objects (linker, simulator).
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include "error_types/error_types.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+
+/* ANSI escape codes for text color */
+#define ANSI_COLOR_RED      "\x1b[31m"
+#define ANSI_COLOR_BLUE     "\x1B[34m"
+#define ANSI_COLOR_RESET    "\x1b[0m"
+
+/* The first error type of the tools. */
+#define FIRST_TOOL_ERROR_TYPE 4
+
+/* ------------ */
+
+/*
+ * Handles an error of one of the tools that work on assembled objects (linker, simulator).
+ *
+ * @param   *file_name      The name of the object file where the error occurred.
+ * @param   *detailTitle    The title of the detail about the error (NULL if there is none).
+ * @param   *detail         The detail about the error (a symbol name, an address...).
+ * @param   toolError       The specific error that occurred.
+ */
+void handle_tool_error(const char *file_name, const char *detailTitle, const char *detail,
+                       Error toolError)
+{
+    /* Linker error messages array. */
+    const char *linkerErrorMSG[LINKER_ERROR_SIZE - LINKER_ERR_START] =
+            {
+                    /* Indicates no error. !! add new errors after this one !! */
+                "NO_ERROR",
+
+                    /* Object files related linker errors. */
+                "Unable to open object file! Object files are given without the .ob ending.",
+                "Invalid object file! Expected a heading line and Base64 encoded words.",
+                "Invalid entry file! Expected a label name and an address in every line.",
+                "Invalid extern file! Expected a label name and an address in every line.",
+
+                    /* Symbol resolution related linker errors. */
+                "Entry symbol is defined in more than one object file!",
+                "External symbol is not an entry symbol of any linked object file!",
+
+                    /* Linked image related linker errors. */
+                "Linked image overflow! Keep in mind that this system has 1024 words of memory."
+            };
+
+    /* Simulator error messages array. */
+    const char *simulatorErrorMSG[SIMULATOR_ERROR_SIZE - SIMULATOR_ERR_START] =
+            {
+                    /* Indicates no error. !! add new errors after this one !! */
+                "NO_ERROR",
+
+                    /* Loading related simulator errors. */
+                "Program is too large! It must fit in the memory after address 100.",
+                "Program uses an external symbol! Link the object files before running them.",
+
+                    /* Instruction related simulator errors. */
+                "Illegal instruction! The word is not a valid encoded instruction.",
+                "Program counter left the code segment! Missing 'stop' or a jump to data.",
+
+                    /* Stack related simulator errors. */
+                "Stack overflow! Too many nested 'jsr' calls for the free memory.",
+                "Stack underflow! 'rts' was executed without a matching 'jsr'.",
+
+                    /* Run limitations simulator errors. */
+                "Steps limit reached! The program might be in an infinite loop."
+            };
+
+    /* Archive error messages array. */
+    const char *archiveErrorMSG[ARCHIVE_ERROR_SIZE - ARCHIVE_ERR_START] =
+            {
+                    /* Indicates no error. !! add new errors after this one !! */
+                "NO_ERROR",
+
+                    /* Archive file related errors. */
+                "Unable to open archive! Archives are given without the .mar ending.",
+                "Invalid archive! Expected a table of contents at its end.",
+
+                    /* Entries related errors. */
+                "The module is not in the archive! Modules are given without endings."
+            };
+
+    /* Array including all the different error messages. */
+    const char **errorMSG[] = {linkerErrorMSG, simulatorErrorMSG, archiveErrorMSG};
+
+    /* Printing the error. */
+    fprintf(stderr, ANSI_COLOR_RED "\nERROR: " ANSI_COLOR_RESET "%s\n",
+            errorMSG[(toolError / MAX_ERRORS_IN_ENUM) - FIRST_TOOL_ERROR_TYPE]
+                    [toolError % MAX_ERRORS_IN_ENUM]);
+
+    fprintf(stderr, ANSI_COLOR_BLUE "In object file: " ANSI_COLOR_RESET "\"%s\"", file_name);
+    if (detailTitle != NULL)
+        fprintf(stderr, ", " ANSI_COLOR_BLUE "%s: " ANSI_COLOR_RESET "%s", detailTitle, detail);
+    fputc('\n', stderr);
+}
@@ -0,0 +1,26 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the tools_errors.c file.
+ */
+
+#ifndef MMN_14_TOOLS_ERRORS_H
+#define MMN_14_TOOLS_ERRORS_H
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Handles an error of one of the tools that work on assembled objects (linker, simulator).
+ *
+ * @param   *file_name      The name of the object file where the error occurred.
+ * @param   *detailTitle    The title of the detail about the error (NULL if there is none).
+ * @param   *detail         The detail about the error (a symbol name, an address...).
+ * @param   toolError       The specific error that occurred.
+ */
+void handle_tool_error(const char *file_name, const char *detailTitle, const char *detail,
+                       Error toolError);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_TOOLS_ERRORS_H */
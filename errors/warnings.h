@@ -8,6 +8,8 @@
 #ifndef MMN_14_WARNINGS_H
 #define MMN_14_WARNINGS_H
 
+#include <stdio.h>
+
 /* ---------------Prototypes--------------- */
 
 /* ---Typedef prototype for encapsulation--- */
@@ -18,11 +20,12 @@ typedef struct ast_t ast_t;
  * Handles warnings by finding them if there are, making the necessary changes in the given AST
  * and displaying information about the warning, file name, and line number.
  *
+ * @param   *diagnoses      The stream to print the warnings to.
  * @param   *file_name      The name of the file where the warning will be handled (if there is).
  * @param   lineNumber      The line number where the warning will be handled (if there is).
  * @param   *lineAst        The Abstract Syntax Tree (AST) associated with the line.
  */
-void handleWarnings(const char *file_name, int lineNumber, ast_t *lineAst);
+void handleWarnings(FILE *diagnoses, const char *file_name, int lineNumber, ast_t *lineAst);
 
 /* ---------------------------------------- */
 
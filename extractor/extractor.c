@@ -0,0 +1,50 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * extractor.c
+ *
+ * This file houses the main function of the extractor program. The extractor reads the
+ * output archive of a batch of assembled files (assembler --archive name), and writes back
+ * the output files of the wanted modules.
+ *
+ * Usage: mmn_14_extractor archive_name [module ...]
+ *
+ * Archive and module names are given without endings (the same as the assembler source files).
+ * Without modules, the table of contents of the archive is printed. Otherwise, the files of
+ * every module are written to {module}{file ending}, as the assembler writes them.
+ *
+ * Note: This implementation assumes the C90 standard for compatibility.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include "../new-data-types/boolean.h"
+#include "../new-data-types/process_result.h"
+#include "extractor_algorithm.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define ARCHIVE_ARGUMENT 1
+#define FIRST_MODULE_ARGUMENT 2
+#define SUCCESS_CODE 0
+#define FAILURE_CODE 1
+/* ------------ */
+
+/*
+ * Driver code.
+ */
+int main(int argc, char *argv[])
+{
+    process_result result = SUCCESS;
+
+    if (argc <= ARCHIVE_ARGUMENT) /* Print a message if the arguments are insufficient. */
+        puts("\nPlease select the archive to extract (and the modules to extract from it).");
+    else if (argc == FIRST_MODULE_ARGUMENT)
+        result = list_archive(argv[ARCHIVE_ARGUMENT]);
+    else
+        result = extract_modules(argv[ARCHIVE_ARGUMENT], argv + FIRST_MODULE_ARGUMENT,
+                                 argc - FIRST_MODULE_ARGUMENT);
+
+    return (result == SUCCESS)? SUCCESS_CODE : FAILURE_CODE;
+}
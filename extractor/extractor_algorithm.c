@@ -0,0 +1,152 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * extractor_algorithm.c
+ *
+ * This file implements the reading of the output archives of the assembler.
+ *
+ * The table of contents of an archive is read (with one seek from its end) when it is opened,
+ * then the files of every wanted module are found in the table, read together with one more
+ * seek, and written to their own files.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include "../new-data-types/boolean.h"
+#include "../new-data-types/process_result.h"
+#include "../general-enums/neededKeys.h"
+#include "../errors/error_types/error_types.h"
+#include "../errors/tools_errors.h"
+#include "../FileHandling/writeToFile.h"
+#include "../FileHandling/OutputArchive.h"
+#include "../util/memoryUtil.h"
+#include "extractor_algorithm.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE EXTRACTOR_MEMORY /* For the memory statistics. */
+#define MODULE_TITLE "Module"
+#define COLOR_GREEN "\x1B[32m"
+#define COLOR_RESET "\x1B[0m"
+/* ------------ */
+
+/* ---Macros--- */
+#define INFO_MSG(message, file) printf("\n" COLOR_GREEN "Extractor state:" COLOR_RESET \
+        " %s " COLOR_GREEN "On file:" COLOR_RESET " \"%s\"\n", (message), (file))
+/* ------------ */
+
+/* ---------------Prototypes--------------- */
+process_result extractModule(ArchiveReader *reader, const char *archive_name,
+                             const char *module);
+/* ---------------------------------------- */
+
+/*
+ * Prints the table of contents of an output archive.
+ *
+ * @param   *archive_name   The name of the archive (without its ending).
+ *
+ * @return  SUCCESS if the archive was read, otherwise FAILURE.
+ */
+process_result list_archive(const char *archive_name)
+{
+    Error archiveError;
+    ArchiveReader *reader = openArchive(archive_name, &archiveError);
+    const archive_entry_t *entry;
+    int i; /* Loop variable. */
+
+    if (reader == NULL)
+    {
+        handle_tool_error(archive_name, NULL, NULL, archiveError);
+        return FAILURE;
+    }
+
+    printf("\n%-20s %-8s %10s %10s\n", MODULE_TITLE, "File", "Offset", "Length");
+    for (i = 0; i < getArchiveEntriesAmount(reader); i++)
+    {
+        entry = getArchiveEntry(reader, i);
+        printf("%-20s %-8s %10ld %10ld\n", entry -> module, entry -> fileType, entry -> offset,
+               entry -> length);
+    }
+
+    closeArchive(&reader);
+    return SUCCESS;
+}
+
+/*
+ * Writes the output files of modules from an output archive.
+ * The files of every module are read from the archive with one seek.
+ *
+ * @param   *archive_name   The name of the archive (without its ending).
+ * @param   *modules[]      The names of the modules (without endings).
+ * @param   modulesAmount   The amount of the modules.
+ *
+ * @return  SUCCESS if all the modules were extracted, otherwise FAILURE.
+ */
+process_result extract_modules(const char *archive_name, char *modules[], int modulesAmount)
+{
+    process_result result = SUCCESS; /* Value to return. */
+    Error archiveError;
+    ArchiveReader *reader = openArchive(archive_name, &archiveError);
+    int i; /* Loop variable. */
+
+    if (reader == NULL)
+    {
+        handle_tool_error(archive_name, NULL, NULL, archiveError);
+        return FAILURE;
+    }
+
+    for (i = 0; i < modulesAmount; i++)
+        if (extractModule(reader, archive_name, modules[i]) == FAILURE)
+            result = FAILURE;
+
+    closeArchive(&reader);
+    return result;
+}
+
+/*
+ * Writes the output files of a module from an output archive.
+ *
+ * @param   *reader         The reader of the archive.
+ * @param   *archive_name   The name of the archive (for the errors).
+ * @param   *module         The name of the module.
+ *
+ * @return  SUCCESS if the files of the module were written, otherwise FAILURE.
+ */
+process_result extractModule(ArchiveReader *reader, const char *archive_name,
+                             const char *module)
+{
+    const archive_entry_t *first, *entry;
+    char *contents, *entryEnd, endChar;
+    int entriesAmount, firstIndex = findArchiveModule(reader, module, &entriesAmount);
+    int i; /* Loop variable. */
+
+    if (firstIndex == NO_ARCHIVE_ENTRY)
+    {
+        handle_tool_error(archive_name, MODULE_TITLE, module, MODULE_NOT_IN_ARCHIVE_ERR);
+        return FAILURE;
+    }
+
+    if ((contents = readArchiveEntries(reader, firstIndex, entriesAmount)) == NULL)
+    {
+        handle_tool_error(archive_name, MODULE_TITLE, module, INVALID_ARCHIVE_ERR);
+        return FAILURE;
+    }
+
+    /* Every file is a part of the read contents, ended for its writing. */
+    first = getArchiveEntry(reader, firstIndex);
+    for (i = firstIndex; i < firstIndex + entriesAmount; i++)
+    {
+        entry = getArchiveEntry(reader, i);
+        entryEnd = contents + (entry -> offset - first -> offset) + entry -> length;
+        endChar = *entryEnd;
+
+        *entryEnd = NULL_TERMINATOR;
+        writeToFile(module, entry -> fileType, entryEnd - entry -> length);
+        *entryEnd = endChar;
+    }
+
+    INFO_MSG("Successfully extracted module!", module);
+    (void) clear_ptr(contents)
+    return SUCCESS;
+}
@@ -0,0 +1,38 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the extractor_algorithm.c file.
+ */
+
+#ifndef MMN_14_EXTRACTOR_ALGORITHM_H
+#define MMN_14_EXTRACTOR_ALGORITHM_H
+
+#include "../new-data-types/process_result.h"
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Prints the table of contents of an output archive.
+ *
+ * @param   *archive_name   The name of the archive (without its ending).
+ *
+ * @return  SUCCESS if the archive was read, otherwise FAILURE.
+ */
+process_result list_archive(const char *archive_name);
+
+/*
+ * Writes the output files of modules from an output archive.
+ * The files of every module are read from the archive with one seek.
+ *
+ * @param   *archive_name   The name of the archive (without its ending).
+ * @param   *modules[]      The names of the modules (without endings).
+ * @param   modulesAmount   The amount of the modules.
+ *
+ * @return  SUCCESS if all the modules were extracted, otherwise FAILURE.
+ */
+process_result extract_modules(const char *archive_name, char *modules[], int modulesAmount);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_EXTRACTOR_ALGORITHM_H */
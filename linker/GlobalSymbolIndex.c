@@ -0,0 +1,171 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file has the functions of the GlobalSymbolIndex data structure.
+ * The index is an open addressing hash table (linear probing) from a symbol name to its
+ * final address, so resolving a symbol takes a constant time no matter how many objects
+ * are linked together.
+ */
+
+/* ---Include header files--- */
+#include <stdlib.h>
+#include <string.h>
+#include "../new-data-types/boolean.h"
+#include "../general-enums/indexes.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "GlobalSymbolIndex.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE LINKER_MEMORY /* For the memory statistics. */
+#define SUCCESS_CODE 0
+#define NAME_ALREADY_IN_INDEX_CODE (-2)
+#define MIN_CAPACITY 16
+/* ------------ */
+
+/* A slot in the index, empty if the name is NULL. */
+typedef struct
+{
+    const char *name;
+    int address;
+    int objectNumber;
+} index_slot_t;
+
+/* GlobalSymbolIndex data type. */
+typedef struct GlobalSymbolIndex
+{
+    index_slot_t *slots;
+    unsigned long capacity; /* Always a power of 2. */
+    unsigned long size;
+} GlobalSymbolIndex;
+
+/* ---------------Prototypes--------------- */
+unsigned long findSlotIndex(const GlobalSymbolIndex *index, const char *name);
+/* ---------------------------------------- */
+
+/*
+ * Creates a new empty GlobalSymbolIndex.
+ *
+ * @param   expectedSymbols     The amount of symbols expected to be added to the index.
+ *
+ * @return  Pointer to the newly created GlobalSymbolIndex.
+ */
+GlobalSymbolIndex *createGlobalSymbolIndex(int expectedSymbols)
+{
+    GlobalSymbolIndex *index = (GlobalSymbolIndex *) allocate_space(sizeof(GlobalSymbolIndex));
+    unsigned long i; /* Loop variable. */
+
+    /* Keep the index at most half full, so the probing sequences stay short. */
+    index -> capacity = MIN_CAPACITY;
+    while (index -> capacity < 2 * (unsigned long) expectedSymbols)
+        index -> capacity <<= 1;
+
+    index -> size = 0;
+    index -> slots = (index_slot_t *) allocate_space(index -> capacity * sizeof(index_slot_t));
+    for (i = 0; i < index -> capacity; i++)
+        index -> slots[i].name = NULL;
+
+    return index;
+}
+
+/*
+ * Finds the slot of a name in the index, or the empty slot where it should be added.
+ *
+ * @param   *index  The index to search in.
+ * @param   *name   The name to search for.
+ *
+ * @return  The index of the slot.
+ */
+unsigned long findSlotIndex(const GlobalSymbolIndex *index, const char *name)
+{
+    unsigned long slotIndex = hashString(name) & (index -> capacity - 1);
+
+    while (index -> slots[slotIndex].name != NULL &&
+           strcmp(index -> slots[slotIndex].name, name) != 0)
+        slotIndex = (slotIndex + 1) & (index -> capacity - 1);
+
+    return slotIndex;
+}
+
+/*
+ * Adds a symbol to the index. The index does not copy the name,
+ * so it must stay valid as long as the index is used.
+ *
+ * @param   *index          The index to add the symbol to.
+ * @param   *name           The name of the symbol.
+ * @param   address         The final address of the symbol.
+ * @param   objectNumber    The number of the object that defines the symbol.
+ *
+ * @return  0 on success, (-2) if the name is already in the index.
+ */
+int addGlobalSymbol(GlobalSymbolIndex *index, const char *name, int address, int objectNumber)
+{
+    int returnCode = NAME_ALREADY_IN_INDEX_CODE; /* Assume the name is already in the index. */
+    unsigned long slotIndex;
+
+    if (2 * (index -> size + 1) > index -> capacity) /* Grow the index before it gets full. */
+    {
+        GlobalSymbolIndex *biggerIndex = createGlobalSymbolIndex((int) index -> capacity);
+        unsigned long i; /* Loop variable. */
+
+        for (i = 0; i < index -> capacity; i++)
+            if (index -> slots[i].name != NULL)
+                biggerIndex -> slots[findSlotIndex(biggerIndex, index -> slots[i].name)] =
+                        index -> slots[i];
+
+        (void) clear_ptr(index -> slots)
+        index -> slots = biggerIndex -> slots;
+        index -> capacity = biggerIndex -> capacity;
+        (void) clear_ptr(biggerIndex)
+    }
+
+    slotIndex = findSlotIndex(index, name);
+    if (index -> slots[slotIndex].name == NULL)
+    {
+        index -> slots[slotIndex].name = name;
+        index -> slots[slotIndex].address = address;
+        index -> slots[slotIndex].objectNumber = objectNumber;
+        index -> size++;
+        returnCode = SUCCESS_CODE;
+    }
+
+    return returnCode;
+}
+
+/*
+ * Finds a symbol in the index.
+ * The index is not changed, so a few threads can search it at the same time.
+ *
+ * @param   *index          The index to search in.
+ * @param   *name           The name of the symbol to find.
+ * @param   *address        Will hold the final address of the symbol (if found).
+ * @param   *objectNumber   Will hold the number of the object that defines the symbol (if found).
+ *
+ * @return  TRUE if the symbol was found, otherwise FALSE.
+ */
+boolean findGlobalSymbol(const GlobalSymbolIndex *index, const char *name, int *address,
+                         int *objectNumber)
+{
+    index_slot_t *slot = &index -> slots[findSlotIndex(index, name)];
+
+    if (slot -> name != NULL)
+    {
+        *address = slot -> address;
+        *objectNumber = slot -> objectNumber;
+    }
+
+    return (slot -> name != NULL)? TRUE : FALSE;
+}
+
+/*
+ * Deletes the index and frees its memory.
+ *
+ * @param   **pIndex    Pointer to the index to delete.
+ */
+void deleteGlobalSymbolIndex(GlobalSymbolIndex **pIndex)
+{
+    (void) clear_ptr((*pIndex) -> slots)
+    (void) clear_ptr(*pIndex)
+}
@@ -0,0 +1,63 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the GlobalSymbolIndex.c file.
+ */
+
+#ifndef MMN_14_GLOBALSYMBOLINDEX_H
+#define MMN_14_GLOBALSYMBOLINDEX_H
+
+#include "../new-data-types/boolean.h"
+
+/* GlobalSymbolIndex data type - hash index of the entry symbols of all the linked objects. */
+typedef struct GlobalSymbolIndex GlobalSymbolIndex;
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Creates a new empty GlobalSymbolIndex.
+ *
+ * @param   expectedSymbols     The amount of symbols expected to be added to the index.
+ *
+ * @return  Pointer to the newly created GlobalSymbolIndex.
+ */
+GlobalSymbolIndex *createGlobalSymbolIndex(int expectedSymbols);
+
+/*
+ * Adds a symbol to the index. The index does not copy the name,
+ * so it must stay valid as long as the index is used.
+ *
+ * @param   *index          The index to add the symbol to.
+ * @param   *name           The name of the symbol.
+ * @param   address         The final address of the symbol.
+ * @param   objectNumber    The number of the object that defines the symbol.
+ *
+ * @return  0 on success, (-2) if the name is already in the index.
+ */
+int addGlobalSymbol(GlobalSymbolIndex *index, const char *name, int address, int objectNumber);
+
+/*
+ * Finds a symbol in the index.
+ * The index is not changed, so a few threads can search it at the same time.
+ *
+ * @param   *index          The index to search in.
+ * @param   *name           The name of the symbol to find.
+ * @param   *address        Will hold the final address of the symbol (if found).
+ * @param   *objectNumber   Will hold the number of the object that defines the symbol (if found).
+ *
+ * @return  TRUE if the symbol was found, otherwise FALSE.
+ */
+boolean findGlobalSymbol(const GlobalSymbolIndex *index, const char *name, int *address,
+                         int *objectNumber);
+
+/*
+ * Deletes the index and frees its memory.
+ *
+ * @param   **pIndex    Pointer to the index to delete.
+ */
+void deleteGlobalSymbolIndex(GlobalSymbolIndex **pIndex);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_GLOBALSYMBOLINDEX_H */
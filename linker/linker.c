@@ -0,0 +1,71 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * linker.c
+ *
+ * This file houses the main function of the linker program. The linker takes objects
+ * that were assembled separately by the assembler (their .ob, .ent and .ext files),
+ * and links them into a single image that can be loaded to the memory.
+ *
+ * Usage: mmn_14_linker [-o output_name] [-j threads_amount] object_name ...
+ *
+ * Object names are given without endings (the same as the assembler source files).
+ * The linked image is written to {output_name}.ob and {output_name}.ent,
+ * the default output name is "linked". The linked image is not relocated again, so the
+ * {output_name}.ext and {output_name}.rel files of an earlier run are removed.
+ *
+ * Note: This implementation assumes the C90 standard for compatibility.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <stdlib.h>
+#include "../new-data-types/boolean.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "../util/threadUtil.h"
+#include "linker_algorithm.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE LINKER_MEMORY /* For the memory statistics. */
+#define FIRST_ARGUMENT 1
+#define SUCCESS_CODE 0
+#define FAILURE_CODE 1
+#define DEFAULT_OUTPUT_NAME "linked"
+#define OUTPUT_OPTION "-o"
+#define THREADS_OPTION "-j"
+/* ------------ */
+
+/*
+ * Driver code.
+ */
+int main(int argc, char *argv[])
+{
+    char **objectNames = (char **) allocate_space(argc * sizeof(char *));
+    const char *output_name = DEFAULT_OUTPUT_NAME;
+    int threadsAmount = getProcessorsAmount();
+    int objectsAmount = 0, returnCode = SUCCESS_CODE;
+    int i; /* Loop variable. */
+
+    /* Separate the options from the object names. */
+    for (i = FIRST_ARGUMENT; i < argc; i++)
+    {
+        if (sameStrings(argv[i], OUTPUT_OPTION) == TRUE && i + 1 < argc)
+            output_name = argv[++i];
+        else if (sameStrings(argv[i], THREADS_OPTION) == TRUE && i + 1 < argc)
+            threadsAmount = atoi(argv[++i]);
+        else
+            objectNames[objectsAmount++] = argv[i];
+    }
+
+    if (objectsAmount == 0) /* Print a message if the arguments are insufficient. */
+        puts("\nPlease select the assembled objects to link.");
+
+    else if (link_objects(objectNames, objectsAmount, output_name, threadsAmount) == FAILURE)
+        returnCode = FAILURE_CODE;
+
+    (void) free_ptr(objectNames);
+    return returnCode;
+}
@@ -0,0 +1,568 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * linker_algorithm.c
+ *
+ * This file implements the linking of a few assembled objects into a single image.
+ *
+ * The linked image is loaded to the memory at the same place as a single object
+ * (PROGRAM_MEM_START), the code segments of all the objects are placed one after the other,
+ * and after them the data segments, in the order the objects were given.
+ *
+ * Linking is done in four steps:
+ *      1. Every object is loaded and its relocatable (R) words are found, from its relocation
+ *         table (.rel file) or by decoding its instructions if it has no table. (parallel)
+ *      2. The segments of the objects are placed, and the entry symbols of all the objects
+ *         are added to one hash index with their final addresses. (serial)
+ *      3. Every object is copied into the image, its relocatable words are moved by the
+ *         place of its segments and its external (E) words are resolved from the index. (parallel)
+ *      4. The errors are reported and the output files are created. (serial)
+ *
+ * Objects don't share any state during the parallel steps, every object only
+ * writes to its own segments in the image, and the index is only read.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../new-data-types/boolean.h"
+#include "../new-data-types/process_result.h"
+#include "../general-enums/programFinals.h"
+#include "../general-enums/indexes.h"
+#include "../general-enums/assemblerFinals.h"
+#include "../encoding/encoding-finals/ranges.h"
+#include "../encoding/encoding-finals/encoding_types.h"
+#include "../encoding/encoding-finals/addressing_methods.h"
+#include "../encoding/wordHandling.h"
+#include "../assembler_ast/assembler_ast.h"
+#include "../SymbolTable/SymbolTable.h"
+#include "../encoding/encoding.h"
+#include "../ObjectFile/ObjectFile.h"
+#include "../FileHandling/writeToFile.h"
+#include "../errors/tools_errors.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "../util/threadUtil.h"
+#include "GlobalSymbolIndex.h"
+#include "linker_algorithm.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE LINKER_MEMORY /* For the memory statistics. */
+#define OBJECT_END ".ob"
+#define ENT_END ".ent"
+#define EXT_END ".ext"
+#define REL_END ".rel"
+#define SUCCESS_CODE 0
+#define SYMBOL_TITLE "Symbol"
+#define COLOR_GREEN "\x1B[32m"
+#define COLOR_RESET "\x1B[0m"
+/* ------------ */
+
+/* ---Macros--- */
+#define INFO_MSG(message, file) printf("\n" COLOR_GREEN "Linker state:" COLOR_RESET \
+        " %s " COLOR_GREEN "On file:" COLOR_RESET " \"%s\"\n", (message), (file))
+/* ------------ */
+
+/* An object that is being linked. */
+typedef struct
+{
+    ObjectFile *objectFile; /* The loaded object, NULL if it was not loaded. */
+    Error linkError; /* The first error found in the object. */
+    int *relocatableWords; /* Indexes of the relocatable words in the code segment. */
+    int relocatableWordsAmount;
+    int bases[COUNTERS_AMOUNT]; /* The final addresses of the code and data segments. */
+    boolean isUnresolved; /* Flag to indicate if an external symbol was not resolved. */
+} linked_object_t;
+
+/* State shared by all the steps of the linking. */
+typedef struct
+{
+    char **objectNames;
+    int objectsAmount;
+    linked_object_t *objects;
+    GlobalSymbolIndex *globalSymbols; /* The entry symbols of all the objects. */
+    word_t *image; /* The code segments of all the objects followed by their data segments. */
+    int counters[COUNTERS_AMOUNT]; /* Total amount of code and data words. */
+} linker_context_t;
+
+/* ---------------Prototypes--------------- */
+void loadObjectTask(int objectNumber, void *context);
+Error findRelocatableWords(linked_object_t *object);
+void readRelocatableWords(linked_object_t *object);
+int getArgumentWordsAmount(addressing_method_t srcMtd, addressing_method_t destMtd);
+boolean isValidAddressingMethod(int addressingMethod);
+process_result placeObjects(linker_context_t *linker);
+process_result indexEntrySymbols(linker_context_t *linker);
+void relocateObjectTask(int objectNumber, void *context);
+int relocateAddress(const linked_object_t *object, int address);
+process_result reportLoadErrors(linker_context_t *linker);
+process_result reportUnresolvedSymbols(linker_context_t *linker);
+void createLinkedFiles(linker_context_t *linker, const char *output_name);
+void clearLinkerContext(linker_context_t *linker);
+/* ---------------------------------------- */
+
+/*
+ * Links assembled objects into a single image.
+ * Writes the linked image to {output_name}.ob and its entry symbols to {output_name}.ent.
+ *
+ * @param   *objectNames[]  The names of the objects to link (without endings).
+ * @param   objectsAmount   The amount of objects to link.
+ * @param   *output_name    The name of the linked image (without endings).
+ * @param   threadsAmount   The maximum amount of threads to use for per object work.
+ *
+ * @return  SUCCESS if the objects were linked, otherwise FAILURE.
+ */
+process_result link_objects(char *objectNames[], int objectsAmount, const char *output_name,
+                            int threadsAmount)
+{
+    process_result linkResult;
+    linker_context_t linker;
+    int i; /* Loop variable. */
+
+    INFO_MSG("Starting linking objects", output_name);
+
+    linker.objectNames = objectNames;
+    linker.objectsAmount = objectsAmount;
+    linker.objects = (linked_object_t *) allocate_space(objectsAmount * sizeof(linked_object_t));
+    linker.globalSymbols = NULL;
+    linker.image = NULL;
+
+    for (i = ZERO_INDEX; i < objectsAmount; i++)
+    {
+        linker.objects[i].objectFile = NULL;
+        linker.objects[i].relocatableWords = NULL;
+        linker.objects[i].relocatableWordsAmount = ZERO_COUNT;
+        linker.objects[i].isUnresolved = FALSE;
+    }
+
+    /* Step 1: load the objects. */
+    runTasksInParallel(objectsAmount, threadsAmount, loadObjectTask, &linker);
+    linkResult = reportLoadErrors(&linker);
+
+    /* Step 2: place the objects and index their entry symbols. */
+    if (linkResult == SUCCESS)
+        linkResult = placeObjects(&linker);
+    if (linkResult == SUCCESS)
+        linkResult = indexEntrySymbols(&linker);
+
+    /* Step 3: relocate the objects into the image. */
+    if (linkResult == SUCCESS)
+    {
+        runTasksInParallel(objectsAmount, threadsAmount, relocateObjectTask, &linker);
+        linkResult = reportUnresolvedSymbols(&linker);
+    }
+
+    /* Step 4: create the output files. */
+    if (linkResult == SUCCESS)
+        createLinkedFiles(&linker, output_name);
+
+    clearLinkerContext(&linker);
+
+    if (linkResult == SUCCESS)
+        INFO_MSG("Successfully linked objects!", output_name);
+    else
+        INFO_MSG("Failed to link objects.", output_name);
+
+    return linkResult;
+}
+
+/*
+ * Loads an object and finds its relocatable words (parallel task).
+ *
+ * @param   objectNumber    The number of the object to load.
+ * @param   *context        The linker context.
+ */
+void loadObjectTask(int objectNumber, void *context)
+{
+    linker_context_t *linker = (linker_context_t *) context;
+    linked_object_t *object = &linker -> objects[objectNumber];
+
+    object -> objectFile = loadObjectFile(linker -> objectNames[objectNumber], &object -> linkError);
+
+    if (object -> linkError == NO_ERROR && object -> objectFile -> relocations != NULL)
+        readRelocatableWords(object);
+    else if (object -> linkError == NO_ERROR)
+        object -> linkError = findRelocatableWords(object);
+}
+
+/*
+ * Reads the relocatable words of an object from its relocation table,
+ * a single pass over the table instead of decoding the code segment.
+ *
+ * @param   *object     The object to read its relocatable words.
+ */
+void readRelocatableWords(linked_object_t *object)
+{
+    ObjectFile *objectFile = object -> objectFile;
+    int i; /* Loop variable. */
+
+    object -> relocatableWords = (int *) allocate_space(
+            objectFile -> relocationsAmount * sizeof(int) + 1);
+
+    for (i = ZERO_INDEX; i < objectFile -> relocationsAmount; i++)
+        if (objectFile -> relocations[i].kind == RELOCATABLE)
+            object -> relocatableWords[object -> relocatableWordsAmount++] =
+                    objectFile -> relocations[i].address - PROGRAM_MEM_START;
+}
+
+/*
+ * Finds the relocatable words in the code segment of an object,
+ * by going over its instructions and their argument words.
+ *
+ * @param   *object     The object to find its relocatable words.
+ *
+ * @return  NO_ERROR if the code segment is valid, otherwise INVALID_OBJECT_FILE_ERR.
+ */
+Error findRelocatableWords(linked_object_t *object)
+{
+    Error codeError = NO_ERROR;
+    word_t *code = object -> objectFile -> words;
+    int codeSize = object -> objectFile -> counters[IC_];
+    int currWord = ZERO_INDEX, argWord;
+    addressing_method_t argMethods[TWO_INDEX], srcMtd, destMtd;
+    int i; /* Loop variable. */
+
+    object -> relocatableWords = (int *) allocate_space(codeSize * sizeof(int) + 1);
+
+    while (currWord < codeSize && codeError == NO_ERROR)
+    {
+        srcMtd = (addressing_method_t) getBitsInRange(code[currWord], SRC_MTD_LOW, SRC_MTD_HIGH);
+        destMtd = (addressing_method_t) getBitsInRange(code[currWord], DEST_MTD_LOW, DEST_MTD_HIGH);
+
+        if (isValidAddressingMethod(srcMtd) == FALSE || isValidAddressingMethod(destMtd) == FALSE
+            || currWord + getArgumentWordsAmount(srcMtd, destMtd) >= codeSize)
+            codeError = INVALID_OBJECT_FILE_ERR;
+
+        else
+        {
+            /* The source argument word comes before the destination argument word. */
+            argMethods[ZERO_INDEX] = srcMtd;
+            argMethods[ONE_INDEX] = destMtd;
+            argWord = currWord + ONE_INDEX;
+
+            for (i = ZERO_INDEX; i < TWO_INDEX; i++)
+                if (argMethods[i] != ZERO_ADD_MTD)
+                {
+                    if (argMethods[i] == DIRECT &&
+                        getBitsInRange(code[argWord], ARE_LOW, ARE_HIGH) == RELOCATABLE)
+                        object -> relocatableWords[object -> relocatableWordsAmount++] = argWord;
+                    argWord++;
+                }
+
+            currWord += ONE_INDEX + getArgumentWordsAmount(srcMtd, destMtd);
+        }
+    }
+
+    return codeError;
+}
+
+/*
+ * Gets the amount of argument words of an instruction.
+ *
+ * @param   srcMtd      The addressing method of the source argument.
+ * @param   destMtd     The addressing method of the destination argument.
+ *
+ * @return  The amount of argument words of the instruction.
+ */
+int getArgumentWordsAmount(addressing_method_t srcMtd, addressing_method_t destMtd)
+{
+    int argWords = ((srcMtd != ZERO_ADD_MTD)? ONE_INDEX : ZERO_INDEX) +
+            ((destMtd != ZERO_ADD_MTD)? ONE_INDEX : ZERO_INDEX);
+
+    /* Two register arguments share one word. */
+    return (srcMtd == DIRECT_REGISTER && destMtd == DIRECT_REGISTER)? ONE_INDEX : argWords;
+}
+
+/*
+ * Checks if a value of an addressing method field is valid.
+ *
+ * @param   addressingMethod    The value of the field.
+ *
+ * @return  TRUE if the value is a valid addressing method, otherwise FALSE.
+ */
+boolean isValidAddressingMethod(int addressingMethod)
+{
+    return (addressingMethod == ZERO_ADD_MTD || addressingMethod == INSTANT ||
+            addressingMethod == DIRECT || addressingMethod == DIRECT_REGISTER)? TRUE : FALSE;
+}
+
+/*
+ * Places the segments of all the objects in the linked image.
+ *
+ * @param   *linker     The linker context.
+ *
+ * @return  SUCCESS if the linked image fits in the memory, otherwise FAILURE.
+ */
+process_result placeObjects(linker_context_t *linker)
+{
+    process_result placeResult = SUCCESS;
+    int nextAddress[COUNTERS_AMOUNT], i; /* Loop variables. */
+
+    linker -> counters[IC_] = linker -> counters[DC_] = ZERO_COUNT;
+    for (i = ZERO_INDEX; i < linker -> objectsAmount; i++)
+    {
+        linker -> counters[IC_] += linker -> objects[i].objectFile -> counters[IC_];
+        linker -> counters[DC_] += linker -> objects[i].objectFile -> counters[DC_];
+    }
+
+    /* Same rule as the assembler, the last word must be inside the memory. */
+    if (PROGRAM_MEM_START + linker -> counters[IC_] + linker -> counters[DC_] >=
+        IMG_SYSTEM_MEMORY_SIZE)
+    {
+        handle_tool_error(linker -> objectNames[linker -> objectsAmount - 1], NULL, NULL,
+                          LINKED_IMAGE_OVERFLOW_ERR);
+        placeResult = FAILURE;
+    }
+
+    else
+    {
+        nextAddress[IC_] = PROGRAM_MEM_START;
+        nextAddress[DC_] = PROGRAM_MEM_START + linker -> counters[IC_];
+
+        for (i = ZERO_INDEX; i < linker -> objectsAmount; i++)
+        {
+            linker -> objects[i].bases[IC_] = nextAddress[IC_];
+            linker -> objects[i].bases[DC_] = nextAddress[DC_];
+            nextAddress[IC_] += linker -> objects[i].objectFile -> counters[IC_];
+            nextAddress[DC_] += linker -> objects[i].objectFile -> counters[DC_];
+        }
+
+        linker -> image = (word_t *) allocate_space(
+                (linker -> counters[IC_] + linker -> counters[DC_]) * sizeof(word_t) + 1);
+    }
+
+    return placeResult;
+}
+
+/*
+ * Adds the entry symbols of all the objects to the global symbol index.
+ *
+ * @param   *linker     The linker context.
+ *
+ * @return  SUCCESS if every entry symbol is defined once, otherwise FAILURE.
+ */
+process_result indexEntrySymbols(linker_context_t *linker)
+{
+    process_result indexResult = SUCCESS;
+    int entriesAmount = ZERO_COUNT, i, j; /* Loop variables. */
+    ObjectFile *objectFile;
+
+    for (i = ZERO_INDEX; i < linker -> objectsAmount; i++)
+        entriesAmount += linker -> objects[i].objectFile -> entriesAmount;
+
+    linker -> globalSymbols = createGlobalSymbolIndex(entriesAmount);
+
+    for (i = ZERO_INDEX; i < linker -> objectsAmount; i++)
+    {
+        objectFile = linker -> objects[i].objectFile;
+
+        for (j = ZERO_INDEX; j < objectFile -> entriesAmount; j++)
+            if (addGlobalSymbol(linker -> globalSymbols, objectFile -> entries[j].name,
+                                relocateAddress(&linker -> objects[i],
+                                                objectFile -> entries[j].address),
+                                i) != SUCCESS_CODE)
+            {
+                handle_tool_error(objectFile -> file_name, SYMBOL_TITLE,
+                                  objectFile -> entries[j].name, MULTIPLE_ENTRY_SYMBOL_DEF_ERR);
+                indexResult = FAILURE;
+            }
+    }
+
+    return indexResult;
+}
+
+/*
+ * Copies an object into the linked image, relocates its relocatable words
+ * and resolves its external words (parallel task).
+ *
+ * @param   objectNumber    The number of the object to relocate.
+ * @param   *context        The linker context.
+ */
+void relocateObjectTask(int objectNumber, void *context)
+{
+    linker_context_t *linker = (linker_context_t *) context;
+    linked_object_t *object = &linker -> objects[objectNumber];
+    ObjectFile *objectFile = object -> objectFile;
+    word_t *code = linker -> image + (object -> bases[IC_] - PROGRAM_MEM_START);
+    word_t *data = linker -> image + (object -> bases[DC_] - PROGRAM_MEM_START);
+    int i, address, definingObject; /* Loop variables. */
+
+    /* Copy the segments into the image. */
+    (void) memcpy(code, objectFile -> words, objectFile -> counters[IC_] * sizeof(word_t));
+    (void) memcpy(data, objectFile -> words + objectFile -> counters[IC_],
+                  objectFile -> counters[DC_] * sizeof(word_t));
+
+    /* Move the relocatable addresses by the place of the segments. */
+    for (i = ZERO_INDEX; i < object -> relocatableWordsAmount; i++)
+    {
+        address = getBitsInRange(code[object -> relocatableWords[i]], DIR_DATA_LOW, DIR_DATA_HIGH);
+        setBitsInRangeToVal(&code[object -> relocatableWords[i]], DIR_DATA_LOW, DIR_DATA_HIGH,
+                            relocateAddress(object, address));
+    }
+
+    /* Resolve the external words, they become relocatable words in the linked image. */
+    for (i = ZERO_INDEX; i < objectFile -> externsAmount; i++)
+    {
+        int externWord = objectFile -> externs[i].address - PROGRAM_MEM_START;
+
+        if (isObjectCodeAddress(objectFile, objectFile -> externs[i].address) == FALSE ||
+            getBitsInRange(code[externWord], ARE_LOW, ARE_HIGH) != EXTERNAL)
+            object -> linkError = INVALID_EXTERN_FILE_ERR;
+
+        else if (findGlobalSymbol(linker -> globalSymbols, objectFile -> externs[i].name,
+                                  &address, &definingObject) == FALSE)
+            object -> isUnresolved = TRUE;
+
+        else
+        {
+            setBitsInRangeToVal(&code[externWord], DIR_DATA_LOW, DIR_DATA_HIGH, address);
+            setBitsInRangeToVal(&code[externWord], ARE_LOW, ARE_HIGH, RELOCATABLE);
+        }
+    }
+}
+
+/*
+ * Gets the final address of an address of an object (as the assembler assigned it).
+ *
+ * @param   *object     The object of the address.
+ * @param   address     The address to relocate.
+ *
+ * @return  The final address in the linked image.
+ */
+int relocateAddress(const linked_object_t *object, int address)
+{
+    return (isObjectCodeAddress(object -> objectFile, address) == TRUE)?
+            address - PROGRAM_MEM_START + object -> bases[IC_] :
+            address - PROGRAM_MEM_START - object -> objectFile -> counters[IC_] +
+            object -> bases[DC_];
+}
+
+/*
+ * Reports the errors found while loading the objects.
+ *
+ * @param   *linker     The linker context.
+ *
+ * @return  SUCCESS if all the objects were loaded, otherwise FAILURE.
+ */
+process_result reportLoadErrors(linker_context_t *linker)
+{
+    process_result loadResult = SUCCESS;
+    int i; /* Loop variable. */
+
+    for (i = ZERO_INDEX; i < linker -> objectsAmount; i++)
+        if (linker -> objects[i].linkError != NO_ERROR)
+        {
+            handle_tool_error(linker -> objectNames[i], NULL, NULL,
+                              linker -> objects[i].linkError);
+            loadResult = FAILURE;
+        }
+
+    return loadResult;
+}
+
+/*
+ * Reports the errors found while relocating the objects.
+ *
+ * @param   *linker     The linker context.
+ *
+ * @return  SUCCESS if all the external symbols were resolved, otherwise FAILURE.
+ */
+process_result reportUnresolvedSymbols(linker_context_t *linker)
+{
+    process_result resolveResult = SUCCESS;
+    ObjectFile *objectFile;
+    int i, j, address, definingObject; /* Loop variables. */
+
+    for (i = ZERO_INDEX; i < linker -> objectsAmount; i++)
+    {
+        objectFile = linker -> objects[i].objectFile;
+
+        if (linker -> objects[i].linkError != NO_ERROR)
+        {
+            handle_tool_error(objectFile -> file_name, NULL, NULL,
+                              linker -> objects[i].linkError);
+            resolveResult = FAILURE;
+        }
+
+        /* Find the unresolved symbols again, only for objects that have them. */
+        if (linker -> objects[i].isUnresolved == TRUE)
+        {
+            for (j = ZERO_INDEX; j < objectFile -> externsAmount; j++)
+                if (findGlobalSymbol(linker -> globalSymbols, objectFile -> externs[j].name,
+                                     &address, &definingObject) == FALSE)
+                    handle_tool_error(objectFile -> file_name, SYMBOL_TITLE,
+                                      objectFile -> externs[j].name, UNRESOLVED_EXTERN_SYMBOL_ERR);
+            resolveResult = FAILURE;
+        }
+    }
+
+    return resolveResult;
+}
+
+/*
+ * Creates the output files of the linked image (.ob and .ent), and removes its .ext and .rel
+ * files of an earlier run (and its .ent file if it has no entry labels).
+ *
+ * @param   *linker         The linker context.
+ * @param   *output_name    The name of the linked image (without endings).
+ */
+void createLinkedFiles(linker_context_t *linker, const char *output_name)
+{
+    MemoryImage *memoryImage = createMemoryImageFromWords(linker -> image,
+                                                          linker -> counters[IC_],
+                                                          linker -> counters[DC_]);
+    char *objectFileContents = getObjectFileContents(memoryImage);
+    char *entryFileContents = NULL;
+    ObjectFile *objectFile;
+    int i, j; /* Loop variables. */
+
+    /* The entry symbols stay entry symbols of the linked image. */
+    for (i = ZERO_INDEX; i < linker -> objectsAmount; i++)
+    {
+        objectFile = linker -> objects[i].objectFile;
+
+        for (j = ZERO_INDEX; j < objectFile -> entriesAmount; j++)
+            addToStringInFormat(&entryFileContents, objectFile -> entries[j].name,
+                                relocateAddress(&linker -> objects[i],
+                                                objectFile -> entries[j].address));
+    }
+
+    writeToFile(output_name, OBJECT_END, objectFileContents);
+    if (entryFileContents != NULL)
+        writeToFile(output_name, ENT_END, entryFileContents);
+    else /* There are no entry labels. */
+        removeOutputFile(output_name, ENT_END);
+    /* The linked image is not relocated or linked again, it has no .ext and .rel files. */
+    removeOutputFile(output_name, EXT_END);
+    removeOutputFile(output_name, REL_END);
+
+    (void) clear_ptr(objectFileContents)
+    (void) clear_ptr(entryFileContents)
+    clearMemoryImage(&memoryImage);
+}
+
+/*
+ * Clears the data structures used during the linking.
+ *
+ * @param   *linker     The linker context.
+ */
+void clearLinkerContext(linker_context_t *linker)
+{
+    int i; /* Loop variable. */
+
+    for (i = ZERO_INDEX; i < linker -> objectsAmount; i++)
+    {
+        if (linker -> objects[i].objectFile != NULL)
+            deleteObjectFile(&linker -> objects[i].objectFile);
+        (void) clear_ptr(linker -> objects[i].relocatableWords)
+    }
+
+    if (linker -> globalSymbols != NULL)
+        deleteGlobalSymbolIndex(&linker -> globalSymbols);
+
+    (void) clear_ptr(linker -> image)
+    (void) clear_ptr(linker -> objects)
+}
@@ -0,0 +1,31 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the linker_algorithm.c file.
+ */
+
+#ifndef MMN_14_LINKER_ALGORITHM_H
+#define MMN_14_LINKER_ALGORITHM_H
+
+#include "../new-data-types/process_result.h"
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Links assembled objects into a single image.
+ * Writes the linked image to {output_name}.ob and its entry symbols to {output_name}.ent.
+ *
+ * @param   *objectNames[]  The names of the objects to link (without endings).
+ * @param   objectsAmount   The amount of objects to link.
+ * @param   *output_name    The name of the linked image (without endings).
+ * @param   threadsAmount   The maximum amount of threads to use for per object work.
+ *
+ * @return  SUCCESS if the objects were linked, otherwise FAILURE.
+ */
+process_result link_objects(char *objectNames[], int objectsAmount, const char *output_name,
+                            int threadsAmount);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_LINKER_ALGORITHM_H */
@@ -0,0 +1,919 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * LspDocument.c
+ *
+ * This file has the documents of the language server, and their incremental diagnoses.
+ *
+ * A document keeps every line with its AST (built by the first transition code, which depends
+ * only on the text of the line) and the error found in it, and an index of the names (labels
+ * and macros) to the lines that have them.
+ * The checks of the labels of a line (a label defined twice, .entry and .extern conflicts,
+ * labels that are not defined) depend only on the other lines with the same labels, so after
+ * a change only the changed lines are parsed again, and only the lines that have a name that
+ * the changed lines had or have are checked again.
+ *
+ * Macro definitions are not expanded: the lines of a macro are diagnosed where they are
+ * written (as if the macro is called once), and a line calling a macro defined before it
+ * has no error.
+ */
+
+/* ---Include header files--- */
+#include <stdlib.h>
+#include <string.h>
+#include "../new-data-types/boolean.h"
+#include "../new-data-types/word_number.h"
+#include "../SymbolTable/SymbolTable.h"
+#include "../assembler_ast/assembler_ast.h"
+#include "../general-enums/indexes.h"
+#include "../general-enums/programFinals.h"
+#include "../errors/error_types/error_types.h"
+#include "../errors/FirstTransitionErrors/FirstTransitionLogicalAndImgSystemErrors.h"
+#include "../errors/PreProcessorErrors/PreProcessorErrors.h"
+#include "../diagnoses/diagnose_line.h"
+#include "../diagnoses/diagnose_util.h"
+#include "../diagnoses/assembler_line_diagnoses.h"
+#include "../transitions/first_transition_util.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "LspDocument.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE LSP_MEMORY /* For the memory statistics. */
+#define NAME_BUCKETS 1024
+#define INITIAL_CAPACITY 4
+#define GROWTH_FACTOR 2
+#define NEW_LINE '\n'
+#define CARRIAGE_RETURN '\r'
+#define START_MACRO "mcro"
+#define END_MACRO "endmcro"
+#define ALL_LINES (-1)
+/* ------------ */
+
+/* ---Macros--- */
+#define is_name_char(ch) (isLetter(ch) || isCharNumber(ch))
+/* ------------ */
+
+/* The kinds of the lines of a document. */
+typedef enum {SKIPPED_LINE, MACRO_START_LINE, MACRO_END_LINE, CODE_LINE} line_kind_t;
+
+/* A line of a document. */
+typedef struct
+{
+    char *text;
+    int index; /* The index of the line in the document. */
+    line_kind_t kind;
+    ast_t *lineAst; /* The AST of a code line, NULL if the line has an error in itself. */
+    Error lineError; /* The error in the line itself. */
+    Error error; /* The error of the line, with the checks of its labels. */
+    char *errorLabel; /* The label of a code line with an error in itself, or NULL. */
+    char **names; /* The labels and macros in the line (every name once). */
+    int namesAmount;
+    unsigned long checkStamp; /* The change the line was checked in. */
+} document_line_t;
+
+/* The lines that have a name. */
+typedef struct name_users_t
+{
+    char *name;
+    document_line_t **lines; /* In no order. */
+    int linesAmount;
+    int capacity;
+    unsigned long checkStamp; /* The change the lines were checked in. */
+    struct name_users_t *next; /* The next name in the bucket. */
+} name_users_t;
+
+struct LspDocument
+{
+    char *uri;
+    document_line_t **lines;
+    int linesAmount;
+    int capacity;
+    name_users_t *names[NAME_BUCKETS];
+    unsigned long changeStamp; /* Counts the changes of the document. */
+};
+
+/* ---------------Prototypes--------------- */
+void clampTextPosition(const LspDocument *document, const text_position_t *position,
+                       int *line, int *character);
+void replaceDocumentLines(LspDocument *document, int firstLine, int removedAmount,
+                          const char *newText);
+void makeRoomForLines(LspDocument *document, int firstLine, int removedAmount, int addedAmount);
+document_line_t *createDocumentLine(const char *text, int length);
+void parseDocumentLine(document_line_t *line);
+void addNameToLine(document_line_t *line, const char *name);
+void deleteDocumentLine(document_line_t **pLine);
+name_users_t *findNameUsers(const LspDocument *document, const char *name);
+void addNameUser(LspDocument *document, const char *name, document_line_t *line);
+void removeNameUser(LspDocument *document, const char *name, document_line_t *line);
+void checkNameUsers(LspDocument *document, const char *name);
+void checkDocumentLine(LspDocument *document, document_line_t *line);
+Error checkLineLabels(const LspDocument *document, document_line_t *line);
+int getNameFlags(const LspDocument *document, const char *name, int beforeLine);
+int getLineNameFlags(document_line_t *line, const char *name);
+boolean isCallingDefinedMacro(const LspDocument *document, document_line_t *line);
+char *getNameAtPosition(const LspDocument *document, const text_position_t *position);
+void findNameInLine(const document_line_t *line, const char *name, text_range_t *range);
+int compareRangesByLine(const void *firstRange, const void *secondRange);
+/* ---------------------------------------- */
+
+/*
+ * Creates a document and diagnoses all its lines.
+ *
+ * @param   *uri    The uri of the document.
+ * @param   *text   The text of the document.
+ *
+ * @return  The created document.
+ */
+LspDocument *createLspDocument(const char *uri, const char *text)
+{
+    LspDocument *document = (LspDocument *) allocate_space(sizeof(LspDocument));
+    int i; /* Loop variable. */
+
+    document -> uri = my_strdup(uri);
+    document -> lines = NULL;
+    document -> linesAmount = document -> capacity = ZERO_COUNT;
+    document -> changeStamp = ZERO_COUNT;
+    for (i = ZERO_INDEX; i < NAME_BUCKETS; i++)
+        document -> names[i] = NULL;
+
+    replaceDocumentLines(document, ZERO_INDEX, ZERO_COUNT, text);
+    return document;
+}
+
+/*
+ * Gets the uri of a document.
+ *
+ * @param   *document   The document.
+ *
+ * @return  The uri of the document.
+ */
+const char *getDocumentUri(const LspDocument *document)
+{
+    return document -> uri;
+}
+
+/*
+ * Changes a range of the text of a document, and diagnoses again only the changed lines and
+ * the lines with the labels (and macros) that the changed lines had or have.
+ * A range out of the document is moved to its end.
+ *
+ * @param   *document   The document.
+ * @param   *start      The start of the text to replace, or NULL to replace all the text.
+ * @param   *end        The end of the text to replace (not including it).
+ * @param   *text       The new text.
+ */
+void changeDocumentText(LspDocument *document, const text_position_t *start,
+                        const text_position_t *end, const char *text)
+{
+    int startLine, startChar, endLine, endChar;
+    const char *startText, *endText;
+    char *newText;
+
+    if (start == NULL)
+    {
+        replaceDocumentLines(document, ZERO_INDEX, document -> linesAmount, text);
+        return;
+    }
+
+    /* Keep the range in the document. */
+    clampTextPosition(document, start, &startLine, &startChar);
+    clampTextPosition(document, end, &endLine, &endChar);
+    if (endLine < startLine || (endLine == startLine && endChar < startChar))
+    {
+        endLine = startLine;
+        endChar = startChar;
+    }
+    startText = document -> lines[startLine] -> text;
+    endText = document -> lines[endLine] -> text;
+
+    /* The new text of the changed lines. */
+    newText = strcpyPart(startText, ZERO_INDEX, startChar);
+    addTwoStrings(&newText, text);
+    addTwoStrings(&newText, endText + endChar);
+
+    replaceDocumentLines(document, startLine, endLine - startLine + 1, newText);
+    (void) clear_ptr(newText)
+}
+
+/*
+ * Moves a position into a document (a position after the end of the document is moved to its
+ * end, and a position after the end of a line is moved to the end of the line).
+ *
+ * @param   *document   The document.
+ * @param   *position   The position.
+ * @param   *line       Will hold the index of the line of the position.
+ * @param   *character  Will hold the index of the char of the position in the line.
+ */
+void clampTextPosition(const LspDocument *document, const text_position_t *position,
+                       int *line, int *character)
+{
+    int lineLength;
+
+    *line = (position -> line > ZERO_INDEX)? position -> line : ZERO_INDEX;
+    *character = (position -> character > ZERO_INDEX)? position -> character : ZERO_INDEX;
+    if (*line >= document -> linesAmount)
+    {
+        *line = document -> linesAmount - 1;
+        *character = (int) strlen(document -> lines[*line] -> text);
+    }
+
+    lineLength = (int) strlen(document -> lines[*line] -> text);
+    *character = (*character < lineLength)? *character : lineLength;
+}
+
+/*
+ * Replaces lines of a document with new lines, and diagnoses again the new lines and the
+ * lines with the names that the removed lines or the new lines have.
+ *
+ * @param   *document       The document.
+ * @param   firstLine       The index of the first line to replace.
+ * @param   removedAmount   The amount of lines to replace.
+ * @param   *newText        The text of the new lines.
+ */
+void replaceDocumentLines(LspDocument *document, int firstLine, int removedAmount,
+                          const char *newText)
+{
+    char **removedNames = NULL; /* The names of the removed lines. */
+    int removedNamesAmount = ZERO_COUNT, addedAmount = 1, i, j;
+    const char *lineEnd;
+    document_line_t *line;
+
+    document -> changeStamp++;
+    for (lineEnd = strchr(newText, NEW_LINE); lineEnd != NULL;
+         lineEnd = strchr(lineEnd + 1, NEW_LINE))
+        addedAmount++;
+
+    /* Remove the old lines from the index of the names, but keep the names to check them. */
+    for (i = firstLine; i < firstLine + removedAmount; i++)
+    {
+        line = document -> lines[i];
+        removedNames = (char **) reallocate_space(removedNames, (removedNamesAmount +
+                                                  line -> namesAmount) * sizeof(char *));
+        for (j = ZERO_INDEX; j < line -> namesAmount; j++)
+        {
+            removeNameUser(document, line -> names[j], line);
+            removedNames[removedNamesAmount++] = line -> names[j];
+            line -> names[j] = NULL;
+        }
+        deleteDocumentLine(&document -> lines[i]);
+    }
+
+    makeRoomForLines(document, firstLine, removedAmount, addedAmount);
+
+    /* Add the new lines. */
+    for (i = firstLine; i < firstLine + addedAmount; i++)
+    {
+        lineEnd = strchr(newText, NEW_LINE);
+        line = createDocumentLine(newText, (lineEnd != NULL)? (int) (lineEnd - newText) :
+                                                              (int) strlen(newText));
+        line -> index = i;
+        document -> lines[i] = line;
+        for (j = ZERO_INDEX; j < line -> namesAmount; j++)
+            addNameUser(document, line -> names[j], line);
+
+        newText = (lineEnd != NULL)? lineEnd + 1 : newText;
+    }
+
+    /* Check the new lines, and the other lines with the names of the removed and new lines. */
+    for (i = firstLine; i < firstLine + addedAmount; i++)
+    {
+        checkDocumentLine(document, document -> lines[i]);
+        for (j = ZERO_INDEX; j < document -> lines[i] -> namesAmount; j++)
+            checkNameUsers(document, document -> lines[i] -> names[j]);
+    }
+
+    for (i = ZERO_INDEX; i < removedNamesAmount; i++)
+    {
+        checkNameUsers(document, removedNames[i]);
+        (void) clear_ptr(removedNames[i])
+    }
+    (void) clear_ptr(removedNames)
+}
+
+/*
+ * Moves the lines after the replaced lines, to make room for the new lines.
+ *
+ * @param   *document       The document.
+ * @param   firstLine       The index of the first replaced line.
+ * @param   removedAmount   The amount of replaced lines.
+ * @param   addedAmount     The amount of new lines.
+ */
+void makeRoomForLines(LspDocument *document, int firstLine, int removedAmount, int addedAmount)
+{
+    int newAmount = document -> linesAmount - removedAmount + addedAmount;
+    int i; /* Loop variable. */
+
+    if (newAmount > document -> capacity)
+    {
+        document -> capacity = (newAmount > document -> capacity * GROWTH_FACTOR)?
+                               newAmount : document -> capacity * GROWTH_FACTOR;
+        document -> lines = (document_line_t **) reallocate_space(document -> lines,
+                document -> capacity * sizeof(document_line_t *));
+    }
+
+    (void) memmove(document -> lines + firstLine + addedAmount,
+                   document -> lines + firstLine + removedAmount,
+                   (document -> linesAmount - firstLine - removedAmount) *
+                   sizeof(document_line_t *));
+    document -> linesAmount = newAmount;
+
+    if (addedAmount != removedAmount) /* The lines after the new lines moved. */
+        for (i = firstLine + addedAmount; i < document -> linesAmount; i++)
+            document -> lines[i] -> index = i;
+}
+
+/*
+ * Creates a line of a document and parses it.
+ *
+ * @param   *text       The text of the line.
+ * @param   length      The length of the line in the text.
+ *
+ * @return  The created line.
+ */
+document_line_t *createDocumentLine(const char *text, int length)
+{
+    document_line_t *line = (document_line_t *) allocate_space(sizeof(document_line_t));
+
+    if (length > ZERO_COUNT && text[length - 1] == CARRIAGE_RETURN)
+        length--;
+
+    line -> text = strcpyPart(text, ZERO_INDEX, length);
+    line -> lineAst = NULL;
+    line -> lineError = line -> error = NO_ERROR;
+    line -> errorLabel = NULL;
+    line -> names = NULL;
+    line -> namesAmount = ZERO_COUNT;
+    line -> checkStamp = ZERO_COUNT;
+
+    parseDocumentLine(line);
+    return line;
+}
+
+/*
+ * Finds the kind of a line, its AST and error, and the names in it.
+ *
+ * @param   *line   The line.
+ */
+void parseDocumentLine(document_line_t *line)
+{
+    char *firstWord = NULL, *secondWord = NULL;
+    label_type_t labelType;
+    arg_node_t *currArg;
+    char *labelName;
+
+    findWord(line -> text, &firstWord, FIRST_WORD);
+    line -> kind = CODE_LINE;
+
+    if (isLineTooLong(line -> text) == TRUE)
+    {
+        line -> kind = SKIPPED_LINE;
+        line -> lineError = LINE_OVERFLOW_ERR;
+    }
+    else if (isSkipLine(line -> text) == TRUE)
+        line -> kind = SKIPPED_LINE;
+
+    else if (isIncludeLine(line -> text) == TRUE)
+    {
+        line -> kind = SKIPPED_LINE;
+        line -> lineError = checkIncludeLineErrors(line -> text);
+    }
+
+    else if (sameStrings(firstWord, START_MACRO) == TRUE)
+    {
+        line -> kind = MACRO_START_LINE;
+        findWord(line -> text, &secondWord, SECOND_WORD);
+        line -> lineError = checkPreProcessErrors(line -> text, secondWord, FALSE, TRUE);
+        if (line -> lineError == NO_ERROR)
+            addNameToLine(line, secondWord);
+    }
+    else if (sameStrings(firstWord, END_MACRO) == TRUE)
+    {
+        line -> kind = MACRO_END_LINE;
+        line -> lineError = checkPreProcessErrors(line -> text, NULL, TRUE, FALSE);
+    }
+
+    else if ((line -> lineAst = buildAstFromLine(line -> text, &line -> lineError)) == NULL)
+    {
+        addNameToLine(line, firstWord); /* Can be a call of a macro. */
+
+        /* Keep the label, so its uses are not reported as undefined (as in the assembler). */
+        line -> errorLabel = getLabelOfErrorLine(line -> text);
+        addNameToLine(line, line -> errorLabel);
+    }
+
+    else
+    {
+        labelType = getLabelTypeForTable(line -> lineAst);
+        if (labelType == NORMAL)
+        {
+            labelName = getLabelName(line -> lineAst);
+            addNameToLine(line, labelName);
+            (void) clear_ptr(labelName)
+        }
+
+        /* The labels in the arguments (declared labels, or label operands). */
+        if (labelType == ENTRY || labelType == EXTERN ||
+            getSentence(line -> lineAst).sentenceType == DIRECTION_SENTENCE)
+            for (currArg = getArgList(line -> lineAst); currArg != NULL;
+                 currArg = getNextNode(currArg))
+                if (getArgData(currArg).dataType == STRING)
+                    addNameToLine(line, getArgData(currArg).data.string);
+    }
+
+    (void) clear_ptr(secondWord)
+    (void) clear_ptr(firstWord)
+}
+
+/*
+ * Adds a name to the names of a line (if it is not there already).
+ *
+ * @param   *line   The line.
+ * @param   *name   The name.
+ */
+void addNameToLine(document_line_t *line, const char *name)
+{
+    int i; /* Loop variable. */
+
+    if (name == NULL)
+        return;
+
+    for (i = ZERO_INDEX; i < line -> namesAmount; i++)
+        if (sameStrings(line -> names[i], name) == TRUE)
+            return;
+
+    line -> names = (char **) reallocate_space(line -> names,
+                                               (line -> namesAmount + 1) * sizeof(char *));
+    line -> names[line -> namesAmount++] = my_strdup(name);
+}
+
+/*
+ * Deletes a line of a document and frees its memory.
+ *
+ * @param   **pLine     Pointer to the line to delete.
+ */
+void deleteDocumentLine(document_line_t **pLine)
+{
+    int i; /* Loop variable. */
+
+    for (i = ZERO_INDEX; i < (*pLine) -> namesAmount; i++)
+        {(void) clear_ptr((*pLine) -> names[i])}
+
+    (void) clear_ptr((*pLine) -> names)
+    (void) clear_ptr((*pLine) -> errorLabel)
+    (void) deleteAst(&(*pLine) -> lineAst);
+    (void) clear_ptr((*pLine) -> text)
+    (void) clear_ptr(*pLine)
+}
+
+/*
+ * Finds the lines that have a name.
+ *
+ * @param   *document   The document.
+ * @param   *name       The name.
+ *
+ * @return  The lines that have the name, or NULL if there are none.
+ */
+name_users_t *findNameUsers(const LspDocument *document, const char *name)
+{
+    name_users_t *users = document -> names[hashString(name) % NAME_BUCKETS];
+
+    while (users != NULL && sameStrings(users -> name, name) == FALSE)
+        users = users -> next;
+
+    return users;
+}
+
+/*
+ * Adds a line to the lines that have a name.
+ *
+ * @param   *document   The document.
+ * @param   *name       The name.
+ * @param   *line       The line.
+ */
+void addNameUser(LspDocument *document, const char *name, document_line_t *line)
+{
+    name_users_t *users = findNameUsers(document, name);
+    unsigned long bucket;
+
+    if (users == NULL)
+    {
+        bucket = hashString(name) % NAME_BUCKETS;
+        users = (name_users_t *) allocate_space(sizeof(name_users_t));
+        users -> name = my_strdup(name);
+        users -> lines = NULL;
+        users -> linesAmount = users -> capacity = ZERO_COUNT;
+        users -> checkStamp = ZERO_COUNT;
+        users -> next = document -> names[bucket];
+        document -> names[bucket] = users;
+    }
+
+    if (users -> linesAmount == users -> capacity)
+    {
+        users -> capacity = (users -> capacity == ZERO_COUNT)? INITIAL_CAPACITY :
+                            users -> capacity * GROWTH_FACTOR;
+        users -> lines = (document_line_t **) reallocate_space(users -> lines,
+                users -> capacity * sizeof(document_line_t *));
+    }
+
+    users -> lines[users -> linesAmount++] = line;
+}
+
+/*
+ * Removes a line from the lines that have a name (and the name, if no line has it).
+ *
+ * @param   *document   The document.
+ * @param   *name       The name.
+ * @param   *line       The line.
+ */
+void removeNameUser(LspDocument *document, const char *name, document_line_t *line)
+{
+    name_users_t **pUsers = &document -> names[hashString(name) % NAME_BUCKETS];
+    name_users_t *users;
+    int i; /* Loop variable. */
+
+    while (*pUsers != NULL && sameStrings((*pUsers) -> name, name) == FALSE)
+        pUsers = &(*pUsers) -> next;
+
+    if ((users = *pUsers) == NULL)
+        return;
+
+    for (i = ZERO_INDEX; i < users -> linesAmount && users -> lines[i] != line; i++);
+    if (i < users -> linesAmount) /* The lines are in no order, move the last line to it. */
+        users -> lines[i] = users -> lines[--users -> linesAmount];
+
+    if (users -> linesAmount == ZERO_COUNT)
+    {
+        *pUsers = users -> next;
+        (void) clear_ptr(users -> lines)
+        (void) clear_ptr(users -> name)
+        (void) clear_ptr(users)
+    }
+}
+
+/*
+ * Checks again all the lines that have a name (once in a change).
+ *
+ * @param   *document   The document.
+ * @param   *name       The name.
+ */
+void checkNameUsers(LspDocument *document, const char *name)
+{
+    name_users_t *users = findNameUsers(document, name);
+    int i; /* Loop variable. */
+
+    if (users != NULL && users -> checkStamp != document -> changeStamp)
+    {
+        users -> checkStamp = document -> changeStamp;
+        for (i = ZERO_INDEX; i < users -> linesAmount; i++)
+            checkDocumentLine(document, users -> lines[i]);
+    }
+}
+
+/*
+ * Finds the error of a line (once in a change).
+ *
+ * @param   *document   The document.
+ * @param   *line       The line.
+ */
+void checkDocumentLine(LspDocument *document, document_line_t *line)
+{
+    if (line -> checkStamp == document -> changeStamp)
+        return;
+
+    line -> checkStamp = document -> changeStamp;
+    if (line -> kind != CODE_LINE)
+        line -> error = line -> lineError;
+    else if (line -> lineAst == NULL)
+        line -> error = (isCallingDefinedMacro(document, line) == TRUE)? NO_ERROR :
+                        line -> lineError;
+    else
+        line -> error = checkLineLabels(document, line);
+}
+
+/*
+ * Checks the labels of a line, by the other lines with the same labels (the same checks as the
+ * checks of the symbol table in the first and the second transitions).
+ *
+ * @param   *document   The document.
+ * @param   *line       The line (with an AST).
+ *
+ * @return  The error found in the labels, or NO_ERROR if there is none.
+ */
+Error checkLineLabels(const LspDocument *document, document_line_t *line)
+{
+    label_type_t labelType = getLabelTypeForTable(line -> lineAst);
+    Error labelsError = NO_ERROR; /* Value to return. */
+    arg_node_t *currArg;
+    const char *argLabel;
+    char *labelName;
+
+    if (labelType == NORMAL)
+    {
+        labelName = getLabelName(line -> lineAst);
+        labelsError = checkLabelDefFlagsError(getNameFlags(document, labelName, line -> index));
+        (void) clear_ptr(labelName)
+    }
+
+    for (currArg = getArgList(line -> lineAst); currArg != NULL && labelsError == NO_ERROR;
+         currArg = getNextNode(currArg))
+    {
+        if (getArgData(currArg).dataType != STRING)
+            continue;
+
+        argLabel = getArgData(currArg).data.string;
+        if (labelType == ENTRY)
+        {
+            labelsError = checkEntryFlagsError(getNameFlags(document, argLabel, line -> index));
+            if (labelsError == NO_ERROR &&
+                !(getNameFlags(document, argLabel, ALL_LINES) &
+                  (SYMBOL_DEFINED | SYMBOL_IN_ERROR_LINE)))
+                labelsError = ENTRY_LABEL_NOT_DEFINED_IN_FILE_ERR;
+        }
+        else if (labelType == EXTERN)
+            labelsError = checkExternFlagsError(getNameFlags(document, argLabel, line -> index));
+
+        else if (getSentence(line -> lineAst).sentenceType == DIRECTION_SENTENCE &&
+                 !(getNameFlags(document, argLabel, ALL_LINES) &
+                   (SYMBOL_DEFINED | SYMBOL_EXTERN | SYMBOL_IN_ERROR_LINE)))
+            labelsError = USE_OF_UNDEFINED_LABEL_ERR;
+    }
+
+    return labelsError;
+}
+
+/*
+ * Gets the flags of a name (SYMBOL_DEFINED, SYMBOL_ENTRY, SYMBOL_EXTERN, SYMBOL_IN_ERROR_LINE)
+ * by the lines before a line.
+ *
+ * @param   *document   The document.
+ * @param   *name       The name.
+ * @param   beforeLine  The index of the line, or ALL_LINES for the flags by all the lines.
+ *
+ * @return  The flags of the name.
+ */
+int getNameFlags(const LspDocument *document, const char *name, int beforeLine)
+{
+    name_users_t *users = findNameUsers(document, name);
+    int flags = NO_SYMBOL_FLAGS, i;
+
+    for (i = ZERO_INDEX; users != NULL && i < users -> linesAmount; i++)
+        if (beforeLine == ALL_LINES || users -> lines[i] -> index < beforeLine)
+            flags |= getLineNameFlags(users -> lines[i], name);
+
+    return flags;
+}
+
+/*
+ * Gets what a line does with a name (defines it, declares it as entry or as external, or
+ * defines it in a line with an error in itself).
+ *
+ * @param   *line   The line.
+ * @param   *name   The name.
+ *
+ * @return  The flags of the name by the line (SYMBOL_DEFINED, SYMBOL_ENTRY, SYMBOL_EXTERN,
+ *          SYMBOL_IN_ERROR_LINE).
+ */
+int getLineNameFlags(document_line_t *line, const char *name)
+{
+    int flags = NO_SYMBOL_FLAGS; /* Value to return. */
+    label_type_t labelType;
+    char *labelName;
+
+    if (line -> lineAst == NULL) /* Only the label of a line with an error in itself. */
+        return (sameStrings(line -> errorLabel, name) == TRUE)? SYMBOL_IN_ERROR_LINE : flags;
+
+    labelType = getLabelTypeForTable(line -> lineAst);
+    if (labelType == NORMAL)
+    {
+        labelName = getLabelName(line -> lineAst);
+        flags = (sameStrings(labelName, name) == TRUE)? SYMBOL_DEFINED : NO_SYMBOL_FLAGS;
+        (void) clear_ptr(labelName)
+    }
+    else if (labelType == ENTRY) /* The line has the name, it is one of the arguments. */
+        flags = SYMBOL_ENTRY;
+    else if (labelType == EXTERN)
+        flags = SYMBOL_EXTERN;
+
+    return flags;
+}
+
+/*
+ * Checks if a line (that is not an assembly line) calls a macro defined before it.
+ *
+ * @param   *document   The document.
+ * @param   *line       The line.
+ *
+ * @return  TRUE if the line calls a macro, otherwise FALSE.
+ */
+boolean isCallingDefinedMacro(const LspDocument *document, document_line_t *line)
+{
+    name_users_t *users = (line -> namesAmount > ZERO_COUNT)?
+                          findNameUsers(document, line -> names[ZERO_INDEX]) : NULL;
+    boolean isCalling = FALSE; /* Value to return. */
+    int i; /* Loop variable. */
+
+    for (i = ZERO_INDEX; users != NULL && i < users -> linesAmount; i++)
+        if (users -> lines[i] -> kind == MACRO_START_LINE &&
+            users -> lines[i] -> index < line -> index)
+            isCalling = TRUE;
+
+    return isCalling;
+}
+
+/*
+ * Gets the amount of lines of a document.
+ *
+ * @param   *document   The document.
+ *
+ * @return  The amount of lines.
+ */
+int getDocumentLinesAmount(const LspDocument *document)
+{
+    return document -> linesAmount;
+}
+
+/*
+ * Gets the error of a line of a document.
+ *
+ * @param   *document   The document.
+ * @param   lineIndex   The index of the line (from 0).
+ * @param   *range      Will hold the range of the line.
+ *
+ * @return  The error of the line, or NO_ERROR if there is none.
+ */
+Error getDocumentLineError(const LspDocument *document, int lineIndex, text_range_t *range)
+{
+    range -> line = lineIndex;
+    range -> start = ZERO_INDEX;
+    range -> end = (int) strlen(document -> lines[lineIndex] -> text);
+
+    return document -> lines[lineIndex] -> error;
+}
+
+/*
+ * Finds the definition of the label (or macro) in a position of a document.
+ *
+ * @param   *document   The document.
+ * @param   *position   The position of the label.
+ * @param   *definition Will hold the range of the label in the line of the definition.
+ *
+ * @return  TRUE if the definition was found, otherwise FALSE.
+ */
+boolean findDocumentDefinition(const LspDocument *document, const text_position_t *position,
+                               text_range_t *definition)
+{
+    char *name = getNameAtPosition(document, position);
+    name_users_t *users = (name != NULL)? findNameUsers(document, name) : NULL;
+    document_line_t *definitionLine = NULL, *externLine = NULL, *currLine;
+    int i; /* Loop variable. */
+
+    /* The first definition (or the first .extern declaration, if the label is external). */
+    for (i = ZERO_INDEX; users != NULL && i < users -> linesAmount; i++)
+    {
+        currLine = users -> lines[i];
+        if ((currLine -> kind == MACRO_START_LINE ||
+             getLineNameFlags(currLine, name) == SYMBOL_DEFINED) &&
+            (definitionLine == NULL || currLine -> index < definitionLine -> index))
+            definitionLine = currLine;
+
+        else if (getLineNameFlags(currLine, name) == SYMBOL_EXTERN &&
+                 (externLine == NULL || currLine -> index < externLine -> index))
+            externLine = currLine;
+    }
+
+    if (definitionLine == NULL)
+        definitionLine = externLine;
+    if (definitionLine != NULL)
+        findNameInLine(definitionLine, name, definition);
+
+    (void) clear_ptr(name)
+    return (definitionLine != NULL)? TRUE : FALSE;
+}
+
+/*
+ * Finds all the references to the label (or macro) in a position of a document
+ * (its definition, declarations and uses).
+ *
+ * @param   *document       The document.
+ * @param   *position       The position of the label.
+ * @param   **references    Will hold the ranges of the references (dynamically allocated).
+ *
+ * @return  The amount of references.
+ */
+int findDocumentReferences(const LspDocument *document, const text_position_t *position,
+                           text_range_t **references)
+{
+    char *name = getNameAtPosition(document, position);
+    name_users_t *users = (name != NULL)? findNameUsers(document, name) : NULL;
+    int referencesAmount = (users != NULL)? users -> linesAmount : ZERO_COUNT;
+    int i; /* Loop variable. */
+
+    *references = NULL;
+    if (referencesAmount > ZERO_COUNT)
+    {
+        *references = (text_range_t *) allocate_space(referencesAmount * sizeof(text_range_t));
+        for (i = ZERO_INDEX; i < referencesAmount; i++)
+            findNameInLine(users -> lines[i], name, &(*references)[i]);
+
+        qsort(*references, (size_t) referencesAmount, sizeof(text_range_t), compareRangesByLine);
+    }
+
+    (void) clear_ptr(name)
+    return referencesAmount;
+}
+
+/*
+ * Gets the name (label or macro) in a position of a document.
+ *
+ * @param   *document   The document.
+ * @param   *position   The position.
+ *
+ * @return  The name (dynamically allocated), or NULL if there is no name in the position.
+ */
+char *getNameAtPosition(const LspDocument *document, const text_position_t *position)
+{
+    const char *text;
+    int start, end;
+
+    if (position -> line < ZERO_INDEX || position -> line >= document -> linesAmount)
+        return NULL;
+
+    text = document -> lines[position -> line] -> text;
+    if (position -> character < ZERO_INDEX || position -> character > (int) strlen(text))
+        return NULL;
+
+    for (start = position -> character; start > ZERO_INDEX && is_name_char(text[start - 1]);
+         start--);
+    for (end = position -> character; is_name_char(text[end]); end++);
+
+    return (start < end)? strcpyPart(text, start, end) : NULL;
+}
+
+/*
+ * Finds a name in a line (the first time it is a whole word).
+ *
+ * @param   *line   The line.
+ * @param   *name   The name.
+ * @param   *range  Will hold the range of the name, or of all the line if it was not found.
+ */
+void findNameInLine(const document_line_t *line, const char *name, text_range_t *range)
+{
+    const char *found = line -> text;
+    size_t nameLength = strlen(name);
+
+    while ((found = strstr(found, name)) != NULL &&
+           ((found > line -> text && is_name_char(found[-1])) || is_name_char(found[nameLength])))
+        found++;
+
+    range -> line = line -> index;
+    range -> start = (found != NULL)? (int) (found - line -> text) : ZERO_INDEX;
+    range -> end = (found != NULL)? range -> start + (int) nameLength :
+                   (int) strlen(line -> text);
+}
+
+/*
+ * Compares two ranges by their lines (for qsort).
+ *
+ * @param   *firstRange     The first range.
+ * @param   *secondRange    The second range.
+ *
+ * @return  Negative if the first range is before the second, positive if after, 0 if equal.
+ */
+int compareRangesByLine(const void *firstRange, const void *secondRange)
+{
+    return ((const text_range_t *) firstRange) -> line -
+           ((const text_range_t *) secondRange) -> line;
+}
+
+/*
+ * Deletes a document and frees its memory.
+ *
+ * @param   **pDocument     Pointer to the document to delete.
+ */
+void deleteLspDocument(LspDocument **pDocument)
+{
+    name_users_t *users, *nextUsers;
+    int i; /* Loop variable. */
+
+    if (pDocument == NULL || *pDocument == NULL)
+        return;
+
+    for (i = ZERO_INDEX; i < (*pDocument) -> linesAmount; i++)
+        deleteDocumentLine(&(*pDocument) -> lines[i]);
+
+    for (i = ZERO_INDEX; i < NAME_BUCKETS; i++)
+        for (users = (*pDocument) -> names[i]; users != NULL; users = nextUsers)
+        {
+            nextUsers = users -> next;
+            (void) clear_ptr(users -> lines)
+            (void) clear_ptr(users -> name)
+            (void) clear_ptr(users)
+        }
+
+    (void) clear_ptr((*pDocument) -> lines)
+    (void) clear_ptr((*pDocument) -> uri)
+    (void) clear_ptr(*pDocument)
+}
@@ -0,0 +1,117 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the LspDocument.c file.
+ */
+
+#ifndef MMN_14_LSPDOCUMENT_H
+#define MMN_14_LSPDOCUMENT_H
+
+/* A document (source file) opened in the language server. */
+typedef struct LspDocument LspDocument;
+
+/* A position in a document (the line and the char in it, both from 0). */
+typedef struct
+{
+    int line;
+    int character;
+} text_position_t;
+
+/* A range of a line of a document, from the start char to the end char (not including it). */
+typedef struct
+{
+    int line;
+    int start;
+    int end;
+} text_range_t;
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Creates a document and diagnoses all its lines.
+ *
+ * @param   *uri    The uri of the document.
+ * @param   *text   The text of the document.
+ *
+ * @return  The created document.
+ */
+LspDocument *createLspDocument(const char *uri, const char *text);
+
+/*
+ * Gets the uri of a document.
+ *
+ * @param   *document   The document.
+ *
+ * @return  The uri of the document.
+ */
+const char *getDocumentUri(const LspDocument *document);
+
+/*
+ * Changes a range of the text of a document, and diagnoses again only the changed lines and
+ * the lines with the labels (and macros) that the changed lines had or have.
+ * A range out of the document is moved to its end.
+ *
+ * @param   *document   The document.
+ * @param   *start      The start of the text to replace, or NULL to replace all the text.
+ * @param   *end        The end of the text to replace (not including it).
+ * @param   *text       The new text.
+ */
+void changeDocumentText(LspDocument *document, const text_position_t *start,
+                        const text_position_t *end, const char *text);
+
+/*
+ * Gets the amount of lines of a document.
+ *
+ * @param   *document   The document.
+ *
+ * @return  The amount of lines.
+ */
+int getDocumentLinesAmount(const LspDocument *document);
+
+/*
+ * Gets the error of a line of a document.
+ *
+ * @param   *document   The document.
+ * @param   lineIndex   The index of the line (from 0).
+ * @param   *range      Will hold the range of the line.
+ *
+ * @return  The error of the line, or NO_ERROR if there is none.
+ */
+Error getDocumentLineError(const LspDocument *document, int lineIndex, text_range_t *range);
+
+/*
+ * Finds the definition of the label (or macro) in a position of a document.
+ *
+ * @param   *document   The document.
+ * @param   *position   The position of the label.
+ * @param   *definition Will hold the range of the label in the line of the definition.
+ *
+ * @return  TRUE if the definition was found, otherwise FALSE.
+ */
+boolean findDocumentDefinition(const LspDocument *document, const text_position_t *position,
+                               text_range_t *definition);
+
+/*
+ * Finds all the references to the label (or macro) in a position of a document
+ * (its definition, declarations and uses).
+ *
+ * @param   *document       The document.
+ * @param   *position       The position of the label.
+ * @param   **references    Will hold the ranges of the references (dynamically allocated).
+ *
+ * @return  The amount of references.
+ */
+int findDocumentReferences(const LspDocument *document, const text_position_t *position,
+                           text_range_t **references);
+
+/*
+ * Deletes a document and frees its memory.
+ *
+ * @param   **pDocument     Pointer to the document to delete.
+ */
+void deleteLspDocument(LspDocument **pDocument);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_LSPDOCUMENT_H */
@@ -0,0 +1,34 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * lsp.c
+ *
+ * This file houses the main function of the language server of the assembly language.
+ * The server talks with the editor by the Language Server Protocol, over the standard input
+ * and output: it publishes the errors of the open source files while they are edited,
+ * and finds the definition and the references of labels and macros.
+ *
+ * Usage: mmn_14_lsp (started by the editor)
+ *
+ * Note: This implementation assumes the C90 standard for compatibility.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include "../new-data-types/process_result.h"
+#include "lsp_algorithm.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define SUCCESS_CODE 0
+#define FAILURE_CODE 1
+/* ------------ */
+
+/*
+ * Driver code.
+ */
+int main(void)
+{
+    return (run_language_server(stdin, stdout) == SUCCESS)? SUCCESS_CODE : FAILURE_CODE;
+}
@@ -0,0 +1,629 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * lsp_algorithm.c
+ *
+ * This file implements the language server of the assembly language (the Language Server
+ * Protocol, over the standard input and output).
+ *
+ * Every message is a JSON-RPC message after a "Content-Length" header. The server handles:
+ *      initialize, initialized, shutdown and exit,
+ *      textDocument/didOpen, textDocument/didChange (full or incremental changes) and
+ *      textDocument/didClose, after which the errors of the document are published
+ *      (textDocument/publishDiagnostics),
+ *      textDocument/definition and textDocument/references of labels and macros.
+ *
+ * The documents diagnose only the lines that a change affects (see LspDocument.c).
+ * The positions of the protocol are counted in chars, the source files are ASCII.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../new-data-types/boolean.h"
+#include "../new-data-types/process_result.h"
+#include "../new-data-types/error_count.h"
+#include "../general-enums/indexes.h"
+#include "../general-enums/programFinals.h"
+#include "../errors/error_types/error_types.h"
+#include "../errors/assembler_errors.h"
+#include "../errors/FirstTransitionErrors/FirstTransitionSyntaxScanner.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "lsp_json.h"
+#include "LspDocument.h"
+#include "lsp_algorithm.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE LSP_MEMORY /* For the memory statistics. */
+#define HEADER_BUFFER 256
+#define NUMBER_BUFFER 64
+#define CONTENT_LENGTH_HEADER "Content-Length:"
+#define NO_LENGTH (-1)
+#define METHOD_NOT_FOUND_CODE (-32601)
+#define ERROR_SEVERITY 1
+#define SERVER_NAME "mmn_14_lsp"
+#define DIAGNOSTICS_SOURCE "mmn_14"
+#define JSON_NULL "null"
+#define INCREMENTAL_SYNC 2
+/* ------------ */
+
+/* The state of the language server. */
+typedef struct
+{
+    FILE *output;
+    LspDocument **documents;
+    int documentsAmount;
+    boolean isShutdown; /* The client sent the shutdown request. */
+    boolean isExit; /* The client sent the exit notification. */
+} language_server_t;
+
+/* A handler of a method, gets the message and its id (NULL for a notification). */
+typedef void (*method_handler_t)(language_server_t *server, const char *message,
+                                 const char *id);
+
+/* A method of the protocol, and its handler. */
+typedef struct
+{
+    const char *method;
+    method_handler_t handler;
+} lsp_method_t;
+
+/* ---------------Prototypes--------------- */
+char *readLspMessage(FILE *input);
+void handleLspMessage(language_server_t *server, const char *message);
+char *getMessageId(const char *message);
+void sendLspMessage(const language_server_t *server, const char *body);
+void sendLspResponse(const language_server_t *server, const char *id, const char *result);
+void sendLspError(const language_server_t *server, const char *id, int code,
+                  const char *errorMessage);
+void handleInitialize(language_server_t *server, const char *message, const char *id);
+void handleInitialized(language_server_t *server, const char *message, const char *id);
+void handleShutdown(language_server_t *server, const char *message, const char *id);
+void handleExit(language_server_t *server, const char *message, const char *id);
+void handleDidOpen(language_server_t *server, const char *message, const char *id);
+void handleDidChange(language_server_t *server, const char *message, const char *id);
+void handleDidClose(language_server_t *server, const char *message, const char *id);
+void handleDefinition(language_server_t *server, const char *message, const char *id);
+void handleReferences(language_server_t *server, const char *message, const char *id);
+int findLspDocument(const language_server_t *server, const char *message);
+void publishDiagnostics(const language_server_t *server, const char *uri,
+                        const LspDocument *document);
+void readTextPosition(const char *value, text_position_t *position);
+void addLocationToJson(char **json, const char *uri, const text_range_t *range);
+void addRangeToJson(char **json, const text_range_t *range);
+/* ---------------------------------------- */
+
+/* The methods the server handles. */
+static const lsp_method_t lspMethods[] =
+        {
+            {"initialize",              handleInitialize},
+            {"initialized",             handleInitialized},
+            {"shutdown",                handleShutdown},
+            {"exit",                    handleExit},
+            {"textDocument/didOpen",    handleDidOpen},
+            {"textDocument/didChange",  handleDidChange},
+            {"textDocument/didClose",   handleDidClose},
+            {"textDocument/definition", handleDefinition},
+            {"textDocument/references", handleReferences}
+        };
+
+/*
+ * Runs the language server, until the client sends the exit notification (or closes the input).
+ *
+ * @param   *input      The stream of the messages from the client.
+ * @param   *output     The stream of the messages to the client.
+ *
+ * @return  SUCCESS if the client shut the server down before the exit, otherwise FAILURE.
+ */
+process_result run_language_server(FILE *input, FILE *output)
+{
+    language_server_t server;
+    char *message;
+    int i; /* Loop variable. */
+
+    server.output = output;
+    server.documents = NULL;
+    server.documentsAmount = ZERO_COUNT;
+    server.isShutdown = server.isExit = FALSE;
+    initSyntaxScanner(); /* Build the char class table of the syntax checks. */
+
+    while (server.isExit == FALSE && (message = readLspMessage(input)) != NULL)
+    {
+        handleLspMessage(&server, message);
+        (void) clear_ptr(message)
+    }
+
+    for (i = ZERO_INDEX; i < server.documentsAmount; i++)
+        deleteLspDocument(&server.documents[i]);
+    (void) clear_ptr(server.documents)
+
+    return (server.isShutdown == TRUE)? SUCCESS : FAILURE;
+}
+
+/*
+ * Reads a message (its headers and its JSON content).
+ *
+ * @param   *input  The stream of the messages.
+ *
+ * @return  The JSON content of the message (dynamically allocated),
+ *          or NULL if the stream has ended.
+ */
+char *readLspMessage(FILE *input)
+{
+    char header[HEADER_BUFFER];
+    char *content = NULL; /* Value to return. */
+    long contentLength = NO_LENGTH;
+    size_t readLength;
+
+    /* The headers end with an empty line. */
+    while (fgets(header, HEADER_BUFFER, input) != NULL)
+    {
+        if (header[ZERO_INDEX] == '\r' || header[ZERO_INDEX] == '\n')
+        {
+            if (contentLength != NO_LENGTH)
+                break;
+        }
+        else if (strncmp(header, CONTENT_LENGTH_HEADER, strlen(CONTENT_LENGTH_HEADER)) == 0)
+            contentLength = atol(header + strlen(CONTENT_LENGTH_HEADER));
+    }
+
+    if (contentLength >= ZERO_COUNT && !feof(input))
+    {
+        content = (char *) allocate_space((size_t) contentLength + SIZE_FOR_NULL);
+        readLength = fread(content, sizeof(char), (size_t) contentLength, input);
+        content[readLength] = '\0';
+    }
+
+    return content;
+}
+
+/*
+ * Handles a message by its method.
+ * A request with an unknown method is answered with an error, other messages are ignored.
+ *
+ * @param   *server     The language server.
+ * @param   *message    The JSON content of the message.
+ */
+void handleLspMessage(language_server_t *server, const char *message)
+{
+    char *method = readJsonString(findJsonMember(message, "method"));
+    char *id = getMessageId(message);
+    int i; /* Loop variable. */
+
+    if (method != NULL) /* Not a response to the server. */
+    {
+        for (i = ZERO_INDEX; i < (int) (sizeof(lspMethods) / sizeof(lsp_method_t)) &&
+                             sameStrings(lspMethods[i].method, method) == FALSE; i++);
+
+        if (i < (int) (sizeof(lspMethods) / sizeof(lsp_method_t)))
+            lspMethods[i].handler(server, message, id);
+        else if (id != NULL)
+            sendLspError(server, id, METHOD_NOT_FOUND_CODE, "Method not found");
+    }
+
+    (void) clear_ptr(id)
+    (void) clear_ptr(method)
+}
+
+/*
+ * Gets the id of a request, as it is written in the message (a number or a string).
+ *
+ * @param   *message    The JSON content of the message.
+ *
+ * @return  The JSON text of the id (dynamically allocated), or NULL for a notification.
+ */
+char *getMessageId(const char *message)
+{
+    const char *id = findJsonMember(message, "id"), *idEnd;
+
+    if (id == NULL)
+        return NULL;
+
+    for (idEnd = skipJsonValue(id); idEnd > id && strchr(" \t\r\n", idEnd[-1]) != NULL; idEnd--);
+    return strcpyPart(id, ZERO_INDEX, (int) (idEnd - id));
+}
+
+/*
+ * Sends a message (with its header).
+ *
+ * @param   *server     The language server.
+ * @param   *body       The JSON content of the message.
+ */
+void sendLspMessage(const language_server_t *server, const char *body)
+{
+    fprintf(server -> output, "%s %lu\r\n\r\n%s", CONTENT_LENGTH_HEADER,
+            (unsigned long) strlen(body), body);
+    (void) fflush(server -> output);
+}
+
+/*
+ * Sends the response to a request.
+ *
+ * @param   *server     The language server.
+ * @param   *id         The id of the request.
+ * @param   *result     The JSON text of the result.
+ */
+void sendLspResponse(const language_server_t *server, const char *id, const char *result)
+{
+    char *response = NULL;
+
+    addTwoStrings(&response, "{\"jsonrpc\":\"2.0\",\"id\":");
+    addTwoStrings(&response, id);
+    addTwoStrings(&response, ",\"result\":");
+    addTwoStrings(&response, result);
+    addTwoStrings(&response, "}");
+
+    sendLspMessage(server, response);
+    (void) clear_ptr(response)
+}
+
+/*
+ * Sends an error response to a request.
+ *
+ * @param   *server         The language server.
+ * @param   *id             The id of the request.
+ * @param   code            The code of the error.
+ * @param   *errorMessage   The message of the error.
+ */
+void sendLspError(const language_server_t *server, const char *id, int code,
+                  const char *errorMessage)
+{
+    char codeText[NUMBER_BUFFER];
+    char *response = NULL;
+
+    sprintf(codeText, "%d", code);
+    addTwoStrings(&response, "{\"jsonrpc\":\"2.0\",\"id\":");
+    addTwoStrings(&response, id);
+    addTwoStrings(&response, ",\"error\":{\"code\":");
+    addTwoStrings(&response, codeText);
+    addTwoStrings(&response, ",\"message\":");
+    addJsonString(&response, errorMessage);
+    addTwoStrings(&response, "}}");
+
+    sendLspMessage(server, response);
+    (void) clear_ptr(response)
+}
+
+/*
+ * Handles the initialize request, answers with the capabilities of the server.
+ *
+ * @param   *server     The language server.
+ * @param   *message    The JSON content of the message.
+ * @param   *id         The id of the request.
+ */
+void handleInitialize(language_server_t *server, const char *message, const char *id)
+{
+    char capabilities[HEADER_BUFFER];
+
+    (void) message;
+    sprintf(capabilities, "{\"capabilities\":{\"textDocumentSync\":{\"openClose\":true,"
+                          "\"change\":%d},\"definitionProvider\":true,\"referencesProvider\":true},"
+                          "\"serverInfo\":{\"name\":\"%s\"}}", INCREMENTAL_SYNC, SERVER_NAME);
+
+    if (id != NULL)
+        sendLspResponse(server, id, capabilities);
+}
+
+/*
+ * Handles the initialized notification (nothing to do).
+ *
+ * @param   *server     The language server.
+ * @param   *message    The JSON content of the message.
+ * @param   *id         The id of the request (NULL).
+ */
+void handleInitialized(language_server_t *server, const char *message, const char *id)
+{
+    (void) server;
+    (void) message;
+    (void) id;
+}
+
+/*
+ * Handles the shutdown request.
+ *
+ * @param   *server     The language server.
+ * @param   *message    The JSON content of the message.
+ * @param   *id         The id of the request.
+ */
+void handleShutdown(language_server_t *server, const char *message, const char *id)
+{
+    (void) message;
+    server -> isShutdown = TRUE;
+
+    if (id != NULL)
+        sendLspResponse(server, id, JSON_NULL);
+}
+
+/*
+ * Handles the exit notification, the server stops after it.
+ *
+ * @param   *server     The language server.
+ * @param   *message    The JSON content of the message.
+ * @param   *id         The id of the request (NULL).
+ */
+void handleExit(language_server_t *server, const char *message, const char *id)
+{
+    (void) message;
+    (void) id;
+    server -> isExit = TRUE;
+}
+
+/*
+ * Handles the didOpen notification, creates the document and publishes its errors.
+ *
+ * @param   *server     The language server.
+ * @param   *message    The JSON content of the message.
+ * @param   *id         The id of the request (NULL).
+ */
+void handleDidOpen(language_server_t *server, const char *message, const char *id)
+{
+    char *uri = readJsonString(findJsonMember(message, "params.textDocument.uri"));
+    char *text = readJsonString(findJsonMember(message, "params.textDocument.text"));
+    int documentIndex = findLspDocument(server, message);
+
+    (void) id;
+    if (uri != NULL && text != NULL)
+    {
+        if (documentIndex != MINUS_ONE_INDEX) /* Opened again, replace the old text. */
+            changeDocumentText(server -> documents[documentIndex], NULL, NULL, text);
+        else
+        {
+            documentIndex = server -> documentsAmount++;
+            server -> documents = (LspDocument **) reallocate_space(server -> documents,
+                    server -> documentsAmount * sizeof(LspDocument *));
+            server -> documents[documentIndex] = createLspDocument(uri, text);
+        }
+
+        publishDiagnostics(server, uri, server -> documents[documentIndex]);
+    }
+
+    (void) clear_ptr(text)
+    (void) clear_ptr(uri)
+}
+
+/*
+ * Handles the didChange notification, changes the document by the changes in their order
+ * and publishes its errors.
+ *
+ * @param   *server     The language server.
+ * @param   *message    The JSON content of the message.
+ * @param   *id         The id of the request (NULL).
+ */
+void handleDidChange(language_server_t *server, const char *message, const char *id)
+{
+    int documentIndex = findLspDocument(server, message);
+    const char *change, *range;
+    text_position_t start, end;
+    LspDocument *document;
+    char *text;
+
+    (void) id;
+    if (documentIndex == MINUS_ONE_INDEX)
+        return;
+
+    document = server -> documents[documentIndex];
+    for (change = getFirstJsonElement(findJsonMember(message, "params.contentChanges"));
+         change != NULL; change = getNextJsonElement(change))
+    {
+        if ((text = readJsonString(findJsonMember(change, "text"))) == NULL)
+            continue;
+
+        if ((range = findJsonMember(change, "range")) != NULL)
+        {
+            readTextPosition(findJsonMember(range, "start"), &start);
+            readTextPosition(findJsonMember(range, "end"), &end);
+            changeDocumentText(document, &start, &end, text);
+        }
+        else /* The change has all the text. */
+            changeDocumentText(document, NULL, NULL, text);
+
+        (void) clear_ptr(text)
+    }
+
+    publishDiagnostics(server, getDocumentUri(document), document);
+}
+
+/*
+ * Handles the didClose notification, deletes the document and clears its errors.
+ *
+ * @param   *server     The language server.
+ * @param   *message    The JSON content of the message.
+ * @param   *id         The id of the request (NULL).
+ */
+void handleDidClose(language_server_t *server, const char *message, const char *id)
+{
+    int documentIndex = findLspDocument(server, message);
+    char *uri;
+
+    (void) id;
+    if (documentIndex == MINUS_ONE_INDEX)
+        return;
+
+    uri = my_strdup(getDocumentUri(server -> documents[documentIndex]));
+    deleteLspDocument(&server -> documents[documentIndex]);
+    server -> documents[documentIndex] = server -> documents[--server -> documentsAmount];
+
+    publishDiagnostics(server, uri, NULL);
+    (void) clear_ptr(uri)
+}
+
+/*
+ * Handles the definition request, answers with the location of the definition of the label
+ * (or null if it was not found).
+ *
+ * @param   *server     The language server.
+ * @param   *message    The JSON content of the message.
+ * @param   *id         The id of the request.
+ */
+void handleDefinition(language_server_t *server, const char *message, const char *id)
+{
+    int documentIndex = findLspDocument(server, message);
+    text_position_t position;
+    text_range_t definition;
+    char *result = NULL;
+
+    if (id == NULL)
+        return;
+
+    readTextPosition(findJsonMember(message, "params.position"), &position);
+    if (documentIndex != MINUS_ONE_INDEX &&
+        findDocumentDefinition(server -> documents[documentIndex], &position, &definition))
+        addLocationToJson(&result, getDocumentUri(server -> documents[documentIndex]),
+                          &definition);
+    else
+        addTwoStrings(&result, JSON_NULL);
+
+    sendLspResponse(server, id, result);
+    (void) clear_ptr(result)
+}
+
+/*
+ * Handles the references request, answers with the locations of all the references to the
+ * label.
+ *
+ * @param   *server     The language server.
+ * @param   *message    The JSON content of the message.
+ * @param   *id         The id of the request.
+ */
+void handleReferences(language_server_t *server, const char *message, const char *id)
+{
+    int documentIndex = findLspDocument(server, message);
+    text_range_t *references = NULL;
+    int referencesAmount = ZERO_COUNT, i;
+    text_position_t position;
+    char *result = NULL;
+
+    if (id == NULL)
+        return;
+
+    readTextPosition(findJsonMember(message, "params.position"), &position);
+    if (documentIndex != MINUS_ONE_INDEX)
+        referencesAmount = findDocumentReferences(server -> documents[documentIndex], &position,
+                                                  &references);
+
+    addTwoStrings(&result, "[");
+    for (i = ZERO_INDEX; i < referencesAmount; i++)
+    {
+        if (i > ZERO_INDEX)
+            addTwoStrings(&result, ",");
+        addLocationToJson(&result, getDocumentUri(server -> documents[documentIndex]),
+                          &references[i]);
+    }
+    addTwoStrings(&result, "]");
+
+    sendLspResponse(server, id, result);
+    (void) clear_ptr(result)
+    (void) clear_ptr(references)
+}
+
+/*
+ * Finds the document of a message (by params.textDocument.uri).
+ *
+ * @param   *server     The language server.
+ * @param   *message    The JSON content of the message.
+ *
+ * @return  The index of the document, or MINUS_ONE_INDEX if it is not open.
+ */
+int findLspDocument(const language_server_t *server, const char *message)
+{
+    char *uri = readJsonString(findJsonMember(message, "params.textDocument.uri"));
+    int documentIndex = MINUS_ONE_INDEX, i;
+
+    for (i = ZERO_INDEX; uri != NULL && i < server -> documentsAmount; i++)
+        if (sameStrings(getDocumentUri(server -> documents[i]), uri) == TRUE)
+            documentIndex = i;
+
+    (void) clear_ptr(uri)
+    return documentIndex;
+}
+
+/*
+ * Publishes the errors of a document (a diagnostic for every line with an error).
+ *
+ * @param   *server     The language server.
+ * @param   *uri        The uri of the document.
+ * @param   *document   The document, or NULL to clear the errors of a closed document.
+ */
+void publishDiagnostics(const language_server_t *server, const char *uri,
+                        const LspDocument *document)
+{
+    char severity[NUMBER_BUFFER];
+    char *notification = NULL;
+    boolean isFirst = TRUE;
+    text_range_t range;
+    Error lineError;
+    int i; /* Loop variable. */
+
+    sprintf(severity, ",\"severity\":%d,\"source\":", ERROR_SEVERITY);
+    addTwoStrings(&notification, "{\"jsonrpc\":\"2.0\",\"method\":"
+                                 "\"textDocument/publishDiagnostics\",\"params\":{\"uri\":");
+    addJsonString(&notification, uri);
+    addTwoStrings(&notification, ",\"diagnostics\":[");
+
+    for (i = ZERO_INDEX; document != NULL && i < getDocumentLinesAmount(document); i++)
+        if ((lineError = getDocumentLineError(document, i, &range)) != NO_ERROR)
+        {
+            addTwoStrings(&notification, (isFirst == TRUE)? "{\"range\":" : ",{\"range\":");
+            addRangeToJson(&notification, &range);
+            addTwoStrings(&notification, severity);
+            addJsonString(&notification, DIAGNOSTICS_SOURCE);
+            addTwoStrings(&notification, ",\"message\":");
+            addJsonString(&notification, getAssemblerErrorMessage(lineError));
+            addTwoStrings(&notification, "}");
+            isFirst = FALSE;
+        }
+
+    addTwoStrings(&notification, "]}}");
+    sendLspMessage(server, notification);
+    (void) clear_ptr(notification)
+}
+
+/*
+ * Reads a position of the protocol ({"line": .., "character": ..}).
+ *
+ * @param   *value      The JSON text of the position (can be NULL).
+ * @param   *position   Will hold the position.
+ */
+void readTextPosition(const char *value, text_position_t *position)
+{
+    position -> line = readJsonInt((value != NULL)? findJsonMember(value, "line") : NULL,
+                                   ZERO_INDEX);
+    position -> character = readJsonInt((value != NULL)? findJsonMember(value, "character") :
+                                        NULL, ZERO_INDEX);
+}
+
+/*
+ * Adds a location of the protocol (a uri and a range) to a JSON text.
+ *
+ * @param   **json  Pointer to the JSON text.
+ * @param   *uri    The uri of the document.
+ * @param   *range  The range in the document.
+ */
+void addLocationToJson(char **json, const char *uri, const text_range_t *range)
+{
+    addTwoStrings(json, "{\"uri\":");
+    addJsonString(json, uri);
+    addTwoStrings(json, ",\"range\":");
+    addRangeToJson(json, range);
+    addTwoStrings(json, "}");
+}
+
+/*
+ * Adds a range of the protocol to a JSON text.
+ *
+ * @param   **json  Pointer to the JSON text.
+ * @param   *range  The range (in a line).
+ */
+void addRangeToJson(char **json, const text_range_t *range)
+{
+    char rangeText[HEADER_BUFFER];
+
+    sprintf(rangeText, "{\"start\":{\"line\":%d,\"character\":%d},"
+                       "\"end\":{\"line\":%d,\"character\":%d}}",
+            range -> line, range -> start, range -> line, range -> end);
+    addTwoStrings(json, rangeText);
+}
@@ -0,0 +1,28 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the lsp_algorithm.c file.
+ */
+
+#ifndef MMN_14_LSP_ALGORITHM_H
+#define MMN_14_LSP_ALGORITHM_H
+
+#include <stdio.h>
+#include "../new-data-types/process_result.h"
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Runs the language server, until the client sends the exit notification (or closes the input).
+ *
+ * @param   *input      The stream of the messages from the client.
+ * @param   *output     The stream of the messages to the client.
+ *
+ * @return  SUCCESS if the client shut the server down before the exit, otherwise FAILURE.
+ */
+process_result run_language_server(FILE *input, FILE *output);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_LSP_ALGORITHM_H */
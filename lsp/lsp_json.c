@@ -0,0 +1,405 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * lsp_json.c
+ *
+ * This file has the functions to read and write the JSON messages of the language server.
+ *
+ * The messages are not parsed to a tree, a value is found in the text of the message by its
+ * path and read from there (the messages of the protocol are small, and only a few values
+ * are read from every message).
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../new-data-types/boolean.h"
+#include "../general-enums/indexes.h"
+#include "../general-enums/programFinals.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "lsp_json.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE LSP_MEMORY /* For the memory statistics. */
+#define PATH_SEPARATOR '.'
+#define QUOTE '"'
+#define BACKSLASH '\\'
+#define MEMBER_SEPARATOR ':'
+#define ELEMENT_SEPARATOR ','
+#define OBJECT_START '{'
+#define OBJECT_END '}'
+#define ARRAY_START '['
+#define ARRAY_END ']'
+#define UNICODE_ESCAPE 'u'
+#define UNICODE_DIGITS 4
+#define HEX_BASE 16
+#define MAX_CONTROL_CHAR 0x1f
+#define MAX_ESCAPE_LENGTH 6 /* The longest escape of a char is \u00XX. */
+#define SIZE_FOR_QUOTES 2
+
+/* Limits of the UTF-8 encoding. */
+#define ONE_BYTE_LIMIT 0x80
+#define TWO_BYTES_LIMIT 0x800
+#define HIGH_SURROGATE_START 0xd800
+#define LOW_SURROGATE_START 0xdc00
+#define SURROGATES_END 0xe000
+#define SURROGATE_BITS 10
+#define SURROGATES_BASE 0x10000
+/* ------------ */
+
+/* ---Macros--- */
+#define is_json_space(ch) ((ch) == ' ' || (ch) == '\t' || (ch) == '\n' || (ch) == '\r')
+/* ------------ */
+
+/* ---------------Prototypes--------------- */
+const char *skipJsonSpaces(const char *json);
+const char *skipJsonString(const char *json);
+const char *findJsonObjectMember(const char *json, const char *name, size_t nameLength);
+long readJsonUnicodeEscape(const char **pJson);
+int encodeUtf8(long codePoint, char *bytes);
+/* ---------------------------------------- */
+
+/*
+ * Skips the spaces in a JSON text.
+ *
+ * @param   *json   The JSON text.
+ *
+ * @return  The JSON text after the spaces.
+ */
+const char *skipJsonSpaces(const char *json)
+{
+    while (is_json_space(*json))
+        json++;
+
+    return json;
+}
+
+/*
+ * Skips a JSON string.
+ *
+ * @param   *json   The JSON text, at the opening quote of the string.
+ *
+ * @return  The JSON text after the closing quote.
+ */
+const char *skipJsonString(const char *json)
+{
+    for (json++; *json != QUOTE && *json != '\0'; json++)
+        if (*json == BACKSLASH && json[ONE_INDEX] != '\0')
+            json++;
+
+    return (*json == QUOTE)? json + 1 : json;
+}
+
+/*
+ * Skips a JSON value (with the spaces before and after it).
+ *
+ * @param   *json   The JSON text, at the start of the value.
+ *
+ * @return  The JSON text after the value.
+ */
+const char *skipJsonValue(const char *json)
+{
+    int depth = ZERO_COUNT; /* The depth in objects and arrays. */
+
+    json = skipJsonSpaces(json);
+    do
+    {
+        if (*json == QUOTE)
+            json = skipJsonString(json);
+        else if (*json == OBJECT_START || *json == ARRAY_START)
+        {
+            depth++;
+            json++;
+        }
+        else if (*json == OBJECT_END || *json == ARRAY_END)
+        {
+            depth--;
+            json++;
+        }
+        else if (*json == ELEMENT_SEPARATOR || *json == MEMBER_SEPARATOR || is_json_space(*json))
+            json++;
+        else /* A number, true, false or null. */
+            while (*json != '\0' && *json != ELEMENT_SEPARATOR && *json != OBJECT_END &&
+                   *json != ARRAY_END && !is_json_space(*json))
+                json++;
+    } while (depth > ZERO_COUNT && *json != '\0');
+
+    return skipJsonSpaces(json);
+}
+
+/*
+ * Finds a member of a JSON object by its path (names of members separated by dots,
+ * like "params.textDocument.uri").
+ *
+ * @param   *json   The JSON text of the object.
+ * @param   *path   The path of the member.
+ *
+ * @return  The value of the member, or NULL if it was not found.
+ */
+const char *findJsonMember(const char *json, const char *path)
+{
+    const char *separator;
+
+    while (json != NULL && *path != '\0')
+    {
+        separator = strchr(path, PATH_SEPARATOR);
+        if (separator == NULL)
+            separator = path + strlen(path);
+
+        json = findJsonObjectMember(json, path, (size_t) (separator - path));
+        path = (*separator == PATH_SEPARATOR)? separator + 1 : separator;
+    }
+
+    return json;
+}
+
+/*
+ * Finds a member of a JSON object by its name.
+ *
+ * @param   *json       The JSON text of the object.
+ * @param   *name       The name of the member.
+ * @param   nameLength  The length of the name.
+ *
+ * @return  The value of the member, or NULL if it was not found.
+ */
+const char *findJsonObjectMember(const char *json, const char *name, size_t nameLength)
+{
+    const char *memberName, *value = NULL; /* Value to return. */
+
+    json = skipJsonSpaces(json);
+    if (*json != OBJECT_START)
+        return NULL;
+
+    json = skipJsonSpaces(json + 1);
+    while (value == NULL && *json == QUOTE)
+    {
+        memberName = json + 1;
+        json = skipJsonSpaces(skipJsonString(json));
+        if (*json != MEMBER_SEPARATOR)
+            break;
+
+        json = skipJsonSpaces(json + 1);
+        if (strncmp(memberName, name, nameLength) == 0 && memberName[nameLength] == QUOTE)
+            value = json;
+        else
+        {
+            json = skipJsonValue(json);
+            if (*json == ELEMENT_SEPARATOR)
+                json = skipJsonSpaces(json + 1);
+        }
+    }
+
+    return value;
+}
+
+/*
+ * Reads a JSON string value.
+ *
+ * @param   *value  The JSON text of the value.
+ *
+ * @return  The string (dynamically allocated), or NULL if the value is not a string.
+ */
+char *readJsonString(const char *value)
+{
+    char *str, *currChar; /* Value to return. */
+    long codePoint;
+
+    if (value == NULL || *(value = skipJsonSpaces(value)) != QUOTE)
+        return NULL;
+
+    /* The string is never longer than its JSON text. */
+    str = (char *) allocate_space((size_t) (skipJsonString(value) - value) + SIZE_FOR_NULL);
+    for (value++, currChar = str; *value != QUOTE && *value != '\0'; value++)
+    {
+        if (*value != BACKSLASH)
+            *currChar++ = *value;
+        else
+            switch (*++value)
+            {
+                case 'n': *currChar++ = '\n'; break;
+                case 't': *currChar++ = '\t'; break;
+                case 'r': *currChar++ = '\r'; break;
+                case 'b': *currChar++ = '\b'; break;
+                case 'f': *currChar++ = '\f'; break;
+                case UNICODE_ESCAPE:
+                    codePoint = readJsonUnicodeEscape(&value);
+                    currChar += encodeUtf8(codePoint, currChar);
+                    break;
+                case '\0': value--; break;
+                default: *currChar++ = *value; break; /* Quote, backslash and slash. */
+            }
+    }
+
+    *currChar = '\0';
+    return str;
+}
+
+/*
+ * Reads the code point of a unicode escape (\uXXXX, or two of them for a surrogate pair).
+ *
+ * @param   **pJson     Pointer to the JSON text, at the 'u' of the escape. Will point to the
+ *                      last char of the escape.
+ *
+ * @return  The code point.
+ */
+long readJsonUnicodeEscape(const char **pJson)
+{
+    char digits[UNICODE_DIGITS + SIZE_FOR_NULL];
+    long codePoint, lowSurrogate;
+
+    (void) strncpy(digits, *pJson + 1, UNICODE_DIGITS);
+    digits[UNICODE_DIGITS] = '\0';
+    codePoint = strtol(digits, NULL, HEX_BASE);
+    *pJson += strlen(digits);
+
+    /* A character out of the basic plane is two escapes (a surrogate pair). */
+    if (codePoint >= HIGH_SURROGATE_START && codePoint < LOW_SURROGATE_START &&
+        (*pJson)[ONE_INDEX] == BACKSLASH && (*pJson)[ONE_INDEX + 1] == UNICODE_ESCAPE)
+    {
+        (void) strncpy(digits, *pJson + 3, UNICODE_DIGITS);
+        lowSurrogate = strtol(digits, NULL, HEX_BASE);
+        if (lowSurrogate >= LOW_SURROGATE_START && lowSurrogate < SURROGATES_END)
+        {
+            codePoint = SURROGATES_BASE + ((codePoint - HIGH_SURROGATE_START) << SURROGATE_BITS) +
+                        (lowSurrogate - LOW_SURROGATE_START);
+            *pJson += 2 + strlen(digits);
+        }
+    }
+
+    return codePoint;
+}
+
+/*
+ * Encodes a code point in UTF-8.
+ *
+ * @param   codePoint   The code point.
+ * @param   *bytes      Will hold the bytes of the encoding (up to 4).
+ *
+ * @return  The amount of bytes of the encoding.
+ */
+int encodeUtf8(long codePoint, char *bytes)
+{
+    int length;
+
+    if (codePoint < ONE_BYTE_LIMIT)
+    {
+        bytes[0] = (char) codePoint;
+        length = 1;
+    }
+    else if (codePoint < TWO_BYTES_LIMIT)
+    {
+        bytes[0] = (char) (0xc0 | (codePoint >> 6));
+        bytes[1] = (char) (0x80 | (codePoint & 0x3f));
+        length = 2;
+    }
+    else if (codePoint < SURROGATES_BASE)
+    {
+        bytes[0] = (char) (0xe0 | (codePoint >> 12));
+        bytes[1] = (char) (0x80 | ((codePoint >> 6) & 0x3f));
+        bytes[2] = (char) (0x80 | (codePoint & 0x3f));
+        length = 3;
+    }
+    else
+    {
+        bytes[0] = (char) (0xf0 | (codePoint >> 18));
+        bytes[1] = (char) (0x80 | ((codePoint >> 12) & 0x3f));
+        bytes[2] = (char) (0x80 | ((codePoint >> 6) & 0x3f));
+        bytes[3] = (char) (0x80 | (codePoint & 0x3f));
+        length = 4;
+    }
+
+    return length;
+}
+
+/*
+ * Reads a JSON integer value.
+ *
+ * @param   *value          The JSON text of the value (can be NULL).
+ * @param   defaultValue    The value to return if the value is not an integer.
+ *
+ * @return  The integer.
+ */
+int readJsonInt(const char *value, int defaultValue)
+{
+    char *end;
+    long number;
+
+    if (value == NULL)
+        return defaultValue;
+
+    number = strtol(value, &end, 10);
+    return (end != value)? (int) number : defaultValue;
+}
+
+/*
+ * Gets the first element of a JSON array.
+ *
+ * @param   *array  The JSON text of the array (can be NULL).
+ *
+ * @return  The first element, or NULL if the array is empty or it is not an array.
+ */
+const char *getFirstJsonElement(const char *array)
+{
+    if (array == NULL || *(array = skipJsonSpaces(array)) != ARRAY_START)
+        return NULL;
+
+    array = skipJsonSpaces(array + 1);
+    return (*array != ARRAY_END && *array != '\0')? array : NULL;
+}
+
+/*
+ * Gets the element after an element of a JSON array.
+ *
+ * @param   *element    The JSON text of the element.
+ *
+ * @return  The next element, or NULL if it was the last element.
+ */
+const char *getNextJsonElement(const char *element)
+{
+    element = skipJsonValue(element);
+    return (*element == ELEMENT_SEPARATOR)? skipJsonSpaces(element + 1) : NULL;
+}
+
+/*
+ * Adds a string to a JSON text, as a JSON string value (in quotes, escaped).
+ *
+ * @param   **json  Pointer to the JSON text.
+ * @param   *str    The string to add.
+ */
+void addJsonString(char **json, const char *str)
+{
+    char *escaped = (char *) allocate_space(strlen(str) * MAX_ESCAPE_LENGTH + SIZE_FOR_QUOTES +
+                                            SIZE_FOR_NULL);
+    char *currChar = escaped;
+
+    *currChar++ = QUOTE;
+    for (; *str != '\0'; str++)
+    {
+        if (*str == QUOTE || *str == BACKSLASH)
+        {
+            *currChar++ = BACKSLASH;
+            *currChar++ = *str;
+        }
+        else if (*str == '\n' || *str == '\t' || *str == '\r')
+        {
+            *currChar++ = BACKSLASH;
+            *currChar++ = (*str == '\n')? 'n' : (*str == '\t')? 't' : 'r';
+        }
+        else if ((unsigned char) *str <= MAX_CONTROL_CHAR)
+        {
+            (void) sprintf(currChar, "\\u%04x", (unsigned int) (unsigned char) *str);
+            currChar += strlen(currChar);
+        }
+        else
+            *currChar++ = *str;
+    }
+    *currChar++ = QUOTE;
+    *currChar = '\0';
+
+    addTwoStrings(json, escaped);
+    (void) clear_ptr(escaped)
+}
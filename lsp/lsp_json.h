@@ -0,0 +1,80 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the lsp_json.c file.
+ */
+
+#ifndef MMN_14_LSP_JSON_H
+#define MMN_14_LSP_JSON_H
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Skips a JSON value (with the spaces before and after it).
+ *
+ * @param   *json   The JSON text, at the start of the value.
+ *
+ * @return  The JSON text after the value.
+ */
+const char *skipJsonValue(const char *json);
+
+/*
+ * Finds a member of a JSON object by its path (names of members separated by dots,
+ * like "params.textDocument.uri").
+ *
+ * @param   *json   The JSON text of the object.
+ * @param   *path   The path of the member.
+ *
+ * @return  The value of the member, or NULL if it was not found.
+ */
+const char *findJsonMember(const char *json, const char *path);
+
+/*
+ * Reads a JSON string value.
+ *
+ * @param   *value  The JSON text of the value.
+ *
+ * @return  The string (dynamically allocated), or NULL if the value is not a string.
+ */
+char *readJsonString(const char *value);
+
+/*
+ * Reads a JSON integer value.
+ *
+ * @param   *value          The JSON text of the value (can be NULL).
+ * @param   defaultValue    The value to return if the value is not an integer.
+ *
+ * @return  The integer.
+ */
+int readJsonInt(const char *value, int defaultValue);
+
+/*
+ * Gets the first element of a JSON array.
+ *
+ * @param   *array  The JSON text of the array (can be NULL).
+ *
+ * @return  The first element, or NULL if the array is empty or it is not an array.
+ */
+const char *getFirstJsonElement(const char *array);
+
+/*
+ * Gets the element after an element of a JSON array.
+ *
+ * @param   *element    The JSON text of the element.
+ *
+ * @return  The next element, or NULL if it was the last element.
+ */
+const char *getNextJsonElement(const char *element);
+
+/*
+ * Adds a string to a JSON text, as a JSON string value (in quotes, escaped).
+ *
+ * @param   **json  Pointer to the JSON text.
+ * @param   *str    The string to add.
+ */
+void addJsonString(char **json, const char *str);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_LSP_JSON_H */
@@ -0,0 +1,33 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file contains the new data type 'assembler_options_t'.
+ */
+
+#ifndef MMN_14_ASSEMBLER_OPTIONS_H
+#define MMN_14_ASSEMBLER_OPTIONS_H
+
+#include "boolean.h"
+
+/* The options given to the assembler in the command line. */
+typedef struct
+{
+    boolean isOptimize; /* Run the peephole optimization before encoding. */
+    boolean isLowMemory; /* Keep the ASTs in a temporary file instead of the memory. */
+    boolean isPoolLiterals; /* Encode every .data or .string literal only once. */
+    boolean isEliminateDeadCode; /* Remove unreachable code and unreferenced data. */
+    boolean isControlFlowReport; /* Write the report of the blocks and the cycles of the code. */
+    boolean isPipelined; /* Pre-process, parse and handle the lines of a file on separate threads. */
+    boolean isReadAhead; /* Read the next source files on a background thread. */
+    boolean isMemoryReport; /* Print the memory that every module used for a file. */
+    boolean isTrace; /* Write the spans of the stages of all the files as Chrome trace events. */
+    boolean isCheckOnly; /* Only check the files, without encoding them and writing any file. */
+    boolean isAllErrors; /* Check the labels of the lines that were built, if a line had errors. */
+    boolean isCrossReference; /* Write the index of the definitions and the uses of the names. */
+    int maxErrors; /* Stop reading a file after this many lines with errors, 0 for no cap. */
+    const char *archiveName; /* Write all the output files to this archive, NULL for files. */
+    boolean isArena; /* Take the memory of all the files from one arena, freed at the end. */
+} assembler_options_t;
+
+#endif /* MMN_14_ASSEMBLER_OPTIONS_H */
@@ -0,0 +1,18 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file contains the new data type 'error_count_t'.
+ */
+
+#ifndef MMN_14_ERROR_COUNT_H
+#define MMN_14_ERROR_COUNT_H
+
+/* The count of the lines with errors of a file, in all the stages of its assembly. */
+typedef struct
+{
+    int errorsAmount; /* The amount of the lines with errors so far. */
+    int maxErrors; /* Stop after this many lines with errors, 0 for no cap. */
+} error_count_t;
+
+#endif /* MMN_14_ERROR_COUNT_H */
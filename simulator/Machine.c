@@ -0,0 +1,516 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Machine.c
+ *
+ * This file has the functions of the imaginary machine that runs assembled programs.
+ *
+ * The machine has 1024 words of 12 bits, 8 registers (r0 - r7), a zero flag and a stack.
+ * A program is loaded to PROGRAM_MEM_START, the code segment first and the data segment after it,
+ * the stack starts at the end of the memory and grows down towards the program.
+ *
+ * Semantics of the operations (values are 12 bits two's complement):
+ *      mov src, dest: dest = src              cmp src, dest: zero flag = (src == dest)
+ *      add src, dest: dest = dest + src       sub src, dest: dest = dest - src
+ *      lea src, dest: dest = address of src   not dest: dest = ~dest       clr dest: dest = 0
+ *      inc dest: dest = dest + 1              dec dest: dest = dest - 1
+ *      jmp dest: jump to dest                 bne dest: jump to dest if the zero flag is off
+ *      red dest: dest = next input character (-1 on end of input)
+ *      prn dest: print dest as a signed decimal number and a new line
+ *      jsr dest: push the return address and jump to dest, rts: pop the return address and jump
+ *      stop: stop the program
+ * A jump destination is the address of a label, or the value of a register.
+ * Only 'cmp' changes the zero flag.
+ *
+ * Every word of the code segment is decoded once when the program is loaded, to an array of
+ * decoded instructions (indexed by address). The first words are decoded through the decode
+ * table. The run loop jumps straight from one decoded instruction to the handler of the next
+ * one (threaded dispatch, with the computed goto of GNU C), and falls back to a switch on other
+ * compilers.
+ * Writing to the code segment decodes the changed instructions again.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "../new-data-types/boolean.h"
+#include "../general-enums/indexes.h"
+#include "../general-enums/programFinals.h"
+#include "../general-enums/assemblerFinals.h"
+#include "../encoding/encoding-finals/encoding_finals.h"
+#include "../encoding/encoding-finals/ranges.h"
+#include "../assembler_ast/assembler_ast.h"
+#include "../encoding/decodeTable.h"
+#include "../encoding/wordHandling.h"
+#include "../util/memoryUtil.h"
+#include "Machine.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE SIMULATOR_MEMORY /* For the memory statistics. */
+#define WORD_MASK 0xfff
+#define SIGN_BIT 0x800
+#define WORD_RANGE 0x1000
+#define INSTANT_SIGN_BIT 0x200
+#define INSTANT_RANGE 0x400
+#define ONE_BIT 1
+#define REGISTERS_AMOUNT 8
+#define MAX_INSTRUCTION_LENGTH 3
+#define NO_STEPS_LIMIT 0
+#define INITIAL_OUTPUT_CAPACITY 256
+#define NUMBER_BUFFER 16
+
+/* Handlers that are not operations, after the handlers of the operations. */
+#define ILLEGAL_HANDLER OPCODE_AMOUNT
+#define OUT_OF_CODE_HANDLER (OPCODE_AMOUNT + 1)
+
+/* Address that is never in the code segment (PROGRAM_MEM_START can't be zero). */
+#define OUT_OF_CODE_ADDRESS 0
+
+/* Use threaded dispatch where the computed goto is available. */
+#ifdef __GNUC__
+#define THREADED_DISPATCH
+#endif
+/* ------------ */
+
+/* ---Macros--- */
+#define get_field(word, low, high) (((word) >> (low)) & ((ONE_BIT << ((high) - (low) + 1)) - 1))
+
+#define to_signed(value) (((value) & SIGN_BIT)? (value) - WORD_RANGE : (value))
+
+#define operand_value(machine, operand) \
+    (((operand).method == INSTANT)? (operand).value : \
+    ((operand).method == DIRECT)? (machine) -> memory[(operand).value] : \
+    (machine) -> registers[(operand).value])
+
+#define jump_target(machine, operand) \
+    (((operand).method == DIRECT)? (operand).value : (machine) -> registers[(operand).value])
+
+/* A jump outside the memory lands on an address that is never in the code segment. */
+#define set_pc(target) (pc = ((target) < IMG_SYSTEM_MEMORY_SIZE)? (target) : OUT_OF_CODE_ADDRESS)
+
+/* Fetch the next decoded instruction, the program counter moves past it before it runs. */
+#define FETCH_INSTRUCTION() \
+    if (executed == stepsLimit) { runError = STEPS_LIMIT_REACHED_ERR; goto finish_run; } \
+    currAddress = pc; \
+    inst = &machine -> decoded[pc]; \
+    pc += inst -> length; \
+    executed++
+
+#ifdef THREADED_DISPATCH
+#define HANDLER(label, handlerNumber) label:
+#define NEXT_INSTRUCTION() do { FETCH_INSTRUCTION(); goto *dispatchTable[inst -> handler]; } \
+        while (0)
+#else
+#define HANDLER(label, handlerNumber) case handlerNumber:
+#define NEXT_INSTRUCTION() continue
+#endif
+/* ------------ */
+
+/* A decoded argument of an instruction. */
+typedef struct
+{
+    addressing_method_t method;
+    int value; /* INSTANT: the value, DIRECT: the address, DIRECT_REGISTER: the register. */
+} operand_t;
+
+/* A decoded instruction. */
+typedef struct
+{
+    int handler; /* The opcode, ILLEGAL_HANDLER or OUT_OF_CODE_HANDLER. */
+    operand_t src;
+    operand_t dest;
+    int length; /* The amount of words of the instruction. */
+} decoded_instruction_t;
+
+/* Machine data type. */
+struct Machine
+{
+    int memory[IMG_SYSTEM_MEMORY_SIZE]; /* 12 bits words. */
+    int registers[REGISTERS_AMOUNT];
+    boolean zeroFlag;
+    int pc; /* Address of the current instruction. */
+    int sp; /* Address of the top of the stack. */
+    int codeEnd; /* The first address after the code segment. */
+    int imageEnd; /* The first address after the program (the stack can't pass it). */
+    long executed; /* Amount of executed instructions. */
+    decoded_instruction_t decoded[IMG_SYSTEM_MEMORY_SIZE];
+    boolean isCaptureOutput;
+    char *output; /* The captured output. */
+    size_t outputLength;
+    size_t outputCapacity;
+};
+
+/* ---------------Prototypes--------------- */
+void decodeInstruction(Machine *machine, int address);
+boolean decodeOperand(operand_t *operand, addressing_method_t method, int word, boolean isDest);
+void writeOperand(Machine *machine, const operand_t *operand, int value);
+int readCharacter(Machine *machine);
+void printValue(Machine *machine, int value);
+/* ---------------------------------------- */
+
+/*
+ * Creates a new machine and loads an object to its memory.
+ * Every word of the code segment is decoded once while loading.
+ *
+ * @param   *objectFile     The object to load.
+ * @param   isCaptureOutput Flag indicating if the output of the program is kept in the machine
+ *                          (and the input is empty) instead of using the standard streams.
+ *
+ * @return  Pointer to the newly created machine.
+ */
+Machine *createMachine(const ObjectFile *objectFile, boolean isCaptureOutput)
+{
+    Machine *machine = (Machine *) allocate_space(sizeof(Machine));
+    int address, i; /* Loop variables. */
+
+    (void) memset(machine -> memory, ZERO_NUMBER, sizeof(machine -> memory));
+    (void) memset(machine -> registers, ZERO_NUMBER, sizeof(machine -> registers));
+
+    machine -> codeEnd = PROGRAM_MEM_START + objectFile -> counters[IC_];
+    machine -> imageEnd = machine -> codeEnd + objectFile -> counters[DC_];
+
+    /* Load the words of the program (the loader made sure they fit in the memory). */
+    for (i = ZERO_INDEX; i < getObjectWordsAmount(objectFile); i++)
+        machine -> memory[PROGRAM_MEM_START + i] = getBitsInRange(objectFile -> words[i],
+                                                                  DATA_LOW, DATA_HIGH);
+
+    /* Decode the code segment, every other address is outside the code. */
+    for (address = ZERO_INDEX; address < IMG_SYSTEM_MEMORY_SIZE; address++)
+    {
+        machine -> decoded[address].handler = OUT_OF_CODE_HANDLER;
+        machine -> decoded[address].length = ZERO_COUNT;
+    }
+    for (address = PROGRAM_MEM_START; address < machine -> codeEnd; address++)
+        decodeInstruction(machine, address);
+
+    machine -> zeroFlag = FALSE;
+    machine -> pc = PROGRAM_MEM_START;
+    machine -> sp = IMG_SYSTEM_MEMORY_SIZE;
+    machine -> executed = ZERO_COUNT;
+
+    machine -> isCaptureOutput = isCaptureOutput;
+    machine -> output = NULL;
+    machine -> outputLength = machine -> outputCapacity = ZERO_COUNT;
+
+    return machine;
+}
+
+/*
+ * Decodes the instruction that starts at a given address of the code segment.
+ *
+ * @param   *machine    The machine.
+ * @param   address     The address of the instruction.
+ */
+void decodeInstruction(Machine *machine, int address)
+{
+    decoded_instruction_t *inst = &machine -> decoded[address];
+    const decoded_word_t *decodedWord = decodeInstructionWord(machine -> memory[address]);
+    addressing_method_t srcMtd = decodedWord -> srcMtd, destMtd = decodedWord -> destMtd;
+    int argAddress = address + ONE_INDEX;
+    boolean isValid = (decodedWord -> opcode != NO_OPCODE)? TRUE : FALSE;
+
+    inst -> length = decodedWord -> length;
+    if (isValid == TRUE && address + inst -> length > machine -> codeEnd)
+        isValid = FALSE; /* The instruction is cut by the end of the code segment. */
+
+    if (isValid == TRUE && srcMtd != ZERO_ADD_MTD)
+    {
+        isValid = decodeOperand(&inst -> src, srcMtd, machine -> memory[argAddress], FALSE);
+        if (destMtd != DIRECT_REGISTER || srcMtd != DIRECT_REGISTER)
+            argAddress++;
+    }
+    if (isValid == TRUE && destMtd != ZERO_ADD_MTD)
+        isValid = decodeOperand(&inst -> dest, destMtd, machine -> memory[argAddress], TRUE);
+
+    inst -> handler = (isValid == TRUE)? (int) decodedWord -> opcode : ILLEGAL_HANDLER;
+    if (isValid == FALSE)
+        inst -> length = ONE_INDEX;
+}
+
+/*
+ * Decodes an argument word of an instruction.
+ *
+ * @param   *operand    Will hold the decoded argument.
+ * @param   method      The addressing method of the argument.
+ * @param   word        The argument word.
+ * @param   isDest      Flag indicating if the argument is the destination argument.
+ *
+ * @return  TRUE if the argument word is valid, otherwise FALSE.
+ */
+boolean decodeOperand(operand_t *operand, addressing_method_t method, int word, boolean isDest)
+{
+    operand -> method = method;
+
+    if (method == INSTANT) /* Sign extend the value to a full word. */
+    {
+        operand -> value = get_field(word, DIR_DATA_LOW, DIR_DATA_HIGH);
+        if (operand -> value & INSTANT_SIGN_BIT)
+            operand -> value = (operand -> value - INSTANT_RANGE) & WORD_MASK;
+    }
+    else if (method == DIRECT)
+        operand -> value = get_field(word, DIR_DATA_LOW, DIR_DATA_HIGH);
+    else /* DIRECT_REGISTER */
+        operand -> value = (isDest == TRUE)? get_field(word, DEST_REG_LOW, DEST_REG_HIGH) :
+                get_field(word, SRC_REG_LOW, SRC_REG_HIGH);
+
+    return (method != DIRECT_REGISTER || operand -> value < REGISTERS_AMOUNT)? TRUE : FALSE;
+}
+
+/*
+ * Runs the loaded program until it stops or an error occurs.
+ *
+ * @param   *machine    The machine to run.
+ * @param   maxSteps    The maximum amount of instructions to execute (0 for no limit).
+ *
+ * @return  NO_ERROR if the program stopped, otherwise the SimulatorError that occurred.
+ */
+Error runMachine(Machine *machine, long maxSteps)
+{
+#ifdef THREADED_DISPATCH
+    /* Handlers by the order of the opcodes, then the handlers that are not operations. */
+    static void *dispatchTable[] = {
+            &&mov_handler, &&cmp_handler, &&add_handler, &&sub_handler, &&not_handler,
+            &&clr_handler, &&lea_handler, &&inc_handler, &&dec_handler, &&jmp_handler,
+            &&bne_handler, &&red_handler, &&prn_handler, &&jsr_handler, &&rts_handler,
+            &&stop_handler, &&illegal_handler, &&out_of_code_handler};
+#endif
+    Error runError = NO_ERROR;
+    decoded_instruction_t *inst;
+    int pc = machine -> pc, currAddress = pc, target;
+    long executed = machine -> executed;
+    long stepsLimit = (maxSteps == NO_STEPS_LIMIT)? LONG_MAX : executed + maxSteps;
+
+#ifdef THREADED_DISPATCH
+    NEXT_INSTRUCTION();
+#else
+    for (;;)
+    {
+        FETCH_INSTRUCTION();
+        switch (inst -> handler)
+        {
+#endif
+        HANDLER(mov_handler, mov)
+            writeOperand(machine, &inst -> dest, operand_value(machine, inst -> src));
+            NEXT_INSTRUCTION();
+
+        HANDLER(cmp_handler, cmp)
+            machine -> zeroFlag = (operand_value(machine, inst -> src) ==
+                                   operand_value(machine, inst -> dest))? TRUE : FALSE;
+            NEXT_INSTRUCTION();
+
+        HANDLER(add_handler, add)
+            writeOperand(machine, &inst -> dest, operand_value(machine, inst -> dest) +
+                                                 operand_value(machine, inst -> src));
+            NEXT_INSTRUCTION();
+
+        HANDLER(sub_handler, sub)
+            writeOperand(machine, &inst -> dest, operand_value(machine, inst -> dest) -
+                                                 operand_value(machine, inst -> src));
+            NEXT_INSTRUCTION();
+
+        HANDLER(not_handler, not)
+            writeOperand(machine, &inst -> dest, ~operand_value(machine, inst -> dest));
+            NEXT_INSTRUCTION();
+
+        HANDLER(clr_handler, clr)
+            writeOperand(machine, &inst -> dest, ZERO_NUMBER);
+            NEXT_INSTRUCTION();
+
+        HANDLER(lea_handler, lea)
+            writeOperand(machine, &inst -> dest, inst -> src.value);
+            NEXT_INSTRUCTION();
+
+        HANDLER(inc_handler, inc)
+            writeOperand(machine, &inst -> dest, operand_value(machine, inst -> dest) + 1);
+            NEXT_INSTRUCTION();
+
+        HANDLER(dec_handler, dec)
+            writeOperand(machine, &inst -> dest, operand_value(machine, inst -> dest) - 1);
+            NEXT_INSTRUCTION();
+
+        HANDLER(jmp_handler, jmp)
+            target = jump_target(machine, inst -> dest);
+            set_pc(target);
+            NEXT_INSTRUCTION();
+
+        HANDLER(bne_handler, bne)
+            if (machine -> zeroFlag == FALSE)
+            {
+                target = jump_target(machine, inst -> dest);
+                set_pc(target);
+            }
+            NEXT_INSTRUCTION();
+
+        HANDLER(red_handler, red)
+            writeOperand(machine, &inst -> dest, readCharacter(machine));
+            NEXT_INSTRUCTION();
+
+        HANDLER(prn_handler, prn)
+            printValue(machine, to_signed(operand_value(machine, inst -> dest)));
+            NEXT_INSTRUCTION();
+
+        HANDLER(jsr_handler, jsr)
+            if (machine -> sp - 1 < machine -> imageEnd)
+            {
+                runError = STACK_OVERFLOW_ERR;
+                goto finish_run;
+            }
+            machine -> memory[--(machine -> sp)] = pc; /* Push the return address. */
+            target = jump_target(machine, inst -> dest);
+            set_pc(target);
+            NEXT_INSTRUCTION();
+
+        HANDLER(rts_handler, rts)
+            if (machine -> sp >= IMG_SYSTEM_MEMORY_SIZE)
+            {
+                runError = STACK_UNDERFLOW_ERR;
+                goto finish_run;
+            }
+            target = machine -> memory[(machine -> sp)++]; /* Pop the return address. */
+            set_pc(target);
+            NEXT_INSTRUCTION();
+
+        HANDLER(stop_handler, stop)
+            goto finish_run;
+
+        HANDLER(illegal_handler, ILLEGAL_HANDLER)
+            executed--; /* The word was not executed. */
+            runError = ILLEGAL_INSTRUCTION_ERR;
+            goto finish_run;
+
+        HANDLER(out_of_code_handler, OUT_OF_CODE_HANDLER)
+            executed--; /* The word was not executed. */
+            runError = PC_OUT_OF_CODE_ERR;
+            goto finish_run;
+#ifndef THREADED_DISPATCH
+        }
+    }
+#endif
+
+finish_run:
+    machine -> pc = currAddress;
+    machine -> executed = executed;
+
+    return runError;
+}
+
+/*
+ * Writes a value to the argument of an instruction (a register or a memory word).
+ *
+ * @param   *machine    The machine.
+ * @param   *operand    The argument to write to.
+ * @param   value       The value to write (cut to 12 bits).
+ */
+void writeOperand(Machine *machine, const operand_t *operand, int value)
+{
+    int address; /* Loop variable. */
+
+    if (operand -> method == DIRECT_REGISTER)
+        machine -> registers[operand -> value] = value & WORD_MASK;
+
+    else
+    {
+        machine -> memory[operand -> value] = value & WORD_MASK;
+
+        /* Decode again every instruction that can include the changed word. */
+        if (operand -> value >= PROGRAM_MEM_START && operand -> value < machine -> codeEnd)
+            for (address = operand -> value - MAX_INSTRUCTION_LENGTH + 1;
+                 address <= operand -> value; address++)
+                if (address >= PROGRAM_MEM_START)
+                    decodeInstruction(machine, address);
+    }
+}
+
+/*
+ * Reads the next input character of the program.
+ *
+ * @param   *machine    The machine.
+ *
+ * @return  The read character, -1 on end of input (always when the output is captured).
+ */
+int readCharacter(Machine *machine)
+{
+    return (machine -> isCaptureOutput == TRUE)? EOF : getchar();
+}
+
+/*
+ * Prints a value as the output of the program.
+ *
+ * @param   *machine    The machine.
+ * @param   value       The value to print.
+ */
+void printValue(Machine *machine, int value)
+{
+    char number[NUMBER_BUFFER];
+    size_t numberLength;
+
+    if (machine -> isCaptureOutput == FALSE)
+        printf("%d\n", value);
+
+    else /* Keep the output, grow the buffer when needed. */
+    {
+        numberLength = (size_t) sprintf(number, "%d\n", value);
+
+        if (machine -> outputLength + numberLength + SIZE_FOR_NULL > machine -> outputCapacity)
+        {
+            machine -> outputCapacity = (machine -> outputCapacity == ZERO_COUNT)?
+                    INITIAL_OUTPUT_CAPACITY : 2 * machine -> outputCapacity;
+            machine -> output = (char *) reallocate_space(machine -> output,
+                                                          machine -> outputCapacity);
+        }
+
+        (void) strcpy(machine -> output + machine -> outputLength, number);
+        machine -> outputLength += numberLength;
+    }
+}
+
+/*
+ * Gets the amount of instructions the machine executed.
+ *
+ * @param   *machine    The machine.
+ *
+ * @return  The amount of executed instructions.
+ */
+long getExecutedInstructions(const Machine *machine)
+{
+    return machine -> executed;
+}
+
+/*
+ * Gets the address of the instruction that was executed last.
+ *
+ * @param   *machine    The machine.
+ *
+ * @return  The value of the program counter.
+ */
+int getProgramCounter(const Machine *machine)
+{
+    return machine -> pc;
+}
+
+/*
+ * Gets the output of the program (only when the output is captured).
+ *
+ * @param   *machine    The machine.
+ *
+ * @return  The output of the program, NULL if nothing was printed.
+ */
+const char *getMachineOutput(const Machine *machine)
+{
+    return machine -> output;
+}
+
+/*
+ * Deletes a machine and frees its memory.
+ *
+ * @param   **pMachine  Pointer to the machine to delete.
+ */
+void deleteMachine(Machine **pMachine)
+{
+    (void) clear_ptr((*pMachine) -> output)
+    (void) clear_ptr(*pMachine)
+}
@@ -0,0 +1,78 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the Machine.c file.
+ */
+
+#ifndef MMN_14_MACHINE_H
+#define MMN_14_MACHINE_H
+
+#include "../new-data-types/boolean.h"
+#include "../errors/error_types/error_types.h"
+#include "../ObjectFile/ObjectFile.h"
+
+/* Machine data type - the imaginary machine with a loaded program. */
+typedef struct Machine Machine;
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Creates a new machine and loads an object to its memory.
+ * Every word of the code segment is decoded once while loading.
+ *
+ * @param   *objectFile     The object to load.
+ * @param   isCaptureOutput Flag indicating if the output of the program is kept in the machine
+ *                          (and the input is empty) instead of using the standard streams.
+ *
+ * @return  Pointer to the newly created machine.
+ */
+Machine *createMachine(const ObjectFile *objectFile, boolean isCaptureOutput);
+
+/*
+ * Runs the loaded program until it stops or an error occurs.
+ *
+ * @param   *machine    The machine to run.
+ * @param   maxSteps    The maximum amount of instructions to execute (0 for no limit).
+ *
+ * @return  NO_ERROR if the program stopped, otherwise the SimulatorError that occurred.
+ */
+Error runMachine(Machine *machine, long maxSteps);
+
+/*
+ * Gets the amount of instructions the machine executed.
+ *
+ * @param   *machine    The machine.
+ *
+ * @return  The amount of executed instructions.
+ */
+long getExecutedInstructions(const Machine *machine);
+
+/*
+ * Gets the address of the instruction that was executed last.
+ *
+ * @param   *machine    The machine.
+ *
+ * @return  The value of the program counter.
+ */
+int getProgramCounter(const Machine *machine);
+
+/*
+ * Gets the output of the program (only when the output is captured).
+ *
+ * @param   *machine    The machine.
+ *
+ * @return  The output of the program, NULL if nothing was printed.
+ */
+const char *getMachineOutput(const Machine *machine);
+
+/*
+ * Deletes a machine and frees its memory.
+ *
+ * @param   **pMachine  Pointer to the machine to delete.
+ */
+void deleteMachine(Machine **pMachine);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_MACHINE_H */
@@ -0,0 +1,76 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * simulator.c
+ *
+ * This file houses the main function of the simulator program. The simulator runs
+ * assembled (or linked) objects on the imaginary machine, and reports how many
+ * instructions were executed and how fast.
+ *
+ * Usage: mmn_14_simulator [-b] [-j threads_amount] [-l max_steps] object_name ...
+ *
+ * Object names are given without endings (the same as the assembler source files).
+ * -b runs the objects as a batch, in parallel on up to threads_amount threads,
+ * with the output of every program captured and printed after the runs.
+ * -l limits the amount of instructions every program can execute (no limit by default).
+ *
+ * Note: This implementation assumes the C90 standard for compatibility.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <stdlib.h>
+#include "../new-data-types/boolean.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "../util/threadUtil.h"
+#include "simulator_algorithm.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE SIMULATOR_MEMORY /* For the memory statistics. */
+#define FIRST_ARGUMENT 1
+#define SUCCESS_CODE 0
+#define FAILURE_CODE 1
+#define NO_STEPS_LIMIT 0
+#define BATCH_OPTION "-b"
+#define THREADS_OPTION "-j"
+#define STEPS_LIMIT_OPTION "-l"
+/* ------------ */
+
+/*
+ * Driver code.
+ */
+int main(int argc, char *argv[])
+{
+    char **objectNames = (char **) allocate_space(argc * sizeof(char *));
+    boolean isBatch = FALSE;
+    int threadsAmount = getProcessorsAmount();
+    long maxSteps = NO_STEPS_LIMIT;
+    int objectsAmount = 0, returnCode = SUCCESS_CODE;
+    int i; /* Loop variable. */
+
+    /* Separate the options from the object names. */
+    for (i = FIRST_ARGUMENT; i < argc; i++)
+    {
+        if (sameStrings(argv[i], BATCH_OPTION) == TRUE)
+            isBatch = TRUE;
+        else if (sameStrings(argv[i], THREADS_OPTION) == TRUE && i + 1 < argc)
+            threadsAmount = atoi(argv[++i]);
+        else if (sameStrings(argv[i], STEPS_LIMIT_OPTION) == TRUE && i + 1 < argc)
+            maxSteps = atol(argv[++i]);
+        else
+            objectNames[objectsAmount++] = argv[i];
+    }
+
+    if (objectsAmount == 0) /* Print a message if the arguments are insufficient. */
+        puts("\nPlease select the assembled objects to run.");
+
+    else if (simulate_objects(objectNames, objectsAmount, isBatch, threadsAmount,
+                              maxSteps) == FAILURE)
+        returnCode = FAILURE_CODE;
+
+    (void) free_ptr(objectNames);
+    return returnCode;
+}
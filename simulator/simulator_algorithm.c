@@ -0,0 +1,250 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * simulator_algorithm.c
+ *
+ * This file implements running assembled (or linked) objects on the imaginary machine.
+ *
+ * Every object is loaded from its .ob file to a new machine, which decodes its code segment
+ * once, and then runs it until it stops. After every run the amount of executed instructions,
+ * the run time and the instructions per second are reported.
+ *
+ * In batch mode the programs run in parallel, every program on its own machine with its
+ * output captured (and an empty input). The outputs and reports are printed after all the
+ * runs, in the order the objects were given, followed by the throughput of the whole batch.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <stdlib.h>
+#include "../new-data-types/boolean.h"
+#include "../new-data-types/process_result.h"
+#include "../general-enums/programFinals.h"
+#include "../general-enums/indexes.h"
+#include "../general-enums/assemblerFinals.h"
+#include "../encoding/decodeTable.h"
+#include "../ObjectFile/ObjectFile.h"
+#include "../errors/tools_errors.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "../util/threadUtil.h"
+#include "../util/timeUtil.h"
+#include "Machine.h"
+#include "simulator_algorithm.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE SIMULATOR_MEMORY /* For the memory statistics. */
+#define SYMBOL_TITLE "Symbol"
+#define ADDRESS_TITLE "Address"
+#define ADDRESS_BUFFER 16
+#define COLOR_GREEN "\x1B[32m"
+#define COLOR_RESET "\x1B[0m"
+/* ------------ */
+
+/* ---Macros--- */
+#define INFO_MSG(message, file) printf("\n" COLOR_GREEN "Simulator state:" COLOR_RESET \
+        " %s " COLOR_GREEN "On file:" COLOR_RESET " \"%s\"\n", (message), (file))
+
+#define per_second(amount, seconds) (((seconds) > 0)? (amount) / (seconds) : 0)
+/* ------------ */
+
+/* A program that is being simulated. */
+typedef struct
+{
+    Machine *machine; /* The machine of the program, NULL if the object was not loaded. */
+    Error loadError;
+    char *unlinkedSymbol; /* An external symbol of the object, if it has any. */
+    Error runError;
+    double runSeconds;
+} simulated_program_t;
+
+/* State shared by all the runs. */
+typedef struct
+{
+    char **objectNames;
+    simulated_program_t *programs;
+    boolean isCaptureOutput;
+    long maxSteps;
+} simulator_context_t;
+
+/* ---------------Prototypes--------------- */
+void simulateProgramTask(int programNumber, void *context);
+void loadProgram(simulator_context_t *simulator, int programNumber);
+process_result reportProgram(simulator_context_t *simulator, int programNumber);
+/* ---------------------------------------- */
+
+/*
+ * Runs assembled objects on the imaginary machine.
+ *
+ * @param   *objectNames[]  The names of the objects to run (without endings).
+ * @param   objectsAmount   The amount of objects to run.
+ * @param   isBatch         Flag indicating if the objects run in parallel with captured outputs.
+ * @param   threadsAmount   The maximum amount of threads to use in batch mode.
+ * @param   maxSteps        The maximum amount of instructions to execute in every run
+ *                          (0 for no limit).
+ *
+ * @return  SUCCESS if all the programs stopped, otherwise FAILURE.
+ */
+process_result simulate_objects(char *objectNames[], int objectsAmount, boolean isBatch,
+                                int threadsAmount, long maxSteps)
+{
+    process_result simulateResult = SUCCESS;
+    simulator_context_t simulator;
+    long totalExecuted = ZERO_COUNT;
+    double batchSeconds = ZERO_NUMBER;
+    int i; /* Loop variable. */
+
+    simulator.objectNames = objectNames;
+    simulator.programs = (simulated_program_t *) allocate_space(
+            objectsAmount * sizeof(simulated_program_t));
+    simulator.isCaptureOutput = isBatch;
+    simulator.maxSteps = maxSteps;
+
+    initDecodeTable();
+
+    if (isBatch == TRUE) /* Run all the programs, then report them in order. */
+    {
+        batchSeconds = getMonotonicSeconds();
+        runTasksInParallel(objectsAmount, threadsAmount, simulateProgramTask, &simulator);
+        batchSeconds = getMonotonicSeconds() - batchSeconds;
+    }
+
+    for (i = ZERO_INDEX; i < objectsAmount; i++)
+    {
+        if (isBatch == FALSE) /* Report every program right after it ran. */
+        {
+            INFO_MSG("Starting running program", objectNames[i]);
+            simulateProgramTask(i, &simulator);
+        }
+
+        if (reportProgram(&simulator, i) == FAILURE)
+            simulateResult = FAILURE;
+
+        if (simulator.programs[i].machine != NULL)
+        {
+            totalExecuted += getExecutedInstructions(simulator.programs[i].machine);
+            deleteMachine(&simulator.programs[i].machine);
+        }
+    }
+
+    if (isBatch == TRUE)
+        printf("\nBatch of %d programs: %ld instructions in %.6f seconds "
+               "(%.0f instructions per second, %d threads)\n", objectsAmount, totalExecuted,
+               batchSeconds, per_second(totalExecuted, batchSeconds), threadsAmount);
+
+    (void) clear_ptr(simulator.programs)
+
+    return simulateResult;
+}
+
+/*
+ * Loads a program and runs it (parallel task).
+ *
+ * @param   programNumber   The number of the program to run.
+ * @param   *context        The simulator context.
+ */
+void simulateProgramTask(int programNumber, void *context)
+{
+    simulator_context_t *simulator = (simulator_context_t *) context;
+    simulated_program_t *program = &simulator -> programs[programNumber];
+
+    loadProgram(simulator, programNumber);
+
+    if (program -> machine != NULL)
+    {
+        program -> runSeconds = getMonotonicSeconds();
+        program -> runError = runMachine(program -> machine, simulator -> maxSteps);
+        program -> runSeconds = getMonotonicSeconds() - program -> runSeconds;
+    }
+}
+
+/*
+ * Loads the object of a program to a new machine.
+ * Objects with external symbols can't run, they must be linked first.
+ *
+ * @param   *simulator      The simulator context.
+ * @param   programNumber   The number of the program to load.
+ */
+void loadProgram(simulator_context_t *simulator, int programNumber)
+{
+    simulated_program_t *program = &simulator -> programs[programNumber];
+    ObjectFile *objectFile = loadObjectFile(simulator -> objectNames[programNumber],
+                                            &program -> loadError);
+
+    program -> machine = NULL;
+    program -> unlinkedSymbol = NULL;
+    program -> runError = NO_ERROR;
+    program -> runSeconds = ZERO_NUMBER;
+
+    if (program -> loadError == NO_ERROR)
+    {
+        if (PROGRAM_MEM_START + getObjectWordsAmount(objectFile) > IMG_SYSTEM_MEMORY_SIZE)
+            program -> loadError = PROGRAM_TOO_LARGE_ERR;
+
+        else if (objectFile -> externsAmount > ZERO_COUNT)
+        {
+            program -> loadError = UNLINKED_EXTERN_SYMBOL_ERR;
+            program -> unlinkedSymbol = objectFile -> externs[ZERO_INDEX].name;
+        }
+
+        else
+            program -> machine = createMachine(objectFile, simulator -> isCaptureOutput);
+    }
+
+    if (program -> unlinkedSymbol != NULL) /* Keep the symbol name for the report. */
+        program -> unlinkedSymbol = my_strdup(program -> unlinkedSymbol);
+
+    if (objectFile != NULL)
+        deleteObjectFile(&objectFile);
+}
+
+/*
+ * Reports the result of running a program (its output in batch mode, errors and statistics).
+ *
+ * @param   *simulator      The simulator context.
+ * @param   programNumber   The number of the program to report.
+ *
+ * @return  SUCCESS if the program stopped, otherwise FAILURE.
+ */
+process_result reportProgram(simulator_context_t *simulator, int programNumber)
+{
+    simulated_program_t *program = &simulator -> programs[programNumber];
+    const char *objectName = simulator -> objectNames[programNumber];
+    char address[ADDRESS_BUFFER];
+    long executed;
+
+    if (program -> loadError != NO_ERROR)
+    {
+        handle_tool_error(objectName, (program -> unlinkedSymbol != NULL)? SYMBOL_TITLE : NULL,
+                          program -> unlinkedSymbol, program -> loadError);
+        (void) clear_ptr(program -> unlinkedSymbol)
+        INFO_MSG("Failed to load program.", objectName);
+        return FAILURE;
+    }
+
+    if (simulator -> isCaptureOutput == TRUE)
+    {
+        INFO_MSG("Output of program", objectName);
+        if (getMachineOutput(program -> machine) != NULL)
+            fputs(getMachineOutput(program -> machine), stdout);
+    }
+
+    if (program -> runError != NO_ERROR)
+    {
+        (void) sprintf(address, "%d", getProgramCounter(program -> machine));
+        handle_tool_error(objectName, ADDRESS_TITLE, address, program -> runError);
+    }
+
+    executed = getExecutedInstructions(program -> machine);
+    printf("\nExecuted %ld instructions in %.6f seconds (%.0f instructions per second)\n",
+           executed, program -> runSeconds, per_second(executed, program -> runSeconds));
+
+    if (program -> runError == NO_ERROR)
+        INFO_MSG("Program stopped.", objectName);
+    else
+        INFO_MSG("Program failed.", objectName);
+
+    return (program -> runError == NO_ERROR)? SUCCESS : FAILURE;
+}
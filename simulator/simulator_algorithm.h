@@ -0,0 +1,33 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the simulator_algorithm.c file.
+ */
+
+#ifndef MMN_14_SIMULATOR_ALGORITHM_H
+#define MMN_14_SIMULATOR_ALGORITHM_H
+
+#include "../new-data-types/boolean.h"
+#include "../new-data-types/process_result.h"
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Runs assembled objects on the imaginary machine.
+ *
+ * @param   *objectNames[]  The names of the objects to run (without endings).
+ * @param   objectsAmount   The amount of objects to run.
+ * @param   isBatch         Flag indicating if the objects run in parallel with captured outputs.
+ * @param   threadsAmount   The maximum amount of threads to use in batch mode.
+ * @param   maxSteps        The maximum amount of instructions to execute in every run
+ *                          (0 for no limit).
+ *
+ * @return  SUCCESS if all the programs stopped, otherwise FAILURE.
+ */
+process_result simulate_objects(char *objectNames[], int objectsAmount, boolean isBatch,
+                                int threadsAmount, long maxSteps);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_SIMULATOR_ALGORITHM_H */
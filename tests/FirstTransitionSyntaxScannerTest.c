@@ -0,0 +1,523 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * FirstTransitionSyntaxScannerTest.c
+ *
+ * This file has the equivalence test of the syntax scanner of the first transition.
+ *
+ * The scanner replaced chains of predicates that checked the label definitions and the
+ * arguments one error after the other. The chains are kept here as the reference, and every
+ * place in a set of texts of every kind is filled with all the 256 byte values (up to three
+ * places at a time), so every character class is checked in every state of the scanners.
+ * The scanner should find the same error as the chain (or no error) for every text.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <string.h>
+#include "../new-data-types/boolean.h"
+#include "../new-data-types/word_number.h"
+#include "../general-enums/neededKeys.h"
+#include "../general-enums/indexes.h"
+#include "../general-enums/assemblerFinals.h"
+#include "../encoding/encoding-finals/registers.h"
+#include "../errors/error_types/error_types.h"
+#include "../errors/FirstTransitionErrors/FirstTransitionSyntaxScanner.h"
+#include "../diagnoses/diagnose_line.h"
+#include "../diagnoses/assembler_line_diagnoses.h"
+#include "../diagnoses/diagnose_util.h"
+#include "../util/memoryUtil.h"
+#include "../util/numberUtil.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE DIAGNOSES_MEMORY /* For the memory statistics. */
+#define SUCCESS_CODE 0
+#define FAILURE_CODE 1
+#define CHAR_VALUES_AMOUNT 256
+#define TEMPLATE_PLACE '%' /* A place in a template, filled with every byte value. */
+#define MAX_TEXT_LEN 80
+#define MAX_REPORTED_MISMATCHES 20
+/* ------------ */
+
+/* The kinds of the scanned texts. */
+typedef enum {LABEL_TEXT, INSTANT_TEXT, REGISTER_TEXT, DIRECT_TEXT} text_kind_t;
+
+/* ---------------Prototypes--------------- */
+void checkTemplates(text_kind_t kind, const char *templates[], int templatesAmount);
+void fillTemplate(text_kind_t kind, const char *template, char *text, int index);
+void checkText(text_kind_t kind, const char *text);
+void checkLongTexts(text_kind_t kind, const char *suffix);
+SyntaxError referenceLabelDefinitionError(const char *labelLine);
+SyntaxError referenceInstantArgError(const char *argument);
+SyntaxError referenceDirectRegArgError(const char *argument);
+SyntaxError referenceDirectArgError(const char *argument);
+boolean isMissingLabel(const char *labelLine);
+boolean isEmptyBetweenLabelAndColon(const char *labelLine);
+boolean isLabelStartWithNumber(const char *labelLine);
+boolean isLabelStartWithIllegalChar(const char *labelLine);
+boolean isLabelContainsIllegalChar(const char *labelLine);
+boolean isLabelTooLong(const char *labelLine);
+boolean isLabelSavedWord(const char *labelLine);
+boolean isMultipleConsColons(const char *labelLine);
+boolean isCommaAfterLabel(const char *labelLine);
+boolean isDirectArgContainsIllegalChars(const char *directArg);
+/* ---------------------------------------- */
+
+/* The amount of the checked texts and of the texts the scanner got wrong. */
+static long checkedAmount = 0;
+static long mismatchesAmount = 0;
+
+/*
+ * Driver code.
+ */
+int main(void)
+{
+    static const char *labelTemplates[] = {"%:", "%%:", "L%:", "L%%:", " %:", "L %:", "%:%",
+                                           "L:%%", "L%:%", "mov%:", "r%:", "r%%:", "data%:",
+                                           "string%:", "entry%:", "extern%:", "stop%:"};
+    static const char *instantTemplates[] = {"%", "%%", "%%%", "+%%", "-%%", "1%%", "12%%",
+                                             "1.%%", "-1.%%", "%1", "%%1", "+1%"};
+    static const char *registerTemplates[] = {"@%", "@%%", "@%%%", "@r%%", "@R%%", "@r1%%",
+                                              "@r12%", "@r7%%", "@r8%"};
+    static const char *directTemplates[] = {"%", "%%", "L%%", "LOOP%%"};
+
+    initSyntaxScanner();
+
+    checkTemplates(LABEL_TEXT, labelTemplates,
+                   (int) (sizeof(labelTemplates) / sizeof(labelTemplates[ZERO_INDEX])));
+    checkTemplates(INSTANT_TEXT, instantTemplates,
+                   (int) (sizeof(instantTemplates) / sizeof(instantTemplates[ZERO_INDEX])));
+    checkTemplates(REGISTER_TEXT, registerTemplates,
+                   (int) (sizeof(registerTemplates) / sizeof(registerTemplates[ZERO_INDEX])));
+    checkTemplates(DIRECT_TEXT, directTemplates,
+                   (int) (sizeof(directTemplates) / sizeof(directTemplates[ZERO_INDEX])));
+    checkLongTexts(LABEL_TEXT, ":");
+    checkLongTexts(DIRECT_TEXT, "");
+
+    printf("Checked %ld texts, the scanner and the reference differ on %ld of them.\n",
+           checkedAmount, mismatchesAmount);
+
+    return (mismatchesAmount == 0)? SUCCESS_CODE : FAILURE_CODE;
+}
+
+/*
+ * Checks all the texts of templates of a kind.
+ *
+ * @param   kind                The kind of the texts.
+ * @param   *templates[]        The templates, every place in them is filled with every byte.
+ * @param   templatesAmount     The amount of the templates.
+ */
+void checkTemplates(text_kind_t kind, const char *templates[], int templatesAmount)
+{
+    char text[MAX_TEXT_LEN];
+    int i; /* Loop variable. */
+
+    for (i = ZERO_INDEX; i < templatesAmount; i++)
+        fillTemplate(kind, templates[i], text, ZERO_INDEX);
+}
+
+/*
+ * Fills the places of a template from an index with every byte value, and checks the texts.
+ * A zero byte ends the text, it is used only where the text can end (labels end with a colon).
+ *
+ * @param   kind        The kind of the text.
+ * @param   *template   The template.
+ * @param   *text       The text, filled until the index.
+ * @param   index       The index to fill the template from.
+ */
+void fillTemplate(text_kind_t kind, const char *template, char *text, int index)
+{
+    int ch; /* Loop variable. */
+    boolean canEnd;
+
+    while (template[index] != NULL_TERMINATOR && template[index] != TEMPLATE_PLACE)
+    {
+        text[index] = template[index];
+        index++;
+    }
+    canEnd = (kind != LABEL_TEXT || memchr(text, COLON, index) != NULL)? TRUE : FALSE;
+
+    if (template[index] == NULL_TERMINATOR) /* The text is done. */
+    {
+        text[index] = NULL_TERMINATOR;
+        checkText(kind, text);
+    }
+    else
+    {
+        if (canEnd == TRUE) /* The zero byte ends the text at the place. */
+        {
+            text[index] = NULL_TERMINATOR;
+            checkText(kind, text);
+        }
+
+        for (ch = ONE_INDEX; ch < CHAR_VALUES_AMOUNT; ch++)
+        {
+            text[index] = (char) ch;
+            fillTemplate(kind, template, text, index + 1);
+        }
+    }
+}
+
+/*
+ * Checks labels or direct arguments around the longest length of a label, with a last
+ * character of every byte value.
+ *
+ * @param   kind        The kind of the texts.
+ * @param   *suffix     The text after the last character.
+ */
+void checkLongTexts(text_kind_t kind, const char *suffix)
+{
+    char text[MAX_TEXT_LEN];
+    int length, ch; /* Loop variables. */
+
+    for (length = MAX_LABEL_LEN - 2; length <= MAX_LABEL_LEN + 1; length++)
+        for (ch = ONE_INDEX; ch < CHAR_VALUES_AMOUNT; ch++)
+        {
+            memset(text, CHAR_A, length);
+            text[length] = (char) ch;
+            strcpy(text + length + 1, suffix);
+            checkText(kind, text);
+        }
+}
+
+/*
+ * Checks that the scanner finds the same error as the reference chain in a text.
+ *
+ * @param   kind    The kind of the text.
+ * @param   *text   The text.
+ */
+void checkText(text_kind_t kind, const char *text)
+{
+    SyntaxError scannerError = NO_ERROR, referenceError = NO_ERROR;
+    int i; /* Loop variable. */
+
+    if (kind == LABEL_TEXT) /* The label definition starts after the blanks, as in the line. */
+    {
+        text += nextCharIndex(text, MINUS_ONE_INDEX);
+        scannerError = scanLabelDefinition(text);
+        referenceError = referenceLabelDefinitionError(text);
+    }
+    else if (kind == INSTANT_TEXT)
+    {
+        scannerError = scanInstantArg(text);
+        referenceError = referenceInstantArgError(text);
+    }
+    else if (kind == REGISTER_TEXT)
+    {
+        scannerError = scanDirectRegArg(text);
+        referenceError = referenceDirectRegArgError(text);
+    }
+    else
+    {
+        scannerError = scanDirectArg(text);
+        referenceError = referenceDirectArgError(text);
+    }
+
+    checkedAmount++;
+    if (scannerError != referenceError && ++mismatchesAmount <= MAX_REPORTED_MISMATCHES)
+    {
+        printf("Text of kind %d (bytes:", kind);
+        for (i = ZERO_INDEX; text[i] != NULL_TERMINATOR; i++)
+            printf(" %02x", (unsigned char) text[i]);
+        printf("): the scanner found %d, the reference found %d\n", scannerError,
+               referenceError);
+    }
+}
+
+/* ---------------REFERENCE CHAINS--------------- */
+
+/*
+ * The reference check of a label definition, the chain the scanner replaced.
+ * Assuming the line starts with the label definition and that it has a colon in it.
+ *
+ * @param   *labelLine  The line of assembly code starting from the label definition.
+ *
+ * @return  The label definition syntax error found in the line, or NO_ERROR if there isn't.
+ */
+SyntaxError referenceLabelDefinitionError(const char *labelLine)
+{
+    SyntaxError labelDefError = NO_ERROR; /* Syntax error to return. */
+
+    /* Checking every possible syntax error in the label definition. */
+    if (isMissingLabel(labelLine))
+        labelDefError = EXPECTED_LABEL_ERR;
+
+    else if (isEmptyBetweenLabelAndColon(labelLine))
+        labelDefError = EMPTY_BETWEEN_LABEL_AND_COLON_ERR;
+
+    else if (isLabelStartWithNumber(labelLine))
+        labelDefError = LABEL_START_WITH_NUM_ERR;
+
+    else if (isLabelStartWithIllegalChar(labelLine))
+        labelDefError = LABEL_START_WITH_ILLEGAL_CHAR_ERR;
+
+    else if (isLabelContainsIllegalChar(labelLine))
+        labelDefError = LABEL_CONTAINS_ILLEGAL_CHAR_ERR;
+
+    else if (isLabelTooLong(labelLine))
+        labelDefError = LABEL_TOO_LONG_ERR;
+
+    else if (isLabelSavedWord(labelLine))
+        labelDefError = LABEL_IS_SAVED_WORD_ERR;
+
+    else if (isMultipleConsColons(labelLine))
+        labelDefError = MULTIPLE_CONS_COLONS_ERR;
+
+    else if (isCommaAfterLabel(labelLine))
+        labelDefError = COMMA_AFTER_LABEL_ERR;
+
+    return labelDefError;
+}
+
+/*
+ * The reference check of an instant argument, the chain the scanner replaced.
+ *
+ * @param   *argument   The instant argument (in string type) to check.
+ *
+ * @return  The specific syntax error in the instant value, or NO_ERROR if there isn't.
+ */
+SyntaxError referenceInstantArgError(const char *argument)
+{
+    SyntaxError instantArgError = NO_ERROR; /* Syntax error to return, assume no error. */
+
+    /* Check for a specific error. */
+    if (isPlusOrMinus(argument[ZERO_INDEX]) && argument[ONE_INDEX] == NULL_TERMINATOR)
+        instantArgError = VALUE_IS_ONLY_SIGN_ERR;
+
+    else if (isPlusOrMinus(argument[ZERO_INDEX]) && isPlusOrMinus(argument[ONE_INDEX]))
+        instantArgError = MULTIPLE_SIGNS_IN_VALUE_ERR;
+
+    else if (isStrFloat(argument))
+        instantArgError = INSTANT_VALUE_IS_FLOAT_ERR;
+
+    else if (isStrInteger(argument) == FALSE)
+        instantArgError = INSTANT_VALUE_IS_ILLEGAL_NUMBER_ERR;
+
+    return instantArgError;
+}
+
+/*
+ * The reference check of a direct register argument, the chain the scanner replaced.
+ * Assuming the argument starts with '@'.
+ *
+ * @param   *argument   The direct register argument (in string type) to check.
+ *
+ * @return  The specific syntax error in the direct register argument, or NO_ERROR if there isn't.
+ */
+SyntaxError referenceDirectRegArgError(const char *argument)
+{
+    SyntaxError regArgSyntaxError = NO_ERROR; /* Syntax error to return, assume no error. */
+
+    /* Check for all the possible errors. */
+    if (argument[ONE_INDEX] == NULL_TERMINATOR)
+        regArgSyntaxError = EXPECTED_REGISTER_ERR;
+
+    else if (argument[ONE_INDEX] == AT)
+        regArgSyntaxError = MULTIPLE_CONS_AT_ERR;
+
+    else if (isLetter(argument[ONE_INDEX]) == FALSE)
+        regArgSyntaxError = MISSING_REG_LETTER_ERR;
+
+    else if (argument[ONE_INDEX] == CHAR_R)
+        regArgSyntaxError = CAPITAL_REGISTER_LETTER_ERR;
+
+    else if (argument[ONE_INDEX] != CHAR_r)
+        regArgSyntaxError = WRONG_REGISTER_LETTER_ERR;
+
+    else if (isCharNumber(argument[TWO_INDEX]) == FALSE)
+        regArgSyntaxError = EXPECTED_REGISTER_NUMBER_ERR;
+
+    else if (!between(argument[TWO_INDEX] - CHAR_ZERO, r0, r7) ||
+            (isCharNumber(argument[THREE_INDEX]) && !isCharNumber(argument[FOUR_INDEX])))
+        regArgSyntaxError = ILLEGAL_REGISTER_NUMBER_ERR;
+
+    else if (argument[THREE_INDEX] != NULL_TERMINATOR)
+        regArgSyntaxError = EXTRANEOUS_TEXT_AFTER_REG_ERR;
+
+    return regArgSyntaxError;
+}
+
+/*
+ * The reference check of a direct (label) argument, the chain the scanner replaced.
+ *
+ * @param   *argument   The direct argument (in string type) to check.
+ *
+ * @return  The specific syntax error in the direct argument, or NO_ERROR if there isn't.
+ */
+SyntaxError referenceDirectArgError(const char *argument)
+{
+    SyntaxError directArgError = NO_ERROR; /* Syntax error to return, assume no error. */
+
+    /* Check all the specific errors. */
+    if (strlen(argument) > MAX_LABEL_LEN)
+        directArgError = ARG_LABEL_TOO_LONG_ERR;
+
+    else if (isDirectArgContainsIllegalChars(argument))
+        directArgError = ILLEGAL_CHARS_IN_DIRECT_ARG_ERR;
+
+    return directArgError;
+}
+
+/* ---------------END OF REFERENCE CHAINS--------------- */
+
+
+/* ---------------REFERENCE PREDICATES--------------- */
+
+/*
+ * Checks if a label is missing in the given line.
+ * Assuming the line starts with the label definition and that it has a colon in it.
+ *
+ * @param   *labelLine  The line of assembly code to check for a missing label.
+ *
+ * @return  TRUE if a label is missing in the given line, otherwise FALSE.
+ */
+boolean isMissingLabel(const char *labelLine)
+{
+    return (labelLine[ZERO_INDEX] == COLON)? TRUE : FALSE;
+}
+
+/*
+ * Checks if there is no empty space between a label and the colon in the given label line.
+ *
+ * @param   *labelLine  The line of assembly code to check for empty space between label and colon.
+ *
+ * @return  TRUE if there is empty space between the label and colon, otherwise FALSE.
+ */
+boolean isEmptyBetweenLabelAndColon(const char *labelLine)
+{
+    return (nextEmptyIndex(labelLine, ZERO_INDEX) <
+            nextSpecificCharIndex(labelLine, ZERO_INDEX, COLON))? TRUE : FALSE;
+}
+
+/*
+ * Checks if the label in the given label line starts with a number.
+ *
+ * @param   *labelLine  The line of assembly code to check for a label that starts with a number.
+ *
+ * @return  TRUE if the label starts with a number, otherwise FALSE.
+ */
+boolean isLabelStartWithNumber(const char *labelLine)
+{
+    return isCharNumber(labelLine[ZERO_INDEX]);
+}
+
+/*
+ * Checks if the label in the given label line starts with an illegal character.
+ *
+ * @param   *labelLine  The line of assembly code to check for a label that starts with
+ *                      an illegal character.
+ *
+ * @return  TRUE if the label starts with an illegal character, otherwise FALSE.
+ */
+boolean isLabelStartWithIllegalChar(const char *labelLine)
+{
+    return (isLetter(labelLine[ZERO_INDEX]) == FALSE)? TRUE : FALSE;
+}
+
+/*
+ * Checks if the label in the given label line contains any illegal characters.
+ *
+ * @param   *labelLine  The line of assembly code to check for a label that contains
+ *                      illegal characters.
+ *
+ * @return  TRUE if the label contains illegal characters, otherwise FALSE.
+ */
+boolean isLabelContainsIllegalChar(const char *labelLine)
+{
+    boolean isLabelContainsIllegalChar = FALSE; /* Value to return, assume no error. */
+    int i = ZERO_INDEX; /* Loop variable. */
+
+    /* While we haven't reached the end of the label definition and didn't find an illegal char. */
+    while (labelLine[i] != COLON && isLabelContainsIllegalChar == FALSE)
+    {
+        if (isLegalChar(labelLine[i]) == FALSE)
+            isLabelContainsIllegalChar = TRUE;
+        i++;
+    }
+
+    return isLabelContainsIllegalChar;
+}
+
+/*
+ * Checks if the label in the given label line is too long (exceeds the maximum allowed length).
+ *
+ * @param   *labelLine  The line of assembly code to check for a label that is too long.
+ *
+ * @return  TRUE if the label is too long, otherwise FALSE.
+ */
+boolean isLabelTooLong(const char *labelLine)
+{
+    return (nextSpecificCharIndex(labelLine, ZERO_INDEX, COLON) > MAX_LABEL_LEN)? TRUE : FALSE;
+}
+
+/*
+ * Checks if the label in the given label line matches a saved word
+ * (e.g., an assembler guidance, opcode or register).
+ *
+ * @param   *labelLine  The line of assembly code to check for a label that matches a saved word.
+ *
+ * @return  TRUE if the label matches a saved word, otherwise FALSE.
+ */
+boolean isLabelSavedWord(const char *labelLine)
+{
+    char *label = getLabelFromLine(labelLine); /* Saving the label in a string. */
+
+    boolean isLabelSavedWord = isSavedWord(label); /* Checking if it's a saved word. */
+
+    (void) clear_ptr(label) /* Freeing the string. */
+    return isLabelSavedWord;
+}
+
+/*
+ * Checks if there are multiple consecutive colons in the given line after the label.
+ *
+ * @param   *labelLine      The line of assembly code to check for multiple consecutive colons.
+ *
+ * @return  TRUE if there are multiple consecutive colons after the label in the given line,
+ *          otherwise FALSE.
+ */
+boolean isMultipleConsColons(const char *labelLine)
+{
+    int colonIndex = nextSpecificCharIndex(labelLine, MINUS_ONE_INDEX, COLON);
+    return (labelLine[nextCharIndex(labelLine, colonIndex)] == COLON)? TRUE : FALSE;
+}
+
+/*
+ * Checks if there is a comma after the label in the given line.
+ *
+ * @param   *labelLine      The line of assembly code to check for a comma after the label.
+ *
+ * @return  TRUE if there is a comma after the label in the given line, otherwise FALSE.
+ */
+boolean isCommaAfterLabel(const char *labelLine)
+{
+    int colonIndex = nextSpecificCharIndex(labelLine, MINUS_ONE_INDEX, COLON);
+    return (labelLine[nextCharIndex(labelLine, colonIndex)] == COMMA)? TRUE : FALSE;
+}
+
+/*
+ * Checks if the given direct argument contains any illegal characters.
+ *
+ * @param   *directArg  The direct argument (in string type) to check for illegal chars in it.
+ *
+ * @return  TRUE if the direct argument contains illegal characters, otherwise FALSE.
+ */
+boolean isDirectArgContainsIllegalChars(const char *directArg)
+{
+    boolean isDirectArgContainsIllegalChars = FALSE; /* Value to return, assume no error. */
+    int i = ZERO_INDEX; /* Loop variable. */
+
+    /* While we haven't reached the end of the direct arg and didn't find an illegal char. */
+    while (directArg[i] != NULL_TERMINATOR && isDirectArgContainsIllegalChars == FALSE)
+    {
+        if (isLegalChar(directArg[i]) == FALSE)
+            isDirectArgContainsIllegalChars = TRUE;
+        i++;
+    }
+
+    return isDirectArgContainsIllegalChars;
+}
+
+/* ---------------END OF REFERENCE PREDICATES--------------- */
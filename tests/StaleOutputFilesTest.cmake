@@ -0,0 +1,38 @@
+# @author Ofir Paz
+# @version (19/10/2026)
+#
+# StaleOutputFilesTest.cmake
+#
+# This file has the test of the output files of a source that is assembled again.
+# The .ent, .ext and .rel files are read with the .ob file (by the simulator and the linker),
+# so when the new assembly has no entries, externals or relocatable words, the files of the
+# earlier assembly should be removed and the program should run with its new .ob alone.
+#
+# Run with: cmake -DASSEMBLER=<mmn_14> -DSIMULATOR=<mmn_14_simulator> -DWORK_DIR=<dir> -P <this>
+
+set(SOURCE "${WORK_DIR}/stale")
+file(REMOVE_RECURSE "${WORK_DIR}")
+file(MAKE_DIRECTORY "${WORK_DIR}")
+
+# The first assembly has all the output files.
+file(WRITE "${SOURCE}.as" ".entry X\n.extern Y\nX: prn 3\n jmp Y\n jmp X\n")
+execute_process(COMMAND "${ASSEMBLER}" "${SOURCE}" OUTPUT_QUIET ERROR_QUIET)
+foreach(END .ob .ent .ext .rel)
+    if(NOT EXISTS "${SOURCE}${END}")
+        message(FATAL_ERROR "The first assembly did not create the ${END} file.")
+    endif()
+endforeach()
+
+# The second assembly has only the .ob file.
+file(WRITE "${SOURCE}.as" " prn 3\n stop\n")
+execute_process(COMMAND "${ASSEMBLER}" "${SOURCE}" OUTPUT_QUIET ERROR_QUIET)
+foreach(END .ent .ext .rel)
+    if(EXISTS "${SOURCE}${END}")
+        message(FATAL_ERROR "The ${END} file of the first assembly was left behind.")
+    endif()
+endforeach()
+
+execute_process(COMMAND "${SIMULATOR}" "${SOURCE}" RESULT_VARIABLE result OUTPUT_VARIABLE output)
+if(NOT result EQUAL 0 OR NOT output MATCHES "\n3\n")
+    message(FATAL_ERROR "The second assembly did not run alone:\n${output}")
+endif()
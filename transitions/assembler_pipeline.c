@@ -0,0 +1,351 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file has the pipeline of the first stages of the assembler.
+ * The pre-processor runs on its own thread and streams the lines of the .am file, while they are
+ * made, to a parser thread. The parser builds the AST of every line and streams it to the thread
+ * that reads the parsed lines (the label bookkeeping of the first transition).
+ * The stages pass their work through bounded lock-free queues, so a stage waits only when the
+ * next stage falls behind, or when the stage before it has nothing new yet.
+ *
+ * The lines are split the same way the first transition reads the .am file, so they get the
+ * same line numbers and the same ASTs.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "../new-data-types/boolean.h"
+#include "../new-data-types/process_result.h"
+#include "../new-data-types/error_count.h"
+#include "../NameTable/NameTable.h"
+#include "../SymbolTable/SymbolTable.h"
+#include "../assembler_ast/assembler_ast.h"
+#include "../general-enums/programFinals.h"
+#include "../general-enums/neededKeys.h"
+#include "../errors/error_types/error_types.h"
+#include "../errors/FirstTransitionErrors/FirstTransitionSyntaxScanner.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "../util/SpscQueue.h"
+#include "../util/traceUtil.h"
+#include "cross_reference.h"
+#include "macro_template.h"
+#include "pre-processor.h"
+#include "first_transition_util.h"
+#include "assembler_pipeline.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE TRANSITIONS_MEMORY /* For the memory statistics. */
+#define AM_PARTS_CAPACITY 256 /* The most .am parts the pre-processor is ahead of the parser. */
+#define PARSED_LINES_CAPACITY 256 /* The most ASTs the parser is ahead of the bookkeeping. */
+#define MAX_READ_LINE_LEN 81 /* A line of 80 chars and its new line char. */
+#define INCOMPLETE_LINE 0
+/* ------------ */
+
+/* A line of the .am file after the parser. */
+typedef struct
+{
+    ast_t *lineAst; /* The AST of the line, or NULL if there was an error in it. */
+    Error lineError; /* The error in the line, or NO_ERROR if there wasn't. */
+    int lineNumber; /* The number of the line in the .am file. */
+    char *errorLabel; /* The label of the line if there was an error in it, or NULL. */
+} parsed_line_t;
+
+struct AssemblerPipeline
+{
+    const char *file_name; /* The name of the source file. */
+    char *sourceText; /* The contents of the source file if they were read already, or NULL. */
+    CrossReference *xref; /* The cross reference of the pre-process, or NULL. */
+    MacroCalls *calls; /* The calls of the macros with parameters of the pre-process, or NULL. */
+    SpscQueue *amParts; /* The parts of the .am contents, from the pre-processor to the parser. */
+    SpscQueue *parsedLines; /* The parsed lines, from the parser to the reader. */
+    pthread_t preProcessThread;
+    pthread_t parseThread;
+    process_result preProcessResult; /* Set by the pre-process thread when it is done. */
+    error_count_t preProcessErrors; /* The lines with errors of the pre-process (its thread). */
+    boolean isParseDone; /* TRUE after the last parsed line was read. */
+};
+
+/* ---------------Prototypes--------------- */
+void *preProcessStage(void *pipeline);
+void *parseStage(void *pipeline);
+size_t parseStreamedLines(AssemblerPipeline *pipeline, const char *text, int *lineCount,
+                          boolean isEnd);
+size_t getStreamedLineLength(const char *text, boolean isEnd);
+void deletePipelineQueues(AssemblerPipeline *pipeline);
+/* ---------------------------------------- */
+
+/*
+ * Starts the pipeline of a source file: the pre-processor streams the lines of the .am file
+ * to the parser, and the parser streams the ASTs of the lines to readParsedLine.
+ *
+ * @param   *file_name  The name of the source file.
+ * @param   *sourceText The contents of the source file if they were read already (freed by
+ *                      the pipeline if it is started), or NULL to read the file.
+ * @param   *xref       The cross reference to record the macros in, or NULL (written by the
+ *                      pre-process thread until the pipeline is finished).
+ * @param   *calls      The calls of the macros with parameters to record, or NULL (recorded by
+ *                      the pre-process thread, every call before its lines are streamed).
+ * @param   maxErrors   The most lines with errors of the file, 0 for no cap.
+ *
+ * @return  Pointer to the started pipeline, or NULL if its threads could not be started.
+ */
+AssemblerPipeline *startAssemblerPipeline(const char *file_name, char *sourceText,
+                                          CrossReference *xref, MacroCalls *calls,
+                                          int maxErrors)
+{
+    AssemblerPipeline *pipeline = (AssemblerPipeline *) allocate_space(sizeof(AssemblerPipeline));
+
+    initSyntaxScanner(); /* The parser thread only reads the char class table. */
+
+    pipeline -> file_name = file_name;
+    pipeline -> sourceText = sourceText;
+    pipeline -> xref = xref;
+    pipeline -> calls = calls;
+    pipeline -> amParts = createSpscQueue(AM_PARTS_CAPACITY);
+    pipeline -> parsedLines = createSpscQueue(PARSED_LINES_CAPACITY);
+    pipeline -> preProcessResult = FAILURE;
+    pipeline -> preProcessErrors.errorsAmount = ZERO_COUNT;
+    pipeline -> preProcessErrors.maxErrors = maxErrors;
+    pipeline -> isParseDone = FALSE;
+
+    /* The parser starts first, the pre-processor can't finish without it. */
+    if (pthread_create(&pipeline -> parseThread, NULL, parseStage, pipeline) != 0)
+    {
+        deletePipelineQueues(pipeline);
+        (void) clear_ptr(pipeline)
+    }
+    else if (pthread_create(&pipeline -> preProcessThread, NULL, preProcessStage, pipeline) != 0)
+    {
+        pushToSpscQueue(pipeline -> amParts, NULL); /* Stop the parser. */
+        (void) popFromSpscQueue(pipeline -> parsedLines);
+        (void) pthread_join(pipeline -> parseThread, NULL);
+
+        deletePipelineQueues(pipeline);
+        (void) clear_ptr(pipeline)
+    }
+
+    return pipeline;
+}
+
+/*
+ * Reads the next parsed line of the .am file, waits until the parser is done with it.
+ *
+ * @param   *pipeline       The pipeline.
+ * @param   **lineAst       Will hold the AST of the line, or NULL if there was an error in it.
+ * @param   *lineError      Will hold the error in the line, or NO_ERROR if there wasn't.
+ * @param   *lineNumber     Will hold the number of the line in the .am file.
+ * @param   **errorLabel    Will hold the label of the line if there was an error in it (needs
+ *                          to be freed), or NULL.
+ *
+ * @return  TRUE if a line was read, FALSE if there are no more lines.
+ */
+boolean readParsedLine(AssemblerPipeline *pipeline, ast_t **lineAst, Error *lineError,
+                       int *lineNumber, char **errorLabel)
+{
+    parsed_line_t *parsedLine = (pipeline -> isParseDone == FALSE)?
+            (parsed_line_t *) popFromSpscQueue(pipeline -> parsedLines) : NULL;
+
+    if (parsedLine == NULL) /* The parser is done. */
+        pipeline -> isParseDone = TRUE;
+    else
+    {
+        *lineAst = parsedLine -> lineAst;
+        *lineError = parsedLine -> lineError;
+        *lineNumber = parsedLine -> lineNumber;
+        *errorLabel = parsedLine -> errorLabel;
+        (void) clear_ptr(parsedLine)
+    }
+
+    return (pipeline -> isParseDone == FALSE)? TRUE : FALSE;
+}
+
+/*
+ * Waits for the threads of the pipeline to finish and deletes it.
+ *
+ * @param   **pPipeline     Pointer to the pipeline.
+ * @param   *errors         The count of the lines with errors of the file, the lines with
+ *                          errors of the pre-process are added to it.
+ *
+ * @return  The result of the pre-process of the file.
+ */
+process_result finishAssemblerPipeline(AssemblerPipeline **pPipeline, error_count_t *errors)
+{
+    AssemblerPipeline *pipeline = *pPipeline;
+    process_result preProcessResult;
+    ast_t *lineAst;
+    Error lineError;
+    int lineNumber;
+    char *errorLabel;
+
+    /* Drop the lines that were not read, so the parser is not stuck on a full queue. */
+    while (readParsedLine(pipeline, &lineAst, &lineError, &lineNumber, &errorLabel) == TRUE)
+    {
+        deleteAst(&lineAst);
+        (void) free_ptr(errorLabel);
+    }
+
+    (void) pthread_join(pipeline -> parseThread, NULL);
+    (void) pthread_join(pipeline -> preProcessThread, NULL);
+    preProcessResult = pipeline -> preProcessResult;
+    errors -> errorsAmount += pipeline -> preProcessErrors.errorsAmount;
+
+    deletePipelineQueues(pipeline);
+    (void) clear_ptr(*pPipeline)
+
+    return preProcessResult;
+}
+
+/*
+ * The pre-process thread, pre-processes the file and streams the .am contents.
+ *
+ * @param   *pipeline   The pipeline.
+ *
+ * @return  NULL.
+ */
+void *preProcessStage(void *pipeline)
+{
+    AssemblerPipeline *assemblerPipeline = (AssemblerPipeline *) pipeline;
+
+    assemblerPipeline -> preProcessResult = pre_process(assemblerPipeline -> file_name,
+                                                        assemblerPipeline -> sourceText,
+                                                        assemblerPipeline -> amParts, NULL,
+                                                        assemblerPipeline -> xref,
+                                                        assemblerPipeline -> calls,
+                                                        &assemblerPipeline -> preProcessErrors);
+
+    endTraceThread();
+    return NULL;
+}
+
+/*
+ * The parser thread, splits the streamed .am contents to lines and parses every line.
+ *
+ * @param   *pipeline   The pipeline.
+ *
+ * @return  NULL.
+ */
+void *parseStage(void *pipeline)
+{
+    AssemblerPipeline *assemblerPipeline = (AssemblerPipeline *) pipeline;
+    char *text = NULL; /* The streamed contents that were not parsed yet. */
+    char *part; /* The current streamed part. */
+    char *restOfText;
+    size_t parsedLength;
+    int lineCount = ZERO_COUNT;
+    trace_span_t span;
+
+    beginTraceSpan(&span, "parse", assemblerPipeline -> file_name);
+
+    while ((part = (char *) popFromSpscQueue(assemblerPipeline -> amParts)) != NULL)
+    {
+        if (text == NULL)
+            text = part;
+        else /* A line was split between the parts. */
+        {
+            addTwoStrings(&text, part);
+            (void) clear_ptr(part)
+        }
+
+        /* Parse the complete lines, and keep the start of the last one for the next part. */
+        parsedLength = parseStreamedLines(assemblerPipeline, text, &lineCount, FALSE);
+        if (text[parsedLength] == '\0')
+        {
+            (void) clear_ptr(text)
+        }
+        else if (parsedLength > 0)
+        {
+            restOfText = strcpyPart(text, (int) parsedLength, (int) strlen(text));
+            (void) clear_ptr(text)
+            text = restOfText;
+        }
+    }
+
+    if (text != NULL) /* The last line has no new line char. */
+    {
+        (void) parseStreamedLines(assemblerPipeline, text, &lineCount, TRUE);
+        (void) clear_ptr(text)
+    }
+
+    pushToSpscQueue(assemblerPipeline -> parsedLines, NULL); /* No more lines. */
+
+    endTraceSpan(&span);
+    endTraceThread();
+    return NULL;
+}
+
+/*
+ * Parses the complete lines of the streamed text and pushes them to the parsed lines queue.
+ *
+ * @param   *pipeline       The pipeline.
+ * @param   *text           The text.
+ * @param   *lineCount      The number of the last parsed line.
+ * @param   isEnd           TRUE if no more text will be streamed.
+ *
+ * @return  The length of the start of the text that was parsed.
+ */
+size_t parseStreamedLines(AssemblerPipeline *pipeline, const char *text, int *lineCount,
+                          boolean isEnd)
+{
+    size_t lineStart = 0, lineLength;
+    parsed_line_t *parsedLine;
+    char *line;
+
+    while (text[lineStart] != '\0' &&
+           (lineLength = getStreamedLineLength(text + lineStart, isEnd)) != INCOMPLETE_LINE)
+    {
+        line = strcpyPart(text, (int) lineStart, (int) (lineStart + lineLength));
+        lineStart += lineLength;
+
+        parsedLine = (parsed_line_t *) allocate_space(sizeof(parsed_line_t));
+        parsedLine -> lineAst = buildAstFromLine(line, &parsedLine -> lineError);
+        parsedLine -> lineNumber = ++(*lineCount);
+        parsedLine -> errorLabel = (parsedLine -> lineAst == NULL)?
+                getLabelOfErrorLine(line) : NULL;
+        (void) clear_ptr(line)
+
+        pushToSpscQueue(pipeline -> parsedLines, parsedLine);
+    }
+
+    return lineStart;
+}
+
+/*
+ * Gets the length of the line at the start of a streamed text.
+ * A longer line is read in parts, the same as the first transition reads the .am file.
+ *
+ * @param   *text       The text.
+ * @param   isEnd       TRUE if no more text will be streamed.
+ *
+ * @return  The length of the line (with its new line char), or INCOMPLETE_LINE if the end of
+ *          the line was not streamed yet.
+ */
+size_t getStreamedLineLength(const char *text, boolean isEnd)
+{
+    size_t length = 0;
+
+    while (length < MAX_READ_LINE_LEN && text[length] != '\0' && text[length] != ENTER_KEY)
+        length++;
+
+    if (length < MAX_READ_LINE_LEN && text[length] == ENTER_KEY)
+        length++; /* With the new line. */
+    else if (length < MAX_READ_LINE_LEN && isEnd == FALSE)
+        length = INCOMPLETE_LINE;
+
+    return length;
+}
+
+/*
+ * Deletes the queues of a pipeline.
+ *
+ * @param   *pipeline   The pipeline.
+ */
+void deletePipelineQueues(AssemblerPipeline *pipeline)
+{
+    deleteSpscQueue(&pipeline -> amParts);
+    deleteSpscQueue(&pipeline -> parsedLines);
+}
@@ -0,0 +1,64 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the assembler_pipeline.c file.
+ */
+
+#ifndef MMN_14_ASSEMBLER_PIPELINE_H
+#define MMN_14_ASSEMBLER_PIPELINE_H
+
+/* AssemblerPipeline data type - the pre-process and the parse of a file, on their own threads. */
+typedef struct AssemblerPipeline AssemblerPipeline;
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Starts the pipeline of a source file: the pre-processor streams the lines of the .am file
+ * to the parser, and the parser streams the ASTs of the lines to readParsedLine.
+ *
+ * @param   *file_name  The name of the source file.
+ * @param   *sourceText The contents of the source file if they were read already (freed by
+ *                      the pipeline if it is started), or NULL to read the file.
+ * @param   *xref       The cross reference to record the macros in, or NULL (written by the
+ *                      pre-process thread until the pipeline is finished).
+ * @param   *calls      The calls of the macros with parameters to record, or NULL (recorded by
+ *                      the pre-process thread, every call before its lines are streamed).
+ * @param   maxErrors   The most lines with errors of the file, 0 for no cap (the pre-process
+ *                      counts its own lines with errors, on its thread).
+ *
+ * @return  Pointer to the started pipeline, or NULL if its threads could not be started.
+ */
+AssemblerPipeline *startAssemblerPipeline(const char *file_name, char *sourceText,
+                                          CrossReference *xref, MacroCalls *calls,
+                                          int maxErrors);
+
+/*
+ * Reads the next parsed line of the .am file, waits until the parser is done with it.
+ *
+ * @param   *pipeline       The pipeline.
+ * @param   **lineAst       Will hold the AST of the line, or NULL if there was an error in it.
+ * @param   *lineError      Will hold the error in the line, or NO_ERROR if there wasn't.
+ * @param   *lineNumber     Will hold the number of the line in the .am file.
+ * @param   **errorLabel    Will hold the label of the line if there was an error in it (needs
+ *                          to be freed), or NULL.
+ *
+ * @return  TRUE if a line was read, FALSE if there are no more lines.
+ */
+boolean readParsedLine(AssemblerPipeline *pipeline, ast_t **lineAst, Error *lineError,
+                       int *lineNumber, char **errorLabel);
+
+/*
+ * Waits for the threads of the pipeline to finish and deletes it.
+ *
+ * @param   **pPipeline     Pointer to the pipeline.
+ * @param   *errors         The count of the lines with errors of the file, the lines with
+ *                          errors of the pre-process are added to it.
+ *
+ * @return  The result of the pre-process of the file.
+ */
+process_result finishAssemblerPipeline(AssemblerPipeline **pPipeline, error_count_t *errors);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_ASSEMBLER_PIPELINE_H */
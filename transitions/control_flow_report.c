@@ -0,0 +1,557 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * control_flow_report.c
+ *
+ * This file implements the control flow report of the assembler (option -C).
+ *
+ * The code of the file is split to basic blocks: a block starts at the first instruction, at an
+ * instruction with a label, at the destination of a jump and after 'jmp', 'bne', 'jsr', 'rts' and
+ * 'stop', and the blocks are linked to a control flow graph by the jumps and the fall through.
+ * A 'jsr' is linked to the subroutine and to the instruction after it (where 'rts' returns to).
+ *
+ * The cost of an instruction is estimated by the cost model:
+ *      one cycle for every word fetched, one cycle for every memory (label) operand,
+ *      and the cycles of the operation itself (in the instruction set list, isa.h).
+ * The report (the .cfg file) has the words and the cycles of every block, of the code of every
+ * label (until the next label) and of one iteration of every loop (found by the back edges of
+ * the graph).
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <stddef.h>
+#include "../new-data-types/boolean.h"
+#include "../SymbolTable/SymbolTable.h"
+#include "../assembler_ast/assembler_ast.h"
+#include "../FileHandling/writeToFile.h"
+#include "../general-enums/assemblerFinals.h"
+#include "../general-enums/indexes.h"
+#include "../general-enums/programFinals.h"
+#include "../errors/error_types/error_types.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "first_transition_util.h"
+#include "control_flow_report.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE TRANSITIONS_MEMORY /* For the memory statistics. */
+#define CFG_END ".cfg"
+#define BUFFER 128
+#define MAX_SUCCESSORS 2
+#define NONE (-1)
+#define FETCH_CYCLES 1 /* For every word of an instruction. */
+#define MEMORY_OPERAND_CYCLES 1 /* For every label operand. */
+/* ------------ */
+
+/* ---Macros--- */
+#define OPERATION_CYCLES_ENTRY(name, srcMethods, destMethods, cycles) cycles,
+/* ------------ */
+
+/* The state of a block in the search of the loops. */
+typedef enum {NOT_VISITED, IN_PATH, VISITED} visit_state_t;
+
+/* An instruction of the code. */
+typedef struct
+{
+    ast_t *lineAst;
+    int address;
+    int words;
+    int cycles;
+} instruction_info_t;
+
+/* A basic block, instructions that always run one after the other. */
+typedef struct
+{
+    int first, last; /* The indexes of the first and the last instructions of the block. */
+    int words;
+    int cycles;
+    int successors[MAX_SUCCESSORS]; /* The blocks the program can continue to. */
+    int successorsAmount;
+    boolean isUnknownJump; /* Jumps to a register or to an external label. */
+} basic_block_t;
+
+/* The control flow graph of the code. */
+typedef struct
+{
+    instruction_info_t *instructions;
+    int instructionsAmount;
+    int *instructionAtAddress; /* The instruction that starts in every address of the code. */
+    basic_block_t *blocks;
+    int blocksAmount;
+    int *blockOfInstruction;
+} control_flow_t;
+
+/* The cycles of the operations, by the opcodes. */
+static const int operationCycles[OPCODE_AMOUNT] = {ISA_OPERATIONS(OPERATION_CYCLES_ENTRY)};
+
+/* ---------------Prototypes--------------- */
+void collectInstructions(control_flow_t *cfg, ast_list_t *astList);
+int estimateInstructionCycles(ast_t *lineAst, int words);
+void buildBasicBlocks(control_flow_t *cfg, SymbolTable *symbols);
+void linkBasicBlock(control_flow_t *cfg, int blockIndex, SymbolTable *symbols);
+void addSuccessor(basic_block_t *block, int successor);
+int findJumpTarget(const control_flow_t *cfg, ast_t *lineAst, SymbolTable *symbols);
+boolean isEndingBlock(ast_t *lineAst);
+void addBlocksToReport(char **report, const control_flow_t *cfg);
+void addLabelsToReport(char **report, const control_flow_t *cfg);
+void addLoopsToReport(char **report, const control_flow_t *cfg);
+void addLoopToReport(char **report, const control_flow_t *cfg, int header, int tail);
+void addBlockNameToReport(char **report, const control_flow_t *cfg, int blockIndex);
+void deleteControlFlow(control_flow_t *cfg);
+/* ---------------------------------------- */
+
+/*
+ * Builds the basic blocks and the control flow graph of the code of the file, and writes
+ * a report of the words and the estimated cycles of every block, label and loop (in the
+ * .cfg file).
+ * Assumes that the file was assembled successfully !!
+ *
+ * @param   *file_name      The name of the source file.
+ * @param   *astList        The list of ASTs of the file.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ */
+void createControlFlowReport(const char *file_name, ast_list_t *astList, SymbolTable *symbols)
+{
+    control_flow_t cfg;
+    char *report = NULL;
+
+    collectInstructions(&cfg, astList);
+    buildBasicBlocks(&cfg, symbols);
+
+    addTwoStrings(&report, "; Cost model: 1 cycle for every word, 1 cycle for every label "
+                           "operand and the cycles of the operation.\n");
+    addBlocksToReport(&report, &cfg);
+    addLabelsToReport(&report, &cfg);
+    addLoopsToReport(&report, &cfg);
+
+    writeToFile(file_name, CFG_END, report);
+
+    (void) clear_ptr(report)
+    deleteControlFlow(&cfg);
+}
+
+/*
+ * Collects the instructions of the list of ASTs with their addresses and costs.
+ *
+ * @param   *cfg        The control flow graph, the instructions are set in it.
+ * @param   *astList    The list of ASTs.
+ */
+void collectInstructions(control_flow_t *cfg, ast_list_t *astList)
+{
+    int codeSize = *getCounterPointer(astList, IC_) - PROGRAM_MEM_START;
+    int address = PROGRAM_MEM_START, i = ZERO_INDEX;
+    ast_list_node_t *currNode;
+
+    cfg -> instructions = NULL;
+    cfg -> instructionAtAddress = NULL;
+    if (codeSize > ZERO_COUNT)
+    {
+        cfg -> instructions = (instruction_info_t *) allocate_space(codeSize *
+                                                                    sizeof(instruction_info_t));
+        cfg -> instructionAtAddress = (int *) allocate_space(codeSize * sizeof(int));
+    }
+
+    for (currNode = getAstHead(astList); currNode != NULL; currNode = getNextAstNode(currNode))
+        if (getSentence(getAst(currNode)).sentenceType == DIRECTION_SENTENCE)
+        {
+            cfg -> instructions[i].lineAst = getAst(currNode);
+            cfg -> instructions[i].address = address;
+            cfg -> instructions[i].words = howManyWordsForInstruction(getAst(currNode));
+            cfg -> instructions[i].cycles =
+                    estimateInstructionCycles(getAst(currNode), cfg -> instructions[i].words);
+
+            /* Only the first word of an instruction starts it. */
+            cfg -> instructionAtAddress[address - PROGRAM_MEM_START] = i;
+            for (address++; address < cfg -> instructions[i].address +
+                                      cfg -> instructions[i].words; address++)
+                cfg -> instructionAtAddress[address - PROGRAM_MEM_START] = NONE;
+            i++;
+        }
+
+    cfg -> instructionsAmount = i;
+}
+
+/*
+ * Estimates the cycles of an instruction by the cost model.
+ *
+ * @param   *lineAst    The AST of the instruction.
+ * @param   words       The amount of words of the instruction.
+ *
+ * @return  The estimated cycles of the instruction.
+ */
+int estimateInstructionCycles(ast_t *lineAst, int words)
+{
+    int cycles = words * FETCH_CYCLES + operationCycles[getOpcodeFromAST(lineAst)];
+    arg_node_t *currArg;
+
+    for (currArg = getArgList(lineAst); currArg != NULL; currArg = getNextNode(currArg))
+        if (getArgAddressingMethod(currArg) == DIRECT)
+            cycles += MEMORY_OPERAND_CYCLES;
+
+    return cycles;
+}
+
+/*
+ * Splits the instructions to basic blocks and links the blocks.
+ *
+ * @param   *cfg        The control flow graph, with the instructions.
+ * @param   *symbols    The table of the symbols (labels) of the file.
+ */
+void buildBasicBlocks(control_flow_t *cfg, SymbolTable *symbols)
+{
+    boolean *isLeader = NULL; /* Is the instruction the first of a block. */
+    int i, target;
+
+    cfg -> blocks = NULL;
+    cfg -> blockOfInstruction = NULL;
+    cfg -> blocksAmount = ZERO_COUNT;
+    if (cfg -> instructionsAmount == ZERO_COUNT)
+        return;
+
+    isLeader = (boolean *) allocate_space(cfg -> instructionsAmount * sizeof(boolean));
+    for (i = ZERO_INDEX; i < cfg -> instructionsAmount; i++)
+        isLeader[i] = (i == ZERO_INDEX || isLabel(cfg -> instructions[i].lineAst) == TRUE ||
+                       isEndingBlock(cfg -> instructions[i - 1].lineAst) == TRUE)? TRUE : FALSE;
+
+    for (i = ZERO_INDEX; i < cfg -> instructionsAmount; i++)
+        if ((target = findJumpTarget(cfg, cfg -> instructions[i].lineAst, symbols)) != NONE)
+            isLeader[target] = TRUE;
+
+    cfg -> blocks = (basic_block_t *) allocate_space(cfg -> instructionsAmount *
+                                                     sizeof(basic_block_t));
+    cfg -> blockOfInstruction = (int *) allocate_space(cfg -> instructionsAmount * sizeof(int));
+    for (i = ZERO_INDEX; i < cfg -> instructionsAmount; i++)
+    {
+        if (isLeader[i] == TRUE)
+        {
+            cfg -> blocks[cfg -> blocksAmount].first = i;
+            cfg -> blocks[cfg -> blocksAmount].words = ZERO_COUNT;
+            cfg -> blocks[cfg -> blocksAmount].cycles = ZERO_COUNT;
+            cfg -> blocksAmount++;
+        }
+
+        cfg -> blocks[cfg -> blocksAmount - 1].last = i;
+        cfg -> blocks[cfg -> blocksAmount - 1].words += cfg -> instructions[i].words;
+        cfg -> blocks[cfg -> blocksAmount - 1].cycles += cfg -> instructions[i].cycles;
+        cfg -> blockOfInstruction[i] = cfg -> blocksAmount - 1;
+    }
+
+    for (i = ZERO_INDEX; i < cfg -> blocksAmount; i++)
+        linkBasicBlock(cfg, i, symbols);
+
+    (void) clear_ptr(isLeader)
+}
+
+/*
+ * Finds the blocks the program can continue to after a block.
+ *
+ * @param   *cfg            The control flow graph.
+ * @param   blockIndex      The index of the block.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ */
+void linkBasicBlock(control_flow_t *cfg, int blockIndex, SymbolTable *symbols)
+{
+    basic_block_t *block = &cfg -> blocks[blockIndex];
+    ast_t *lastAst = cfg -> instructions[block -> last].lineAst;
+    int target = findJumpTarget(cfg, lastAst, symbols);
+    opcodes_t opcode = getOpcodeFromAST(lastAst);
+
+    block -> successorsAmount = ZERO_COUNT;
+    block -> isUnknownJump = FALSE;
+
+    if (opcode == jmp || opcode == bne || opcode == jsr)
+    {
+        if (target != NONE)
+            addSuccessor(block, cfg -> blockOfInstruction[target]);
+        else
+            block -> isUnknownJump = TRUE;
+    }
+
+    /* Fall through (a subroutine returns to the instruction after the 'jsr'). */
+    if (opcode != jmp && opcode != rts && opcode != stop && blockIndex + 1 < cfg -> blocksAmount)
+        addSuccessor(block, blockIndex + 1);
+}
+
+/*
+ * Adds a successor to a block (if it is not a successor already).
+ *
+ * @param   *block      The block.
+ * @param   successor   The index of the successor block.
+ */
+void addSuccessor(basic_block_t *block, int successor)
+{
+    if (block -> successorsAmount == ZERO_COUNT || block -> successors[ZERO_INDEX] != successor)
+        block -> successors[block -> successorsAmount++] = successor;
+}
+
+/*
+ * Finds the instruction a jump goes to (for 'jmp', 'bne' and 'jsr' to a label of the file).
+ *
+ * @param   *cfg        The control flow graph.
+ * @param   *lineAst    The AST of the instruction.
+ * @param   *symbols    The table of the symbols (labels) of the file.
+ *
+ * @return  The index of the instruction the jump goes to, or NONE if the instruction is not
+ *          a jump or its destination is not known in the file.
+ */
+int findJumpTarget(const control_flow_t *cfg, ast_t *lineAst, SymbolTable *symbols)
+{
+    opcodes_t opcode = getOpcodeFromAST(lineAst);
+    arg_node_t *destArg = getArgList(lineAst);
+    const symbol_t *label;
+    int target = NONE; /* Value to return. */
+
+    if ((opcode == jmp || opcode == bne || opcode == jsr) &&
+        getArgAddressingMethod(destArg) == DIRECT)
+    {
+        label = findSymbol(symbols, getArgData(destArg).data.string);
+        if (label != NULL && (label -> flags & SYMBOL_DEFINED) &&
+            label -> section == CODE_SECTION && label -> value >= PROGRAM_MEM_START &&
+            label -> value < cfg -> instructions[cfg -> instructionsAmount - 1].address +
+                             cfg -> instructions[cfg -> instructionsAmount - 1].words)
+            target = cfg -> instructionAtAddress[label -> value - PROGRAM_MEM_START];
+    }
+
+    return target;
+}
+
+/*
+ * Checks if an instruction ends a basic block.
+ *
+ * @param   *lineAst    The AST of the instruction.
+ *
+ * @return  TRUE if the instruction is 'jmp', 'bne', 'jsr', 'rts' or 'stop', otherwise FALSE.
+ */
+boolean isEndingBlock(ast_t *lineAst)
+{
+    opcodes_t opcode = getOpcodeFromAST(lineAst);
+
+    return (opcode == jmp || opcode == bne || opcode == jsr || opcode == rts ||
+            opcode == stop)? TRUE : FALSE;
+}
+
+/*
+ * Adds the blocks to the report, a line for every block in the format
+ * {name [tab] addresses [tab] words [tab] cycles [tab] -> successors [new line]}.
+ *
+ * @param   **report    Pointer to the string of the report.
+ * @param   *cfg        The control flow graph.
+ */
+void addBlocksToReport(char **report, const control_flow_t *cfg)
+{
+    const basic_block_t *block;
+    char reportLine[BUFFER];
+    int i, j;
+
+    addTwoStrings(report, "\n; Blocks: name, addresses, words, cycles and successors.\n");
+    for (i = ZERO_INDEX; i < cfg -> blocksAmount; i++)
+    {
+        block = &cfg -> blocks[i];
+        addBlockNameToReport(report, cfg, i);
+        (void) sprintf(reportLine, "\t%d-%d\t%d\t%d\t->",
+                       cfg -> instructions[block -> first].address,
+                       cfg -> instructions[block -> last].address +
+                       cfg -> instructions[block -> last].words - 1,
+                       block -> words, block -> cycles);
+        addTwoStrings(report, reportLine);
+
+        for (j = ZERO_INDEX; j < block -> successorsAmount; j++)
+        {
+            addTwoStrings(report, " ");
+            addBlockNameToReport(report, cfg, block -> successors[j]);
+        }
+        addTwoStrings(report, (block -> isUnknownJump == TRUE)? " ?\n" : "\n");
+    }
+}
+
+/*
+ * Adds the code of the labels to the report (the blocks from a label until the next label),
+ * a line for every label in the format {label [tab] address [tab] words [tab] cycles [new line]}.
+ *
+ * @param   **report    Pointer to the string of the report.
+ * @param   *cfg        The control flow graph.
+ */
+void addLabelsToReport(char **report, const control_flow_t *cfg)
+{
+    char reportLine[BUFFER];
+    int i, lastBlock, words, cycles;
+    char *labelName;
+
+    addTwoStrings(report, "\n; Labels: label, address, words and cycles until the next label.\n");
+    for (i = ZERO_INDEX; i < cfg -> blocksAmount; i = lastBlock)
+    {
+        words = cfg -> blocks[i].words;
+        cycles = cfg -> blocks[i].cycles;
+        for (lastBlock = i + 1; lastBlock < cfg -> blocksAmount &&
+             isLabel(cfg -> instructions[cfg -> blocks[lastBlock].first].lineAst) == FALSE;
+             lastBlock++)
+        {
+            words += cfg -> blocks[lastBlock].words;
+            cycles += cfg -> blocks[lastBlock].cycles;
+        }
+
+        if (isLabel(cfg -> instructions[cfg -> blocks[i].first].lineAst) == TRUE)
+        {
+            labelName = getLabelName(cfg -> instructions[cfg -> blocks[i].first].lineAst);
+            (void) sprintf(reportLine, "%s\t%d\t%d\t%d\n", labelName,
+                           cfg -> instructions[cfg -> blocks[i].first].address, words, cycles);
+            addTwoStrings(report, reportLine);
+            (void) clear_ptr(labelName)
+        }
+    }
+}
+
+/*
+ * Finds the loops of the code (the back edges of a depth first search on the graph),
+ * and adds them to the report.
+ *
+ * @param   **report    Pointer to the string of the report.
+ * @param   *cfg        The control flow graph.
+ */
+void addLoopsToReport(char **report, const control_flow_t *cfg)
+{
+    visit_state_t *states;
+    int *pathBlocks, *nextSuccessors; /* The path of the search. */
+    int pathLength, root, block, successor;
+
+    addTwoStrings(report, "\n; Loops: header, back edge, blocks, words and cycles of an "
+                          "iteration.\n");
+    if (cfg -> blocksAmount == ZERO_COUNT)
+        return;
+
+    states = (visit_state_t *) allocate_space(cfg -> blocksAmount * sizeof(visit_state_t));
+    pathBlocks = (int *) allocate_space(cfg -> blocksAmount * sizeof(int));
+    nextSuccessors = (int *) allocate_space(cfg -> blocksAmount * sizeof(int));
+    for (block = ZERO_INDEX; block < cfg -> blocksAmount; block++)
+        states[block] = NOT_VISITED;
+
+    for (root = ZERO_INDEX; root < cfg -> blocksAmount; root++)
+    {
+        if (states[root] != NOT_VISITED)
+            continue;
+
+        states[root] = IN_PATH;
+        pathBlocks[ZERO_INDEX] = root;
+        nextSuccessors[ZERO_INDEX] = ZERO_INDEX;
+        pathLength = 1;
+        while (pathLength > ZERO_COUNT)
+        {
+            block = pathBlocks[pathLength - 1];
+            if (nextSuccessors[pathLength - 1] < cfg -> blocks[block].successorsAmount)
+            {
+                successor = cfg -> blocks[block].successors[nextSuccessors[pathLength - 1]++];
+                if (states[successor] == IN_PATH) /* A back edge closes a loop. */
+                    addLoopToReport(report, cfg, successor, block);
+                else if (states[successor] == NOT_VISITED)
+                {
+                    states[successor] = IN_PATH;
+                    pathBlocks[pathLength] = successor;
+                    nextSuccessors[pathLength] = ZERO_INDEX;
+                    pathLength++;
+                }
+            }
+            else
+            {
+                states[block] = VISITED;
+                pathLength--;
+            }
+        }
+    }
+
+    (void) clear_ptr(nextSuccessors)
+    (void) clear_ptr(pathBlocks)
+    (void) clear_ptr(states)
+}
+
+/*
+ * Adds a loop to the report. The loop is the header and all the blocks that get to the tail
+ * (the block of the back edge) without passing through the header.
+ *
+ * @param   **report    Pointer to the string of the report.
+ * @param   *cfg        The control flow graph.
+ * @param   header      The index of the first block of the loop.
+ * @param   tail        The index of the block that jumps back to the header.
+ */
+void addLoopToReport(char **report, const control_flow_t *cfg, int header, int tail)
+{
+    boolean *isInLoop = (boolean *) allocate_space(cfg -> blocksAmount * sizeof(boolean));
+    int *pending = (int *) allocate_space(cfg -> blocksAmount * sizeof(int));
+    int pendingAmount = ZERO_COUNT, blocksAmount = 1, words, cycles, block, i, j;
+    char reportLine[BUFFER];
+
+    for (i = ZERO_INDEX; i < cfg -> blocksAmount; i++)
+        isInLoop[i] = FALSE;
+    isInLoop[header] = TRUE;
+    words = cfg -> blocks[header].words;
+    cycles = cfg -> blocks[header].cycles;
+
+    if (tail != header)
+        pending[pendingAmount++] = tail;
+    while (pendingAmount > ZERO_COUNT) /* Go backwards from the tail to the header. */
+    {
+        block = pending[--pendingAmount];
+        if (isInLoop[block] == TRUE)
+            continue;
+
+        isInLoop[block] = TRUE;
+        blocksAmount++;
+        words += cfg -> blocks[block].words;
+        cycles += cfg -> blocks[block].cycles;
+        for (i = ZERO_INDEX; i < cfg -> blocksAmount; i++)
+            for (j = ZERO_INDEX; j < cfg -> blocks[i].successorsAmount; j++)
+                if (cfg -> blocks[i].successors[j] == block && isInLoop[i] == FALSE)
+                    pending[pendingAmount++] = i;
+    }
+
+    addBlockNameToReport(report, cfg, header);
+    addTwoStrings(report, "\t<- ");
+    addBlockNameToReport(report, cfg, tail);
+    (void) sprintf(reportLine, "\t%d\t%d\t%d\n", blocksAmount, words, cycles);
+    addTwoStrings(report, reportLine);
+
+    (void) clear_ptr(pending)
+    (void) clear_ptr(isInLoop)
+}
+
+/*
+ * Adds the name of a block to the report, its label if it starts with one, otherwise
+ * B{index of the block}.
+ *
+ * @param   **report        Pointer to the string of the report.
+ * @param   *cfg            The control flow graph.
+ * @param   blockIndex      The index of the block.
+ */
+void addBlockNameToReport(char **report, const control_flow_t *cfg, int blockIndex)
+{
+    ast_t *firstAst = cfg -> instructions[cfg -> blocks[blockIndex].first].lineAst;
+    char blockName[BUFFER];
+    char *labelName;
+
+    if (isLabel(firstAst) == TRUE)
+    {
+        labelName = getLabelName(firstAst);
+        addTwoStrings(report, labelName);
+        (void) clear_ptr(labelName)
+    }
+    else
+    {
+        (void) sprintf(blockName, "B%d", blockIndex);
+        addTwoStrings(report, blockName);
+    }
+}
+
+/*
+ * Frees the memory of the control flow graph.
+ *
+ * @param   *cfg    The control flow graph.
+ */
+void deleteControlFlow(control_flow_t *cfg)
+{
+    (void) clear_ptr(cfg -> blockOfInstruction)
+    (void) clear_ptr(cfg -> blocks)
+    (void) clear_ptr(cfg -> instructionAtAddress)
+    (void) clear_ptr(cfg -> instructions)
+}
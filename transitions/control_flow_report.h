@@ -0,0 +1,27 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the control_flow_report.c file.
+ */
+
+#ifndef MMN_14_CONTROL_FLOW_REPORT_H
+#define MMN_14_CONTROL_FLOW_REPORT_H
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Builds the basic blocks and the control flow graph of the code of the file, and writes
+ * a report of the words and the estimated cycles of every block, label and loop (in the
+ * .cfg file).
+ * Assumes that the file was assembled successfully !!
+ *
+ * @param   *file_name      The name of the source file.
+ * @param   *astList        The list of ASTs of the file.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ */
+void createControlFlowReport(const char *file_name, ast_list_t *astList, SymbolTable *symbols);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_CONTROL_FLOW_REPORT_H */
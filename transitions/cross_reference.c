@@ -0,0 +1,424 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * cross_reference.c
+ *
+ * This file implements the cross reference of the assembler (option --xref).
+ *
+ * The passes of the assembler record the names they meet on the way: the pre-processor records
+ * the definitions and the calls of the macros, and the second transition records the labels
+ * that are arguments of the lines. The definitions of the labels are already in the table of
+ * the symbols, so the file is made without any extra scan of the source.
+ *
+ * The .xref file has a line for every macro and label in the format
+ *      {name [tab] type [tab] line [tab] address [tab] uses [new line]}
+ * where the type is code, data, extern or macro, and the uses are the lines of the uses
+ * (separated by commas). A missing field is '-'. The lines of the macros are lines of the .as
+ * file, and the lines of the labels are lines of the .am file (as in the errors).
+ * The lines are sorted by the bytes of the names (the comment line at the start sorts first),
+ * so a name can be found by a binary search on the offsets of the file (like look(1) does).
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../new-data-types/boolean.h"
+#include "../SymbolTable/SymbolTable.h"
+#include "../assembler_ast/assembler_ast.h"
+#include "../FileHandling/fileHelpMethods.h"
+#include "../general-enums/programFinals.h"
+#include "../general-enums/indexes.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "../util/traceUtil.h"
+#include "cross_reference.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE TRANSITIONS_MEMORY /* For the memory statistics. */
+#define XREF_END ".xref"
+#define WRITE_MODE "w"
+#define MIN_CAPACITY 16
+#define NO_VALUE (-1) /* A line or an address that is not known (written as '-'). */
+#define MISSING_FIELD "-"
+#define XREF_HEADER "; name\ttype\tline\taddress\tuses (the lines of the macros are of the .as " \
+                    "file, of the labels of the .am file)\n"
+/* ------------ */
+
+/* The kind of a name (a macro and a label can have the same name). */
+typedef enum {LABEL_NAME, MACRO_NAME} name_kind_t;
+
+/* A recorded definition or use of a name. */
+typedef struct
+{
+    char *name;
+    name_kind_t kind;
+    int lineNumber;
+} reference_t;
+
+/* A growing array of references. */
+typedef struct
+{
+    reference_t *references;
+    int size;
+    int capacity;
+} reference_array_t;
+
+/* CrossReference data type. */
+struct CrossReference
+{
+    reference_array_t definitions; /* Of the macros (the labels are in the table of symbols). */
+    reference_array_t uses;
+};
+
+/* A line of the .xref file (without the uses). */
+typedef struct
+{
+    const char *name;
+    name_kind_t kind;
+    const char *type;
+    int lineNumber;
+    int address;
+} xref_entry_t;
+
+/* ---------------Prototypes--------------- */
+void addReference(reference_array_t *array, const char *name, name_kind_t kind, int lineNumber);
+xref_entry_t *getCrossReferenceEntries(const CrossReference *xref, const SymbolTable *symbols,
+                                       int *entriesAmount);
+void writeCrossReferenceLines(FILE *xrefFile, const xref_entry_t *entries, int entriesAmount,
+                              const reference_array_t *uses);
+void writeNumberField(FILE *xrefFile, int number);
+int compareNames(const char *firstName, name_kind_t firstKind, const char *secondName,
+                 name_kind_t secondKind);
+int compareEntries(const void *firstEntry, const void *secondEntry);
+int compareReferences(const void *firstReference, const void *secondReference);
+void deleteReferenceArray(reference_array_t *array);
+/* ---------------------------------------- */
+
+/*
+ * Creates a new empty CrossReference.
+ *
+ * @return  Pointer to the newly created CrossReference.
+ */
+CrossReference *createCrossReference(void)
+{
+    CrossReference *xref = (CrossReference *) allocate_space(sizeof(CrossReference));
+
+    xref -> definitions.references = xref -> uses.references = NULL;
+    xref -> definitions.size = xref -> uses.size = ZERO_COUNT;
+    xref -> definitions.capacity = xref -> uses.capacity = ZERO_COUNT;
+
+    return xref;
+}
+
+/*
+ * Records the definition of a macro.
+ *
+ * @param   *xref       The cross reference.
+ * @param   *name       The name of the macro (copied).
+ * @param   lineNumber  The line of the definition in the source (.as) file.
+ */
+void addMacroDefinition(CrossReference *xref, const char *name, int lineNumber)
+{
+    addReference(&xref -> definitions, name, MACRO_NAME, lineNumber);
+}
+
+/*
+ * Records a call of a macro.
+ *
+ * @param   *xref       The cross reference.
+ * @param   *name       The name of the macro (copied).
+ * @param   lineNumber  The line of the call in the source (.as) file.
+ */
+void addMacroUse(CrossReference *xref, const char *name, int lineNumber)
+{
+    addReference(&xref -> uses, name, MACRO_NAME, lineNumber);
+}
+
+/*
+ * Records the labels that are arguments of a line (the uses of the labels).
+ *
+ * @param   *xref       The cross reference.
+ * @param   *lineAst    The AST of the line.
+ * @param   lineNumber  The line in the .am file.
+ */
+void addLabelUsesOfLine(CrossReference *xref, ast_t *lineAst, int lineNumber)
+{
+    arg_node_t *currArg;
+
+    /* Only the arguments of the instructions are labels (.entry and .extern declare them). */
+    if (getSentence(lineAst).sentenceType == DIRECTION_SENTENCE)
+        for (currArg = getArgList(lineAst); currArg != NULL; currArg = getNextNode(currArg))
+            if (getArgData(currArg).dataType == STRING)
+                addReference(&xref -> uses, getArgData(currArg).data.string, LABEL_NAME,
+                             lineNumber);
+}
+
+/*
+ * Adds a reference to an array of references.
+ *
+ * @param   *array      The array of references.
+ * @param   *name       The name of the reference (copied).
+ * @param   kind        The kind of the name.
+ * @param   lineNumber  The line of the reference.
+ */
+void addReference(reference_array_t *array, const char *name, name_kind_t kind, int lineNumber)
+{
+    if (array -> size == array -> capacity) /* Grow the array. */
+    {
+        array -> capacity = (array -> capacity == ZERO_COUNT)? MIN_CAPACITY :
+                            2 * array -> capacity;
+        array -> references = (reference_t *) reallocate_space(array -> references,
+                                                               array -> capacity *
+                                                               sizeof(reference_t));
+    }
+
+    array -> references[array -> size].name = my_strdup(name);
+    array -> references[array -> size].kind = kind;
+    array -> references[array -> size].lineNumber = lineNumber;
+    array -> size++;
+}
+
+/*
+ * Writes the cross reference file (.xref): a line for every macro and label, sorted by name.
+ * Assumes that the file was assembled successfully !!
+ *
+ * @param   *file_name  The name of the source file.
+ * @param   *xref       The cross reference of the file.
+ * @param   *symbols    The table of the symbols (labels) of the file.
+ */
+void createCrossReferenceFile(const char *file_name, CrossReference *xref,
+                              const SymbolTable *symbols)
+{
+    xref_entry_t *entries;
+    int entriesAmount;
+    FILE *xrefFile;
+    trace_span_t span;
+
+    beginTraceSpan(&span, "write_file", file_name);
+
+    entries = getCrossReferenceEntries(xref, symbols, &entriesAmount);
+    qsort(entries, (size_t) entriesAmount, sizeof(xref_entry_t), compareEntries);
+    qsort(xref -> uses.references, (size_t) xref -> uses.size, sizeof(reference_t),
+          compareReferences);
+
+    if ((xrefFile = openFile(file_name, XREF_END, WRITE_MODE)) != NULL)
+    {
+        fputs(XREF_HEADER, xrefFile);
+        writeCrossReferenceLines(xrefFile, entries, entriesAmount, &xref -> uses);
+        closeFile(&xrefFile);
+    }
+
+    (void) free_ptr(entries);
+    endTraceSpan(&span);
+}
+
+/*
+ * Gets the defined names of the file: the macros defined in it, and its labels.
+ *
+ * @param   *xref               The cross reference of the file.
+ * @param   *symbols            The table of the symbols (labels) of the file.
+ * @param   *entriesAmount      Will hold the amount of the names.
+ *
+ * @return  The defined names (needs to be freed), their names are kept by the tables.
+ */
+xref_entry_t *getCrossReferenceEntries(const CrossReference *xref, const SymbolTable *symbols,
+                                       int *entriesAmount)
+{
+    int symbolsAmount, i; /* The amount of the symbols, and a loop variable. */
+    const symbol_t *records = getSymbols(symbols, &symbolsAmount);
+    xref_entry_t *entries = (xref_entry_t *) allocate_space((xref -> definitions.size +
+                                                             symbolsAmount + 1) *
+                                                            sizeof(xref_entry_t));
+    xref_entry_t *entry = entries;
+
+    for (i = ZERO_INDEX; i < xref -> definitions.size; i++, entry++)
+    {
+        entry -> name = xref -> definitions.references[i].name;
+        entry -> kind = MACRO_NAME;
+        entry -> type = "macro";
+        entry -> lineNumber = xref -> definitions.references[i].lineNumber;
+        entry -> address = NO_VALUE;
+    }
+
+    for (i = ZERO_INDEX; i < symbolsAmount; i++)
+        if (records[i].flags & (SYMBOL_DEFINED | SYMBOL_EXTERN))
+        {
+            entry -> name = records[i].name;
+            entry -> kind = LABEL_NAME;
+            entry -> lineNumber = records[i].lineNumber;
+            if (records[i].flags & SYMBOL_DEFINED)
+            {
+                entry -> type = (records[i].section == DATA_SECTION)? "data" : "code";
+                entry -> address = records[i].value;
+            }
+            else
+            {
+                entry -> type = "extern";
+                entry -> address = NO_VALUE;
+            }
+            entry++;
+        }
+
+    *entriesAmount = (int) (entry - entries);
+    return entries;
+}
+
+/*
+ * Writes the lines of the .xref file. The names and the uses are sorted already, so they are
+ * merged in one walk. Uses of a name that is not defined in the file (a macro of an included
+ * file) get a line of their own.
+ *
+ * @param   *xrefFile       The file to write to.
+ * @param   *entries        The defined names, sorted.
+ * @param   entriesAmount   The amount of the defined names.
+ * @param   *uses           The uses of the names, sorted.
+ */
+void writeCrossReferenceLines(FILE *xrefFile, const xref_entry_t *entries, int entriesAmount,
+                              const reference_array_t *uses)
+{
+    int i = ZERO_INDEX, j = ZERO_INDEX; /* The next name and the next use. */
+    int order, lastLine; /* The order of the next name and use, and the last written use. */
+    const char *name;
+    name_kind_t kind;
+
+    while (i < entriesAmount || j < uses -> size)
+    {
+        order = (i == entriesAmount)? 1 : (j == uses -> size)? -1 :
+                compareNames(entries[i].name, entries[i].kind, uses -> references[j].name,
+                             uses -> references[j].kind);
+
+        if (order <= 0) /* A defined name. */
+        {
+            name = entries[i].name;
+            kind = entries[i].kind;
+            fprintf(xrefFile, "%s\t%s\t", name, entries[i].type);
+            writeNumberField(xrefFile, entries[i].lineNumber);
+            fputc('\t', xrefFile);
+            writeNumberField(xrefFile, entries[i].address);
+            i++;
+        }
+        else /* Only used in the file. */
+        {
+            name = uses -> references[j].name;
+            kind = uses -> references[j].kind;
+            fprintf(xrefFile, "%s\t%s\t%s\t%s", name, (kind == MACRO_NAME)? "macro" : "label",
+                    MISSING_FIELD, MISSING_FIELD);
+        }
+
+        fputc('\t', xrefFile);
+        if (order < 0) /* No uses. */
+            fputs(MISSING_FIELD, xrefFile);
+
+        /* The lines of the uses of the name (a line with a few uses is written once). */
+        for (lastLine = NO_VALUE; order >= 0 && j < uses -> size &&
+             compareNames(name, kind, uses -> references[j].name,
+                          uses -> references[j].kind) == 0; j++)
+            if (uses -> references[j].lineNumber != lastLine)
+            {
+                fprintf(xrefFile, (lastLine == NO_VALUE)? "%d" : ",%d",
+                        uses -> references[j].lineNumber);
+                lastLine = uses -> references[j].lineNumber;
+            }
+
+        fputc('\n', xrefFile);
+    }
+}
+
+/*
+ * Writes a number field of the .xref file.
+ *
+ * @param   *xrefFile   The file to write to.
+ * @param   number      The number, or NO_VALUE if it is not known.
+ */
+void writeNumberField(FILE *xrefFile, int number)
+{
+    if (number == NO_VALUE)
+        fputs(MISSING_FIELD, xrefFile);
+    else
+        fprintf(xrefFile, "%d", number);
+}
+
+/*
+ * Compares two names by their bytes, and then by their kinds.
+ *
+ * @param   *firstName      The first name.
+ * @param   firstKind       The kind of the first name.
+ * @param   *secondName     The second name.
+ * @param   secondKind      The kind of the second name.
+ *
+ * @return  Negative if the first name is before the second, positive if after, 0 if equal.
+ */
+int compareNames(const char *firstName, name_kind_t firstKind, const char *secondName,
+                 name_kind_t secondKind)
+{
+    int order = strcmp(firstName, secondName);
+
+    return (order != 0)? order : (int) firstKind - (int) secondKind;
+}
+
+/*
+ * Compares two defined names (for qsort).
+ *
+ * @param   *firstEntry     The first name.
+ * @param   *secondEntry    The second name.
+ *
+ * @return  Negative if the first name is before the second, positive if after, 0 if equal.
+ */
+int compareEntries(const void *firstEntry, const void *secondEntry)
+{
+    return compareNames(((const xref_entry_t *) firstEntry) -> name,
+                        ((const xref_entry_t *) firstEntry) -> kind,
+                        ((const xref_entry_t *) secondEntry) -> name,
+                        ((const xref_entry_t *) secondEntry) -> kind);
+}
+
+/*
+ * Compares two references by their names, and then by their lines (for qsort).
+ *
+ * @param   *firstReference     The first reference.
+ * @param   *secondReference    The second reference.
+ *
+ * @return  Negative if the first reference is before the second, positive if after,
+ *          0 if equal.
+ */
+int compareReferences(const void *firstReference, const void *secondReference)
+{
+    const reference_t *first = (const reference_t *) firstReference;
+    const reference_t *second = (const reference_t *) secondReference;
+    int order = compareNames(first -> name, first -> kind, second -> name, second -> kind);
+
+    return (order != 0)? order : first -> lineNumber - second -> lineNumber;
+}
+
+/*
+ * Deletes the cross reference and frees its memory.
+ *
+ * @param   **pXref     Pointer to the cross reference to delete.
+ */
+void deleteCrossReference(CrossReference **pXref)
+{
+    if (pXref != NULL && *pXref != NULL) /* Check if it is already deleted. */
+    {
+        deleteReferenceArray(&(*pXref) -> definitions);
+        deleteReferenceArray(&(*pXref) -> uses);
+        (void) clear_ptr(*pXref)
+    }
+}
+
+/*
+ * Frees the memory of an array of references.
+ *
+ * @param   *array  The array of references.
+ */
+void deleteReferenceArray(reference_array_t *array)
+{
+    int i; /* Loop variable. */
+
+    for (i = ZERO_INDEX; i < array -> size; i++)
+        {(void) clear_ptr(array -> references[i].name)}
+
+    (void) clear_ptr(array -> references)
+}
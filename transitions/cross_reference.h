@@ -0,0 +1,71 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the cross_reference.c file.
+ */
+
+#ifndef MMN_14_CROSS_REFERENCE_H
+#define MMN_14_CROSS_REFERENCE_H
+
+/* CrossReference data type - the definitions and the uses of the macros and the labels of a
+ * source file, recorded during the passes of the assembler. */
+typedef struct CrossReference CrossReference;
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Creates a new empty CrossReference.
+ *
+ * @return  Pointer to the newly created CrossReference.
+ */
+CrossReference *createCrossReference(void);
+
+/*
+ * Records the definition of a macro.
+ *
+ * @param   *xref       The cross reference.
+ * @param   *name       The name of the macro (copied).
+ * @param   lineNumber  The line of the definition in the source (.as) file.
+ */
+void addMacroDefinition(CrossReference *xref, const char *name, int lineNumber);
+
+/*
+ * Records a call of a macro.
+ *
+ * @param   *xref       The cross reference.
+ * @param   *name       The name of the macro (copied).
+ * @param   lineNumber  The line of the call in the source (.as) file.
+ */
+void addMacroUse(CrossReference *xref, const char *name, int lineNumber);
+
+/*
+ * Records the labels that are arguments of a line (the uses of the labels).
+ *
+ * @param   *xref       The cross reference.
+ * @param   *lineAst    The AST of the line.
+ * @param   lineNumber  The line in the .am file.
+ */
+void addLabelUsesOfLine(CrossReference *xref, ast_t *lineAst, int lineNumber);
+
+/*
+ * Writes the cross reference file (.xref): a line for every macro and label, sorted by name.
+ * Assumes that the file was assembled successfully !!
+ *
+ * @param   *file_name  The name of the source file.
+ * @param   *xref       The cross reference of the file.
+ * @param   *symbols    The table of the symbols (labels) of the file.
+ */
+void createCrossReferenceFile(const char *file_name, CrossReference *xref,
+                              const SymbolTable *symbols);
+
+/*
+ * Deletes the cross reference and frees its memory.
+ *
+ * @param   **pXref     Pointer to the cross reference to delete.
+ */
+void deleteCrossReference(CrossReference **pXref);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_CROSS_REFERENCE_H */
@@ -0,0 +1,334 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * dead_code_eliminator.c
+ *
+ * This file implements the dead code elimination of the assembler (option -D).
+ *
+ * The elimination runs at the end of the first transition, on the list of ASTs, and finds
+ * which lines are live, starting from the first instruction and the .entry labels:
+ *  - An instruction after a live instruction is live, unless the live one is 'stop', 'jmp'
+ *    or 'rts' (the program can't get from it to the next instruction).
+ *  - The line of a label that is an operand of a live instruction is live.
+ *  - A data line without a label after a live data line is live (it continues its table).
+ * All the other instructions and data lines are removed, and the addresses are computed again.
+ * The addresses of the code and the data are assumed to be taken only through labels.
+ */
+
+/* ---Include header files--- */
+#include <stddef.h>
+#include "../new-data-types/boolean.h"
+#include "../SymbolTable/SymbolTable.h"
+#include "../assembler_ast/assembler_ast.h"
+#include "../general-enums/assemblerFinals.h"
+#include "../general-enums/indexes.h"
+#include "../general-enums/programFinals.h"
+#include "../errors/error_types/error_types.h"
+#include "../util/memoryUtil.h"
+#include "first_transition_util.h"
+#include "dead_code_eliminator.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE TRANSITIONS_MEMORY /* For the memory statistics. */
+#define NO_LINE (-1)
+/* ------------ */
+
+/* What the analysis knows about a line. */
+typedef struct
+{
+    ast_t *lineAst;
+    int address; /* The address of the first word of the line (the data is after the code). */
+    int words; /* The amount of words of the line. */
+    boolean isLive;
+} line_info_t;
+
+/* ---------------Prototypes--------------- */
+line_info_t *collectLines(ast_list_t *astList, int *linesAmount);
+int *mapAddressesToLines(const line_info_t *lines, int linesAmount, int totalWords);
+void markLiveLines(line_info_t *lines, int linesAmount, const int *lineAtAddress,
+                   int totalWords, SymbolTable *symbols);
+void markLabelLine(line_info_t *lines, const char *labelName, const int *lineAtAddress,
+                   int totalWords, SymbolTable *symbols, int *liveStack, int *stackSize);
+void markLineLive(line_info_t *lines, int lineIndex, int *liveStack, int *stackSize);
+int lineAtAddressOf(const int *lineAtAddress, int totalWords, int address);
+boolean isFallingThrough(ast_t *lineAst);
+int removeDeadLines(ast_list_t *astList, const line_info_t *lines, SymbolTable *symbols);
+/* ---------------------------------------- */
+
+/*
+ * Removes the instructions that can't be reached and the data that is not referenced from
+ * the list of ASTs made in the first transition, and computes again the counters and the
+ * addresses of the labels.
+ * Assumes that the first transition finished successfully !!
+ *
+ * @param   *astList        The list of ASTs made in the first transition.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ *
+ * @return  The amount of words removed.
+ */
+int eliminate_dead_code(ast_list_t *astList, SymbolTable *symbols)
+{
+    int totalWords = *getCounterPointer(astList, IC_) + *getCounterPointer(astList, DC_) -
+                     2 * PROGRAM_MEM_START;
+    int linesAmount, removedWords;
+    line_info_t *lines = collectLines(astList, &linesAmount);
+    int *lineAtAddress = mapAddressesToLines(lines, linesAmount, totalWords);
+
+    markLiveLines(lines, linesAmount, lineAtAddress, totalWords, symbols);
+    removedWords = removeDeadLines(astList, lines, symbols);
+
+    (void) clear_ptr(lineAtAddress)
+    (void) clear_ptr(lines)
+
+    return removedWords;
+}
+
+/*
+ * Collects the lines of the list of ASTs with their addresses.
+ * The lines that are not instructions or data (.entry and .extern) are always live.
+ *
+ * @param   *astList        The list of ASTs.
+ * @param   *linesAmount    Will hold the amount of lines.
+ *
+ * @return  The lines, in the order of the list.
+ */
+line_info_t *collectLines(ast_list_t *astList, int *linesAmount)
+{
+    ast_list_node_t *currNode;
+    line_info_t *lines = NULL; /* Value to return. */
+    int IC = PROGRAM_MEM_START, DC = *getCounterPointer(astList, IC_);
+    int i; /* Loop variable. */
+
+    *linesAmount = ZERO_COUNT;
+    for (currNode = getAstHead(astList); currNode != NULL; currNode = getNextAstNode(currNode))
+        (*linesAmount)++;
+
+    if (*linesAmount > ZERO_COUNT)
+        lines = (line_info_t *) allocate_space(*linesAmount * sizeof(line_info_t));
+
+    for (i = ZERO_INDEX, currNode = getAstHead(astList); currNode != NULL;
+         i++, currNode = getNextAstNode(currNode))
+    {
+        lines[i].lineAst = getAst(currNode);
+        if (getSentence(lines[i].lineAst).sentenceType == DIRECTION_SENTENCE)
+        {
+            lines[i].address = IC;
+            lines[i].words = howManyWordsForInstruction(lines[i].lineAst);
+            IC += lines[i].words;
+        }
+        else
+        {
+            lines[i].address = DC;
+            lines[i].words = howManyWordsForData(lines[i].lineAst);
+            DC += lines[i].words;
+        }
+
+        lines[i].isLive = (lines[i].words == ZERO_COUNT)? TRUE : FALSE;
+    }
+
+    return lines;
+}
+
+/*
+ * Maps every address of the file to the line that starts in it.
+ *
+ * @param   *lines          The lines of the file.
+ * @param   linesAmount     The amount of lines.
+ * @param   totalWords      The amount of words of the code and the data.
+ *
+ * @return  The index of the line that starts in every address (from PROGRAM_MEM_START),
+ *          or NO_LINE if no line starts in it.
+ */
+int *mapAddressesToLines(const line_info_t *lines, int linesAmount, int totalWords)
+{
+    int *lineAtAddress = NULL; /* Value to return. */
+    int i; /* Loop variable. */
+
+    if (totalWords > ZERO_COUNT)
+        lineAtAddress = (int *) allocate_space(totalWords * sizeof(int));
+
+    for (i = ZERO_INDEX; i < totalWords; i++)
+        lineAtAddress[i] = NO_LINE;
+
+    for (i = ZERO_INDEX; i < linesAmount; i++)
+        if (lines[i].words > ZERO_COUNT)
+            lineAtAddress[lines[i].address - PROGRAM_MEM_START] = i;
+
+    return lineAtAddress;
+}
+
+/*
+ * Gets the line that starts in an address.
+ *
+ * @param   *lineAtAddress  The line that starts in every address.
+ * @param   totalWords      The amount of words of the code and the data.
+ * @param   address         The address.
+ *
+ * @return  The index of the line, or NO_LINE if no line starts in the address.
+ */
+int lineAtAddressOf(const int *lineAtAddress, int totalWords, int address)
+{
+    return (address >= PROGRAM_MEM_START && address - PROGRAM_MEM_START < totalWords)?
+           lineAtAddress[address - PROGRAM_MEM_START] : NO_LINE;
+}
+
+/*
+ * Finds all the live lines, starting from the first instruction and the .entry labels.
+ *
+ * @param   *lines          The lines of the file.
+ * @param   linesAmount     The amount of lines.
+ * @param   *lineAtAddress  The line that starts in every address.
+ * @param   totalWords      The amount of words of the code and the data.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ */
+void markLiveLines(line_info_t *lines, int linesAmount, const int *lineAtAddress,
+                   int totalWords, SymbolTable *symbols)
+{
+    int *liveStack = NULL, stackSize = ZERO_COUNT; /* Live lines that were not handled yet. */
+    int i, lineIndex, nextLine;
+    arg_node_t *currArg;
+
+    if (linesAmount > ZERO_COUNT)
+        liveStack = (int *) allocate_space(linesAmount * sizeof(int));
+
+    /* The roots: the first instruction and the .entry labels. */
+    markLineLive(lines, lineAtAddressOf(lineAtAddress, totalWords, PROGRAM_MEM_START),
+                 liveStack, &stackSize);
+    for (i = ZERO_INDEX; i < linesAmount; i++)
+        if (getLabelTypeForTable(lines[i].lineAst) == ENTRY)
+            for (currArg = getArgList(lines[i].lineAst); currArg != NULL;
+                 currArg = getNextNode(currArg))
+                markLabelLine(lines, getArgData(currArg).data.string, lineAtAddress,
+                              totalWords, symbols, liveStack, &stackSize);
+
+    while (stackSize > ZERO_COUNT) /* Follow the live lines. */
+    {
+        lineIndex = liveStack[--stackSize];
+        nextLine = lineAtAddressOf(lineAtAddress, totalWords,
+                                   lines[lineIndex].address + lines[lineIndex].words);
+
+        if (getSentence(lines[lineIndex].lineAst).sentenceType == DIRECTION_SENTENCE)
+        {
+            for (currArg = getArgList(lines[lineIndex].lineAst); currArg != NULL;
+                 currArg = getNextNode(currArg))
+                if (getArgAddressingMethod(currArg) == DIRECT)
+                    markLabelLine(lines, getArgData(currArg).data.string, lineAtAddress,
+                                  totalWords, symbols, liveStack, &stackSize);
+
+            if (isFallingThrough(lines[lineIndex].lineAst) == TRUE && nextLine != NO_LINE &&
+                getSentence(lines[nextLine].lineAst).sentenceType == DIRECTION_SENTENCE)
+                markLineLive(lines, nextLine, liveStack, &stackSize);
+        }
+
+        else if (nextLine != NO_LINE && isLabel(lines[nextLine].lineAst) == FALSE)
+            markLineLive(lines, nextLine, liveStack, &stackSize); /* The table continues. */
+    }
+
+    (void) clear_ptr(liveStack)
+}
+
+/*
+ * Marks the line of a label as live (if the label is defined in the file).
+ *
+ * @param   *lines          The lines of the file.
+ * @param   *labelName      The name of the label.
+ * @param   *lineAtAddress  The line that starts in every address.
+ * @param   totalWords      The amount of words of the code and the data.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ * @param   *liveStack      The live lines that were not handled yet.
+ * @param   *stackSize      The amount of lines in the stack.
+ */
+void markLabelLine(line_info_t *lines, const char *labelName, const int *lineAtAddress,
+                   int totalWords, SymbolTable *symbols, int *liveStack, int *stackSize)
+{
+    const symbol_t *label = findSymbol(symbols, labelName);
+
+    /* Labels of the same literal (option -P) have the address of its line. */
+    if (label != NULL && (label -> flags & SYMBOL_DEFINED))
+        markLineLive(lines, lineAtAddressOf(lineAtAddress, totalWords, label -> value),
+                     liveStack, stackSize);
+}
+
+/*
+ * Marks a line as live, and adds it to the stack of lines to handle (if it was not live).
+ *
+ * @param   *lines          The lines of the file.
+ * @param   lineIndex       The index of the line, or NO_LINE.
+ * @param   *liveStack      The live lines that were not handled yet.
+ * @param   *stackSize      The amount of lines in the stack.
+ */
+void markLineLive(line_info_t *lines, int lineIndex, int *liveStack, int *stackSize)
+{
+    if (lineIndex != NO_LINE && lines[lineIndex].isLive == FALSE)
+    {
+        lines[lineIndex].isLive = TRUE;
+        liveStack[(*stackSize)++] = lineIndex;
+    }
+}
+
+/*
+ * Checks if the program can get from an instruction to the instruction after it.
+ *
+ * @param   *lineAst    The AST of the instruction.
+ *
+ * @return  FALSE if the instruction is 'stop', 'jmp' or 'rts', otherwise TRUE.
+ */
+boolean isFallingThrough(ast_t *lineAst)
+{
+    opcodes_t opcode = getOpcodeFromAST(lineAst);
+
+    return (opcode == stop || opcode == jmp || opcode == rts)? FALSE : TRUE;
+}
+
+/*
+ * Removes the lines that are not live from the list of ASTs, and computes again the counters
+ * and the addresses of the labels.
+ *
+ * @param   *astList    The list of ASTs.
+ * @param   *lines      The lines of the file (in the order of the list).
+ * @param   *symbols    The table of the symbols (labels) of the file.
+ *
+ * @return  The amount of words removed.
+ */
+int removeDeadLines(ast_list_t *astList, const line_info_t *lines, SymbolTable *symbols)
+{
+    ast_list_node_t *prevNode = NULL, *currNode = getAstHead(astList), *nextNode;
+    int dataStart = *getCounterPointer(astList, IC_);
+    int dataSize = *getCounterPointer(astList, DC_) - PROGRAM_MEM_START;
+    int *newOffsets = NULL; /* The new offset of every word of the data. */
+    int removedWords = ZERO_COUNT, newOffset = ZERO_COUNT, i, word;
+
+    if (dataSize > ZERO_COUNT)
+        newOffsets = (int *) allocate_space(dataSize * sizeof(int));
+
+    for (i = ZERO_INDEX; currNode != NULL; i++, currNode = nextNode)
+    {
+        /* Words of removed data move to the next data that is kept. */
+        if (getSentence(lines[i].lineAst).sentenceType == GUIDANCE_SENTENCE)
+        {
+            for (word = ZERO_INDEX; word < lines[i].words; word++)
+                newOffsets[lines[i].address - dataStart + word] =
+                        newOffset + ((lines[i].isLive == TRUE)? word : ZERO_COUNT);
+            if (lines[i].isLive == TRUE)
+                newOffset += lines[i].words;
+        }
+
+        nextNode = getNextAstNode(currNode);
+        if (lines[i].isLive == FALSE)
+        {
+            removedWords += lines[i].words;
+            (void) deleteNextAstFromList(astList, prevNode);
+        }
+        else
+            prevNode = currNode;
+    }
+
+    /* Labels without lines of their own (option -P) follow the data they point to. */
+    moveDataSymbols(symbols, dataStart, newOffsets, dataSize);
+    recomputeAddresses(astList, symbols);
+
+    (void) clear_ptr(newOffsets)
+    return removedWords;
+}
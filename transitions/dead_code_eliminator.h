@@ -0,0 +1,28 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the dead_code_eliminator.c file.
+ */
+
+#ifndef MMN_14_DEAD_CODE_ELIMINATOR_H
+#define MMN_14_DEAD_CODE_ELIMINATOR_H
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Removes the instructions that can't be reached and the data that is not referenced from
+ * the list of ASTs made in the first transition, and computes again the counters and the
+ * addresses of the labels.
+ * Assumes that the first transition finished successfully !!
+ *
+ * @param   *astList        The list of ASTs made in the first transition.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ *
+ * @return  The amount of words removed.
+ */
+int eliminate_dead_code(ast_list_t *astList, SymbolTable *symbols);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_DEAD_CODE_ELIMINATOR_H */
@@ -20,65 +20,172 @@
 /* ---Include header files--- */
 #include <stdio.h>
 #include <string.h>
+#include "../SymbolTable/SymbolTable.h"
 #include "../NameTable/NameTable.h"
 #include "../new-data-types/process_result.h"
+#include "../new-data-types/assembler_options.h"
+#include "../new-data-types/error_count.h"
 #include "../assembler_ast/assembler_ast.h"
 #include "../general-enums/programFinals.h"
 #include "../general-enums/assemblerFinals.h"
 #include "../FileHandling/readFromFile.h"
+#include "../FileHandling/StructuralIndex.h"
 #include "../errors/error_types/error_types.h"
 #include "../errors/FirstTransitionErrors/FirstTransitionLogicalAndImgSystemErrors.h"
+#include "../errors/FirstTransitionErrors/FirstTransitionSyntaxScanner.h"
 #include "../errors/assembler_errors.h"
 #include "../errors/warnings.h"
 #include "../util/memoryUtil.h"
+#include "../util/traceUtil.h"
 #include "first_transition_util.h"
+#include "literal_pool.h"
+#include "dead_code_eliminator.h"
+#include "cross_reference.h"
+#include "macro_template.h"
+#include "assembler_pipeline.h"
 /* -------------------------- */
 
 /* ---Finals--- */
+#define MEMORY_MODULE TRANSITIONS_MEMORY /* For the memory statistics. */
 #define AFTER_MACRO ".am" /* File end of after pre-processor type file */
 #define NO_LINE 0
+#define MAX_READ_LINE_LEN 81 /* A line of 80 chars and its new line char. */
 /* ------------ */
 
 /* ---Macros--- */
-
-/* Will be used to distinguish between data labels and instruction labels. */
-#define DATA_TEMP_ADDRESS(address) (-1 * (address))
-
 /* ------------ */
 
 /* ---------------Prototypes--------------- */
-process_result firstFileTraverse(const char *file_name, NameTable *labelsMap[],
-                                 ast_list_t *astList);
-boolean handleLineInFirstTrans(const char *file_name, const char *line, int lineNumber,
-                               ast_list_t *astList, NameTable *labelsMap[], int *IC, int *DC);
-ast_t *firstAssemblerAlgo(const char *file_name, const char *line, int lineNumber,
-                          NameTable *labelsMap[], int *IC, int *DC);
-Error addToTablesIfNeededInFirstTrans(ast_t *lineAst, NameTable *labelsMap[], int IC, int DC);
-Error addToNormalTable(ast_t *lineAst, NameTable *normalTable, NameTable *extTable, int IC, int DC);
-Error addToOtherTable(ast_t *lineAst, NameTable *labelsMap[], label_type_t table);
+process_result finish_first_transition(const char *file_name, SymbolTable *symbols,
+                                       ast_list_t *astList, process_result linesRes,
+                                       const assembler_options_t *options);
+void startFirstTransition(SymbolTable **symbols, ast_list_t **astList,
+                          const assembler_options_t *options);
+process_result firstFileTraverse(const char *file_name, SymbolTable *symbols,
+                                 ast_list_t *astList, char **amText, error_count_t *errors,
+                                 MacroCalls *calls);
+boolean handleLineInFirstTrans(const char *file_name, ast_t *lineAst, Error lineError,
+                               char *errorLabel, int lineNumber, ast_list_t *astList,
+                               SymbolTable *symbols, FILE *diagnoses);
+ast_t *firstAssemblerAlgo(const char *file_name, ast_t *lineAst, int lineNumber,
+                          SymbolTable *symbols, int *IC, int *DC, Error *lineError,
+                          FILE *diagnoses);
+Error addToTablesIfNeededInFirstTrans(ast_t *lineAst, SymbolTable *symbols, int IC, int DC);
+Error addToNormalTable(ast_t *lineAst, SymbolTable *symbols, int IC, int DC);
+Error addToOtherTable(ast_t *lineAst, SymbolTable *symbols, label_type_t table);
 /* ---------------------------------------- */
 
 /*
  * Performs the first transition phase of an assembler on the given source file.
  *
  * @param   *file_name  The name of the source file to be processed.
- * @param   *labelsMap  An array of pointers to symbol tables for label management.
+ * @param   **symbols   Will hold the table of the symbols (labels) of the file.
  * @param   **astList   A pointer to the list of abstract syntax trees for line processing.
+ * @param   *options    The options given to the assembler.
+ * @param   **amText    Pointer to the contents of the .am file if it was not written (taken,
+ *                      NULL if it has no lines), or NULL to read the .am file.
+ * @param   *calls      The calls of the macros with parameters, to report the call of a line
+ *                      with an error (can be NULL).
+ * @param   *errors     The count of the lines with errors of the file (stops at its cap).
+ *
+ * @return  A process_result indicating the outcome of the first transition phase.
+ */
+process_result first_transition(const char *file_name, SymbolTable **symbols,
+                                ast_list_t **astList, const assembler_options_t *options,
+                                char **amText, MacroCalls *calls, error_count_t *errors)
+{
+    process_result firstTransRes;
+    trace_span_t span;
+
+    beginTraceSpan(&span, "first_transition", file_name);
+
+    startFirstTransition(symbols, astList, options);
+    firstTransRes = firstFileTraverse(file_name, *symbols, *astList, amText, errors, calls);
+    firstTransRes = finish_first_transition(file_name, *symbols, *astList, firstTransRes,
+                                            options);
+
+    endTraceSpan(&span);
+    return firstTransRes;
+}
+
+/*
+ * Performs the lines part of the first transition phase on the lines of a pipeline
+ * (the lines are parsed on the pipeline threads, while the file is pre-processed).
+ * finish_first_transition should be called after it.
+ *
+ * @param   *file_name      The name of the source file to be processed.
+ * @param   **symbols       Will hold the table of the symbols (labels) of the file.
+ * @param   **astList       A pointer to the list of abstract syntax trees for line processing.
+ * @param   *options        The options given to the assembler.
+ * @param   *pipeline       The pipeline of the file.
+ * @param   *diagnoses      The stream to print the errors and the warnings of the lines to.
+ * @param   *calls          The calls of the macros with parameters, to report the call of a
+ *                          line with an error (can be NULL).
+ * @param   *errors         The count of the lines with errors of the file (stops at its cap).
+ *
+ * @return  A process_result indicating the outcome of the lines.
+ */
+process_result first_transition_pipelined(const char *file_name, SymbolTable **symbols,
+                                          ast_list_t **astList,
+                                          const assembler_options_t *options,
+                                          AssemblerPipeline *pipeline, FILE *diagnoses,
+                                          MacroCalls *calls, error_count_t *errors)
+{
+    int errorsAmount = ZERO_COUNT;
+    ast_t *lineAst; /* The AST of the current line. */
+    Error lineError; /* The error in the current line (if there is). */
+    char *errorLabel; /* The label of the current line if there is an error in it. */
+    int lineNumber;
+
+    startFirstTransition(symbols, astList, options);
+
+    /* Handle the lines in their order, while the next lines are still parsed.
+     * The lines after the cap of the errors are left to the pipeline to drop. */
+    while (isErrorsCapReached(file_name, errors, diagnoses) == FALSE &&
+           readParsedLine(pipeline, &lineAst, &lineError, &lineNumber, &errorLabel) == TRUE)
+        if (handleLineInFirstTrans(file_name, lineAst, lineError, errorLabel, lineNumber,
+                                   *astList, *symbols, diagnoses) == TRUE)
+        {
+            errorsAmount++;
+            errors -> errorsAmount++;
+            reportMacroCallOfLine(diagnoses, calls, lineNumber); /* If it came from a call. */
+        }
+
+    return (errorsAmount == ZERO_COUNT)? SUCCESS : FAILURE;
+}
+
+/*
+ * Finishes the first transition phase, after all the lines were handled.
+ *
+ * @param   *file_name      The name of the source file to be processed.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ * @param   *astList        The list of abstract syntax trees of the file.
+ * @param   linesRes        The outcome of the lines.
+ * @param   *options        The options given to the assembler.
  *
  * @return  A process_result indicating the outcome of the first transition phase.
  */
-process_result first_transition(const char *file_name, NameTable *labelsMap[],
-                                ast_list_t **astList)
+process_result finish_first_transition(const char *file_name, SymbolTable *symbols,
+                                       ast_list_t *astList, process_result linesRes,
+                                       const assembler_options_t *options)
 {
-    labelsMap[NORMAL] = createNameTable(INT_TYPE); /* Will hold normal labels */
-    labelsMap[ENTRY] = createNameTable(INT_TYPE); /* Will hold the .entry labels. */
-    labelsMap[EXTERN] = createNameTable(INT_TYPE); /* Will hold the .extern labels. */
-    *astList = createAstList(); /* Data structure to help diagnose and encode each line. */
+    process_result firstTransRes = linesRes;
+    ImgSystemError imgSystemError;
+
+    /* Separate instructions and data */
+    updateDataLabels(symbols, *getCounterPointer(astList, IC_) - PROGRAM_MEM_START);
+
+    /* Pool the tables of the data before the dead ones are found (with their labels). */
+    if (firstTransRes == SUCCESS && options -> isPoolLiterals == TRUE)
+        printf("Literal pooling saved %d words\n", pool_literals(astList, symbols));
 
-    process_result firstTransRes = firstFileTraverse(file_name, labelsMap, *astList);
+    /* Remove the dead code before the size of the program is checked. */
+    if (firstTransRes == SUCCESS && options -> isEliminateDeadCode == TRUE)
+        printf("Dead code elimination removed %d words\n",
+               eliminate_dead_code(astList, symbols));
 
     /* Check if the program is too big (memory overflow). */
-    ImgSystemError imgSystemError = checkFileMemoryOverflow(*astList);
+    imgSystemError = checkFileMemoryOverflow(astList);
 
     if (imgSystemError != NO_ERROR) {
         handle_assembler_error(file_name, NO_LINE, imgSystemError);
@@ -88,98 +195,161 @@ process_result first_transition(const char *file_name, NameTable *labelsMap[],
     return firstTransRes;
 }
 
+/*
+ * Creates the data structures of the first transition phase.
+ *
+ * @param   **symbols       Will hold the table of the symbols (labels) of the file.
+ * @param   **astList       Will hold the list of abstract syntax trees of the file.
+ * @param   *options        The options given to the assembler.
+ */
+void startFirstTransition(SymbolTable **symbols, ast_list_t **astList,
+                          const assembler_options_t *options)
+{
+    initSyntaxScanner(); /* Build the char class table of the syntax checks. */
+    *symbols = createSymbolTable(); /* Will hold the normal, .entry and .extern labels. */
+
+    /* Data structure to help diagnose and encode each line.
+     * The optimizations and the report need all the ASTs in the memory, so they override
+     * low memory. */
+    *astList = (options -> isLowMemory == TRUE && options -> isOptimize == FALSE &&
+                options -> isPoolLiterals == FALSE && options -> isEliminateDeadCode == FALSE &&
+                options -> isControlFlowReport == FALSE)?
+            createSpilledAstList() : createAstList();
+
+    /* Initializing IC and DC. */
+    *getCounterPointer(*astList, IC_) = *getCounterPointer(*astList, DC_) = PROGRAM_MEM_START;
+}
+
 /*
  * Initiates the traversal and processing of the source file during the first transition phase.
  *
  * @param   *file_name      The name of the source file to be processed.
- * @param   *labelsMap[]    An array of symbol tables for label management.
+ * @param   *symbols        The table of the symbols (labels) of the file.
  * @param   *astList        A pointer to the list of abstract syntax trees for line processing.
+ * @param   **amText        Pointer to the contents of the .am file if it was not written (taken,
+ *                          NULL if it has no lines), or NULL to read the .am file.
+ * @param   *errors         The count of the lines with errors of the file (stops at its cap).
+ * @param   *calls          The calls of the macros with parameters (can be NULL).
  *
  * @return  A process_result indicating the outcome of the first transition phase.
  */
-process_result firstFileTraverse(const char *file_name, NameTable *labelsMap[],
-                                 ast_list_t *astList)
+process_result firstFileTraverse(const char *file_name, SymbolTable *symbols,
+                                 ast_list_t *astList, char **amText, error_count_t *errors,
+                                 MacroCalls *calls)
 {
-    boolean wasError = FALSE;
-    int *IC = getCounterPointer(astList, IC_), *DC = getCounterPointer(astList, DC_);
-    char *line = NULL; /* This will hold the current line */
-    int readCode; /* Will hold the current line's read code. */
+    int errorsAmount = ZERO_COUNT;
+    StructuralIndex *amIndex = NULL;
+    boolean isFileRead;
+    char *line; /* This will hold the current line */
+    Error lineError; /* Represents the error in the line (if there is). */
+    ast_t *lineAst;
+    char *errorLabel; /* The label of the line if there is an error in it. */
     int lineCount = ZERO_COUNT;
 
-    *IC = *DC = PROGRAM_MEM_START; /* Initializing IC and DC. */
-    /* Read the file line-by-line and handle it. */
-    while ((readCode = readNextLineFromFile(file_name, AFTER_MACRO, &line)) != EOF)
+    if (amText == NULL)
+        amIndex = readIndexedFile(file_name, AFTER_MACRO);
+    else if (*amText != NULL) /* The index takes the contents. */
     {
-        if (readCode == UNABLE_TO_OPEN_FILE) break;
+        amIndex = createStructuralIndex(*amText);
+        *amText = NULL;
+    }
+    else /* The same as a .am file that was not written, since it has no lines. */
+        printf("\nThere are no lines in file: \"%s\"\n", file_name);
+    isFileRead = (amIndex != NULL)? TRUE : FALSE;
 
-        lineCount++;
-        boolean wasErrorInLine = handleLineInFirstTrans(file_name, line, lineCount,
-                                                        astList, labelsMap, IC, DC);
+    /* Read the file line-by-line and handle it. */
+    while (isFileRead == TRUE &&
+           isErrorsCapReached(file_name, errors, stderr) == FALSE &&
+           (line = readIndexedLine(amIndex, MAX_READ_LINE_LEN, NO_SKIPPED_LINES,
+                                   &lineCount)) != NULL)
+    {
+        lineAst = buildAstFromLine(line, &lineError);
+        errorLabel = (lineAst == NULL)? getLabelOfErrorLine(line) : NULL;
         (void) clear_ptr(line) /* Next line */
 
-        if (wasErrorInLine == TRUE) wasError = TRUE;
+        if (handleLineInFirstTrans(file_name, lineAst, lineError, errorLabel, lineCount, astList,
+                                   symbols, stderr) == TRUE)
+        {
+            errorsAmount++;
+            errors -> errorsAmount++;
+            reportMacroCallOfLine(stderr, calls, lineCount); /* If it came from a call. */
+        }
     }
-    (void) clear_ptr(line) /* Free the last line. */
-
-    /* Separate instructions and data */
-    updateDataLabels(labelsMap[NORMAL], *IC - PROGRAM_MEM_START);
+    deleteStructuralIndex(&amIndex);
 
-    return (wasError == FALSE && readCode != UNABLE_TO_OPEN_FILE)? SUCCESS : FAILURE;
+    return (errorsAmount == ZERO_COUNT && isFileRead == TRUE)? SUCCESS : FAILURE;
 }
 
 /*
  * Handles a line of assembly code during the first transition phase.
  *
  * @param   *file_name    The name of the source file being processed.
- * @param   *line         The input line of assembly code.
+ * @param   *lineAst      The abstract syntax tree (AST) of the line, or NULL if there was an
+ *                        error in the line itself.
+ * @param   lineError     The error in the line itself, or NO_ERROR if there wasn't.
+ * @param   *errorLabel   The label of the line if there was an error in the line itself
+ *                        (freed), or NULL.
  * @param   lineNumber    The line number in the source file.
  * @param   *astList      A pointer to the list of abstract syntax trees for line processing
- *                        (The created AST from the line will be added to the list).
- * @param   *labelsMap    An array of symbol tables for label management.
- * @param   *IC           A pointer to the Instruction Counter.
- * @param   *DC           A pointer to the Data Counter.
+ *                        (The AST of the line will be added to the list).
+ * @param   *symbols      The table of the symbols (labels) of the file.
+ * @param   *diagnoses    The stream to print the errors and the warnings to.
  *
- * @return  TRUE if the line is successfully handled, otherwise FALSE.
+ * @return  TRUE if there was an error in the line, otherwise FALSE.
  */
-boolean handleLineInFirstTrans(const char *file_name, const char *line, int lineNumber,
-                               ast_list_t *astList, NameTable *labelsMap[], int *IC, int *DC)
+boolean handleLineInFirstTrans(const char *file_name, ast_t *lineAst, Error lineError,
+                               char *errorLabel, int lineNumber, ast_list_t *astList,
+                               SymbolTable *symbols, FILE *diagnoses)
 {
-    ast_t *lineAst = firstAssemblerAlgo(file_name, line, lineNumber, labelsMap, IC, DC);
-    (void) addAstToList(astList, &lineAst); /* Add the ast to the list. */
+    /* Keep the label, so its uses are not reported as undefined when checking a failed file. */
+    if (errorLabel != NULL)
+    {
+        declareSymbol(symbols, errorLabel, SYMBOL_IN_ERROR_LINE, lineNumber);
+        (void) clear_ptr(errorLabel)
+    }
+
+    lineAst = firstAssemblerAlgo(file_name, lineAst, lineNumber, symbols,
+                                 getCounterPointer(astList, IC_),
+                                 getCounterPointer(astList, DC_), &lineError, diagnoses);
+
+    /* Add the ast to the list (can delete the ast). There is no ast if it was not needed. */
+    (void) addAstToList(astList, &lineAst);
 
-    return (lineAst == NULL)? TRUE : FALSE;
+    return (lineError != NO_ERROR)? TRUE : FALSE;
 }
 
 /*
  * Initiates the first transition algorithm for processing an assembly file.
  *
  * @param   *file_name    The name of the source file being processed.
- * @param   *line         The input line of assembly code.
+ * @param   *lineAst      The abstract syntax tree (AST) of the line, or NULL if there was an
+ *                        error in the line itself.
  * @param   lineNumber    The line number in the source file.
- * @param   *labelsMap    An array of symbol tables for label management.
+ * @param   *symbols      The table of the symbols (labels) of the file.
  * @param   *IC           A pointer to the Instruction Counter.
  * @param   *DC           A pointer to the Data Counter.
+ * @param   *lineError    The error in the line itself, will hold the error in the line,
+ *                        or NO_ERROR if there wasn't.
+ * @param   *diagnoses    The stream to print the errors and the warnings to.
  *
- * @return  The abstract syntax tree (AST) representing the processed line,
- *          or NULL if there was an error during processing.
+ * @return  The abstract syntax tree (AST) representing the processed line, or NULL if
+ *          there was an error during processing.
  */
-ast_t *firstAssemblerAlgo(const char *file_name, const char *line, int lineNumber,
-                          NameTable *labelsMap[], int *IC, int *DC)
+ast_t *firstAssemblerAlgo(const char *file_name, ast_t *lineAst, int lineNumber,
+                          SymbolTable *symbols, int *IC, int *DC, Error *lineError,
+                          FILE *diagnoses)
 {
-    Error lineError; /* Represents the error in the line (if there is). */
-
-    /* AST (abstract syntax tree) representing the line to return. */
-    ast_t *lineAst = buildAstFromLine(line, &lineError);
-
     if (lineAst != NULL) /* If the tree was built (there were no errors in the line itself) */
     {
-        handleWarnings(file_name, lineNumber, lineAst); /* Handle warnings. */
-        lineError = addToTablesIfNeededInFirstTrans(lineAst, labelsMap, *IC, *DC);
+        setAstLineNumber(lineAst, lineNumber);
+        handleWarnings(diagnoses, file_name, lineNumber, lineAst); /* Handle warnings. */
+
+        *lineError = addToTablesIfNeededInFirstTrans(lineAst, symbols, *IC, *DC);
     }
 
-    if (lineError != NO_ERROR) /* If there was an error. */
+    if (*lineError != NO_ERROR) /* If there was an error. */
     {
-        handle_assembler_error(file_name, lineNumber, lineError);
+        report_assembler_error(diagnoses, file_name, lineNumber, *lineError);
         deleteAst(&lineAst);
     }
     else /* Update the counters if there were no errors. */
@@ -193,71 +363,66 @@ ast_t *firstAssemblerAlgo(const char *file_name, const char *line, int lineNumbe
  * Adds relevant entries to symbol tables if needed during the first transition phase.
  *
  * @param   *lineAst     The abstract syntax tree (AST) representing the processed line.
- * @param   *labelsMap   An array of symbol tables for label management.
+ * @param   *symbols     The table of the symbols (labels) of the file.
  * @param   IC           The Instruction Counter value.
  * @param   DC           The Data Counter value.
  *
  * @return  An error code indicating the outcome of the operation, or NO_ERROR if successful.
  */
-Error addToTablesIfNeededInFirstTrans(ast_t *lineAst, NameTable *labelsMap[], int IC, int DC)
+Error addToTablesIfNeededInFirstTrans(ast_t *lineAst, SymbolTable *symbols, int IC, int DC)
 {
     Error lineError = NO_ERROR; /* Value to return. */
 
     label_type_t labelType = getLabelTypeForTable(lineAst);
 
     if (labelType == NORMAL)
-            lineError = addToNormalTable(lineAst, labelsMap[NORMAL],
-                                          labelsMap[EXTERN], IC, DC);
+            lineError = addToNormalTable(lineAst, symbols, IC, DC);
     else if (labelType == ENTRY || labelType == EXTERN)
-            lineError = addToOtherTable(lineAst, labelsMap, labelType);
+            lineError = addToOtherTable(lineAst, symbols, labelType);
 
     return lineError;
 }
 
 /*
- * Adds an entry to the normal symbol table if needed during the first transition phase.
+ * Defines the label of the line in the symbol table if needed during the first transition phase.
  *
  * @param   *lineAst      The abstract syntax tree (AST) representing the processed line.
- * @param   *normalTable  The normal symbol table for label management.
- * @param   *extTable     The external symbol table for reference management.
+ * @param   *symbols      The table of the symbols (labels) of the file.
  * @param   IC            The Instruction Counter value.
  * @param   DC            The Data Counter value.
  *
  * @return  An error code indicating the outcome of the operation, or NO_ERROR if successful.
  */
-Error addToNormalTable(ast_t *lineAst, NameTable *normalTable, NameTable *extTable, int IC, int DC)
+Error addToNormalTable(ast_t *lineAst, SymbolTable *symbols, int IC, int DC)
 {
-    Error lineError = checkLabelDefTableError(lineAst, normalTable, extTable);
+    Error lineError = checkLabelDefTableError(lineAst, symbols);
 
     if (lineError == NO_ERROR)
-    {
-        /* The address will be decided based on the type of sentence. */
-        int address = (getSentence(lineAst).sentenceType == DIRECTION_SENTENCE)?
-                IC : DATA_TEMP_ADDRESS(DC);
-        addLabelToTable(normalTable, getLabelName(lineAst), address);
-    }
+        addLabelToTable(symbols, lineAst, IC, DC);
 
     return lineError;
 }
 
 /*
- * Adds an entry to the specified symbol table if needed during the first transition phase.
+ * Declares the arguments of a .entry or .extern guidance in the symbol table during the
+ * first transition phase.
  *
  * @param   *lineAst     The abstract syntax tree (AST) representing the processed line.
- * @param   *labelsMap   An array of pointers to symbol tables for label management.
- * @param   table        The type of symbol table to add the entry to (NORMAL or EXTERN).
+ * @param   *symbols     The table of the symbols (labels) of the file.
+ * @param   table        The type of the declaration (ENTRY or EXTERN).
  *
  * @return  An error code indicating the outcome of the operation, or NO_ERROR if successful.
  */
-Error addToOtherTable(ast_t *lineAst, NameTable *labelsMap[], label_type_t table)
+Error addToOtherTable(ast_t *lineAst, SymbolTable *symbols, label_type_t table)
 {
     Error lineError = NO_ERROR; /* Value to return, assume no error. */
 
-    /* Add all arguments of .entry or .extern guidance to the specific table. */
+    /* Declare all arguments of .entry or .extern guidance in the table. */
     arg_node_t *currArg = getArgList(lineAst);
     while (currArg != NULL)
     {
-        addLabelToOtherTable(getArgData(currArg).data.string, labelsMap, table, &lineError);
+        addLabelToOtherTable(getArgData(currArg).data.string, symbols, table,
+                             getAstLineNumber(lineAst), &lineError);
 
         currArg = getNextNode(currArg);
     }
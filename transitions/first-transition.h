@@ -14,13 +14,58 @@
  * Performs the first transition phase of an assembler on the given source file.
  *
  * @param   *file_name  The name of the source file to be processed.
- * @param   *labelsMap  An array of pointers to symbol tables for label management.
+ * @param   **symbols   Will hold the table of the symbols (labels) of the file.
  * @param   **astList   A pointer to the list of abstract syntax trees for line processing.
+ * @param   *options    The options given to the assembler.
+ * @param   **amText    Pointer to the contents of the .am file if it was not written (taken,
+ *                      NULL if it has no lines), or NULL to read the .am file.
+ * @param   *calls      The calls of the macros with parameters, to report the call of a line
+ *                      with an error (can be NULL).
+ * @param   *errors     The count of the lines with errors of the file (stops at its cap).
  *
  * @return  A process_result indicating the outcome of the first transition phase.
  */
-process_result first_transition(const char *file_name, NameTable *labelsMap[],
-                                ast_list_t **astList);
+process_result first_transition(const char *file_name, SymbolTable **symbols,
+                                ast_list_t **astList, const assembler_options_t *options,
+                                char **amText, MacroCalls *calls, error_count_t *errors);
+
+/*
+ * Performs the lines part of the first transition phase on the lines of a pipeline
+ * (the lines are parsed on the pipeline threads, while the file is pre-processed).
+ * finish_first_transition should be called after it.
+ *
+ * @param   *file_name      The name of the source file to be processed.
+ * @param   **symbols       Will hold the table of the symbols (labels) of the file.
+ * @param   **astList       A pointer to the list of abstract syntax trees for line processing.
+ * @param   *options        The options given to the assembler.
+ * @param   *pipeline       The pipeline of the file.
+ * @param   *diagnoses      The stream to print the errors and the warnings of the lines to.
+ * @param   *calls          The calls of the macros with parameters, to report the call of a
+ *                          line with an error (can be NULL).
+ * @param   *errors         The count of the lines with errors of the file (stops at its cap).
+ *
+ * @return  A process_result indicating the outcome of the lines.
+ */
+process_result first_transition_pipelined(const char *file_name, SymbolTable **symbols,
+                                          ast_list_t **astList,
+                                          const assembler_options_t *options,
+                                          AssemblerPipeline *pipeline, FILE *diagnoses,
+                                          MacroCalls *calls, error_count_t *errors);
+
+/*
+ * Finishes the first transition phase, after all the lines were handled.
+ *
+ * @param   *file_name      The name of the source file to be processed.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ * @param   *astList        The list of abstract syntax trees of the file.
+ * @param   linesRes        The outcome of the lines.
+ * @param   *options        The options given to the assembler.
+ *
+ * @return  A process_result indicating the outcome of the first transition phase.
+ */
+process_result finish_first_transition(const char *file_name, SymbolTable *symbols,
+                                       ast_list_t *astList, process_result linesRes,
+                                       const assembler_options_t *options);
 /* ---------------------------------------- */
 
 #endif /* MMN_14_FIRST_TRANSITION_H */
\ No newline at end of file
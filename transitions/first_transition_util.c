@@ -8,7 +8,7 @@
 /* ---Include header files--- */
 #include <string.h>
 #include <stddef.h>
-#include "../NameTable/NameTable.h"
+#include "../SymbolTable/SymbolTable.h"
 #include "../assembler_ast/assembler_ast.h"
 #include "../general-enums/programFinals.h"
 #include "../general-enums/assemblerFinals.h"
@@ -18,12 +18,14 @@
 #include "../diagnoses/assembler_line_diagnoses.h"
 #include "../util/memoryUtil.h"
 #include "../util/stringsUtil.h"
+#include "first_transition_util.h"
 /* -------------------------- */
 
 /* ---Macros--- */
 /* ------------ */
 
 /* ---Finals--- */
+#define MEMORY_MODULE TRANSITIONS_MEMORY /* For the memory statistics. */
 
 /* Word counter */
 enum {ZERO_WORDS, ONE_WORDS, TWO_WORDS, THREE_WORDS};
@@ -36,11 +38,8 @@ Error addDataFromLineToAST(ast_t *lineAST, const char *line);
 Error addLabelFromLineToAST(ast_t *lineAST, const char *line);
 Error addSentenceFromLineToAST(ast_t *lineAST, const char *line);
 Error addArgumentsFromLineToAST(ast_t *lineAST, const char *line);
-Error addLabelToEntryTable(char *label, NameTable *entLabels, NameTable *extLabels);
-Error addLabelToExternTable(char *label, NameTable *labelsMap[]);
-void addLabelToTable(NameTable *labelMap, char *labelName, int address);
-int howManyWordsForInstruction(ast_t *lineAst);
-int howManyWordsForData(ast_t *lineAst);
+Error addLabelToEntryTable(char *label, SymbolTable *symbols, int lineNumber);
+Error addLabelToExternTable(char *label, SymbolTable *symbols, int lineNumber);
 /* ---------------------------------------- */
 
 /*
@@ -163,75 +162,86 @@ Error addArgumentsFromLineToAST(ast_t *lineAST, const char *line)
 }
 
 /*
- * Adds a label to the specified symbol table during the first transition phase.
+ * Declares a label of a .entry or .extern guidance in the symbol table during the
+ * first transition phase.
  *
- * @param   *label       The label to be added.
- * @param   *labelsMap   An array of symbol tables for label management.
- * @param   table        The type of symbol table to add the label to (NORMAL or EXTERN).
+ * @param   *label       The label to be declared.
+ * @param   *symbols     The table of the symbols (labels) of the file.
+ * @param   table        The type of the declaration (ENTRY or EXTERN).
+ * @param   lineNumber   The number of the line of the declaration.
  * @param   *argError    Pointer to an error variable for recording the outcome of the operation.
  */
-void addLabelToOtherTable(char *label, NameTable *labelsMap[], label_type_t table,
+void addLabelToOtherTable(char *label, SymbolTable *symbols, label_type_t table, int lineNumber,
                           Error *argError)
 {
     Error newError; /* Will hold the found error (if there is). */
 
     if (table == ENTRY)
-        newError = addLabelToEntryTable(label, labelsMap[ENTRY], labelsMap[EXTERN]);
+        newError = addLabelToEntryTable(label, symbols, lineNumber);
     else /* table == EXTERN */
-        newError = addLabelToExternTable(label, labelsMap);
+        newError = addLabelToExternTable(label, symbols, lineNumber);
 
     if (*argError == NO_ERROR)
         *argError = newError;
 }
 
 /*
- * Adds a label to the entry symbol table during the first transition phase.
+ * Declares a label as an entry label during the first transition phase.
  *
- * @param   *label       The label to be added.
- * @param   *entLabels   The entry symbol table for label management.
- * @param   *extLabels   The external symbol table for reference management.
+ * @param   *label       The label to be declared.
+ * @param   *symbols     The table of the symbols (labels) of the file.
+ * @param   lineNumber   The number of the line of the declaration.
  *
  * @return  An error code indicating the outcome of the operation, or NO_ERROR if successful.
  */
-Error addLabelToEntryTable(char *label, NameTable *entLabels, NameTable *extLabels)
+Error addLabelToEntryTable(char *label, SymbolTable *symbols, int lineNumber)
 {
-    Error argLabelError = checkAddToEntryTableError(label, entLabels, extLabels);
+    Error argLabelError = checkAddToEntryTableError(label, symbols);
 
     if (argLabelError == NO_ERROR)
-        addLabelToTable(entLabels, my_strdup(label), ZERO_NUMBER);
+        declareSymbol(symbols, label, SYMBOL_ENTRY, lineNumber);
 
     return argLabelError;
 }
 
 /*
- * Adds a label to the external symbol table during the first transition phase.
+ * Declares a label as an external label during the first transition phase.
  *
- * @param   *label       The label to be added.
- * @param   *labelsMap   An array symbol tables for label management.
+ * @param   *label       The label to be declared.
+ * @param   *symbols     The table of the symbols (labels) of the file.
+ * @param   lineNumber   The number of the line of the declaration.
  *
  * @return  An error code indicating the outcome of the operation, or NO_ERROR if successful.
  */
-Error addLabelToExternTable(char *label, NameTable *labelsMap[])
+Error addLabelToExternTable(char *label, SymbolTable *symbols, int lineNumber)
 {
-    Error argLabelError = checkAddToExternTableError(label, labelsMap);
+    Error argLabelError = checkAddToExternTableError(label, symbols);
 
     if (argLabelError == NO_ERROR)
-        addLabelToTable(labelsMap[EXTERN], my_strdup(label), ZERO_NUMBER);
+        declareSymbol(symbols, label, SYMBOL_EXTERN, lineNumber);
 
     return argLabelError;
 }
 
 /*
- * Adds a label with an associated address to a symbol table during the first transition phase.
+ * Defines the label of a line in the symbol table during the first transition phase.
+ * The address will be decided based on the type of sentence.
  *
- * @param   *labelMap     The symbol table to which the label is added.
- * @param   *labelName    The name of the label to be added.
- * @param   address       The address associated with the label.
+ * @param   *symbols      The table of the symbols (labels) of the file.
+ * @param   *lineAst      The AST of the line with the label.
+ * @param   IC            The Instruction Counter value.
+ * @param   DC            The Data Counter value.
  */
-void addLabelToTable(NameTable *labelMap, char *labelName, int address)
+void addLabelToTable(SymbolTable *symbols, ast_t *lineAst, int IC, int DC)
 {
-    (void) addNameToTable(labelMap, labelName);
-    (void) setNumberInData(labelMap, labelName, address);
+    char *labelName = getLabelName(lineAst);
+
+    if (getSentence(lineAst).sentenceType == DIRECTION_SENTENCE)
+        defineSymbol(symbols, labelName, CODE_SECTION, IC, getAstLineNumber(lineAst));
+    else
+        defineSymbol(symbols, labelName, DATA_SECTION, DC, getAstLineNumber(lineAst));
+
+    (void) clear_ptr(labelName)
 }
 
 /*
@@ -306,10 +316,68 @@ int howManyWordsForData(ast_t *lineAst)
  * Updates all the data labels addresses.
  * Basically, separates between the data image and the instruction image.
  *
- * @param   *labels     List of all labels defined in the file.
+ * @param   *symbols    The table of the symbols (labels) of the file.
  * @param   finalIC     The amount of words needed for the instructions in the file.
  */
-void updateDataLabels(NameTable *labels, int finalIC)
+void updateDataLabels(SymbolTable *symbols, int finalIC)
+{
+    relocateDataSymbols(symbols, finalIC);
+}
+
+/*
+ * Computes again the counters of the AST list and the addresses of all the normal labels,
+ * the same way the first transition does. Used after ASTs are removed or changed.
+ * Data labels of lines that are not in the list (pooled literals) keep their data address.
+ * Assumes that all the ASTs in the list represent valid lines of code !!
+ *
+ * @param   *astList        The list of ASTs.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ */
+void recomputeAddresses(ast_list_t *astList, SymbolTable *symbols)
 {
-    (void) changeToPosAndAdd(labels, finalIC);
-}
\ No newline at end of file
+    int *IC = getCounterPointer(astList, IC_), *DC = getCounterPointer(astList, DC_);
+    ast_list_node_t *currAstNode;
+    ast_t *lineAst;
+    char *labelName;
+
+    updateDataLabels(symbols, PROGRAM_MEM_START - *IC); /* Join the images back. */
+    *IC = *DC = PROGRAM_MEM_START; /* Initializing IC and DC. */
+    for (currAstNode = getAstHead(astList); currAstNode != NULL;
+         currAstNode = getNextAstNode(currAstNode))
+    {
+        lineAst = getAst(currAstNode);
+
+        /* The address will be decided based on the type of sentence. */
+        if (getLabelTypeForTable(lineAst) == NORMAL)
+        {
+            labelName = getLabelName(lineAst);
+            setSymbolValue(symbols, labelName,
+                           (getSentence(lineAst).sentenceType == DIRECTION_SENTENCE)? *IC : *DC);
+            (void) clear_ptr(labelName)
+        }
+
+        updateCounters(lineAst, IC, DC);
+    }
+
+    /* Separate instructions and data */
+    updateDataLabels(symbols, *IC - PROGRAM_MEM_START);
+}
+
+/*
+ * Gets the label of a line with an error in itself (a line that has no AST).
+ *
+ * @param   *line   The line.
+ *
+ * @return  The label of the line (needs to be freed), or NULL if the line has no label.
+ */
+char *getLabelOfErrorLine(const char *line)
+{
+    char *label = (isColonInLineForLabel(line) == TRUE)? getLabelFromLine(line) : NULL;
+
+    if (label != NULL && *label == '\0') /* Only a colon. */
+    {
+        (void) clear_ptr(label)
+    }
+
+    return label;
+}
@@ -10,7 +10,7 @@
 
 /* ---------------Prototypes--------------- */
 
-void updateDataLabels(NameTable *labels, int finalIC);
+void updateDataLabels(SymbolTable *symbols, int finalIC);
 
 /*
  * Build an abstract syntax tree (AST) from the given line of assembly code.
@@ -24,23 +24,27 @@ void updateDataLabels(NameTable *labels, int finalIC);
 ast_t *buildAstFromLine(const char *line, Error *lineError);
 
 /*
- * Adds a label with an associated address to a symbol table during the first transition phase.
+ * Defines the label of a line in the symbol table during the first transition phase.
+ * The address will be decided based on the type of sentence.
  *
- * @param   *labelMap     The symbol table to which the label is added.
- * @param   *labelName    The name of the label to be added.
- * @param   address       The address associated with the label.
+ * @param   *symbols      The table of the symbols (labels) of the file.
+ * @param   *lineAst      The AST of the line with the label.
+ * @param   IC            The Instruction Counter value.
+ * @param   DC            The Data Counter value.
  */
-void addLabelToTable(NameTable *labelMap, char *labelName, int address);
+void addLabelToTable(SymbolTable *symbols, ast_t *lineAst, int IC, int DC);
 
 /*
- * Adds a label to the specified symbol table during the first transition phase.
+ * Declares a label of a .entry or .extern guidance in the symbol table during the
+ * first transition phase.
  *
- * @param   *label       The label to be added.
- * @param   *labelsMap   An array of symbol tables for label management.
- * @param   table        The type of symbol table to add the label to (NORMAL or EXTERN).
+ * @param   *label       The label to be declared.
+ * @param   *symbols     The table of the symbols (labels) of the file.
+ * @param   table        The type of the declaration (ENTRY or EXTERN).
+ * @param   lineNumber   The number of the line of the declaration.
  * @param   *argError    Pointer to an error variable for recording the outcome of the operation.
  */
-void addLabelToOtherTable(char *label, NameTable *labelsMap[], label_type_t table,
+void addLabelToOtherTable(char *label, SymbolTable *symbols, label_type_t table, int lineNumber,
                           Error *argError);
 
 /*
@@ -54,6 +58,45 @@ void addLabelToOtherTable(char *label, NameTable *labelsMap[], label_type_t tabl
  */
 void updateCounters(ast_t *lineAst, int *IC, int *DC);
 
+/*
+ * Calculates the number of words required to represent an instruction in memory.
+ * Assumes that lineAst represents a valid line of code !!
+ *
+ * @param   *lineAst    The abstract syntax tree (AST) representing the processed line
+ *                      with the instruction.
+ *
+ * @return  The number of words needed to store the instruction.
+ */
+int howManyWordsForInstruction(ast_t *lineAst);
+
+/*
+ * Calculates the number of words required to represent data in memory.
+ *
+ * @param   *lineAst  The abstract syntax tree (AST) representing the processed line.
+ *
+ * @return  The number of words needed to store the data.
+ */
+int howManyWordsForData(ast_t *lineAst);
+
+/*
+ * Computes again the counters of the AST list and the addresses of all the normal labels,
+ * the same way the first transition does. Used after ASTs are removed or changed.
+ * Assumes that all the ASTs in the list represent valid lines of code !!
+ *
+ * @param   *astList        The list of ASTs.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ */
+void recomputeAddresses(ast_list_t *astList, SymbolTable *symbols);
+
+/*
+ * Gets the label of a line with an error in itself (a line that has no AST).
+ *
+ * @param   *line   The line.
+ *
+ * @return  The label of the line (needs to be freed), or NULL if the line has no label.
+ */
+char *getLabelOfErrorLine(const char *line);
+
 /* ---------------------------------------- */
 
 #endif /* MMN_14_FIRST_TRANSITION_UTIL_H */
@@ -0,0 +1,505 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * literal_pool.c
+ *
+ * This file implements the literal pool of the first transition (option -P).
+ *
+ * A literal is a table of the data: a .data or .string line with a label, and all the lines
+ * without a label after it (they continue its table, the data lines between are in the order
+ * of their words). When a table has the same words as an earlier table, its lines are removed
+ * from the data image, and its label gets the address of the earlier table. A .string and a
+ * .data with the same words (like .string "ab" and .data 97, 98, 0) are the same literal.
+ * Data lines without a label before them are never pooled, they can only be reached as a part
+ * of the table before them.
+ * A table that the program can write to is a variable and not a literal, so it is not pooled
+ * (and no later table is pooled with it): a table whose label is the destination operand of
+ * an instruction that writes it (mov, add, sub, not, clr, lea, inc, dec and red), or a .entry
+ * label (another file that is linked with this one can write it).
+ *
+ * The pool runs at the end of the first transition, on the list of ASTs, and the literals are
+ * kept in a hash table of buckets, where each bucket is a linked list.
+ */
+
+/* ---Include header files--- */
+#include <stddef.h>
+#include <string.h>
+#include "../new-data-types/boolean.h"
+#include "../SymbolTable/SymbolTable.h"
+#include "../assembler_ast/assembler_ast.h"
+#include "../general-enums/assemblerFinals.h"
+#include "../general-enums/indexes.h"
+#include "../general-enums/programFinals.h"
+#include "../errors/error_types/error_types.h"
+#include "../util/memoryUtil.h"
+#include "first_transition_util.h"
+#include "literal_pool.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE TRANSITIONS_MEMORY /* For the memory statistics. */
+#define POOL_BUCKETS 256 /* Must be a power of 2. */
+#define FNV_OFFSET_BASIS 2166136261UL
+#define FNV_PRIME 16777619UL
+#define HASH_MASK 0xffffffffUL
+#define QUOTES_LEN 1
+#define STRING_END 0
+#define NOT_POOLED (-1)
+#define NO_LINE (-1)
+/* ------------ */
+
+/* A literal in the pool. */
+typedef struct literal_t
+{
+    int *words; /* The values of the words of the literal. */
+    int length; /* The amount of words. */
+    int address; /* The address of the literal. */
+    unsigned long hash;
+    struct literal_t *next; /* The next literal in the same bucket. */
+} literal_t;
+
+/* The pool of the literals. */
+typedef struct
+{
+    literal_t *buckets[POOL_BUCKETS];
+} literal_pool_t;
+
+/* What the pool knows about a data line. */
+typedef struct
+{
+    ast_t *lineAst;
+    int address; /* The address of the first word of the line (the data is after the code). */
+    int words; /* The amount of words of the line. */
+    int pooledAddress; /* The address of the same words in an earlier table, or NOT_POOLED. */
+    boolean isWritten; /* TRUE if the program can write to the table of the line. */
+} data_line_t;
+
+/* ---------------Prototypes--------------- */
+boolean isLiteralLine(ast_t *lineAst);
+data_line_t *collectDataLines(ast_list_t *astList, int *linesAmount);
+void markWrittenTables(ast_list_t *astList, SymbolTable *symbols, data_line_t *lines,
+                       int linesAmount);
+boolean isWritingInstruction(ast_t *lineAst);
+int findLineOfAddress(const data_line_t *lines, int linesAmount, int address);
+void poolTables(data_line_t *lines, int linesAmount);
+int *getTableWords(const data_line_t *lines, int firstLine, int endLine, int *length);
+int *getLiteralWords(ast_t *lineAst, int *length);
+unsigned long hashLiteralWords(const int *words, int length);
+int findPooledLiteral(literal_pool_t *pool, int *words, int length, int address);
+int removePooledLines(ast_list_t *astList, const data_line_t *lines, SymbolTable *symbols);
+void clearLiteralPool(literal_pool_t *pool);
+/* ---------------------------------------- */
+
+/*
+ * Removes the tables of the data that have the same words as an earlier table from the list
+ * of ASTs made in the first transition, and computes again the counters and the addresses of
+ * the labels (the label of a removed table gets the address of the earlier one).
+ * Tables that the program can write to are not pooled.
+ * Assumes that the first transition finished successfully !!
+ *
+ * @param   *astList        The list of ASTs made in the first transition.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ *
+ * @return  The amount of words saved.
+ */
+int pool_literals(ast_list_t *astList, SymbolTable *symbols)
+{
+    int linesAmount, savedWords = ZERO_COUNT;
+    data_line_t *lines = collectDataLines(astList, &linesAmount);
+
+    if (linesAmount > ZERO_COUNT)
+    {
+        markWrittenTables(astList, symbols, lines, linesAmount);
+        poolTables(lines, linesAmount);
+        savedWords = removePooledLines(astList, lines, symbols);
+    }
+
+    (void) clear_ptr(lines)
+    return savedWords;
+}
+
+/*
+ * Checks if a line is a .data or .string guidance.
+ *
+ * @param   *lineAst    The AST of the line.
+ *
+ * @return  TRUE if the line is a .data or .string guidance, otherwise FALSE.
+ */
+boolean isLiteralLine(ast_t *lineAst)
+{
+    return (getSentence(lineAst).sentenceType == GUIDANCE_SENTENCE &&
+            (getGuidanceFromAST(lineAst) == data || getGuidanceFromAST(lineAst) == str))?
+           TRUE : FALSE;
+}
+
+/*
+ * Collects the data lines of the list of ASTs with their addresses.
+ *
+ * @param   *astList        The list of ASTs.
+ * @param   *linesAmount    Will hold the amount of data lines.
+ *
+ * @return  The data lines, in the order of the list (NULL if there are none).
+ */
+data_line_t *collectDataLines(ast_list_t *astList, int *linesAmount)
+{
+    ast_list_node_t *currNode;
+    data_line_t *lines = NULL; /* Value to return. */
+    int DC = *getCounterPointer(astList, IC_);
+    int i; /* Loop variable. */
+
+    *linesAmount = ZERO_COUNT;
+    for (currNode = getAstHead(astList); currNode != NULL; currNode = getNextAstNode(currNode))
+        if (isLiteralLine(getAst(currNode)) == TRUE)
+            (*linesAmount)++;
+
+    if (*linesAmount > ZERO_COUNT)
+        lines = (data_line_t *) allocate_space(*linesAmount * sizeof(data_line_t));
+
+    for (i = ZERO_INDEX, currNode = getAstHead(astList); currNode != NULL;
+         currNode = getNextAstNode(currNode))
+        if (isLiteralLine(getAst(currNode)) == TRUE)
+        {
+            lines[i].lineAst = getAst(currNode);
+            lines[i].address = DC;
+            lines[i].words = howManyWordsForData(lines[i].lineAst);
+            lines[i].pooledAddress = NOT_POOLED;
+            lines[i].isWritten = FALSE;
+            DC += lines[i++].words;
+        }
+
+    return lines;
+}
+
+/*
+ * Marks the data lines of the tables that the program can write to: the tables of the
+ * destination operands of the writing instructions, and the tables of the .entry labels.
+ *
+ * @param   *astList        The list of ASTs.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ * @param   *lines          The data lines of the file.
+ * @param   linesAmount     The amount of data lines.
+ */
+void markWrittenTables(ast_list_t *astList, SymbolTable *symbols, data_line_t *lines,
+                       int linesAmount)
+{
+    ast_list_node_t *currNode;
+    arg_node_t *destArg;
+    const symbol_t *label;
+    char *labelName;
+    int lineIndex, i; /* i is a loop variable. */
+
+    for (currNode = getAstHead(astList); currNode != NULL; currNode = getNextAstNode(currNode))
+        if (isWritingInstruction(getAst(currNode)) == TRUE)
+        {
+            /* The destination operand is the last one. */
+            for (destArg = getArgList(getAst(currNode)); getNextNode(destArg) != NULL;
+                 destArg = getNextNode(destArg))
+                ;
+
+            label = (getArgAddressingMethod(destArg) == DIRECT)?
+                    findSymbol(symbols, getArgData(destArg).data.string) : NULL;
+            lineIndex = (label != NULL && label -> section == DATA_SECTION)?
+                        findLineOfAddress(lines, linesAmount, label -> value) : NO_LINE;
+            if (lineIndex != NO_LINE)
+                lines[lineIndex].isWritten = TRUE;
+        }
+
+    for (i = ZERO_INDEX; i < linesAmount; i++)
+        if (isLabel(lines[i].lineAst) == TRUE)
+        {
+            labelName = getLabelName(lines[i].lineAst);
+            if (getSymbolFlags(symbols, labelName) & SYMBOL_ENTRY)
+                lines[i].isWritten = TRUE;
+            (void) clear_ptr(labelName)
+        }
+}
+
+/*
+ * Checks if a line is an instruction that writes its destination operand.
+ *
+ * @param   *lineAst    The AST of the line.
+ *
+ * @return  TRUE if the line is a writing instruction, otherwise FALSE.
+ */
+boolean isWritingInstruction(ast_t *lineAst)
+{
+    boolean isWriting = FALSE;
+
+    if (getSentence(lineAst).sentenceType == DIRECTION_SENTENCE)
+        switch (getOpcodeFromAST(lineAst))
+        {
+            case mov:
+            case add:
+            case sub:
+            case not:
+            case clr:
+            case lea:
+            case inc:
+            case dec:
+            case red:
+                isWriting = TRUE;
+                break;
+
+            default:
+                break;
+        }
+
+    return isWriting;
+}
+
+/*
+ * Finds the data line that starts in an address.
+ *
+ * @param   *lines          The data lines of the file (by the order of their addresses).
+ * @param   linesAmount     The amount of data lines.
+ * @param   address         The address.
+ *
+ * @return  The index of the line, or NO_LINE if no line starts in the address.
+ */
+int findLineOfAddress(const data_line_t *lines, int linesAmount, int address)
+{
+    int low = ZERO_INDEX, high = linesAmount - 1, middle, lineIndex = NO_LINE;
+
+    while (lineIndex == NO_LINE && low <= high) /* Binary search. */
+    {
+        middle = low + (high - low) / 2;
+        if (lines[middle].address == address)
+            lineIndex = middle;
+        else if (lines[middle].address < address)
+            low = middle + 1;
+        else
+            high = middle - 1;
+    }
+
+    return lineIndex;
+}
+
+/*
+ * Finds the tables with the same words as an earlier table, and marks their lines with the
+ * addresses of the same words in the earlier table (tables that can be written are skipped).
+ *
+ * @param   *lines          The data lines of the file.
+ * @param   linesAmount     The amount of data lines.
+ */
+void poolTables(data_line_t *lines, int linesAmount)
+{
+    literal_pool_t pool;
+    int *words, length, pooledAddress, firstLine, endLine, i;
+
+    for (i = ZERO_INDEX; i < POOL_BUCKETS; i++)
+        pool.buckets[i] = NULL;
+
+    for (firstLine = ZERO_INDEX; firstLine < linesAmount; firstLine = endLine)
+    {
+        /* A table is a line with a label and the lines without a label after it. */
+        for (endLine = firstLine + 1; endLine < linesAmount &&
+                                      getLabelTypeForTable(lines[endLine].lineAst) != NORMAL;
+             endLine++)
+            ;
+
+        /* A table that can be written is not a literal. */
+        if (getLabelTypeForTable(lines[firstLine].lineAst) == NORMAL &&
+            lines[firstLine].isWritten == FALSE)
+        {
+            words = getTableWords(lines, firstLine, endLine, &length);
+            pooledAddress = findPooledLiteral(&pool, words, length, lines[firstLine].address);
+
+            for (i = firstLine; pooledAddress != NOT_POOLED && i < endLine; i++)
+                lines[i].pooledAddress = pooledAddress + (lines[i].address -
+                                                          lines[firstLine].address);
+        }
+    }
+
+    clearLiteralPool(&pool);
+}
+
+/*
+ * Gets the values of the words of a table (of lines that follow each other).
+ *
+ * @param   *lines      The data lines of the file.
+ * @param   firstLine   The index of the first line of the table.
+ * @param   endLine     The index after the last line of the table.
+ * @param   *length     Will hold the amount of words.
+ *
+ * @return  The values of the words of the table.
+ */
+int *getTableWords(const data_line_t *lines, int firstLine, int endLine, int *length)
+{
+    int *words, *lineWords, lineLength, i; /* i is a loop variable. */
+
+    *length = lines[endLine - 1].address + lines[endLine - 1].words - lines[firstLine].address;
+    words = (int *) allocate_space(*length * sizeof(int));
+
+    for (i = firstLine; i < endLine; i++)
+    {
+        lineWords = getLiteralWords(lines[i].lineAst, &lineLength);
+        memcpy(words + (lines[i].address - lines[firstLine].address), lineWords,
+               lineLength * sizeof(int));
+        (void) clear_ptr(lineWords)
+    }
+
+    return words;
+}
+
+/*
+ * Gets the values of the words of the literal of a .data or .string line.
+ *
+ * @param   *lineAst    The AST of the line.
+ * @param   *length     Will hold the amount of words.
+ *
+ * @return  The values of the words.
+ */
+int *getLiteralWords(ast_t *lineAst, int *length)
+{
+    int *words; /* Value to return. */
+    arg_node_t *currArg;
+    char *dataString;
+    int i; /* Loop variable. */
+
+    *length = howManyWordsForData(lineAst);
+    words = (int *) allocate_space(*length * sizeof(int));
+
+    if (getGuidanceFromAST(lineAst) == data) /* Numbers. */
+        for (i = ZERO_INDEX, currArg = getArgList(lineAst); currArg != NULL;
+             i++, currArg = getNextNode(currArg))
+            words[i] = getArgData(currArg).data.num;
+
+    else /* String (ignore the " "), with a null terminator. */
+    {
+        dataString = getArgData(getArgList(lineAst)).data.string;
+        for (i = ZERO_INDEX; i < *length - 1; i++)
+            words[i] = dataString[i + QUOTES_LEN];
+        words[i] = STRING_END;
+    }
+
+    return words;
+}
+
+/*
+ * Calculates the hash of the words of a literal (FNV-1a over the values of the words).
+ *
+ * @param   *words      The values of the words.
+ * @param   length      The amount of words.
+ *
+ * @return  The hash of the words.
+ */
+unsigned long hashLiteralWords(const int *words, int length)
+{
+    unsigned long hash = FNV_OFFSET_BASIS;
+    int i; /* Loop variable. */
+
+    for (i = ZERO_INDEX; i < length; i++)
+        hash = ((hash ^ (unsigned long) (unsigned int) words[i]) * FNV_PRIME) & HASH_MASK;
+
+    return hash;
+}
+
+/*
+ * Finds an earlier literal with the same words in the pool, or adds the words to the pool if
+ * there isn't one.
+ *
+ * @param   *pool       The pool of the literals.
+ * @param   *words      The values of the words (taken by the pool or freed).
+ * @param   length      The amount of words.
+ * @param   address     The address of the words.
+ *
+ * @return  The address of the earlier literal, or NOT_POOLED if there isn't one.
+ */
+int findPooledLiteral(literal_pool_t *pool, int *words, int length, int address)
+{
+    unsigned long hash = hashLiteralWords(words, length);
+    literal_t *currLiteral = pool -> buckets[hash & (POOL_BUCKETS - 1)];
+
+    for (; currLiteral != NULL; currLiteral = currLiteral -> next)
+        if (currLiteral -> hash == hash && currLiteral -> length == length &&
+            memcmp(currLiteral -> words, words, length * sizeof(int)) == 0)
+        {
+            (void) clear_ptr(words)
+            return currLiteral -> address;
+        }
+
+    /* Add it to the start of its bucket. */
+    currLiteral = (literal_t *) allocate_space(sizeof(literal_t));
+    currLiteral -> words = words;
+    currLiteral -> length = length;
+    currLiteral -> address = address;
+    currLiteral -> hash = hash;
+    currLiteral -> next = pool -> buckets[hash & (POOL_BUCKETS - 1)];
+    pool -> buckets[hash & (POOL_BUCKETS - 1)] = currLiteral;
+
+    return NOT_POOLED;
+}
+
+/*
+ * Removes the pooled data lines from the list of ASTs, and computes again the counters and
+ * the addresses of the labels.
+ *
+ * @param   *astList    The list of ASTs.
+ * @param   *lines      The data lines of the file (in the order of the list).
+ * @param   *symbols    The table of the symbols (labels) of the file.
+ *
+ * @return  The amount of words removed.
+ */
+int removePooledLines(ast_list_t *astList, const data_line_t *lines, SymbolTable *symbols)
+{
+    ast_list_node_t *prevNode = NULL, *currNode = getAstHead(astList), *nextNode;
+    int dataStart = *getCounterPointer(astList, IC_);
+    int dataSize = *getCounterPointer(astList, DC_) - PROGRAM_MEM_START;
+    int *newOffsets = (int *) allocate_space(dataSize * sizeof(int));
+    int removedWords = ZERO_COUNT, newOffset = ZERO_COUNT, i = ZERO_INDEX, word, offset;
+    boolean isPooled;
+
+    for (; currNode != NULL; currNode = nextNode)
+    {
+        nextNode = getNextAstNode(currNode);
+        isPooled = FALSE;
+
+        if (isLiteralLine(getAst(currNode)) == TRUE)
+        {
+            /* Words of a pooled line move to the same words of the earlier table. */
+            offset = lines[i].address - dataStart;
+            isPooled = (lines[i].pooledAddress != NOT_POOLED)? TRUE : FALSE;
+            for (word = ZERO_INDEX; word < lines[i].words; word++)
+                newOffsets[offset + word] = (isPooled == FALSE)? newOffset + word :
+                                            newOffsets[lines[i].pooledAddress - dataStart + word];
+
+            if (isPooled == TRUE)
+                removedWords += lines[i].words;
+            else
+                newOffset += lines[i].words;
+            i++;
+        }
+
+        if (isPooled == TRUE)
+            (void) deleteNextAstFromList(astList, prevNode);
+        else
+            prevNode = currNode;
+    }
+
+    /* The labels of the pooled tables have no lines of their own anymore. */
+    moveDataSymbols(symbols, dataStart, newOffsets, dataSize);
+    recomputeAddresses(astList, symbols);
+
+    (void) clear_ptr(newOffsets)
+    return removedWords;
+}
+
+/*
+ * Frees the memory of the literals of a pool.
+ *
+ * @param   *pool   The pool of the literals.
+ */
+void clearLiteralPool(literal_pool_t *pool)
+{
+    literal_t *currLiteral, *nextLiteral;
+    int i; /* Loop variable. */
+
+    for (i = ZERO_INDEX; i < POOL_BUCKETS; i++)
+        for (currLiteral = pool -> buckets[i]; currLiteral != NULL; currLiteral = nextLiteral)
+        {
+            nextLiteral = currLiteral -> next;
+            (void) clear_ptr(currLiteral -> words)
+            (void) clear_ptr(currLiteral)
+        }
+}
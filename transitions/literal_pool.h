@@ -0,0 +1,31 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the literal_pool.c file.
+ */
+
+#ifndef MMN_14_LITERAL_POOL_H
+#define MMN_14_LITERAL_POOL_H
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Removes the tables of the data that have the same words as an earlier table from the list
+ * of ASTs made in the first transition, and computes again the counters and the addresses of
+ * the labels (the label of a removed table gets the address of the earlier one).
+ * A table is a .data or .string line with a label and the data lines without a label after it.
+ * A table that the program can write to (its label is the destination operand of mov, add,
+ * sub, not, clr, lea, inc, dec or red, or is a .entry label) is not pooled.
+ * Assumes that the first transition finished successfully !!
+ *
+ * @param   *astList        The list of ASTs made in the first transition.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ *
+ * @return  The amount of words saved.
+ */
+int pool_literals(ast_list_t *astList, SymbolTable *symbols);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_LITERAL_POOL_H */
@@ -0,0 +1,477 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file has the macros with parameters (mcro name p1, p2 ... called with name a1, a2).
+ *
+ * The body of a macro with parameters is compiled once, when it is defined, to a template -
+ * a header with the names of the parameters, then the literal text of the body where every use
+ * of a parameter (a whole word of letters and numbers, outside of quotes) is a slot with its
+ * index. A call is expanded with one pass that measures the expansion and one pass that copies
+ * it to the end of the .am contents, the body is not searched again.
+ * The templates are kept as the strings of the macro table, so the macros of included files
+ * are shared as they are.
+ *
+ * The calls of these macros are recorded with the lines of the .am file that they were expanded
+ * to, so an error in an expanded line can be reported with its call in the source file.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <string.h>
+#include "../new-data-types/boolean.h"
+#include "../new-data-types/error_count.h"
+#include "../NameTable/NameTable.h"
+#include "../general-enums/indexes.h"
+#include "../general-enums/neededKeys.h"
+#include "../errors/error_types/error_types.h"
+#include "../errors/assembler_errors.h"
+#include "../diagnoses/assembler_line_diagnoses.h"
+#include "../diagnoses/diagnose_util.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "macro_template.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE TRANSITIONS_MEMORY /* For the memory statistics. */
+#define TEMPLATE_MARK '\x02' /* The first char of a template (before the names of the params). */
+#define SLOT_MARK '\x01' /* A slot in a template, the next char is the index of its param. */
+#define FIRST_SLOT_CHAR 'A' /* The char of the index of the first parameter. */
+#define SLOT_LEN 2
+#define NO_PARAMETER (-1)
+#define MAX_LINE_LEN 80
+#define MAX_READ_LINE_LEN (MAX_LINE_LEN + 1) /* The .am lines are read in parts of this length. */
+/* ------------ */
+
+/* A recorded call of a macro with parameters. */
+typedef struct macro_call_t
+{
+    char *name; /* The name of the macro. */
+    int callLine; /* The line of the call in the source (.as) file. */
+    int firstAmLine, lastAmLine; /* The lines of the .am file that the call was expanded to. */
+    struct macro_call_t *next;
+} macro_call_t;
+
+/* The calls of a file. Written by the pre-process, and read by the first transition while the
+ * file is pre-processed (in a pipeline), so a call is published after it is made. */
+struct MacroCalls
+{
+    macro_call_t *head; /* Published (atomic). */
+    macro_call_t *tail; /* Of the writer. */
+    size_t countedLength; /* The length of the .am contents that its lines were counted. */
+    int countedLines; /* The .am lines in the counted contents. */
+    int lineLength; /* The length of the last counted line, if it is not ended. */
+    macro_call_t *cursor; /* Of the reader, the call of the last reported line. */
+};
+
+/* ---------------Prototypes--------------- */
+int getParametersAmount(const char *body);
+int getParameterIndex(const char *header, const char *word, int wordLength);
+char *compileTemplateLine(const char *header, const char *line);
+Error measureTemplate(const char *template, char **args, size_t *expansionLength);
+void copyTemplate(char *dest, const char *template, char **args);
+void countAmLines(MacroCalls *calls, const char *amFileContents, size_t length);
+/* ---------------------------------------- */
+
+/*
+ * Adds the parameters of a new macro definition to the macro (makes it a template).
+ * Does nothing if the definition has no parameters, or if they are not legal.
+ *
+ * @param   *macroTable     The table of the macros (the macro is in it already).
+ * @param   *name           The name of the macro.
+ * @param   *line           The definition line (mcro name p1, p2, ...).
+ */
+void addMacroParameters(NameTable *macroTable, const char *name, const char *line)
+{
+    int paramsAmount, i; /* i is a loop variable. */
+    char **params = getMacroArguments(line, THIRD_WORD, &paramsAmount);
+    char *header, *curr;
+    size_t headerLength = 1; /* The mark, then the names separated by commas, then a new line. */
+
+    /* A macro that was defined before keeps its first definition. */
+    if (paramsAmount > 0 && areLegalMacroParameters(params, paramsAmount) == TRUE &&
+        getDataByName(macroTable, name) == NULL)
+    {
+        for (i = 0; i < paramsAmount; i++)
+            headerLength += strlen(params[i]) + 1;
+
+        curr = header = (char *) allocate_space(headerLength + 1);
+        *curr++ = TEMPLATE_MARK;
+        for (i = 0; i < paramsAmount; i++)
+        {
+            (void) strcpy(curr, params[i]);
+            curr += strlen(params[i]);
+            *curr++ = (i < paramsAmount - 1)? COMMA : ENTER_KEY;
+        }
+        *curr = NULL_TERMINATOR;
+
+        (void) addStringToData(macroTable, name, header);
+        (void) clear_ptr(header)
+    }
+
+    freeMacroArguments(params, paramsAmount);
+}
+
+/*
+ * Adds a line of the body of a macro definition to the macro.
+ * In a template, the uses of the parameters in the line are compiled to slots.
+ *
+ * @param   *macroTable     The table of the macros.
+ * @param   *name           The name of the macro.
+ * @param   *line           The line of the body.
+ */
+void addMacroBodyLine(NameTable *macroTable, const char *name, const char *line)
+{
+    name_data_t *data = getDataByName(macroTable, name);
+    char *compiledLine;
+
+    if (data != NULL && isMacroTemplate(data -> string) == TRUE)
+    {
+        compiledLine = compileTemplateLine(data -> string, line);
+        (void) addStringToData(macroTable, name, compiledLine);
+        (void) clear_ptr(compiledLine)
+    }
+    else
+        (void) addStringToData(macroTable, name, line);
+}
+
+/*
+ * Checks if the body of a macro is a template (the macro has parameters).
+ *
+ * @param   *body   The body of the macro (can be NULL).
+ *
+ * @return  TRUE if the body is a template, otherwise FALSE.
+ */
+boolean isMacroTemplate(const char *body)
+{
+    return (body != NULL && body[ZERO_INDEX] == TEMPLATE_MARK)? TRUE : FALSE;
+}
+
+/*
+ * Expands a call of a macro to the end of the .am contents.
+ *
+ * @param   **amFileContents    Pointer to string that holds the contents of the .am file.
+ * @param   *body               The body of the called macro (can be NULL if it is empty).
+ * @param   *line               The call line (name a1, a2, ...).
+ *
+ * @return  The error in the call, or NO_ERROR (0) if there wasn't (then it was expanded).
+ *          An expanded line that is too long is an error of the call.
+ */
+Error expandMacroCall(char **amFileContents, const char *body, const char *line)
+{
+    Error callError = NO_ERROR; /* Value to return. */
+    int argsAmount, i; /* i is a loop variable. */
+    char **args = getMacroArguments(line, SECOND_WORD, &argsAmount);
+    const char *template;
+    size_t amLength, expansionLength;
+
+    for (i = 0; i < argsAmount && callError == NO_ERROR; i++)
+        if (args[i][ZERO_INDEX] == NULL_TERMINATOR)
+            callError = EXPECTED_ARGUMENT_ERR;
+
+    if (callError == NO_ERROR && argsAmount != getParametersAmount(body))
+        callError = MACRO_ARGUMENTS_AMOUNT_ERR;
+
+    else if (callError == NO_ERROR && isMacroTemplate(body) == FALSE)
+    {
+        if (body != NULL)
+            addTwoStrings(amFileContents, body);
+    }
+
+    else if (callError == NO_ERROR)
+    {
+        template = strchr(body, ENTER_KEY) + 1; /* The body after the header. */
+        callError = measureTemplate(template, args, &expansionLength); /* To copy it once. */
+
+        if (callError == NO_ERROR)
+        {
+            amLength = (*amFileContents != NULL)? strlen(*amFileContents) : 0;
+            *amFileContents = (char *) reallocate_space(*amFileContents,
+                                                        amLength + expansionLength + 1);
+            copyTemplate(*amFileContents + amLength, template, args);
+        }
+    }
+
+    freeMacroArguments(args, argsAmount);
+    return callError;
+}
+
+/*
+ * Creates a new empty MacroCalls.
+ *
+ * @return  Pointer to the newly created MacroCalls.
+ */
+MacroCalls *createMacroCalls(void)
+{
+    MacroCalls *calls = (MacroCalls *) allocate_space(sizeof(MacroCalls));
+
+    calls -> head = calls -> tail = calls -> cursor = NULL;
+    calls -> countedLength = 0;
+    calls -> countedLines = calls -> lineLength = 0;
+
+    return calls;
+}
+
+/*
+ * Records a call of a macro, after it was expanded.
+ * Should be called for the calls in their order, by one thread (the pre-process).
+ *
+ * @param   *calls              The calls.
+ * @param   *name               The name of the macro (copied).
+ * @param   callLine            The line of the call in the source (.as) file.
+ * @param   *amFileContents     The contents of the .am file, with the expansion of the call.
+ * @param   expansionStart      The length of the contents before the expansion.
+ */
+void addMacroCall(MacroCalls *calls, const char *name, int callLine, const char *amFileContents,
+                  size_t expansionStart)
+{
+    macro_call_t *call;
+    int firstAmLine;
+
+    /* Only the contents after the last call are counted. */
+    countAmLines(calls, amFileContents, expansionStart);
+    firstAmLine = calls -> countedLines + 1;
+    countAmLines(calls, amFileContents, expansionStart + strlen(amFileContents + expansionStart));
+
+    if (calls -> countedLines + ((calls -> lineLength > 0)? 1 : 0) >= firstAmLine)
+    {
+        call = (macro_call_t *) allocate_space(sizeof(macro_call_t));
+        call -> name = my_strdup(name);
+        call -> callLine = callLine;
+        call -> firstAmLine = firstAmLine;
+        call -> lastAmLine = calls -> countedLines + ((calls -> lineLength > 0)? 1 : 0);
+        call -> next = NULL;
+
+        /* Publish the call, after it was made. */
+        if (calls -> tail == NULL)
+            __atomic_store_n(&calls -> head, call, __ATOMIC_RELEASE);
+        else
+            __atomic_store_n(&calls -> tail -> next, call, __ATOMIC_RELEASE);
+        calls -> tail = call;
+    }
+}
+
+/*
+ * Prints the call of a macro that a line of the .am file was expanded from (if it was).
+ * Can be called while the calls are recorded, by one thread, for the lines in their order.
+ *
+ * @param   *diagnoses  The stream to print the call to.
+ * @param   *calls      The calls (can be NULL).
+ * @param   amLine      The line in the .am file.
+ */
+void reportMacroCallOfLine(FILE *diagnoses, MacroCalls *calls, int amLine)
+{
+    macro_call_t *call, *next;
+
+    if (calls != NULL)
+    {
+        /* The lines are in their order, so the search goes on from the last call. */
+        call = (calls -> cursor != NULL)?
+                calls -> cursor : __atomic_load_n(&calls -> head, __ATOMIC_ACQUIRE);
+        while (call != NULL && call -> lastAmLine < amLine &&
+               (next = __atomic_load_n(&call -> next, __ATOMIC_ACQUIRE)) != NULL)
+            call = next;
+        calls -> cursor = call;
+
+        if (call != NULL && call -> firstAmLine <= amLine && amLine <= call -> lastAmLine)
+            report_macro_call(diagnoses, call -> name, call -> callLine);
+    }
+}
+
+/*
+ * Deletes the calls and frees their memory.
+ *
+ * @param   **pCalls    Pointer to the calls to delete.
+ */
+void deleteMacroCalls(MacroCalls **pCalls)
+{
+    macro_call_t *call, *next;
+
+    if (*pCalls != NULL)
+    {
+        for (call = (*pCalls) -> head; call != NULL; call = next)
+        {
+            next = call -> next;
+            (void) clear_ptr(call -> name)
+            (void) clear_ptr(call)
+        }
+
+        (void) clear_ptr(*pCalls)
+    }
+}
+
+/*
+ * Gets the amount of the parameters of a macro.
+ *
+ * @param   *body   The body of the macro (can be NULL).
+ *
+ * @return  The amount of the parameters (0 if the body is not a template).
+ */
+int getParametersAmount(const char *body)
+{
+    int paramsAmount = 0; /* Value to return. */
+
+    if (isMacroTemplate(body) == TRUE)
+        for (paramsAmount = 1; *body != ENTER_KEY; body++)
+            if (*body == COMMA)
+                paramsAmount++;
+
+    return paramsAmount;
+}
+
+/*
+ * Gets the index of a parameter in the header of a template.
+ *
+ * @param   *header         The template (starts with its header).
+ * @param   *word           The word to look for (not null-terminated).
+ * @param   wordLength      The length of the word.
+ *
+ * @return  The index of the parameter, or NO_PARAMETER if the word is not a parameter.
+ */
+int getParameterIndex(const char *header, const char *word, int wordLength)
+{
+    int index = 0, paramLength;
+
+    for (header++; *header != ENTER_KEY; header += paramLength + 1, index++)
+    {
+        for (paramLength = 0; header[paramLength] != COMMA && header[paramLength] != ENTER_KEY;
+             paramLength++)
+            ;
+
+        if (paramLength == wordLength && strncmp(header, word, (size_t) wordLength) == 0)
+            return index;
+        if (header[paramLength] == ENTER_KEY)
+            break;
+    }
+
+    return NO_PARAMETER;
+}
+
+/*
+ * Compiles a line of the body of a template - every use of a parameter is a slot.
+ *
+ * @param   *header     The template so far (starts with its header).
+ * @param   *line       The line to compile.
+ *
+ * @return  The compiled line (needs to be freed).
+ */
+char *compileTemplateLine(const char *header, const char *line)
+{
+    /* A slot is at most twice the length of the word it replaces. */
+    char *compiledLine = (char *) allocate_space(SLOT_LEN * strlen(line) + 1);
+    char *curr = compiledLine;
+    int i = ZERO_INDEX, end, paramIndex;
+    boolean isInQuotes = FALSE;
+
+    while (line[i] != NULL_TERMINATOR)
+    {
+        if (isInQuotes == FALSE && isLegalChar(line[i]) == TRUE) /* A whole word. */
+        {
+            for (end = i; isLegalChar(line[end]) == TRUE; end++)
+                ;
+
+            if ((paramIndex = getParameterIndex(header, line + i, end - i)) != NO_PARAMETER)
+            {
+                *curr++ = SLOT_MARK;
+                *curr++ = (char) (FIRST_SLOT_CHAR + paramIndex);
+            }
+            else
+                for (; i < end; i++)
+                    *curr++ = line[i];
+
+            i = end;
+        }
+        else
+        {
+            if (line[i] == QUOTES)
+                isInQuotes = (isInQuotes == TRUE)? FALSE : TRUE;
+            *curr++ = line[i++];
+        }
+    }
+
+    *curr = NULL_TERMINATOR;
+    return compiledLine;
+}
+
+/*
+ * Measures the expansion of a template.
+ *
+ * @param   *template           The body of the template (after its header).
+ * @param   **args              The arguments of the call, by the indexes of the parameters.
+ * @param   *expansionLength    Will hold the length of the expansion.
+ *
+ * @return  LINE_OVERFLOW_ERR if an expanded line is too long, otherwise NO_ERROR (0).
+ */
+Error measureTemplate(const char *template, char **args, size_t *expansionLength)
+{
+    size_t lineLength = 0; /* The length of the current line, without its new line char. */
+
+    for (*expansionLength = 0; *template != NULL_TERMINATOR; template++)
+    {
+        if (*template == ENTER_KEY)
+        {
+            *expansionLength += lineLength + 1;
+            lineLength = 0;
+        }
+        else if (*template == SLOT_MARK)
+            lineLength += strlen(args[*++template - FIRST_SLOT_CHAR]);
+        else
+            lineLength++;
+
+        if (lineLength > MAX_LINE_LEN)
+            return LINE_OVERFLOW_ERR;
+    }
+
+    *expansionLength += lineLength;
+    return NO_ERROR;
+}
+
+/*
+ * Copies the expansion of a template (its literal text, and the arguments in its slots).
+ * Assumes the destination has the space for the expansion !!
+ *
+ * @param   *dest       The destination.
+ * @param   *template   The body of the template (after its header).
+ * @param   **args      The arguments of the call, by the indexes of the parameters.
+ */
+void copyTemplate(char *dest, const char *template, char **args)
+{
+    size_t argLength;
+
+    for (; *template != NULL_TERMINATOR; template++)
+    {
+        if (*template == SLOT_MARK)
+        {
+            argLength = strlen(args[*++template - FIRST_SLOT_CHAR]);
+            (void) memcpy(dest, args[*template - FIRST_SLOT_CHAR], argLength);
+            dest += argLength;
+        }
+        else
+            *dest++ = *template;
+    }
+
+    *dest = NULL_TERMINATOR;
+}
+
+/*
+ * Counts the lines of the .am contents, up to a given length.
+ * The lines are counted as the first transition reads them (a long line is read in parts).
+ *
+ * @param   *calls              The calls (has the counted part of the contents).
+ * @param   *amFileContents     The contents of the .am file.
+ * @param   length              The length to count up to.
+ */
+void countAmLines(MacroCalls *calls, const char *amFileContents, size_t length)
+{
+    for (; calls -> countedLength < length; calls -> countedLength++)
+    {
+        calls -> lineLength++;
+        if (amFileContents[calls -> countedLength] == ENTER_KEY ||
+            calls -> lineLength == MAX_READ_LINE_LEN)
+        {
+            calls -> countedLines++;
+            calls -> lineLength = 0;
+        }
+    }
+}
@@ -0,0 +1,96 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the macro_template.c file.
+ */
+
+#ifndef MMN_14_MACRO_TEMPLATE_H
+#define MMN_14_MACRO_TEMPLATE_H
+
+/* MacroCalls data type - the calls of the macros with parameters in a source file, and the lines
+ * of the .am file that every call was expanded to. */
+typedef struct MacroCalls MacroCalls;
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Adds the parameters of a new macro definition to the macro (makes it a template).
+ * Does nothing if the definition has no parameters, or if they are not legal.
+ *
+ * @param   *macroTable     The table of the macros (the macro is in it already).
+ * @param   *name           The name of the macro.
+ * @param   *line           The definition line (mcro name p1, p2, ...).
+ */
+void addMacroParameters(NameTable *macroTable, const char *name, const char *line);
+
+/*
+ * Adds a line of the body of a macro definition to the macro.
+ * In a template, the uses of the parameters in the line are compiled to slots.
+ *
+ * @param   *macroTable     The table of the macros.
+ * @param   *name           The name of the macro.
+ * @param   *line           The line of the body.
+ */
+void addMacroBodyLine(NameTable *macroTable, const char *name, const char *line);
+
+/*
+ * Checks if the body of a macro is a template (the macro has parameters).
+ *
+ * @param   *body   The body of the macro (can be NULL).
+ *
+ * @return  TRUE if the body is a template, otherwise FALSE.
+ */
+boolean isMacroTemplate(const char *body);
+
+/*
+ * Expands a call of a macro to the end of the .am contents.
+ *
+ * @param   **amFileContents    Pointer to string that holds the contents of the .am file.
+ * @param   *body               The body of the called macro (can be NULL if it is empty).
+ * @param   *line               The call line (name a1, a2, ...).
+ *
+ * @return  The error in the call, or NO_ERROR (0) if there wasn't (then it was expanded).
+ */
+Error expandMacroCall(char **amFileContents, const char *body, const char *line);
+
+/*
+ * Creates a new empty MacroCalls.
+ *
+ * @return  Pointer to the newly created MacroCalls.
+ */
+MacroCalls *createMacroCalls(void);
+
+/*
+ * Records a call of a macro, after it was expanded.
+ * Should be called for the calls in their order, by one thread (the pre-process).
+ *
+ * @param   *calls              The calls.
+ * @param   *name               The name of the macro (copied).
+ * @param   callLine            The line of the call in the source (.as) file.
+ * @param   *amFileContents     The contents of the .am file, with the expansion of the call.
+ * @param   expansionStart      The length of the contents before the expansion.
+ */
+void addMacroCall(MacroCalls *calls, const char *name, int callLine, const char *amFileContents,
+                  size_t expansionStart);
+
+/*
+ * Prints the call of a macro that a line of the .am file was expanded from (if it was).
+ * Can be called while the calls are recorded, by one thread, for the lines in their order.
+ *
+ * @param   *diagnoses  The stream to print the call to.
+ * @param   *calls      The calls (can be NULL).
+ * @param   amLine      The line in the .am file.
+ */
+void reportMacroCallOfLine(FILE *diagnoses, MacroCalls *calls, int amLine);
+
+/*
+ * Deletes the calls and frees their memory.
+ *
+ * @param   **pCalls    Pointer to the calls to delete.
+ */
+void deleteMacroCalls(MacroCalls **pCalls);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_MACRO_TEMPLATE_H */
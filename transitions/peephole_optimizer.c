@@ -0,0 +1,272 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * peephole_optimizer.c
+ *
+ * This file implements the peephole optimization of the assembler (option -O).
+ *
+ * The optimization runs after the first transition, on the list of ASTs, and removes
+ * instructions that have no effect on the program:
+ *  - 'mov' of an operand to itself.
+ *  - 'add' and 'sub' of the instant value 0.
+ *  - 'jmp' and 'bne' to the instruction right after them.
+ *  - 'inc' and 'dec' of the same operand, one right after the other.
+ * A label of a removed instruction moves to the next instruction (if the next instruction
+ * has no label of its own, otherwise the instruction is kept).
+ *
+ * After every round of removals the counters and the addresses of the labels are computed
+ * again, and the rounds repeat until nothing is removed (a removal can make a jump redundant).
+ * The addresses of the code are assumed to be taken only through labels.
+ */
+
+/* ---Include header files--- */
+#include <stddef.h>
+#include "../new-data-types/boolean.h"
+#include "../SymbolTable/SymbolTable.h"
+#include "../assembler_ast/assembler_ast.h"
+#include "../general-enums/assemblerFinals.h"
+#include "../errors/error_types/error_types.h"
+#include "../util/memoryUtil.h"
+#include "../util/stringsUtil.h"
+#include "first_transition_util.h"
+#include "peephole_optimizer.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE TRANSITIONS_MEMORY /* For the memory statistics. */
+#define ZERO_VALUE 0
+/* ------------ */
+
+/* ---------------Prototypes--------------- */
+boolean optimizeRound(ast_list_t *astList, SymbolTable *symbols);
+boolean isRedundantInstruction(ast_t *lineAst, SymbolTable *symbols, int nextAddress);
+boolean isCancelingPair(ast_t *firstAst, ast_t *secondAst);
+boolean isSameOperand(arg_node_t *firstArg, arg_node_t *secondArg);
+boolean moveLabelForward(ast_t *lineAst, ast_list_node_t *nextInstructionNode);
+ast_list_node_t *findNextInstruction(ast_list_node_t *astNode, ast_list_node_t **pPrevNode);
+/* ---------------------------------------- */
+
+/*
+ * Removes redundant instructions from the list of ASTs made in the first transition,
+ * and computes again the counters and the addresses of the labels.
+ * Assumes that the first transition finished successfully !!
+ *
+ * @param   *astList        The list of ASTs made in the first transition.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ *
+ * @return  The amount of words saved.
+ */
+int peephole_optimize(ast_list_t *astList, SymbolTable *symbols)
+{
+    int initialIC = *getCounterPointer(astList, IC_);
+
+    while (optimizeRound(astList, symbols) == TRUE)
+        recomputeAddresses(astList, symbols);
+
+    return initialIC - *getCounterPointer(astList, IC_);
+}
+
+/*
+ * Goes over the list of ASTs once and removes the redundant instructions.
+ * The addresses of the labels are of the list before the round.
+ *
+ * @param   *astList        The list of ASTs.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ *
+ * @return  TRUE if an instruction was removed, otherwise FALSE.
+ */
+boolean optimizeRound(ast_list_t *astList, SymbolTable *symbols)
+{
+    ast_list_node_t *prevNode = NULL, *currNode = getAstHead(astList), *nextNode;
+    ast_list_node_t *pairNode, *pairPrevNode, *unusedNode;
+    int address = PROGRAM_MEM_START; /* The address of the current instruction before the round. */
+    int words;
+    boolean isChanged = FALSE, isRemoved;
+    ast_t *lineAst;
+
+    while (currNode != NULL)
+    {
+        lineAst = getAst(currNode);
+        isRemoved = FALSE;
+
+        if (getSentence(lineAst).sentenceType == DIRECTION_SENTENCE)
+        {
+            words = howManyWordsForInstruction(lineAst);
+            pairNode = findNextInstruction(currNode, &pairPrevNode);
+
+            if (isRedundantInstruction(lineAst, symbols, address + words) == TRUE &&
+                moveLabelForward(lineAst, pairNode) == TRUE)
+                isRemoved = TRUE;
+
+            else if (pairNode != NULL && isLabel(getAst(pairNode)) == FALSE &&
+                     isCancelingPair(lineAst, getAst(pairNode)) == TRUE &&
+                     moveLabelForward(lineAst, findNextInstruction(pairNode, &unusedNode)) == TRUE)
+            {
+                /* Remove the second instruction of the pair (the first is removed below). */
+                words += howManyWordsForInstruction(getAst(pairNode));
+                (void) deleteNextAstFromList(astList, pairPrevNode);
+                isRemoved = TRUE;
+            }
+
+            address += words;
+        }
+
+        nextNode = getNextAstNode(currNode);
+        if (isRemoved == TRUE)
+        {
+            (void) deleteNextAstFromList(astList, prevNode);
+            isChanged = TRUE;
+        }
+        else
+            prevNode = currNode;
+
+        currNode = nextNode;
+    }
+
+    return isChanged;
+}
+
+/*
+ * Checks if an instruction has no effect on the program.
+ *
+ * @param   *lineAst        The AST of the instruction.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ * @param   nextAddress     The address of the instruction after it.
+ *
+ * @return  TRUE if the instruction can be removed, otherwise FALSE.
+ */
+boolean isRedundantInstruction(ast_t *lineAst, SymbolTable *symbols, int nextAddress)
+{
+    arg_node_t *firstArg = getArgList(lineAst);
+    boolean isRedundant = FALSE;
+    const symbol_t *label;
+    data_t argData;
+
+    switch (getOpcodeFromAST(lineAst))
+    {
+        case mov: /* Moving an operand to itself. */
+            isRedundant = isSameOperand(firstArg, getNextNode(firstArg));
+            break;
+
+        case add:
+        case sub: /* Adding or subtracting 0. */
+            argData = getArgData(firstArg);
+            isRedundant = (getArgAddressingMethod(firstArg) == INSTANT &&
+                           argData.data.num == ZERO_VALUE)? TRUE : FALSE;
+            break;
+
+        case jmp:
+        case bne: /* Jumping to the next instruction. */
+            argData = getArgData(firstArg);
+            label = (getArgAddressingMethod(firstArg) == DIRECT)?
+                    findSymbol(symbols, argData.data.string) : NULL;
+            isRedundant = (label != NULL && (label -> flags & SYMBOL_DEFINED) &&
+                           label -> value == nextAddress)? TRUE : FALSE;
+            break;
+
+        default:
+            break;
+    }
+
+    return isRedundant;
+}
+
+/*
+ * Checks if two instructions cancel each other ('inc' and 'dec' of the same operand).
+ *
+ * @param   *firstAst   The AST of the first instruction.
+ * @param   *secondAst  The AST of the instruction right after it.
+ *
+ * @return  TRUE if the instructions cancel each other, otherwise FALSE.
+ */
+boolean isCancelingPair(ast_t *firstAst, ast_t *secondAst)
+{
+    opcodes_t firstOpcode = getOpcodeFromAST(firstAst);
+    opcodes_t secondOpcode = getOpcodeFromAST(secondAst);
+
+    return (((firstOpcode == inc && secondOpcode == dec) ||
+             (firstOpcode == dec && secondOpcode == inc)) &&
+            isSameOperand(getArgList(firstAst), getArgList(secondAst)) == TRUE)? TRUE : FALSE;
+}
+
+/*
+ * Checks if two arguments are the same operand (the same register or the same label).
+ *
+ * @param   *firstArg   The first argument.
+ * @param   *secondArg  The second argument.
+ *
+ * @return  TRUE if the arguments are the same operand, otherwise FALSE.
+ */
+boolean isSameOperand(arg_node_t *firstArg, arg_node_t *secondArg)
+{
+    boolean isSame = FALSE;
+    data_t firstData, secondData;
+
+    if (firstArg != NULL && secondArg != NULL &&
+        getArgAddressingMethod(firstArg) == getArgAddressingMethod(secondArg))
+    {
+        firstData = getArgData(firstArg);
+        secondData = getArgData(secondArg);
+
+        if (getArgAddressingMethod(firstArg) == DIRECT_REGISTER)
+            isSame = (firstData.data.reg == secondData.data.reg)? TRUE : FALSE;
+        else if (getArgAddressingMethod(firstArg) == DIRECT)
+            isSame = sameStrings(firstData.data.string, secondData.data.string);
+    }
+
+    return isSame;
+}
+
+/*
+ * Moves the label of an instruction that is about to be removed to the next instruction,
+ * so the label keeps pointing to the same address.
+ *
+ * @param   *lineAst                The AST of the instruction to remove.
+ * @param   *nextInstructionNode    The node of the next instruction (NULL if there is none).
+ *
+ * @return  TRUE if the instruction can be removed (it has no label, or the label moved),
+ *          otherwise FALSE.
+ */
+boolean moveLabelForward(ast_t *lineAst, ast_list_node_t *nextInstructionNode)
+{
+    boolean canRemove = TRUE;
+    char *labelName;
+
+    if (isLabel(lineAst) == TRUE)
+    {
+        if (nextInstructionNode != NULL && isLabel(getAst(nextInstructionNode)) == FALSE)
+        {
+            labelName = getLabelName(lineAst);
+            addLabelToAst(getAst(nextInstructionNode), labelName);
+            (void) clear_ptr(labelName)
+            (void) deleteLabel(lineAst);
+        }
+        else
+            canRemove = FALSE;
+    }
+
+    return canRemove;
+}
+
+/*
+ * Finds the next instruction in the list of ASTs (guidance sentences are skipped).
+ *
+ * @param   *astNode    The node to search after.
+ * @param   **pPrevNode Will hold the node before the found instruction.
+ *
+ * @return  The node of the next instruction, or NULL if there is none.
+ */
+ast_list_node_t *findNextInstruction(ast_list_node_t *astNode, ast_list_node_t **pPrevNode)
+{
+    ast_list_node_t *currNode = getNextAstNode(astNode);
+
+    *pPrevNode = astNode;
+    while (currNode != NULL && getSentence(getAst(currNode)).sentenceType != DIRECTION_SENTENCE)
+    {
+        *pPrevNode = currNode;
+        currNode = getNextAstNode(currNode);
+    }
+
+    return currNode;
+}
@@ -0,0 +1,27 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the peephole_optimizer.c file.
+ */
+
+#ifndef MMN_14_PEEPHOLE_OPTIMIZER_H
+#define MMN_14_PEEPHOLE_OPTIMIZER_H
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Removes redundant instructions from the list of ASTs made in the first transition,
+ * and computes again the counters and the addresses of the labels.
+ * Assumes that the first transition finished successfully !!
+ *
+ * @param   *astList        The list of ASTs made in the first transition.
+ * @param   *symbols        The table of the symbols (labels) of the file.
+ *
+ * @return  The amount of words saved.
+ */
+int peephole_optimize(ast_list_t *astList, SymbolTable *symbols);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_PEEPHOLE_OPTIMIZER_H */
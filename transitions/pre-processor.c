@@ -3,15 +3,26 @@
  * @version (18/08/2023)
  *
  * This file has the method for handling the entire pre-processor stage of the assembler.
+ *
+ * A .include "file" line adds the lines and the macros of another file in its place.
+ * Every included file is pre-processed only once for all the source files of the assembler,
+ * and the result is kept in a cache that is shared by all the files that include it.
  */
 
 /* ---Include header files--- */
 #include <stdio.h>
+#include <string.h>
 #include "../new-data-types/boolean.h"
 #include "../new-data-types/process_result.h"
+#include "../new-data-types/error_count.h"
 #include "../NameTable/NameTable.h"
+#include "../SymbolTable/SymbolTable.h"
+#include "../assembler_ast/assembler_ast.h"
 #include "../general-enums/programFinals.h"
+#include "../general-enums/neededKeys.h"
+#include "../general-enums/indexes.h"
 #include "../FileHandling/readFromFile.h"
+#include "../FileHandling/StructuralIndex.h"
 #include "../FileHandling/writeToFile.h"
 #include "../errors/error_types/error_types.h"
 #include "../errors/assembler_errors.h"
@@ -20,27 +31,64 @@
 #include "../diagnoses/assembler_line_diagnoses.h"
 #include "../util/memoryUtil.h"
 #include "../util/stringsUtil.h"
+#include "../util/SpscQueue.h"
+#include "../util/traceUtil.h"
+#include "cross_reference.h"
+#include "macro_template.h"
 /* -------------------------- */
 
 /* ---Finals--- */
+#define MEMORY_MODULE TRANSITIONS_MEMORY /* For the memory statistics. */
 #define BEFORE_MACRO ".as" /* File end of assembly type file */
 #define AFTER_MACRO ".am" /* File end of after pre-processor type file */
 #define START_MACRO "mcro"
 #define END_MACRO "endmcro"
+#define NO_FILE_TYPE "" /* The name of an included file is given with its type. */
+#define NEW_LINE "\n"
+#define QUOTES_LEN 1
+#define MAX_LINE_LEN 80
+#define MAX_READ_LINE_LEN (MAX_LINE_LEN + 1) /* Longer lines are read in parts. */
 /* ------------ */
 
+/* A file included with .include. It is pre-processed on its first include only, and its lines
+ * and macros are shared by all the files that include it. */
+typedef struct included_file_t
+{
+    char *name; /* The name of the file, as written in the .include line. */
+    char *expandedLines; /* The lines of the file after the pre-processor. */
+    NameTable *macroTable; /* The macros defined in the file. */
+    Error includeError; /* The error of including the file, or NO_ERROR. */
+    boolean isInProgress; /* TRUE while the file is pre-processed (to find include cycles). */
+    struct included_file_t *next;
+} included_file_t;
+
+/* The files included so far, by all the source files of the assembler. */
+static included_file_t *includeCache = NULL;
+
 /* ----------Prototypes---------- */
-process_result traverse_before_macro_file(const char *file_name,
-                                          char **amFileContents, NameTable *macro_table);
+process_result traverse_before_macro_file(const char *file_name, char *sourceText,
+                                          char **amFileContents, NameTable *macro_table,
+                                          SpscQueue *amLines, CrossReference *xref,
+                                          MacroCalls *calls, error_count_t *errors);
+size_t streamNewAmContents(SpscQueue *amLines, const char *amFileContents, size_t streamedLength);
 Error handleLineInPreProc(const char *file_name, const char *line, int lineNumber,
-                          char **macro_name, char **amFileContents, NameTable *macro_table);
+                          char **macro_name, boolean *wasInMacroDef, char **amFileContents,
+                          NameTable *macro_table, CrossReference *xref, MacroCalls *calls);
 Error preProcessorAssemblerAlgo(const char *file_name, const char *line, int lineNumber,
-                                char **macro_name, char **amFileContents, NameTable *macro_table);
+                                char **macro_name, boolean *wasInMacroDef,
+                                char **amFileContents, NameTable *macro_table,
+                                CrossReference *xref, MacroCalls *calls);
 boolean isInMcroDef(const char *line, boolean wasInMacroDef);
 void getMacroName(const char *line, char **macro_name, boolean wasInMacroDef, boolean isInMacroDef);
-void addToTablesIfNeededInPreProc(const char *line, char *macro_name, boolean wasInMacroDef,
-                         boolean isInMacroDef,  char **amFileContents, NameTable *macro_table);
+Error addToTablesIfNeededInPreProc(const char *line, int lineNumber, char *macro_name,
+                                   boolean wasInMacroDef, boolean isInMacroDef,
+                                   char **amFileContents, NameTable *macro_table,
+                                   CrossReference *xref, MacroCalls *calls);
 char *getMacroIfCalling(const char *line, NameTable *macro_table);
+Error includeFile(const char *line, char **amFileContents, NameTable *macro_table);
+char *getIncludedFileName(const char *line);
+included_file_t *getIncludedFile(const char *includedName);
+Error preProcessIncludedFile(included_file_t *includedFile);
 /* ------------------------------ */
 
 /*
@@ -48,25 +96,48 @@ char *getMacroIfCalling(const char *line, NameTable *macro_table);
  * the given file name.
  *
  * @param   *file_name  The name of the file to process.
+ * @param   *sourceText The contents of the source file if they were read already (freed by
+ *                      the pre-processor), or NULL to read the file.
+ * @param   *amLines    If not NULL, the lines of the .am file are also pushed to this queue
+ *                      while they are made (in parts, ending with a NULL part).
+ * @param   **amText    Will hold the contents of the .am file instead of writing it (NULL if it
+ *                      has no lines), or NULL to write the .am file.
+ * @param   *xref       The cross reference to record the macros in, or NULL.
+ * @param   *calls      The calls of the macros with parameters to record, or NULL.
+ * @param   *errors     The count of the lines with errors of the file (stops at its cap).
  *
  * @return  SUCCESS (1) if there were no errors, otherwise FAILURE (0).
  */
-process_result pre_process(const char *file_name)
+process_result pre_process(const char *file_name, char *sourceText, SpscQueue *amLines,
+                           char **amText, CrossReference *xref, MacroCalls *calls,
+                           error_count_t *errors)
 {
     process_result processResult; /* Value to return. */
+    trace_span_t span;
 
     char *amFileContents = NULL; /* Will hold the file to print */
     NameTable *macro_table = createNameTable(STRING_TYPE); /* Will hold the macros */
 
-    processResult = traverse_before_macro_file(file_name, &amFileContents, macro_table);
+    beginTraceSpan(&span, "pre_process", file_name);
+    processResult = traverse_before_macro_file(file_name, sourceText, &amFileContents,
+                                               macro_table, amLines, xref, calls, errors);
+
+    if (amText != NULL) /* The contents are given instead of the file. */
+    {
+        *amText = amFileContents;
+        amFileContents = NULL;
+    }
+    else /* Create the .am file */
+        writeToFile(file_name, AFTER_MACRO, amFileContents);
 
-    /* Create the .am file */
-    writeToFile(file_name, AFTER_MACRO, amFileContents);
+    if (amLines != NULL) /* No more lines. */
+        pushToSpscQueue(amLines, NULL);
 
     /* Free unnecessary variable */
     clear_ptr(amFileContents)
     deleteTable(&macro_table);
 
+    endTraceSpan(&span);
     return processResult;
 }
 
@@ -74,35 +145,76 @@ process_result pre_process(const char *file_name)
  * Traverses the file with the given file name and processes it.
  *
  * @param   *file_name          The name of the file to process.
+ * @param   *sourceText         The contents of the file if they were read already, or NULL.
  * @param   **amFileContents    Pointer to string that holds the contents of the .am file.
  * @param   *macro_table        The data structure to hold the macros and their contents.
+ * @param   *amLines            The queue to push the new lines of the .am file to, or NULL.
+ * @param   *xref               The cross reference to record the macros in, or NULL.
+ * @param   *calls              The calls of the macros with parameters to record, or NULL.
+ * @param   *errors             The count of the lines with errors of the file (stops at its
+ *                              cap).
  *
  * @return  SUCCESS (1) if there were no errors, otherwise FAILURE (0).
  */
-process_result traverse_before_macro_file(const char *file_name,
-                                          char **amFileContents, NameTable *macro_table)
+process_result traverse_before_macro_file(const char *file_name, char *sourceText,
+                                          char **amFileContents, NameTable *macro_table,
+                                          SpscQueue *amLines, CrossReference *xref,
+                                          MacroCalls *calls, error_count_t *errors)
 {
     boolean wasError = FALSE; /* Will indicate if there was an error. */
-    char *line = NULL; /* This will hold the current line */
+    StructuralIndex *sourceIndex = (sourceText != NULL)?
+            createStructuralIndex(sourceText) : readIndexedFile(file_name, BEFORE_MACRO);
+    char *line; /* This will hold the current line */
     char *macro_name = NULL; /* This will hold the current macro name we are working with. */
-    int readCode; /* Will hold the current line's read code. */
+    boolean wasInMacroDef = FALSE; /* See if last line was in a mcro def. */
     int lineCount = ZERO_COUNT;
+    size_t streamedLength = 0; /* The length of the .am contents that were pushed already. */
 
-    /* Read the file line-by-line and handle it. */
-    while ((readCode = readNextLineFromFile(file_name, BEFORE_MACRO, &line)) != EOF)
-    {
-        if (readCode == UNABLE_TO_OPEN_FILE) break;
+    if (sourceIndex == NULL)
+        return FAILURE;
 
-        lineCount++; /* Increasing line counter by 1 since we reached a new line */
-        if (handleLineInPreProc(file_name, line, lineCount, &macro_name, amFileContents,
-                                   macro_table) != NO_ERROR)
+    /* Read the file line-by-line and handle it (blank and comment lines are skipped). */
+    while (isErrorsCapReached(file_name, errors, stderr) == FALSE &&
+           (line = readIndexedLine(sourceIndex, MAX_READ_LINE_LEN, MAX_LINE_LEN,
+                                   &lineCount)) != NULL)
+    {
+        if (handleLineInPreProc(file_name, line, lineCount, &macro_name, &wasInMacroDef,
+                                amFileContents, macro_table, xref, calls) != NO_ERROR)
+        {
             wasError = TRUE;
+            errors -> errorsAmount++;
+        }
+
+        if (amLines != NULL) /* Stream the lines that the line added. */
+            streamedLength = streamNewAmContents(amLines, *amFileContents, streamedLength);
 
         (void) clear_ptr(line) /* Next line */
     }
 
-    (void) clear_ptr(line)
-    return (wasError == FALSE && readCode != UNABLE_TO_OPEN_FILE)? SUCCESS : FAILURE;
+    /* The name of a macro whose definition was not finished is freed with the macro table. */
+    deleteStructuralIndex(&sourceIndex);
+    return (wasError == FALSE)? SUCCESS : FAILURE;
+}
+
+/*
+ * Pushes the part of the .am contents that was added since the last push to a queue.
+ *
+ * @param   *amLines            The queue to push the new part to.
+ * @param   *amFileContents     The contents of the .am file so far (can be NULL).
+ * @param   streamedLength      The length of the contents that were pushed already.
+ *
+ * @return  The length of the contents that were pushed now.
+ */
+size_t streamNewAmContents(SpscQueue *amLines, const char *amFileContents, size_t streamedLength)
+{
+    /* Only the new part is measured, the start of the contents is known already. */
+    size_t amLength = (amFileContents != NULL)?
+            streamedLength + strlen(amFileContents + streamedLength) : 0;
+
+    if (amLength > streamedLength)
+        pushToSpscQueue(amLines, strcpyPart(amFileContents, (int) streamedLength, (int) amLength));
+
+    return amLength;
 }
 
 /*
@@ -112,13 +224,17 @@ process_result traverse_before_macro_file(const char *file_name,
  * @param   *line               Current line string.
  * @param   lineNumber          The index of the current line.
  * @param   **macro_name        Pointer to the current macro name.
+ * @param   *wasInMacroDef      Pointer to the flag of the last line being in a macro definition.
  * @param   **amFileContents    Pointer to string that holds the contents of the .am file.
  * @param   *macro_table        Data structure to hold the macro names and contents.
+ * @param   *xref               The cross reference to record the macros in, or NULL.
+ * @param   *calls              The calls of the macros with parameters to record, or NULL.
  *
  * @return  The error code of the found error in the line, or NO_ERROR (0) if there wasn't.
  */
 Error handleLineInPreProc(const char *file_name, const char *line, int lineNumber,
-                          char **macro_name, char **amFileContents, NameTable *macro_table)
+                          char **macro_name, boolean *wasInMacroDef, char **amFileContents,
+                          NameTable *macro_table, CrossReference *xref, MacroCalls *calls)
 {
     Error lineError = NO_ERROR; /* Value to return. Represents the error in the line. */
 
@@ -127,7 +243,8 @@ Error handleLineInPreProc(const char *file_name, const char *line, int lineNumbe
 
     else if (isSkipLine(line) == FALSE) /* Go to next line if we can skip this one */
         lineError = preProcessorAssemblerAlgo(file_name, line, lineNumber, macro_name,
-                                              amFileContents, macro_table);
+                                              wasInMacroDef, amFileContents, macro_table, xref,
+                                              calls);
 
     if (lineError != NO_ERROR) /* Print error if there are. */
         handle_assembler_error(file_name, lineNumber, lineError);
@@ -142,36 +259,51 @@ Error handleLineInPreProc(const char *file_name, const char *line, int lineNumbe
  * @param   *line               Current line string.
  * @param   lineNumber          The index of the current line.
  * @param   **macro_name        Pointer to the current macro name.
+ * @param   *wasInMacroDef      Pointer to the flag of the last line being in a macro definition.
  * @param   **amFileContents    Pointer to string that holds the contents of the .am file.
  * @param   *macro_table        Data structure to hold the macro names and contents.
+ * @param   *xref               The cross reference to record the macros in, or NULL.
+ * @param   *calls              The calls of the macros with parameters to record, or NULL.
  *
  * @return  The error code of the found error in the line, or NO_ERROR (0) if there wasn't.
  */
 Error preProcessorAssemblerAlgo(const char *file_name, const char *line, int lineNumber,
-                                char **macro_name, char **amFileContents, NameTable *macro_table)
+                                char **macro_name, boolean *wasInMacroDef,
+                                char **amFileContents, NameTable *macro_table,
+                                CrossReference *xref, MacroCalls *calls)
 {
-    static boolean wasInMacroDef = FALSE; /* See if last line was in a mcro def. */
-
     /* Value to return. Represents the error in the line (if there is). */
-    Error lineError = NO_ERROR;
-
-    boolean isInMacroDef = isInMcroDef(line, wasInMacroDef); /* Is curr line in mcro def */
-    getMacroName(line, macro_name, wasInMacroDef, isInMacroDef); /* Get curr macro name */
+    Error lineError = NO_ERROR, callError;
+    boolean isInMacroDef; /* Is curr line in mcro def */
 
-    lineError = checkPreProcessErrors(line, *macro_name, wasInMacroDef, isInMacroDef);
+    /* A .include line (a .include inside a macro definition is a part of the macro). */
+    if (*wasInMacroDef == FALSE && isIncludeLine(line) == TRUE)
+        lineError = includeFile(line, amFileContents, macro_table);
 
-    /* Address a specific error */
-    if (lineError == INVALID_MACRO_NAME_ERR || lineError == EXPECTED_MACRO_ERR)
+    else
     {
-        isInMacroDef = FALSE;
-        (void) clear_ptr(*macro_name)
+        isInMacroDef = isInMcroDef(line, *wasInMacroDef);
+        getMacroName(line, macro_name, *wasInMacroDef, isInMacroDef); /* Get curr macro name */
+
+        lineError = checkPreProcessErrors(line, *macro_name, *wasInMacroDef, isInMacroDef);
+
+        /* Address a specific error */
+        if (lineError == INVALID_MACRO_NAME_ERR || lineError == EXPECTED_MACRO_ERR)
+        {
+            isInMacroDef = FALSE;
+            (void) clear_ptr(*macro_name)
+        }
+
+        /* Will make the necessary actions. add to amFile, or macro_table */
+        callError = addToTablesIfNeededInPreProc(line, lineNumber, *macro_name, *wasInMacroDef,
+                                                 isInMacroDef, amFileContents, macro_table,
+                                                 xref, calls);
+        if (lineError == NO_ERROR)
+            lineError = callError;
+
+        *wasInMacroDef = isInMacroDef;
     }
 
-    /* Will make the necessary actions. add to amFile, or macro_table */
-    addToTablesIfNeededInPreProc(line, *macro_name, wasInMacroDef, isInMacroDef,
-                                 amFileContents, macro_table);
-
-    wasInMacroDef = isInMacroDef;
     return lineError;
 }
 
@@ -224,22 +356,39 @@ void getMacroName(const char *line, char **macro_name, boolean wasInMacroDef, bo
  * Will know if any addition is needed based on the given flags and line string.
  *
  * @param   *line               The line string which the program is currently processing.
+ * @param   lineNumber          The index of the current line.
  * @param   *macro_name         The macro name which is the program is currently working with.
  * @param   wasInMacroDef       Flag to indicate if the last line was in a macro definition.
  * @param   inMacroDef          Flag to indicate if the current line is in a macro definition.
  * @param   **amFileContents    Pointer to string that holds the contents of the .am file.
  * @param   *macro_table        The data structure to hold the macros and their contents.
+ * @param   *xref               The cross reference to record the macros in, or NULL.
+ * @param   *calls              The calls of the macros with parameters to record, or NULL.
+ *
+ * @return  The error in the macro call of the line, or NO_ERROR (0) if there wasn't.
  */
-void addToTablesIfNeededInPreProc(const char *line, char *macro_name, boolean wasInMacroDef,
-                         boolean isInMacroDef, char **amFileContents, NameTable *macro_table)
+Error addToTablesIfNeededInPreProc(const char *line, int lineNumber, char *macro_name,
+                                   boolean wasInMacroDef, boolean isInMacroDef,
+                                   char **amFileContents, NameTable *macro_table,
+                                   CrossReference *xref, MacroCalls *calls)
 {
+    Error callError = NO_ERROR; /* Value to return. */
+    name_data_t *macroData;
+    const char *body; /* The body of the called macro, NULL if it is empty. */
+    size_t expansionStart;
+
     /* Entered new macro definition, add the macro to the macro table. */
     if (isInNewMacroDef(wasInMacroDef, isInMacroDef) == TRUE)
+    {
         (void) addNameToTable(macro_table, macro_name);
+        addMacroParameters(macro_table, macro_name, line); /* If it has parameters. */
+        if (xref != NULL && macro_name != NULL)
+            addMacroDefinition(xref, macro_name, lineNumber);
+    }
 
     /* Currently defining a macro, add the line to the macro data. */
     else if (isStillInMacroDef(wasInMacroDef, isInMacroDef) == TRUE)
-        (void) addStringToData(macro_table, macro_name, line);
+        addMacroBodyLine(macro_table, macro_name, line);
 
     /* End macro statement, Ignore the line. */
     else if (isFinishMacroDef(wasInMacroDef, isInMacroDef) == TRUE);
@@ -248,7 +397,17 @@ void addToTablesIfNeededInPreProc(const char *line, char *macro_name, boolean wa
     else if (isCallingMacro(line, macro_table) == TRUE)
     {
         char *macro = getMacroIfCalling(line, macro_table);
-        addTwoStrings(amFileContents, getDataByName(macro_table, macro) -> string);
+        macroData = getDataByName(macro_table, macro);
+        body = (macroData != NULL)? macroData -> string : NULL;
+        expansionStart = (*amFileContents != NULL)? strlen(*amFileContents) : 0;
+
+        callError = expandMacroCall(amFileContents, body, line);
+
+        /* Only the calls of the macros with parameters are recorded. */
+        if (callError == NO_ERROR && calls != NULL && isMacroTemplate(body) == TRUE)
+            addMacroCall(calls, macro, lineNumber, *amFileContents, expansionStart);
+        if (xref != NULL)
+            addMacroUse(xref, macro, lineNumber);
         (void) clear_ptr(macro) /* Free unnecessary variable. */
     }
 
@@ -256,6 +415,7 @@ void addToTablesIfNeededInPreProc(const char *line, char *macro_name, boolean wa
     else
         addTwoStrings(amFileContents, line);
 
+    return callError;
 }
 
 /*
@@ -274,4 +434,155 @@ char *getMacroIfCalling(const char *line, NameTable *macro_table)
         findWord(line, &firstWord, FIRST_WORD); /* Find the first word. */
 
     return firstWord;
-}
\ No newline at end of file
+}
+
+/*
+ * Handles a .include line. Adds the lines of the included file to the .am file,
+ * and the macros defined in it to the macro table.
+ *
+ * @param   *line               The .include line.
+ * @param   **amFileContents    Pointer to string that holds the contents of the .am file.
+ * @param   *macro_table        The data structure to hold the macros and their contents.
+ *
+ * @return  The error code of the found error in the line, or NO_ERROR (0) if there wasn't.
+ */
+Error includeFile(const char *line, char **amFileContents, NameTable *macro_table)
+{
+    Error lineError = checkIncludeLineErrors(line); /* Value to return. */
+    included_file_t *includedFile;
+    char *includedName;
+
+    if (lineError == NO_ERROR)
+    {
+        includedName = getIncludedFileName(line);
+        includedFile = getIncludedFile(includedName);
+
+        if (includedFile -> isInProgress == TRUE) /* The file includes itself. */
+            lineError = INCLUDE_CYCLE_ERR;
+        else
+            lineError = includedFile -> includeError;
+
+        if (lineError == NO_ERROR)
+        {
+            addTwoStrings(amFileContents, includedFile -> expandedLines);
+            copyStringTable(macro_table, includedFile -> macroTable);
+        }
+
+        (void) clear_ptr(includedName) /* Free unnecessary variable. */
+    }
+
+    return lineError;
+}
+
+/*
+ * Gets the name of the included file from a .include line (without the quotes).
+ * Assumes that the line has no errors.
+ *
+ * @param   *line   The .include line.
+ *
+ * @return  The name of the included file.
+ */
+char *getIncludedFileName(const char *line)
+{
+    char *quotedName = NULL, *includedName; /* Will hold the file name with and without quotes. */
+
+    findWord(line, &quotedName, SECOND_WORD);
+    includedName = strcpyPart(quotedName, QUOTES_LEN, (int) strlen(quotedName) - QUOTES_LEN);
+
+    (void) clear_ptr(quotedName) /* Free unnecessary variable. */
+    return includedName;
+}
+
+/*
+ * Gets an included file from the cache. Pre-processes it if it was not included before.
+ *
+ * @param   *includedName   The name of the included file.
+ *
+ * @return  The included file.
+ */
+included_file_t *getIncludedFile(const char *includedName)
+{
+    included_file_t *includedFile = includeCache; /* Value to return. */
+
+    while (includedFile != NULL && sameStrings(includedFile -> name, includedName) == FALSE)
+        includedFile = includedFile -> next;
+
+    if (includedFile == NULL) /* First include of the file. */
+    {
+        includedFile = (included_file_t *) allocate_space(sizeof(included_file_t));
+        includedFile -> name = my_strdup(includedName);
+        includedFile -> expandedLines = NULL;
+        includedFile -> macroTable = createNameTable(STRING_TYPE);
+        includedFile -> isInProgress = TRUE;
+        includedFile -> next = includeCache;
+        includeCache = includedFile; /* Add it before pre-processing it, to find cycles. */
+
+        includedFile -> includeError = preProcessIncludedFile(includedFile);
+        includedFile -> isInProgress = FALSE;
+    }
+
+    return includedFile;
+}
+
+/*
+ * Pre-processes an included file. Errors in the file are printed with the name of the file.
+ * Its lines are read whole (a line longer than the maximum is one line, with one error).
+ *
+ * @param   *includedFile   The included file.
+ *
+ * @return  NO_ERROR (0) if there were no errors, otherwise the error of the include.
+ */
+Error preProcessIncludedFile(included_file_t *includedFile)
+{
+    Error includeError = INCLUDED_FILE_NOT_FOUND_ERR; /* Value to return, assume no file. */
+    char *contents = readWholeFile(includedFile -> name, NO_FILE_TYPE);
+    StructuralIndex *includedIndex;
+    char *line;
+    char *macro_name = NULL; /* This will hold the current macro name we are working with. */
+    boolean wasInMacroDef = FALSE, wasError = FALSE;
+    int lineCount = ZERO_COUNT;
+
+    if (contents != NULL)
+    {
+        includedIndex = createStructuralIndex(contents);
+
+        /* Handle the file line-by-line (blank and comment lines are skipped). */
+        while ((line = readIndexedLine(includedIndex, WHOLE_LINES, MAX_LINE_LEN,
+                                       &lineCount)) != NULL)
+        {
+            if (line[strlen(line) - 1] != ENTER_KEY) /* The last line, add a new line char. */
+                addTwoStrings(&line, NEW_LINE);
+
+            if (handleLineInPreProc(includedFile -> name, line, lineCount, &macro_name,
+                                    &wasInMacroDef, &includedFile -> expandedLines,
+                                    includedFile -> macroTable, NULL, NULL) != NO_ERROR)
+                wasError = TRUE;
+
+            (void) clear_ptr(line) /* Next line */
+        }
+
+        includeError = (wasError == FALSE)? NO_ERROR : ERRORS_IN_INCLUDED_FILE_ERR;
+        deleteStructuralIndex(&includedIndex);
+    }
+
+    return includeError;
+}
+
+/*
+ * Clears the cache of the included files.
+ * Should be called after all the source files were assembled.
+ */
+void clearIncludeCache(void)
+{
+    included_file_t *next;
+
+    while (includeCache != NULL) /* Delete it file-by-file. */
+    {
+        next = includeCache -> next;
+        (void) clear_ptr(includeCache -> name)
+        (void) clear_ptr(includeCache -> expandedLines)
+        deleteTable(&includeCache -> macroTable);
+        (void) clear_ptr(includeCache)
+        includeCache = next;
+    }
+}
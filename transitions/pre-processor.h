@@ -15,10 +15,27 @@
  * the given file name.
  *
  * @param   *file_name  The name of the file to process.
+ * @param   *sourceText The contents of the source file if they were read already (freed by
+ *                      the pre-processor), or NULL to read the file.
+ * @param   *amLines    If not NULL, the lines of the .am file are also pushed to this queue
+ *                      while they are made (in parts, ending with a NULL part).
+ * @param   **amText    Will hold the contents of the .am file instead of writing it (NULL if it
+ *                      has no lines), or NULL to write the .am file.
+ * @param   *xref       The cross reference to record the macros in, or NULL.
+ * @param   *calls      The calls of the macros with parameters to record, or NULL.
+ * @param   *errors     The count of the lines with errors of the file (stops at its cap).
  *
  * @return  SUCCESS (1) if there were no errors, otherwise FAILURE (0).
  */
-process_result pre_process(const char *file_name);
+process_result pre_process(const char *file_name, char *sourceText, SpscQueue *amLines,
+                           char **amText, CrossReference *xref, MacroCalls *calls,
+                           error_count_t *errors);
+
+/*
+ * Clears the cache of the included files.
+ * Should be called after all the source files were assembled.
+ */
+void clearIncludeCache(void);
 
 /* ---------------------------------------- */
 
@@ -18,44 +18,52 @@
  */
 
 /* ---Include header files--- */
+#include <stdio.h>
 #include <string.h>
 #include "../new-data-types/boolean.h"
-#include "../NameTable/NameTable.h"
+#include "../SymbolTable/SymbolTable.h"
 #include "../FileHandling/writeToFile.h"
 #include "../new-data-types/process_result.h"
+#include "../new-data-types/error_count.h"
 #include "../assembler_ast/assembler_ast.h"
 #include "../general-enums/assemblerFinals.h"
 #include "../encoding/encoding.h"
 #include "../errors/error_types/error_types.h"
 #include "../errors/SecondTransitionErrors/SecondTransitionErrors.h"
+#include "../errors/assembler_errors.h"
 #include "../util/memoryUtil.h"
+#include "../util/traceUtil.h"
 #include "../util/stringsUtil.h"
+#include "cross_reference.h"
 /* -------------------------- */
 
 /* ---Macros--- */
 /* ------------ */
 
 /* ---Finals--- */
+#define MEMORY_MODULE TRANSITIONS_MEMORY /* For the memory statistics. */
 #define OBJECT_END ".ob"
 #define ENT_END ".ent"
 #define EXT_END ".ext"
+#define REL_END ".rel"
 /* ------------ */
 
 /* ---------------Prototypes--------------- */
 process_result secondFileTraverse(const char *file_name, ast_list_t *astList,
-                                  NameTable *labelsMap[], MemoryImage *memoryImage,
-                                  char **extFileContents);
+                                  SymbolTable *symbols, MemoryImage *memoryImage,
+                                  char **extFileContents, char **relFileContents,
+                                  CrossReference *xref, error_count_t *errors);
 void handleLineInSecondTrans(const char *file_name, int currLine, ast_t *lineAst,
-                             NameTable *labelsMap[], MemoryImage *memoryImage,
-                             char **extFileContents, boolean *wasError);
-Error updateTablesIfNeededInSecondTrans(ast_t *lineAst, NameTable *normalLabels,
-                                        NameTable *entLabels);
-Error updateEntTable(NameTable *normalLabels, NameTable *entLabels, arg_node_t *entLabelArgNode);
-void createOutputFiles(const char *file_name, MemoryImage *memoryImage, NameTable *entLabels,
-                       char **extFileContents);
+                             SymbolTable *symbols, MemoryImage *memoryImage,
+                             char **extFileContents, char **relFileContents, boolean *wasError,
+                             error_count_t *errors);
+Error checkEntryLabelsIfNeededInSecondTrans(ast_t *lineAst, SymbolTable *symbols);
+void createOutputFiles(const char *file_name, MemoryImage *memoryImage, SymbolTable *symbols,
+                       char **extFileContents, char **relFileContents);
 void createObjectFile(const char *file_name, MemoryImage *memoryImage);
-void createEntryFile(const char *file_name, NameTable *entTable);
+void createEntryFile(const char *file_name, SymbolTable *symbols);
 void createExternFile(const char *file_name, char **extFileContents);
+void createRelocationFile(const char *file_name, char **relFileContents);
 /* ---------------------------------------- */
 
 /*
@@ -63,63 +71,86 @@ void createExternFile(const char *file_name, char **extFileContents);
  * ASTs and produce the final product of the assembler.
  *
  * @param   *file_name      The name of the with the assembly source code.
- * @param   *labelsMap[]    Array of tables to hold the different labels.
+ * @param   *symbols        The table of the symbols (labels) of the file.
  * @param   *astList        List of ASTs (Abstract syntax trees) that were made in the
  *                          first transition.
- * @param   *memoryImage    The memory image of the assembly code.
+ * @param   isCheckOnly     TRUE to only check the lines, without encoding them and creating
+ *                          the output files.
+ * @param   *xref           The cross reference to record the uses of the labels in, or NULL.
+ * @param   *errors         The count of the lines with errors of the file.
  *
  * @return  SUCCESS on success, FAILURE on failure.
  */
-process_result second_transition(const char *file_name, NameTable *labelsMap[],
-                                 ast_list_t *astList)
+process_result second_transition(const char *file_name, SymbolTable *symbols,
+                                 ast_list_t *astList, boolean isCheckOnly, CrossReference *xref,
+                                 error_count_t *errors)
 {
     char *extFileContents = NULL; /* Will hold the contents of the .ext file. */
+    char *relFileContents = NULL; /* Will hold the contents of the .rel file. */
+    MemoryImage *memoryImage = NULL; /* There is no memory image when only checking. */
+    process_result secondTransitionRes;
+    trace_span_t span;
 
-    MemoryImage *memoryImage = createMemoryImage(
-            *getCounterPointer(astList, IC_) - PROGRAM_MEM_START,
-            *getCounterPointer(astList, DC_) - PROGRAM_MEM_START);
+    beginTraceSpan(&span, "second_transition", file_name);
+
+    if (isCheckOnly == FALSE)
+        memoryImage = createMemoryImage(*getCounterPointer(astList, IC_) - PROGRAM_MEM_START,
+                                        *getCounterPointer(astList, DC_) - PROGRAM_MEM_START);
 
     /* Travers through the ASTs (not the file). */
-    process_result secondTransitionRes =
-            secondFileTraverse(file_name, astList, labelsMap, memoryImage, &extFileContents);
+    secondTransitionRes = secondFileTraverse(file_name, astList, symbols, memoryImage,
+                                             &extFileContents, &relFileContents, xref, errors);
 
-    if (secondTransitionRes == SUCCESS) /* If there were no errors, create the output files. */
-        createOutputFiles(file_name, memoryImage, labelsMap[ENTRY], &extFileContents);
+    /* If there were no errors, create the output files. */
+    if (secondTransitionRes == SUCCESS && memoryImage != NULL)
+        createOutputFiles(file_name, memoryImage, symbols, &extFileContents,
+                          &relFileContents);
 
-    clearMemoryImage(&memoryImage); /* Delete memory image. */
+    if (memoryImage != NULL)
+        clearMemoryImage(&memoryImage); /* Delete memory image. */
+    (void) clear_ptr(extFileContents)
+    (void) clear_ptr(relFileContents)
 
+    endTraceSpan(&span);
     return secondTransitionRes;
 }
 
 /*
  * Initiates the traversal and processing of the source file during the second transition phase.
  * Will traverse through the ASTs created in the first transition instead of the source file.
+ * The ASTs are read one by one, so a spilled list is streamed back from its temporary file.
  *
  * @param   *file_name          The name of the source file being processed.
  * @param   *astList            Pointer to the list of abstract syntax trees.
- * @param   *labelsMap          Array of pointers to symbol tables for label management.
+ * @param   *symbols            The table of the symbols (labels) of the file.
  * @param   *memoryImage        Pointer to the memory image structure for storing machine code.
  * @param   **extFileContents   Pointer to the string of external file contents for reference.
+ * @param   **relFileContents   Pointer to the string of the relocation table to output.
+ * @param   *xref               The cross reference to record the uses of the labels in, or NULL.
+ * @param   *errors             The count of the lines with errors of the file.
  *
  * @return  A process_result indicating the outcome of the second transition phase.
  */
 process_result secondFileTraverse(const char *file_name, ast_list_t *astList,
-                                  NameTable *labelsMap[], MemoryImage *memoryImage,
-                                  char **extFileContents)
+                                  SymbolTable *symbols, MemoryImage *memoryImage,
+                                  char **extFileContents, char **relFileContents,
+                                  CrossReference *xref, error_count_t *errors)
 {
-    ast_list_node_t *currAstNode = getAstHead(astList);
-    int currLine = FIRST_LINE;
+    ast_t *lineAst;
     boolean wasError = FALSE; /* Indicates if there was an error. */
 
-    while (currAstNode != NULL) /* Traverse through the ASTs and handle them. */
+    rewindAstList(astList);
+    /* Traverse through the ASTs, until the lines with errors of the file reach their cap. */
+    while (isErrorsCapReached(file_name, errors, stderr) == FALSE &&
+           (lineAst = readNextAstFromList(astList)) != NULL)
     {
-        ast_t *lineAst = getAst(currAstNode);
-
-        handleLineInSecondTrans(file_name, currLine, lineAst, labelsMap, memoryImage,
-                                extFileContents, &wasError);
+        /* Each AST keeps the number of the line it represents (ASTs can be optimized out). */
+        handleLineInSecondTrans(file_name, getAstLineNumber(lineAst), lineAst, symbols,
+                                memoryImage, extFileContents, relFileContents, &wasError,
+                                errors);
 
-        currAstNode = getNextAstNode(currAstNode); /* Go to next AST */
-        currLine++; /* Increase line counter by 1 (each AST represents a different line). */
+        if (xref != NULL) /* Record the labels used in the line. */
+            addLabelUsesOfLine(xref, lineAst, getAstLineNumber(lineAst));
     }
 
     return (wasError == FALSE)? SUCCESS : FAILURE;
@@ -131,53 +162,56 @@ process_result secondFileTraverse(const char *file_name, ast_list_t *astList,
  * @param   *file_name          The name of the source file being processed.
  * @param   currLine            The current line number in the source file.
  * @param   *lineAst            The abstract syntax tree (AST) representing the processed line.
- * @param   *labelsMap          An array of pointers to symbol tables for label management.
- * @param   *memoryImage        Pointer to the memory image structure for storing machine code.
+ * @param   *symbols            The table of the symbols (labels) of the file.
+ * @param   *memoryImage        Pointer to the memory image structure for storing machine code,
+ *                              NULL to only check the line.
  * @param   **extFileContents   Pointer to the string of external file contents.
+ * @param   **relFileContents   Pointer to the string of the relocation table to output.
  * @param   *wasError           Pointer to a boolean indicating if an error occurred.
+ * @param   *errors             The count of the lines with errors of the file.
  */
 void handleLineInSecondTrans(const char *file_name, int currLine, ast_t *lineAst,
-                             NameTable *labelsMap[], MemoryImage *memoryImage,
-                             char **extFileContents, boolean *wasError)
+                             SymbolTable *symbols, MemoryImage *memoryImage,
+                             char **extFileContents, char **relFileContents, boolean *wasError,
+                             error_count_t *errors)
 {
-    /* Update addresses of entry labels based on data from first transition. */
-    Error lineError = updateTablesIfNeededInSecondTrans(lineAst,
-                                                        labelsMap[NORMAL], labelsMap[ENTRY]);
+    /* Check that the entry labels were defined in the first transition. */
+    Error lineError = checkEntryLabelsIfNeededInSecondTrans(lineAst, symbols);
     if (lineError == NO_ERROR)
-        lineError = checkUndefinedLabelArgumentError(lineAst, labelsMap[NORMAL], labelsMap[EXTERN]);
+        lineError = checkUndefinedLabelArgumentError(lineAst, symbols);
 
     /* Handle found errors (if found). */
     handleLineErrorInSecondTrans(file_name, currLine, lineError, wasError);
+    if (lineError != NO_ERROR)
+        errors -> errorsAmount++;
 
     /* Encode instruction\data and add content (if needed) to ext file if there was no error. */
-    if (*wasError == FALSE)
-        encodeLine(lineAst, memoryImage, labelsMap[NORMAL], labelsMap[EXTERN], extFileContents);
+    if (*wasError == FALSE && memoryImage != NULL)
+        encodeLine(lineAst, memoryImage, symbols, extFileContents, relFileContents);
 }
 
 /*
- * Updates symbol tables if needed during the second transition phase.
+ * Checks the labels of a .entry guidance (if the line is one) during the second transition phase.
  *
  * @param   *lineAst       The abstract syntax tree (AST) representing the processed line.
- * @param   *normalLabels  The normal symbol table for label management.
- * @param   *entLabels     The entry symbol table for label management.
+ * @param   *symbols       The table of the symbols (labels) of the file.
  *
  * @return  An error code indicating the outcome of the operation, or NO_ERROR if successful.
  */
-Error updateTablesIfNeededInSecondTrans(ast_t *lineAst, NameTable *normalLabels,
-                                        NameTable *entLabels)
+Error checkEntryLabelsIfNeededInSecondTrans(ast_t *lineAst, SymbolTable *symbols)
 {
     Error lineError = NO_ERROR;
 
-    /* If need to update table. */
+    /* If need to check entry labels. */
     if (getSentence(lineAst).sentenceType == GUIDANCE_SENTENCE &&
         getSentence(lineAst).sentence.guidance == ent)
     {
         arg_node_t *currEntLabel = getArgList(lineAst);
 
-        /* Update all .entry arguments to the address of their definition in the file. */
+        /* Check that all .entry arguments are defined in the file. */
         while (currEntLabel != NULL)
         {
-            lineError = updateEntTable(normalLabels, entLabels, currEntLabel);
+            lineError = checkEntryLabelError(getArgData(currEntLabel).data.string, symbols);
             currEntLabel = getNextNode(currEntLabel);
         }
     }
@@ -185,45 +219,33 @@ Error updateTablesIfNeededInSecondTrans(ast_t *lineAst, NameTable *normalLabels,
     return lineError;
 }
 
-/*
- * Updates the entry symbol table during the second transition phase.
- *
- * @param   *normalLabels    The normal symbol table for label management.
- * @param   *entLabels       The entry symbol table for label management.
- * @param   *entLabelArgNode The argument node containing the entry label information.
- *
- * @return  An error code indicating the outcome of the operation, or NO_ERROR if successful.
- */
-Error updateEntTable(NameTable *normalLabels, NameTable *entLabels, arg_node_t *entLabelArgNode)
-{
-    char *entLabel = getArgData(entLabelArgNode).data.string; /* The name of the label. */
-
-    Error lineError = checkEntryLabelError(entLabel, normalLabels); /* Check validation. */
-
-    if (lineError == NO_ERROR)
-        (void) setNumberInData(entLabels, entLabel,
-                               getDataByName(normalLabels, entLabel) -> num);
-
-    return lineError;
-}
-
 /*
  * Creates the output files containing the machine code (in the .ob file),
- * entry labels (in the .ent file), and external references (in the .ext file).
- * If there is no need to print the .ent or .ext file, will not print them.
+ * entry labels (in the .ent file), external references (in the .ext file),
+ * and the relocation table (in the .rel file).
+ * If there is no need to print the .ent, .ext or .rel file, will not print them (and will
+ * remove the one of an earlier assembly of the file, so it is not read with the new .ob).
  * The .ob file will always be printed.
  *
  * @param   *file_name          The name of the source file being processed.
  * @param   *memoryImage        A pointer to the memory image structure containing machine code.
- * @param   *entLabels          The entry symbol table for label management.
+ * @param   *symbols            The table of the symbols (labels) of the file.
  * @param   **extFileContents   Pointer to the array of external file contents for reference.
+ * @param   **relFileContents   Pointer to the string of the relocation table to output.
  */
-void createOutputFiles(const char *file_name, MemoryImage *memoryImage, NameTable *entLabels,
-                       char **extFileContents)
+void createOutputFiles(const char *file_name, MemoryImage *memoryImage, SymbolTable *symbols,
+                       char **extFileContents, char **relFileContents)
 {
+    trace_span_t span;
+
+    beginTraceSpan(&span, "create_output_files", file_name);
+
     createObjectFile(file_name, memoryImage);
-    createEntryFile(file_name, entLabels);
+    createEntryFile(file_name, symbols);
     createExternFile(file_name, extFileContents);
+    createRelocationFile(file_name, relFileContents);
+
+    endTraceSpan(&span);
 }
 
 /*
@@ -235,34 +257,27 @@ void createOutputFiles(const char *file_name, MemoryImage *memoryImage, NameTabl
  */
 void createObjectFile(const char *file_name, MemoryImage *memoryImage)
 {
-    /* Get the heading of the .ob file. */
-    char *objectFileContents = getEncodingInformation(memoryImage);
-
-    char *instructionSection = getEncodedWords(memoryImage, TRUE); /* Add the code segment. */
-    char *dataSection = getEncodedWords(memoryImage, FALSE); /* Add the data segment. */
-
-    /* Apply to string containing the header. */
-    addTwoStrings(&objectFileContents, instructionSection);
-    addTwoStrings(&objectFileContents, dataSection);
+    char *objectFileContents = getObjectFileContents(memoryImage);
 
     writeToFile(file_name, OBJECT_END, objectFileContents);
 
     (void) clear_ptr(objectFileContents)
-    (void) clear_ptr(instructionSection)
-    (void) clear_ptr(dataSection)
 }
 
 /*
- * Creates the entry file containing the entry labels.
+ * Creates the entry file containing the entry labels (in the order of their declarations).
  *
  * @param   *file_name   The name of the source file being processed.
- * @param   *entTable    The entry symbol table containing entry label information.
+ * @param   *symbols     The table of the symbols (labels) of the file.
  */
-void createEntryFile(const char *file_name, NameTable *entTable)
+void createEntryFile(const char *file_name, SymbolTable *symbols)
 {
-    char *entryFileContents = numbersNameTableToString(entTable);
+    char *entryFileContents = entrySymbolsToString(symbols);
 
-    writeToFile(file_name, ENT_END, entryFileContents);
+    if (entryFileContents != NULL)
+        writeToFile(file_name, ENT_END, entryFileContents);
+    else /* There are no entry labels. */
+        removeOutputFile(file_name, ENT_END);
 
     (void) clear_ptr(entryFileContents)
 }
@@ -276,7 +291,29 @@ void createEntryFile(const char *file_name, NameTable *entTable)
 void createExternFile(const char *file_name, char **extFileContents)
 {
     /* The contents of the extern file was created in the encoding process. */
-    writeToFile(file_name, EXT_END, *extFileContents);
+    if (*extFileContents != NULL)
+        writeToFile(file_name, EXT_END, *extFileContents);
+    else /* There are no external references. */
+        removeOutputFile(file_name, EXT_END);
 
     (void) clear_ptr(*extFileContents)
-}
\ No newline at end of file
+}
+
+/*
+ * Creates the relocation file containing the relocation table.
+ * Every line of the table is {address [tab] kind} of a word that depends on where the
+ * program will be loaded, kind is 'R' for relocatable words and 'E' for external words.
+ *
+ * @param   *file_name          The name of the source file being processed.
+ * @param   **relFileContents   Pointer to the string of the relocation table.
+ */
+void createRelocationFile(const char *file_name, char **relFileContents)
+{
+    /* The contents of the relocation file was created in the encoding process. */
+    if (*relFileContents != NULL)
+        writeToFile(file_name, REL_END, *relFileContents);
+    else /* There are no relocatable or external words. */
+        removeOutputFile(file_name, REL_END);
+
+    (void) clear_ptr(*relFileContents)
+}
@@ -15,14 +15,19 @@
  * ASTs and produce the final product of the assembler.
  *
  * @param   *file_name      The name of the with the assembly source code.
- * @param   *labelsMap[]    Array of tables to hold the different labels.
+ * @param   *symbols        The table of the symbols (labels) of the file.
  * @param   *astList        List of ASTs (Abstract syntax trees) that were made in the
  *                          first transition.
+ * @param   isCheckOnly     TRUE to only check the lines, without encoding them and creating
+ *                          the output files.
+ * @param   *xref           The cross reference to record the uses of the labels in, or NULL.
+ * @param   *errors         The count of the lines with errors of the file.
  *
  * @return  SUCCESS on success, FAILURE on failure.
  */
-process_result second_transition(const char *file_name, NameTable *labelsMap[],
-                                 ast_list_t *astList);
+process_result second_transition(const char *file_name, SymbolTable *symbols,
+                                 ast_list_t *astList, boolean isCheckOnly, CrossReference *xref,
+                                 error_count_t *errors);
 
 /* ---------------------------------------- */
 
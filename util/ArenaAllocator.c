@@ -0,0 +1,218 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file has the arena allocator - an allocator that takes the memory of the modules from
+ * big blocks, one after the other, and returns all of it at once when the arena is deleted.
+ * An allocation is a few instructions instead of a call to malloc, and freeing does nothing,
+ * so it fits a run that frees most of its memory only when it is done.
+ */
+
+/* ---Include header files--- */
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "../errors/system_errors.h"
+#include "memoryUtil.h"
+#include "ArenaAllocator.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define ARENA_BLOCK_SIZE 65536 /* The size of a block, a bigger allocation gets its own block. */
+/* ------------ */
+
+/* ---Macros--- */
+/* Rounds a size up to the alignment of the allocations. */
+#define ALIGN_UP(size) (((size) + sizeof(arena_header_t) - 1) / sizeof(arena_header_t) * \
+        sizeof(arena_header_t))
+#define BLOCK_DATA(block) ((char *) (block) + ALIGN_UP(sizeof(arena_block_t)))
+/* ------------ */
+
+/* Comes before every allocation, aligned for any type. */
+typedef union
+{
+    size_t size; /* The size of the allocation. */
+    long alignLong;
+    double alignDouble;
+    void *alignPointer;
+} arena_header_t;
+
+/* A block of the arena, its data comes right after it. */
+typedef struct arena_block_t
+{
+    struct arena_block_t *next; /* The block before it. */
+    size_t capacity; /* The size of the data of the block. */
+    size_t used; /* The used bytes of the data of the block. */
+} arena_block_t;
+
+typedef struct
+{
+    allocator_t allocator; /* The allocator of the arena, its state is the arena. */
+    arena_block_t *blocks; /* The current block first. */
+    pthread_mutex_t lock; /* Guards the blocks. */
+} arena_t;
+
+/* ---------------Prototypes--------------- */
+void *arenaAllocate(void *state, size_t size);
+void *arenaReallocate(void *state, void *ptr, size_t size);
+void arenaRelease(void *state, void *ptr);
+void *takeFromArena(arena_t *arena, size_t size);
+/* ---------------------------------------- */
+
+/*
+ * Creates an arena allocator - the memory is taken from big blocks and is returned only when
+ * the arena is deleted (freeing a pointer does nothing). Safe to use from a few threads.
+ * Terminates the program on allocation error !
+ *
+ * @return  Pointer to the created allocator.
+ */
+allocator_t *createArenaAllocator(void)
+{
+    /* The arena is below the allocators, so its own memory comes from malloc. */
+    arena_t *arena = (arena_t *) malloc(sizeof(arena_t));
+
+    handle_allocation_error(arena);
+    arena -> allocator.allocate = arenaAllocate;
+    arena -> allocator.reallocate = arenaReallocate;
+    arena -> allocator.release = arenaRelease;
+    arena -> allocator.state = arena;
+    arena -> blocks = NULL;
+    (void) pthread_mutex_init(&arena -> lock, NULL);
+
+    return &arena -> allocator;
+}
+
+/*
+ * Deletes an arena allocator, with all the memory that was taken from it.
+ *
+ * @param   **pAllocator    Pointer to the arena allocator, can be NULL.
+ */
+void deleteArenaAllocator(allocator_t **pAllocator)
+{
+    arena_t *arena;
+    arena_block_t *next;
+
+    if (*pAllocator != NULL)
+    {
+        arena = (arena_t *) (*pAllocator) -> state;
+        while (arena -> blocks != NULL) /* Delete it block-by-block. */
+        {
+            next = arena -> blocks -> next;
+            free(arena -> blocks);
+            arena -> blocks = next;
+        }
+        (void) pthread_mutex_destroy(&arena -> lock);
+        free(arena);
+        *pAllocator = NULL;
+    }
+}
+
+/*
+ * The allocate function of the arena allocator.
+ *
+ * @param   *state  The arena.
+ * @param   size    The size of the pointer.
+ *
+ * @return  Allocated pointer with the given size, or NULL if there is no memory.
+ */
+void *arenaAllocate(void *state, size_t size)
+{
+    arena_t *arena = (arena_t *) state;
+    void *ptr;
+
+    (void) pthread_mutex_lock(&arena -> lock);
+    ptr = takeFromArena(arena, size);
+    (void) pthread_mutex_unlock(&arena -> lock);
+
+    return ptr;
+}
+
+/*
+ * The reallocate function of the arena allocator.
+ * The last allocation of the current block is resized in place, if it fits in the block.
+ *
+ * @param   *state  The arena.
+ * @param   *ptr    The pointer to resize (can be NULL).
+ * @param   size    The new size of the pointer.
+ *
+ * @return  Allocated pointer with the given size, or NULL if there is no memory.
+ */
+void *arenaReallocate(void *state, void *ptr, size_t size)
+{
+    arena_t *arena = (arena_t *) state;
+    arena_block_t *block;
+    arena_header_t *header;
+    void *newPtr = ptr; /* Value to return, assume it is resized in place. */
+
+    (void) pthread_mutex_lock(&arena -> lock);
+    if (ptr == NULL)
+        newPtr = takeFromArena(arena, size);
+    else
+    {
+        block = arena -> blocks; /* The pointer has a block, so the arena has a current one. */
+        header = (arena_header_t *) ptr - 1;
+        if ((char *) ptr + ALIGN_UP(header -> size) == BLOCK_DATA(block) + block -> used &&
+            block -> used - ALIGN_UP(header -> size) + ALIGN_UP(size) <= block -> capacity)
+        {
+            block -> used = block -> used - ALIGN_UP(header -> size) + ALIGN_UP(size);
+            header -> size = size;
+        }
+        else if ((newPtr = takeFromArena(arena, size)) != NULL) /* Move it to a new space. */
+            memcpy(newPtr, ptr, (header -> size < size)? header -> size : size);
+    }
+    (void) pthread_mutex_unlock(&arena -> lock);
+
+    return newPtr;
+}
+
+/*
+ * The release function of the arena allocator, the memory is returned with the arena.
+ *
+ * @param   *state  Unused (the arena is deleted as a whole).
+ * @param   *ptr    Unused.
+ */
+void arenaRelease(void *state, void *ptr)
+{
+    (void) state;
+    (void) ptr;
+}
+
+/*
+ * Takes space from the current block of an arena, or from a new block if it does not fit.
+ * The lock of the arena should be held.
+ *
+ * @param   *arena  The arena.
+ * @param   size    The size of the space.
+ *
+ * @return  The space, or NULL if there is no memory.
+ */
+void *takeFromArena(arena_t *arena, size_t size)
+{
+    size_t neededSize = sizeof(arena_header_t) + ALIGN_UP(size);
+    arena_block_t *block = arena -> blocks;
+    arena_header_t *header = NULL;
+
+    if (block == NULL || block -> used + neededSize > block -> capacity) /* Add a block. */
+    {
+        block = (arena_block_t *) malloc(ALIGN_UP(sizeof(arena_block_t)) +
+                                         ((neededSize > ARENA_BLOCK_SIZE)? neededSize
+                                                                         : ARENA_BLOCK_SIZE));
+        if (block != NULL)
+        {
+            block -> capacity = (neededSize > ARENA_BLOCK_SIZE)? neededSize : ARENA_BLOCK_SIZE;
+            block -> used = 0;
+            block -> next = arena -> blocks;
+            arena -> blocks = block;
+        }
+    }
+
+    if (block != NULL)
+    {
+        header = (arena_header_t *) (BLOCK_DATA(block) + block -> used);
+        header -> size = size;
+        block -> used += neededSize;
+        header++; /* The space comes right after its header. */
+    }
+
+    return header;
+}
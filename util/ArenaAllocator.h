@@ -0,0 +1,31 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the ArenaAllocator.c file.
+ */
+
+#ifndef MMN_14_ARENAALLOCATOR_H
+#define MMN_14_ARENAALLOCATOR_H
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Creates an arena allocator - the memory is taken from big blocks and is returned only when
+ * the arena is deleted (freeing a pointer does nothing). Safe to use from a few threads.
+ * Terminates the program on allocation error !
+ *
+ * @return  Pointer to the created allocator.
+ */
+allocator_t *createArenaAllocator(void);
+
+/*
+ * Deletes an arena allocator, with all the memory that was taken from it.
+ *
+ * @param   **pAllocator    Pointer to the arena allocator, can be NULL.
+ */
+void deleteArenaAllocator(allocator_t **pAllocator);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_ARENAALLOCATOR_H */
@@ -0,0 +1,114 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file has the SpscQueue data structure - a bounded queue that passes items from one
+ * producer thread to one consumer thread without locks.
+ * The items are kept in a ring: only the producer moves the tail and only the consumer moves
+ * the head, so every index has one writer, and a release store of an index publishes the items
+ * before it to the other thread.
+ */
+
+/* ---Include header files--- */
+#include <stdlib.h>
+#include <sched.h>
+#include "memoryUtil.h"
+#include "SpscQueue.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE UTIL_MEMORY /* For the memory statistics. */
+#define MIN_CAPACITY 2
+#define CACHE_LINE_SIZE 64
+/* ------------ */
+
+/* ---Macros--- */
+#define LOAD_INDEX(index) __atomic_load_n(&(index), __ATOMIC_ACQUIRE)
+#define STORE_INDEX(index, value) __atomic_store_n(&(index), (value), __ATOMIC_RELEASE)
+/* ------------ */
+
+struct SpscQueue
+{
+    void **items; /* The ring of the items. */
+    unsigned long capacity; /* The size of the ring (a power of 2). */
+    char headPadding[CACHE_LINE_SIZE]; /* The threads should not share a cache line. */
+    unsigned long head; /* The amount of popped items (moved by the consumer only). */
+    char tailPadding[CACHE_LINE_SIZE];
+    unsigned long tail; /* The amount of pushed items (moved by the producer only). */
+};
+
+/*
+ * Creates an empty queue.
+ *
+ * @param   capacity    The most items the queue holds (rounded up to a power of 2).
+ *
+ * @return  Pointer to the created queue.
+ */
+SpscQueue *createSpscQueue(int capacity)
+{
+    SpscQueue *queue = (SpscQueue *) allocate_space(sizeof(SpscQueue));
+
+    /* A power of 2 capacity turns the ring index into a mask. */
+    queue -> capacity = MIN_CAPACITY;
+    while (queue -> capacity < (unsigned long) capacity)
+        queue -> capacity <<= 1;
+
+    queue -> items = (void **) allocate_space(queue -> capacity * sizeof(void *));
+    queue -> head = queue -> tail = 0;
+
+    return queue;
+}
+
+/*
+ * Pushes an item to the end of the queue, waits while the queue is full.
+ * Should be called only by the producer thread.
+ *
+ * @param   *queue  The queue.
+ * @param   *item   The item to push (can be NULL, to mark the end of the items).
+ */
+void pushToSpscQueue(SpscQueue *queue, void *item)
+{
+    unsigned long tail = queue -> tail; /* Only this thread changes the tail. */
+
+    while (tail - LOAD_INDEX(queue -> head) == queue -> capacity)
+        (void) sched_yield(); /* Full, let the consumer catch up. */
+
+    queue -> items[tail & (queue -> capacity - 1)] = item;
+    STORE_INDEX(queue -> tail, tail + 1); /* Publish the item. */
+}
+
+/*
+ * Pops the item at the start of the queue, waits while the queue is empty.
+ * Should be called only by the consumer thread.
+ *
+ * @param   *queue  The queue.
+ *
+ * @return  The popped item.
+ */
+void *popFromSpscQueue(SpscQueue *queue)
+{
+    unsigned long head = queue -> head; /* Only this thread changes the head. */
+    void *item; /* Value to return. */
+
+    while (LOAD_INDEX(queue -> tail) == head)
+        (void) sched_yield(); /* Empty, let the producer catch up. */
+
+    item = queue -> items[head & (queue -> capacity - 1)];
+    STORE_INDEX(queue -> head, head + 1); /* Free the place of the item. */
+
+    return item;
+}
+
+/*
+ * Deletes a queue (not the items in it).
+ *
+ * @param   **pQueue    Pointer to the queue to delete.
+ */
+void deleteSpscQueue(SpscQueue **pQueue)
+{
+    if (pQueue != NULL && *pQueue != NULL) /* Check if it is already deleted. */
+    {
+        (void) clear_ptr((*pQueue) -> items)
+        (void) clear_ptr(*pQueue)
+    }
+}
@@ -0,0 +1,53 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the SpscQueue.c file.
+ */
+
+#ifndef MMN_14_SPSCQUEUE_H
+#define MMN_14_SPSCQUEUE_H
+
+/* SpscQueue data type - a bounded lock-free queue between one producer and one consumer thread. */
+typedef struct SpscQueue SpscQueue;
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Creates an empty queue.
+ *
+ * @param   capacity    The most items the queue holds (rounded up to a power of 2).
+ *
+ * @return  Pointer to the created queue.
+ */
+SpscQueue *createSpscQueue(int capacity);
+
+/*
+ * Pushes an item to the end of the queue, waits while the queue is full.
+ * Should be called only by the producer thread.
+ *
+ * @param   *queue  The queue.
+ * @param   *item   The item to push (can be NULL, to mark the end of the items).
+ */
+void pushToSpscQueue(SpscQueue *queue, void *item);
+
+/*
+ * Pops the item at the start of the queue, waits while the queue is empty.
+ * Should be called only by the consumer thread.
+ *
+ * @param   *queue  The queue.
+ *
+ * @return  The popped item.
+ */
+void *popFromSpscQueue(SpscQueue *queue);
+
+/*
+ * Deletes a queue (not the items in it).
+ *
+ * @param   **pQueue    Pointer to the queue to delete.
+ */
+void deleteSpscQueue(SpscQueue **pQueue);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_SPSCQUEUE_H */
@@ -3,11 +3,16 @@
  * @version (18/08/2023)
  *
  * This file has the function to assist with memory related functions.
+ *
+ * All the memory of the modules is taken from the set allocator (malloc and free by default),
+ * so an arena, size-class pools or a tracking allocator can be plugged in without changing the
+ * modules. The allocations, the allocated bytes and the frees are counted for every module.
  */
 
 /* ---Include header files--- */
 #include <stdlib.h>
 #include "../errors/system_errors.h"
+#include "memoryUtil.h"
 /* -------------------------- */
 
 /* ---Finals--- */
@@ -16,43 +21,196 @@
 /* ------------ */
 
 /* ---Macros--- */
+/* The modules can allocate from a few threads at the same time. */
+#define COUNT(counter, amount) (void) __atomic_fetch_add(&(counter), (amount), __ATOMIC_RELAXED)
+#define GET_ALLOCATOR() __atomic_load_n(&currentAllocator, __ATOMIC_ACQUIRE)
 /* ------------ */
 
 /* ---------------Prototypes--------------- */
+void *standardAllocate(void *state, size_t size);
+void *standardReallocate(void *state, void *ptr, size_t size);
+void standardRelease(void *state, void *ptr);
 /* ---------------------------------------- */
 
+/* The standard allocator (malloc and free). */
+static const allocator_t standardAllocator = {standardAllocate, standardReallocate,
+                                              standardRelease, NULL};
+
+/* The allocator of all the modules. */
+static const allocator_t *currentAllocator = &standardAllocator;
+
+/* The memory statistics of every module. */
+static memory_statistics_t modulesStatistics[MEMORY_MODULES_AMOUNT];
+
 /*
- * Gets a pointer with allocated space in the memory with the given size.
+ * Gets a pointer with allocated space in the memory with the given size
+ * (use allocate_space, it gives the module of the file).
  * Terminates the program on allocation error !
  *
+ * @param   module  The module that allocates the space.
  * @param   size    The size of the pointer.
  *
  * @return  Allocated pointer with the given size.
  */
-void *allocate_space(size_t size)
+void *allocate_module_space(memory_module_t module, size_t size)
 {
-    void *ptr = malloc(size); /* Allocating the space */
+    const allocator_t *allocator = GET_ALLOCATOR();
+    void *ptr = allocator -> allocate(allocator -> state, size); /* Allocating the space */
+
     handle_allocation_error(ptr); /* Handling errors if there are */
+
+    COUNT(modulesStatistics[module].allocations, 1);
+    COUNT(modulesStatistics[module].allocatedBytes, size);
     return ptr;
 }
 
 /*
- * Frees a given pointer.
+ * Changes the size of an allocated pointer, keeping its contents
+ * (use reallocate_space, it gives the module of the file).
+ * Terminates the program on allocation error !
  *
+ * @param   module  The module that reallocates the space.
+ * @param   *ptr    The pointer to resize (can be NULL).
+ * @param   size    The new size of the pointer.
+ *
+ * @return  Allocated pointer with the given size.
+ */
+void *reallocate_module_space(memory_module_t module, void *ptr, size_t size)
+{
+    const allocator_t *allocator = GET_ALLOCATOR();
+
+    ptr = allocator -> reallocate(allocator -> state, ptr, size); /* Resizing the space */
+    handle_allocation_error(ptr); /* Handling errors if there are */
+
+    COUNT(modulesStatistics[module].allocations, 1);
+    COUNT(modulesStatistics[module].allocatedBytes, size);
+    return ptr;
+}
+
+/*
+ * Frees a given pointer (use free_ptr, it gives the module of the file).
+ *
+ * @param   module  The module that frees the pointer.
  * @param   *ptr    Pointer to free.
  *
  * @return  0 if the pointer was freed, (-1) if the pointer was already NULL.
  */
-int free_ptr(void *ptr)
+int free_module_ptr(memory_module_t module, void *ptr)
 {
     int returnCode = WAS_NULL_RETURN_CODE; /* Assume the given pointer doesn't need to be free */
+    const allocator_t *allocator;
 
     if (ptr != NULL) /* Check if we were given a NULL pointer */
     {
         /* Free the pointer */
-        free(ptr);
+        allocator = GET_ALLOCATOR();
+        allocator -> release(allocator -> state, ptr);
+        COUNT(modulesStatistics[module].frees, 1);
         returnCode = FREED_RETURN_CODE;
     }
 
     return returnCode;
-}
\ No newline at end of file
+}
+
+/*
+ * Sets the allocator of all the modules, for the whole run of the program.
+ * A pointer should be freed by the allocator that allocated it, and some memory is kept
+ * between the files (the cached included files, the files that were read ahead), so the
+ * allocator should be set before anything is allocated and kept until everything is freed.
+ *
+ * @param   *allocator  The allocator to set, or NULL for the standard one (malloc and free).
+ */
+void setAllocator(const allocator_t *allocator)
+{
+    __atomic_store_n(&currentAllocator, (allocator != NULL)? allocator : &standardAllocator,
+                     __ATOMIC_RELEASE);
+}
+
+/*
+ * Gets the memory statistics of a module, since they were reset.
+ *
+ * @param   module          The module.
+ * @param   *statistics     Will hold the statistics of the module.
+ */
+void getMemoryStatistics(memory_module_t module, memory_statistics_t *statistics)
+{
+    statistics -> allocations = __atomic_load_n(&modulesStatistics[module].allocations,
+                                                __ATOMIC_RELAXED);
+    statistics -> allocatedBytes = __atomic_load_n(&modulesStatistics[module].allocatedBytes,
+                                                   __ATOMIC_RELAXED);
+    statistics -> frees = __atomic_load_n(&modulesStatistics[module].frees, __ATOMIC_RELAXED);
+}
+
+/*
+ * Resets the memory statistics of all the modules.
+ */
+void resetMemoryStatistics(void)
+{
+    int i; /* Loop variable. */
+
+    for (i = 0; i < MEMORY_MODULES_AMOUNT; i++)
+    {
+        __atomic_store_n(&modulesStatistics[i].allocations, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&modulesStatistics[i].allocatedBytes, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&modulesStatistics[i].frees, 0, __ATOMIC_RELAXED);
+    }
+}
+
+/*
+ * Gets the name of a module.
+ *
+ * @param   module  The module.
+ *
+ * @return  The name of the module.
+ */
+const char *getMemoryModuleName(memory_module_t module)
+{
+    /* The names, in the order of the modules. */
+    static const char *modulesNames[MEMORY_MODULES_AMOUNT] =
+            {"util", "strings", "files", "NameTable", "SymbolTable", "AST", "diagnoses",
+             "transitions", "encoding", "ObjectFile", "assembler", "linker", "simulator",
+             "disassembler", "lsp", "extractor"};
+
+    return modulesNames[module];
+}
+
+/*
+ * The allocate function of the standard allocator.
+ *
+ * @param   *state  Unused (the standard allocator has no state).
+ * @param   size    The size of the pointer.
+ *
+ * @return  Allocated pointer with the given size, or NULL if there is no memory.
+ */
+void *standardAllocate(void *state, size_t size)
+{
+    (void) state;
+    return malloc(size);
+}
+
+/*
+ * The reallocate function of the standard allocator.
+ *
+ * @param   *state  Unused (the standard allocator has no state).
+ * @param   *ptr    The pointer to resize (can be NULL).
+ * @param   size    The new size of the pointer.
+ *
+ * @return  Allocated pointer with the given size, or NULL if there is no memory.
+ */
+void *standardReallocate(void *state, void *ptr, size_t size)
+{
+    (void) state;
+    return realloc(ptr, size);
+}
+
+/*
+ * The release function of the standard allocator.
+ *
+ * @param   *state  Unused (the standard allocator has no state).
+ * @param   *ptr    The pointer to free.
+ */
+void standardRelease(void *state, void *ptr)
+{
+    (void) state;
+    free(ptr);
+}
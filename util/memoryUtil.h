@@ -8,30 +8,111 @@
 #ifndef MMN_14_MEMORYUTIL_H
 #define MMN_14_MEMORYUTIL_H
 
+/* The modules of the programs. The memory statistics are kept for every module, so every file
+ * that uses the memory functions defines MEMORY_MODULE (in its finals) as its module. */
+typedef enum
+{
+    UTIL_MEMORY, STRINGS_MEMORY, FILES_MEMORY, NAME_TABLE_MEMORY, SYMBOL_TABLE_MEMORY,
+    AST_MEMORY, DIAGNOSES_MEMORY, TRANSITIONS_MEMORY, ENCODING_MEMORY, OBJECT_FILE_MEMORY,
+    ASSEMBLER_MEMORY, LINKER_MEMORY, SIMULATOR_MEMORY, DISASSEMBLER_MEMORY, LSP_MEMORY,
+    EXTRACTOR_MEMORY,
+    /* Amount of modules. !! add new modules before this one !! */
+    MEMORY_MODULES_AMOUNT
+} memory_module_t;
+
+/* An allocator - the functions that get and free the memory of all the modules.
+ * The functions return NULL when there is no memory (the program is terminated then). */
+typedef struct allocator_t
+{
+    void *(*allocate)(void *state, size_t size);
+    void *(*reallocate)(void *state, void *ptr, size_t size); /* ptr can be NULL. */
+    void (*release)(void *state, void *ptr);
+    void *state; /* The state of the allocator (an arena, pools...), given to its functions. */
+} allocator_t;
+
+/* The memory statistics of a module. */
+typedef struct
+{
+    unsigned long allocations; /* The amount of allocations and reallocations. */
+    unsigned long allocatedBytes; /* The bytes of the allocations and the reallocations. */
+    unsigned long frees;
+} memory_statistics_t;
+
 /* ---Macros--- */
 #define clear_ptr(ptr) free_ptr((ptr)); ptr = NULL;
+#define allocate_space(size) allocate_module_space(MEMORY_MODULE, (size))
+#define reallocate_space(ptr, size) reallocate_module_space(MEMORY_MODULE, (ptr), (size))
+#define free_ptr(ptr) free_module_ptr(MEMORY_MODULE, (ptr))
 /* ------------ */
 
 /* ---------------Prototypes--------------- */
 
 /*
- * Gets a pointer with allocated space in the memory with the given size.
+ * Gets a pointer with allocated space in the memory with the given size
+ * (use allocate_space, it gives the module of the file).
  * Terminates the program on allocation error !
  *
+ * @param   module  The module that allocates the space.
  * @param   size    The size of the pointer.
  *
  * @return  Allocated pointer with the given size.
  */
-void *allocate_space(size_t size);
+void *allocate_module_space(memory_module_t module, size_t size);
 
 /*
- * Frees a given pointer.
+ * Changes the size of an allocated pointer, keeping its contents
+ * (use reallocate_space, it gives the module of the file).
+ * Terminates the program on allocation error !
  *
+ * @param   module  The module that reallocates the space.
+ * @param   *ptr    The pointer to resize (can be NULL).
+ * @param   size    The new size of the pointer.
+ *
+ * @return  Allocated pointer with the given size.
+ */
+void *reallocate_module_space(memory_module_t module, void *ptr, size_t size);
+
+/*
+ * Frees a given pointer (use free_ptr, it gives the module of the file).
+ *
+ * @param   module  The module that frees the pointer.
  * @param   *ptr    Pointer to free.
  *
  * @return  0 if the pointer was freed, (-1) if the pointer was already NULL.
  */
-int free_ptr(void *ptr);
+int free_module_ptr(memory_module_t module, void *ptr);
+
+/*
+ * Sets the allocator of all the modules, for the whole run of the program.
+ * A pointer should be freed by the allocator that allocated it, and some memory is kept
+ * between the files (the cached included files, the files that were read ahead), so the
+ * allocator should be set before anything is allocated and kept until everything is freed.
+ *
+ * @param   *allocator  The allocator to set, or NULL for the standard one (malloc and free).
+ */
+void setAllocator(const allocator_t *allocator);
+
+/*
+ * Gets the memory statistics of a module, since they were reset.
+ *
+ * @param   module          The module.
+ * @param   *statistics     Will hold the statistics of the module.
+ */
+void getMemoryStatistics(memory_module_t module, memory_statistics_t *statistics);
+
+/*
+ * Resets the memory statistics of all the modules.
+ */
+void resetMemoryStatistics(void);
+
+/*
+ * Gets the name of a module.
+ *
+ * @param   module  The module.
+ *
+ * @return  The name of the module.
+ */
+const char *getMemoryModuleName(memory_module_t module);
 
 /* ---------------------------------------- */
 
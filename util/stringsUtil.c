@@ -18,10 +18,14 @@
 /* -------------------------- */
 
 /* ---Finals--- */
+#define MEMORY_MODULE STRINGS_MEMORY /* For the memory statistics. */
 #define SAME_STRINGS 0
 #define SIZE_FOR_NEW_LINE 1
 #define SIZE_FOR_TAB 1
 #define SIZE_FOR_STR 31
+#define FNV_OFFSET_BASIS 2166136261UL
+#define FNV_PRIME 16777619UL
+#define HASH_MASK 0xffffffffUL
 /* ------------ */
 
 /* ---Macros--- */
@@ -124,8 +128,8 @@ void addTwoStrings(char **str1, const char *str2)
         }
         else /* Add more space if the string already has some. */
         {
-            *str1 = (char *) realloc(*str1,
-                                     strlen(*str1) + strlen(str2) + SIZE_FOR_NULL);
+            *str1 = (char *) reallocate_space(*str1,
+                                              strlen(*str1) + strlen(str2) + SIZE_FOR_NULL);
             (void) strcat(*str1, str2); /* *str1 += str2 */
         }
     }
@@ -270,4 +274,21 @@ void addToStringInFormat(char **pString, const char *str, int val)
     /* Free helper strings. */
     (void) clear_ptr(valStr)
     (void) clear_ptr(startLine)
-}
\ No newline at end of file
+}
+
+/*
+ * Hashes a string (FNV-1a), for hash tables of names.
+ *
+ * @param   *str    The string to hash.
+ *
+ * @return  The hash of the string (32 bits).
+ */
+unsigned long hashString(const char *str)
+{
+    unsigned long hash = FNV_OFFSET_BASIS;
+
+    for (; *str != '\0'; str++)
+        hash = ((hash ^ (unsigned char) *str) * FNV_PRIME) & HASH_MASK;
+
+    return hash;
+}
@@ -112,6 +112,15 @@ char *getStringFromVal(int val);
  */
 void addToStringInFormat(char **pString, const char *str, int val);
 
+/*
+ * Hashes a string (FNV-1a), for hash tables of names.
+ *
+ * @param   *str    The string to hash.
+ *
+ * @return  The hash of the string (32 bits).
+ */
+unsigned long hashString(const char *str);
+
 /* ---------------------------------------- */
 
 #endif /* MMN_14_STRINGSUTIL_H */
@@ -0,0 +1,121 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file has the functions to assist with running work on a few threads.
+ */
+
+/* ---Include header files--- */
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "memoryUtil.h"
+#include "threadUtil.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE UTIL_MEMORY /* For the memory statistics. */
+#define ONE_THREAD 1
+#define FIRST_TASK 0
+/* ------------ */
+
+/* State shared between the threads running the tasks. */
+typedef struct
+{
+    pthread_mutex_t lock; /* Guards nextTask. */
+    int nextTask; /* The next task that was not taken yet. */
+    int tasksAmount;
+    parallel_task_t task;
+    void *context;
+} tasks_state_t;
+
+/* ---------------Prototypes--------------- */
+void *runTasksWorker(void *state);
+/* ---------------------------------------- */
+
+/*
+ * Gets the amount of processors that are currently online.
+ *
+ * @return  The amount of online processors (at least 1).
+ */
+int getProcessorsAmount(void)
+{
+    long processorsAmount = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (processorsAmount < ONE_THREAD)? ONE_THREAD : (int) processorsAmount;
+}
+
+/*
+ * Runs tasks [0, tasksAmount) on a few threads and waits for all of them to finish.
+ * Every thread takes the next task that was not taken yet, so slow tasks
+ * don't hold back the rest of them.
+ * Runs the tasks on the calling thread if only one thread is needed.
+ *
+ * @param   tasksAmount     The amount of tasks to run.
+ * @param   threadsAmount   The maximum amount of threads to use.
+ * @param   task            The task function.
+ * @param   *context        The context shared between all the tasks.
+ */
+void runTasksInParallel(int tasksAmount, int threadsAmount, parallel_task_t task, void *context)
+{
+    int i; /* Loop variable. */
+
+    if (threadsAmount > tasksAmount) /* No need for idle threads. */
+        threadsAmount = tasksAmount;
+
+    if (threadsAmount <= ONE_THREAD) /* Run on the calling thread. */
+        for (i = FIRST_TASK; i < tasksAmount; i++)
+            task(i, context);
+
+    else
+    {
+        tasks_state_t state;
+        pthread_t *threads = (pthread_t *) allocate_space(threadsAmount * sizeof(pthread_t));
+        int startedThreads = 0;
+
+        (void) pthread_mutex_init(&state.lock, NULL);
+        state.nextTask = FIRST_TASK;
+        state.tasksAmount = tasksAmount;
+        state.task = task;
+        state.context = context;
+
+        /* The calling thread works too, so start one thread less. */
+        for (i = ONE_THREAD; i < threadsAmount; i++)
+            if (pthread_create(&threads[startedThreads], NULL, runTasksWorker, &state) == 0)
+                startedThreads++;
+
+        (void) runTasksWorker(&state);
+
+        for (i = 0; i < startedThreads; i++)
+            (void) pthread_join(threads[i], NULL);
+
+        (void) pthread_mutex_destroy(&state.lock);
+        (void) clear_ptr(threads)
+    }
+}
+
+/*
+ * The work loop of every thread, takes tasks until there are no more tasks.
+ *
+ * @param   *state  The shared tasks state.
+ *
+ * @return  NULL.
+ */
+void *runTasksWorker(void *state)
+{
+    tasks_state_t *tasksState = (tasks_state_t *) state;
+    int taskIndex; /* The task to run. */
+
+    do {
+        (void) pthread_mutex_lock(&tasksState -> lock);
+        taskIndex = tasksState -> nextTask;
+        if (taskIndex < tasksState -> tasksAmount)
+            tasksState -> nextTask++;
+        (void) pthread_mutex_unlock(&tasksState -> lock);
+
+        if (taskIndex < tasksState -> tasksAmount)
+            tasksState -> task(taskIndex, tasksState -> context);
+    } while (taskIndex < tasksState -> tasksAmount);
+
+    return NULL;
+}
@@ -0,0 +1,38 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the threadUtil.c file.
+ */
+
+#ifndef MMN_14_THREADUTIL_H
+#define MMN_14_THREADUTIL_H
+
+/* A task that can be run in parallel, gets the index of the task and a shared context. */
+typedef void (*parallel_task_t)(int taskIndex, void *context);
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Gets the amount of processors that are currently online.
+ *
+ * @return  The amount of online processors (at least 1).
+ */
+int getProcessorsAmount(void);
+
+/*
+ * Runs tasks [0, tasksAmount) on a few threads and waits for all of them to finish.
+ * Every thread takes the next task that was not taken yet, so slow tasks
+ * don't hold back the rest of them.
+ * Runs the tasks on the calling thread if only one thread is needed.
+ *
+ * @param   tasksAmount     The amount of tasks to run.
+ * @param   threadsAmount   The maximum amount of threads to use.
+ * @param   task            The task function.
+ * @param   *context        The context shared between all the tasks.
+ */
+void runTasksInParallel(int tasksAmount, int threadsAmount, parallel_task_t task, void *context);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_THREADUTIL_H */
@@ -0,0 +1,29 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file has the functions to assist with measuring time.
+ */
+
+/* ---Include header files--- */
+#include <time.h>
+/* -------------------------- */
+
+/* ---Finals--- */
+#define NANO_SECONDS_IN_SECOND 1e9
+/* ------------ */
+
+/*
+ * Gets the current time of a monotonic clock (not affected by changes of the system time).
+ * Only differences between two calls are meaningful.
+ *
+ * @return  The current time in seconds.
+ */
+double getMonotonicSeconds(void)
+{
+    struct timespec now;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double) now.tv_sec + (double) now.tv_nsec / NANO_SECONDS_IN_SECOND;
+}
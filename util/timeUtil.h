@@ -0,0 +1,23 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the timeUtil.c file.
+ */
+
+#ifndef MMN_14_TIMEUTIL_H
+#define MMN_14_TIMEUTIL_H
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Gets the current time of a monotonic clock (not affected by changes of the system time).
+ * Only differences between two calls are meaningful.
+ *
+ * @return  The current time in seconds.
+ */
+double getMonotonicSeconds(void);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_TIMEUTIL_H */
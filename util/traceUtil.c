@@ -0,0 +1,247 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * This file has the tracer - it records the spans of the work on the files (the stages of the
+ * assembler, reading and writing files), and writes them as Chrome trace events.
+ * Every thread records its spans in its own ring buffer, so recording a span takes no lock.
+ * The buffers are kept in a list, and a buffer of a thread that ended is reused by the next
+ * thread, so the short threads of the pipeline don't need a buffer each.
+ */
+
+/* ---Include header files--- */
+#include <stdio.h>
+#include <string.h>
+#include "../new-data-types/boolean.h"
+#include "memoryUtil.h"
+#include "timeUtil.h"
+#include "traceUtil.h"
+/* -------------------------- */
+
+/* ---Finals--- */
+#define MEMORY_MODULE UTIL_MEMORY /* For the memory statistics. */
+#define BUFFER_EVENTS 8192 /* The spans kept for every thread (a power of 2). */
+#define FILE_NAME_LENGTH 64 /* The longest file name kept for a span (longer are cut). */
+#define MICRO_SECONDS_IN_SECOND 1e6
+#define PROCESS_ID 1
+#define FIRST_THREAD_ID 1
+#define FIRST_CONTROL_CHAR 0x20 /* The characters before it are escaped in JSON. */
+/* ------------ */
+
+/* ---Macros--- */
+#define IS_TRACING() __atomic_load_n(&isTracing, __ATOMIC_ACQUIRE)
+/* ------------ */
+
+/* A recorded span. */
+typedef struct
+{
+    const char *name;
+    char file[FILE_NAME_LENGTH + 1]; /* Empty if the span has no file. */
+    double start; /* Seconds since the tracing was started. */
+    double duration; /* In seconds. */
+} trace_event_t;
+
+/* The ring buffer of the spans of a thread. */
+typedef struct TraceBuffer
+{
+    trace_event_t events[BUFFER_EVENTS];
+    unsigned long recordedAmount; /* The amount of the spans that were ever recorded. */
+    int threadId; /* The id of the thread in the trace. */
+    boolean isOwned; /* TRUE while a thread records to the buffer. */
+    struct TraceBuffer *next;
+} TraceBuffer;
+
+/* ---------------Prototypes--------------- */
+TraceBuffer *takeTraceBuffer(void);
+void writeJsonString(FILE *traceFile, const char *str);
+/* ---------------------------------------- */
+
+static boolean isTracing = FALSE;
+static double traceStart; /* The time the tracing was started at. */
+static TraceBuffer *traceBuffers = NULL; /* The list of the buffers of the threads. */
+static int buffersAmount = 0;
+static __thread TraceBuffer *threadBuffer = NULL; /* The buffer of the calling thread. */
+
+/*
+ * Starts recording the spans of all the threads.
+ */
+void startTracing(void)
+{
+    traceStart = getMonotonicSeconds();
+    __atomic_store_n(&isTracing, TRUE, __ATOMIC_RELEASE);
+}
+
+/*
+ * Begins a span on the calling thread (does nothing if the tracing was not started).
+ * The name is kept as it is, so it should be kept until the trace is stopped (a literal).
+ *
+ * @param   *span   Will hold the begun span.
+ * @param   *name   The name of the span.
+ * @param   *file   The name of the file of the span (can be NULL).
+ */
+void beginTraceSpan(trace_span_t *span, const char *name, const char *file)
+{
+    span -> name = NULL;
+
+    if (IS_TRACING() == TRUE)
+    {
+        if (threadBuffer == NULL) /* A buffer for the thread, while it runs. */
+            threadBuffer = takeTraceBuffer();
+
+        span -> name = name;
+        span -> file = file;
+        span -> start = getMonotonicSeconds();
+    }
+}
+
+/*
+ * Ends a span, and records it in the buffer of the calling thread.
+ * Only the last spans of every thread are kept, the oldest spans are overwritten.
+ *
+ * @param   *span   The span to end, begun on the calling thread.
+ */
+void endTraceSpan(const trace_span_t *span)
+{
+    trace_event_t *event;
+
+    if (span -> name != NULL && IS_TRACING() == TRUE)
+    {
+        event = &threadBuffer -> events[threadBuffer -> recordedAmount++ & (BUFFER_EVENTS - 1)];
+        event -> name = span -> name;
+        event -> file[0] = event -> file[FILE_NAME_LENGTH] = '\0';
+        if (span -> file != NULL)
+            (void) strncpy(event -> file, span -> file, FILE_NAME_LENGTH);
+        event -> start = span -> start - traceStart;
+        event -> duration = getMonotonicSeconds() - span -> start;
+    }
+}
+
+/*
+ * Gives the buffer of the calling thread to the next thread that records a span.
+ * Should be called before a thread that recorded spans returns.
+ */
+void endTraceThread(void)
+{
+    if (threadBuffer != NULL)
+    {
+        __atomic_store_n(&threadBuffer -> isOwned, FALSE, __ATOMIC_RELEASE);
+        threadBuffer = NULL;
+    }
+}
+
+/*
+ * Writes the recorded spans as Chrome trace events (JSON), to be viewed on a timeline
+ * (chrome://tracing or Perfetto).
+ * Should be called when the threads that recorded spans are done.
+ *
+ * @param   *traceFile  The file to write to.
+ */
+void writeTrace(FILE *traceFile)
+{
+    TraceBuffer *buffer;
+    trace_event_t *event;
+    unsigned long i; /* Loop variable. */
+    boolean isFirst = TRUE;
+
+    fputs("{\"traceEvents\":[", traceFile);
+
+    for (buffer = __atomic_load_n(&traceBuffers, __ATOMIC_ACQUIRE); buffer != NULL;
+         buffer = buffer -> next)
+    {
+        /* The spans that were not overwritten, from the oldest. */
+        for (i = (buffer -> recordedAmount > BUFFER_EVENTS)?
+                 buffer -> recordedAmount - BUFFER_EVENTS : 0; i < buffer -> recordedAmount; i++)
+        {
+            event = &buffer -> events[i & (BUFFER_EVENTS - 1)];
+
+            fprintf(traceFile, "%s\n{\"name\":", (isFirst == TRUE)? "" : ",");
+            writeJsonString(traceFile, event -> name);
+            fprintf(traceFile, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d",
+                    event -> start * MICRO_SECONDS_IN_SECOND,
+                    event -> duration * MICRO_SECONDS_IN_SECOND, PROCESS_ID, buffer -> threadId);
+            if (event -> file[0] != '\0')
+            {
+                fputs(",\"args\":{\"file\":", traceFile);
+                writeJsonString(traceFile, event -> file);
+                fputc('}', traceFile);
+            }
+            fputc('}', traceFile);
+            isFirst = FALSE;
+        }
+    }
+
+    fputs("\n],\"displayTimeUnit\":\"ms\"}\n", traceFile);
+}
+
+/*
+ * Stops the tracing and deletes the recorded spans.
+ * Should be called when the threads that recorded spans are done.
+ */
+void stopTracing(void)
+{
+    TraceBuffer *buffer, *next;
+
+    __atomic_store_n(&isTracing, FALSE, __ATOMIC_RELEASE);
+
+    for (buffer = traceBuffers; buffer != NULL; buffer = next)
+    {
+        next = buffer -> next;
+        (void) free_ptr(buffer);
+    }
+
+    traceBuffers = threadBuffer = NULL;
+    buffersAmount = 0;
+}
+
+/*
+ * Takes a buffer for the calling thread: a buffer that no thread owns, or a new one.
+ *
+ * @return  The taken buffer.
+ */
+TraceBuffer *takeTraceBuffer(void)
+{
+    TraceBuffer *buffer;
+
+    /* Look for a buffer of a thread that ended. */
+    for (buffer = __atomic_load_n(&traceBuffers, __ATOMIC_ACQUIRE); buffer != NULL;
+         buffer = buffer -> next)
+        if (__atomic_exchange_n(&buffer -> isOwned, TRUE, __ATOMIC_ACQ_REL) == FALSE)
+            return buffer;
+
+    buffer = (TraceBuffer *) allocate_space(sizeof(TraceBuffer));
+    buffer -> recordedAmount = 0;
+    buffer -> isOwned = TRUE;
+    buffer -> threadId = __atomic_add_fetch(&buffersAmount, 1, __ATOMIC_RELAXED) - 1 +
+                         FIRST_THREAD_ID;
+
+    /* Add the buffer to the start of the list. */
+    buffer -> next = __atomic_load_n(&traceBuffers, __ATOMIC_RELAXED);
+    while (__atomic_compare_exchange_n(&traceBuffers, &buffer -> next, buffer, FALSE,
+                                       __ATOMIC_RELEASE, __ATOMIC_RELAXED) == FALSE)
+        ;
+
+    return buffer;
+}
+
+/*
+ * Writes a string as a JSON string (with quotes, and escaped characters).
+ *
+ * @param   *traceFile  The file to write to.
+ * @param   *str        The string to write.
+ */
+void writeJsonString(FILE *traceFile, const char *str)
+{
+    fputc('"', traceFile);
+
+    for (; *str != '\0'; str++)
+    {
+        if (*str == '"' || *str == '\\')
+            fprintf(traceFile, "\\%c", *str);
+        else if ((unsigned char) *str < FIRST_CONTROL_CHAR)
+            fprintf(traceFile, "\\u%04x", (unsigned char) *str);
+        else
+            fputc(*str, traceFile);
+    }
+
+    fputc('"', traceFile);
+}
@@ -0,0 +1,67 @@
+/*
+ * @author Ofir Paz
+ * @version (19/10/2026)
+ *
+ * Header file for the traceUtil.c file.
+ */
+
+#ifndef MMN_14_TRACEUTIL_H
+#define MMN_14_TRACEUTIL_H
+
+/* A span of the trace - a named part of the work on a file, begun and ended on the same thread. */
+typedef struct
+{
+    const char *name; /* The name of the span, NULL if the tracing was stopped when it began. */
+    const char *file; /* The name of the file of the span (can be NULL), copied when it ends. */
+    double start; /* The time the span began at. */
+} trace_span_t;
+
+/* ---------------Prototypes--------------- */
+
+/*
+ * Starts recording the spans of all the threads.
+ */
+void startTracing(void);
+
+/*
+ * Begins a span on the calling thread (does nothing if the tracing was not started).
+ * The name is kept as it is, so it should be kept until the trace is stopped (a literal).
+ *
+ * @param   *span   Will hold the begun span.
+ * @param   *name   The name of the span.
+ * @param   *file   The name of the file of the span (can be NULL).
+ */
+void beginTraceSpan(trace_span_t *span, const char *name, const char *file);
+
+/*
+ * Ends a span, and records it in the buffer of the calling thread.
+ * Only the last spans of every thread are kept, the oldest spans are overwritten.
+ *
+ * @param   *span   The span to end, begun on the calling thread.
+ */
+void endTraceSpan(const trace_span_t *span);
+
+/*
+ * Gives the buffer of the calling thread to the next thread that records a span.
+ * Should be called before a thread that recorded spans returns.
+ */
+void endTraceThread(void);
+
+/*
+ * Writes the recorded spans as Chrome trace events (JSON), to be viewed on a timeline
+ * (chrome://tracing or Perfetto).
+ * Should be called when the threads that recorded spans are done.
+ *
+ * @param   *traceFile  The file to write to.
+ */
+void writeTrace(FILE *traceFile);
+
+/*
+ * Stops the tracing and deletes the recorded spans.
+ * Should be called when the threads that recorded spans are done.
+ */
+void stopTracing(void);
+
+/* ---------------------------------------- */
+
+#endif /* MMN_14_TRACEUTIL_H */